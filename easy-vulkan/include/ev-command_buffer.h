@@ -31,7 +31,7 @@ public:
 
     explicit CommandBuffer(shared_ptr<Device> _device, VkCommandPool command_pool, VkCommandBufferLevel level = VK_COMMAND_BUFFER_LEVEL_PRIMARY);
 
-    explicit CommandBuffer(shared_ptr<Device> _device, VkCommandPool command_pool, VkCommandBuffer command_buffer); 
+    explicit CommandBuffer(shared_ptr<Device> _device, VkCommandPool command_pool, VkCommandBuffer command_buffer, VkCommandBufferLevel level = VK_COMMAND_BUFFER_LEVEL_PRIMARY); 
 
     CommandBuffer& operator=(const CommandBuffer&) = delete;
 
@@ -75,6 +75,11 @@ public:
         const vector<VkImageBlit> regions,
         VkFilter filter = VK_FILTER_LINEAR);
 
+    /**
+     * @brief buffer 의 [offset, offset + size) 를 4 바이트 값 data 로 채웁니다. (render pass 밖에서만 사용)
+     */
+    void fill_buffer(shared_ptr<Buffer> buffer, VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE, uint32_t data = 0);
+
     void copy_buffer(shared_ptr<Buffer> dst_buffer, shared_ptr<Buffer> src_buffer, VkDeviceSize size = VK_WHOLE_SIZE, VkDeviceSize dst_offset = 0, VkDeviceSize src_offset = 0);
     
     void copy_buffer_to_image(shared_ptr<Image> dst_image, 
@@ -108,6 +113,31 @@ public:
         int32_t vertex_offset = 0, 
         uint32_t first_instance = 0);
 
+    /**
+     * @brief buffer 의 offset 위치부터 VkDrawIndexedIndirectCommand 를 draw_count 개 읽어 그립니다.
+     * @details draw_count 가 1 보다 크면 multiDrawIndirect 기능이 필요합니다.
+     */
+    void draw_indexed_indirect(shared_ptr<Buffer> buffer,
+        VkDeviceSize offset = 0,
+        uint32_t draw_count = 1,
+        uint32_t stride = sizeof(VkDrawIndexedIndirectCommand));
+
+    /**
+     * @brief count_buffer 의 count_offset 위치에 기록된 개수(최대 max_draw_count)만큼 VkDrawIndexedIndirectCommand 를 읽어 그립니다.
+     * @details Device 에서 drawIndirectCount 기능(Vulkan 1.2) 또는 VK_KHR_draw_indirect_count 가 활성화되어 있어야 합니다.
+     */
+    void draw_indexed_indirect_count(shared_ptr<Buffer> buffer,
+        VkDeviceSize offset,
+        shared_ptr<Buffer> count_buffer,
+        VkDeviceSize count_offset,
+        uint32_t max_draw_count,
+        uint32_t stride = sizeof(VkDrawIndexedIndirectCommand));
+
+    /**
+     * @brief task shader(없으면 mesh shader) 워크그룹을 실행합니다. Device 에서 VK_EXT_mesh_shader 가 활성화되어 있어야 합니다.
+     */
+    void draw_mesh_tasks(uint32_t group_count_x, uint32_t group_count_y = 1, uint32_t group_count_z = 1);
+
     void set_viewport(
         float offset_x,
         float offset_y,
@@ -153,6 +183,24 @@ public:
 
     VkResult begin(VkCommandBufferUsageFlags flags = 0);
 
+    /**
+     * @brief secondary 커맨드 버퍼 기록을 시작합니다.
+     * @details render_pass 가 있으면 RENDER_PASS_CONTINUE 로 시작해 해당 subpass 를 상속하므로, 
+     * VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS 로 시작한 subpass 안에서 execute_commands 로 실행해야 합니다.
+     * viewport, scissor 같은 동적 상태는 primary 에서 상속되지 않으므로 secondary 에서 다시 설정해야 합니다.
+     * @param framebuffer 실행할 프레임버퍼를 알면 전달 (드라이버 최적화용). 모르면 nullptr
+     */
+    VkResult begin_secondary(shared_ptr<RenderPass> render_pass,
+        uint32_t subpass = 0,
+        shared_ptr<Framebuffer> framebuffer = nullptr,
+        VkCommandBufferUsageFlags flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+    );
+
+    /**
+     * @brief 기록을 마친 secondary 커맨드 버퍼들을 순서대로 실행합니다.
+     */
+    void execute_commands(const vector<shared_ptr<CommandBuffer>>& command_buffers);
+
     VkResult end();
 
     VkResult reset(VkCommandBufferResetFlags flags = 0);
@@ -160,6 +208,10 @@ public:
 #if defined(VK_VERSION_1_4) 
 #endif
 
+    VkCommandBufferLevel get_level() const {
+        return level;
+    }
+
     operator VkCommandBuffer() const {
         return command_buffer;
     }
@@ -30,6 +30,13 @@ public:
 
     vector<shared_ptr<CommandBuffer>> allocate(size_t nr_commands, VkCommandBufferLevel level);
 
+    /**
+     * @brief 풀에서 할당한 모든 커맨드 버퍼를 initial 상태로 되돌립니다. 커맨드 버퍼들은 해제되지 않고 다시 기록할 수 있습니다.
+     * @details GPU 가 이 풀의 커맨드 버퍼를 모두 실행한 뒤에 호출해야 합니다. 프레임마다 풀을 두면 버퍼별 reset 없이 한 번에 재사용할 수 있습니다.
+     * 풀이 생성되지 않았거나 이미 파괴된 경우 VK_ERROR_INITIALIZATION_FAILED 를 반환합니다.
+     */
+    VkResult reset(VkCommandPoolResetFlags flags = 0);
+
     void destroy();
 
     CommandPool& operator=(const CommandPool&) = delete;
@@ -32,6 +32,9 @@ private:
 
     vector<VkDescriptorSetLayoutBinding> bindings;
 
+    /** bindings 와 같은 순서의 VkDescriptorBindingFlags. 하나라도 0 이 아니면 create_layout 에서 연결 */
+    vector<VkDescriptorBindingFlags> binding_flags;
+
     VkDescriptorSetLayoutCreateFlags flags = 0;
 
 public:
@@ -44,6 +47,13 @@ public:
 
     void add_binding(VkShaderStageFlags flags, VkDescriptorType type, uint32_t binding, uint32_t count=1);
 
+    /**
+     * @brief 추가한 binding 에 descriptor indexing 플래그를 지정합니다. (PARTIALLY_BOUND, UPDATE_AFTER_BIND 등)
+     * @details UPDATE_AFTER_BIND 를 사용하면 레이아웃 플래그에 VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT 가,
+     * 풀에는 VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT 가 필요합니다.
+     */
+    void set_binding_flags(uint32_t binding, VkDescriptorBindingFlags binding_flags);
+
     VkResult create_layout();
 
     void destroy();
@@ -78,6 +88,7 @@ private:
         uint32_t binding;
         VkDescriptorType type;
         uint32_t resource_index;
+        uint32_t array_element = 0;
     };
 
     shared_ptr<Device> device;
@@ -119,6 +130,15 @@ public:
         VkImageLayout layout
     );
 
+    /**
+     * @brief 배열 binding 의 array_element 번째 원소에 텍스처를 기록합니다.
+     */
+    void write_texture_element(uint32_t binding,
+        uint32_t array_element,
+        shared_ptr<Texture> texture,
+        VkDescriptorType type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER
+    );
+
     const size_t registry_size() const {
         return write_registry.size();
     }
@@ -28,6 +28,17 @@ class Device {
 
     bool use_swapchain = true;
 
+    /** VK_EXT_mesh_shader 를 요청했고 task/mesh shader 기능이 지원되면 true */
+    bool mesh_shader_enabled = false;
+
+    PFN_vkCmdDrawMeshTasksEXT cmd_draw_mesh_tasks = nullptr;
+
+    /** Vulkan 1.2 drawIndirectCount 기능 또는 VK_KHR_draw_indirect_count 로 얻은 함수 포인터. 지원하지 않으면 nullptr */
+    PFN_vkCmdDrawIndexedIndirectCount cmd_draw_indexed_indirect_count = nullptr;
+
+    /** Vulkan 1.2 또는 VK_EXT_descriptor_indexing 의 bindless 텍스처 배열 기능(runtime array, partially bound, update after bind)이 켜졌으면 true */
+    bool descriptor_indexing_enabled = false;
+
     struct QueueFamilyIndices {
 
         uint32_t graphics = UINT32_MAX;
@@ -109,6 +120,32 @@ class Device {
     const bool is_swapchain_enabled() const {
         return use_swapchain;
     }
+
+    const bool is_mesh_shader_enabled() const {
+        return mesh_shader_enabled;
+    }
+
+    /**
+     * @brief vkCmdDrawMeshTasksEXT 함수 포인터. mesh shader 가 활성화되지 않았으면 nullptr
+     */
+    PFN_vkCmdDrawMeshTasksEXT get_cmd_draw_mesh_tasks() const {
+        return cmd_draw_mesh_tasks;
+    }
+
+    const bool is_draw_indirect_count_enabled() const {
+        return cmd_draw_indexed_indirect_count != nullptr;
+    }
+
+    const bool is_descriptor_indexing_enabled() const {
+        return descriptor_indexing_enabled;
+    }
+
+    /**
+     * @brief vkCmdDrawIndexedIndirectCount 함수 포인터. 지원하지 않으면 nullptr
+     */
+    PFN_vkCmdDrawIndexedIndirectCount get_cmd_draw_indexed_indirect_count() const {
+        return cmd_draw_indexed_indirect_count;
+    }
 };
 
 }
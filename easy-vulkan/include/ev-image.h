@@ -106,6 +106,10 @@ public:
 
     VkResult unmap();
 
+    void* get_mapped_ptr() const {
+        return mapped_ptr;
+    }
+
     VkFormat get_format() {
         return this->format;
     }
@@ -9,6 +9,11 @@
 
 namespace ev {
 
+/**
+ * @brief VkMemoryBarrier 래퍼 클래스
+ * @param src_access_mask 소스 접근 마스크
+ * @param dst_access_mask 대상 접근 마스크
+ */
 class MemoryBarrier {
 private:
 
@@ -21,9 +26,9 @@ public:
         void* next = nullptr
     );
 
-    MemoryBarrier(const MemoryBarrier&) = delete;
+    MemoryBarrier(const MemoryBarrier&) = default;
 
-    MemoryBarrier& operator=(const MemoryBarrier&) = delete;
+    MemoryBarrier& operator=(const MemoryBarrier&) = default;
 
     ~MemoryBarrier() = default;
 
@@ -32,6 +37,15 @@ public:
     }
 };
 
+/**
+ * @brief VkBufferMemoryBarrier 래퍼 클래스
+ * @param buffer 버퍼 객체
+ * @param src_access_mask 소스 접근 마스크
+ * @param dst_access_mask 대상 접근 마스크
+ * @param size 배리어 범위 (기본값: VK_WHOLE_SIZE)
+ * @param src_queue_family_index 소스 큐 패밀리 인덱스 (기본값: VK_QUEUE_FAMILY_IGNORED)
+ * @param dst_queue_family_index 대상 큐 패밀리 인덱스 (기본값: VK_QUEUE_FAMILY_IGNORED)
+ */
 class BufferMemoryBarrier {
 
 private:
@@ -49,9 +63,9 @@ public:
         void* next = nullptr
     );
 
-    BufferMemoryBarrier(const BufferMemoryBarrier&) = delete;
+    BufferMemoryBarrier(const BufferMemoryBarrier&) = default;
  
-    BufferMemoryBarrier& operator=(const BufferMemoryBarrier&) = delete;
+    BufferMemoryBarrier& operator=(const BufferMemoryBarrier&) = default;
  
    ~BufferMemoryBarrier() = default;
 
@@ -143,6 +157,12 @@ public :
 
     VkResult wait(uint64_t timeout = UINT64_MAX);
 
+    /**
+     * @brief 기다리지 않고 fence 상태를 확인합니다.
+     * @return 신호 상태면 VK_SUCCESS, 아니면 VK_NOT_READY
+     */
+    VkResult get_status() const;
+
     VkResult reset();
 
     void destroy();
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief glTF accessor 를 성분 타입, normalized, byteStride 에 맞게 읽는 함수들
+ * @details KHR_mesh_quantization 처럼 byte/short 성분이나 interleave 된 bufferView 를 사용하는 데이터도 같은 방식으로 읽습니다.
+ * normalized 정수는 glTF 규칙(snorm: max(v / (2^(n-1) - 1), -1), unorm: v / (2^n - 1))으로 float 로 변환합니다.
+ */
+
+namespace ev::tools::accessor {
+
+/**
+ * @brief glTF componentType 값
+ */
+enum class ComponentType : uint32_t {
+    Byte = 5120,
+    UnsignedByte = 5121,
+    Short = 5122,
+    UnsignedShort = 5123,
+    UnsignedInt = 5125,
+    Float = 5126
+};
+
+/**
+ * @return 성분 하나의 바이트 수. 지원하지 않는 타입이면 0
+ */
+uint32_t component_size(ComponentType type);
+
+/**
+ * @brief 버퍼 안의 strided 요소 배열
+ */
+struct View {
+    const uint8_t* data = nullptr;
+    size_t count = 0;
+    /** 요소 시작 간격 (bytes). 0 이면 요소 크기만큼 촘촘하게 배치 */
+    uint32_t stride = 0;
+    ComponentType component_type = ComponentType::Float;
+    /** 요소당 성분 수 (SCALAR 1 ~ VEC4 4, MAT4 16) */
+    uint32_t components = 1;
+    bool normalized = false;
+
+    uint32_t get_element_size() const {
+        return component_size(component_type) * components;
+    }
+
+    uint32_t get_stride() const {
+        return stride ? stride : get_element_size();
+    }
+
+    const uint8_t* element(size_t index) const {
+        return data + index * get_stride();
+    }
+
+    /**
+     * @brief 성분 타입이 올바르고 모든 요소가 buffer_size 바이트 버퍼 안에 있는지 확인합니다.
+     * @param offset data 의 버퍼 내 위치
+     */
+    bool is_valid(size_t offset, size_t buffer_size) const;
+};
+
+/**
+ * @brief 정수 성분 값 하나를 float 로 변환합니다. accessor min/max 처럼 성분 타입 단위로 기록된 값에도 사용합니다.
+ */
+float dequantize(double value, ComponentType type, bool normalized);
+
+/**
+ * @brief 요소 index 의 component 번째 성분을 float 로 읽습니다.
+ */
+float read_float(const View& view, size_t index, uint32_t component);
+
+/**
+ * @brief 요소 index 의 component 번째 성분을 정수로 읽습니다. (인덱스, 관절 번호)
+ */
+uint32_t read_uint(const View& view, size_t index, uint32_t component);
+
+/**
+ * @brief 모든 요소를 float 로 변환해 기록합니다.
+ * @param dst 첫 요소의 출력 위치
+ * @param dst_stride 출력 요소 간격 (bytes). Vertex 배열의 속성 하나에 쓰려면 sizeof(Vertex)
+ * @param dst_components 출력 성분 수. view.components 보다 많은 성분은 defaults 로 채웁니다.
+ * @param defaults dst_components 개의 기본값. nullptr 이면 0
+ */
+void read_floats(const View& view, float* dst, size_t dst_stride, uint32_t dst_components, const float* defaults = nullptr);
+
+/**
+ * @brief 변환 없이 요소 바이트를 그대로 복사합니다. 출력 포맷이 accessor 와 같을 때의 빠른 경로입니다.
+ * @param dst_stride 출력 요소 간격 (bytes). 양쪽이 모두 촘촘하면 한 번에 복사합니다.
+ */
+void copy_elements(const View& view, uint8_t* dst, size_t dst_stride);
+
+}
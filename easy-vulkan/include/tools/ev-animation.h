@@ -0,0 +1,222 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "tools/ev-transform_hierarchy.h"
+
+namespace ev::tools {
+
+/**
+ * @brief 키프레임 애니메이션 클립
+ * @details 트랙마다 시간과 값을 연속 배열에 보관하며 값은 float4 (vec3 는 w 무시, 쿼터니언은 x, y, z, w) 입니다.
+ * CUBICSPLINE 트랙은 glTF 와 같이 키마다 (in-tangent, value, out-tangent) 3 개의 값을 가집니다.
+ * 클립은 생성 후 변경하지 않으므로 여러 AnimationMixer 가 공유할 수 있습니다.
+ */
+class AnimationClip {
+
+public:
+
+    enum Interpolation : uint32_t {
+        LINEAR,
+        STEP,
+        CUBICSPLINE
+    };
+
+    enum Path : uint32_t {
+        TRANSLATION,
+        ROTATION,
+        SCALE
+    };
+
+    struct Track {
+        uint32_t node;          // TransformHierarchy 노드 인덱스
+        Path path;
+        Interpolation interpolation;
+        uint32_t first_key;     // times 시작 위치
+        uint32_t key_count;
+        uint32_t first_value;   // values 시작 위치 (float4 단위)
+    };
+
+private:
+
+    std::string name;
+
+    std::vector<Track> tracks;
+
+    std::vector<float> times;
+
+    std::vector<float> values;
+
+    float start_time = 0.0f;
+
+    float end_time = 0.0f;
+
+public:
+
+    explicit AnimationClip(const std::string& name = "") : name(name) {}
+
+    /**
+     * @param times 오름차순 키 시간 key_count 개
+     * @param values float4 값. LINEAR/STEP 은 key_count 개, CUBICSPLINE 은 key_count * 3 개
+     */
+    void add_track(uint32_t node, Path path, Interpolation interpolation,
+        const float* times, uint32_t key_count, const float* values);
+
+    const std::string& get_name() const {
+        return name;
+    }
+
+    const std::vector<Track>& get_tracks() const {
+        return tracks;
+    }
+
+    const float* get_times(const Track& track) const {
+        return times.data() + track.first_key;
+    }
+
+    const float* get_values(const Track& track) const {
+        return values.data() + static_cast<size_t>(track.first_value) * 4;
+    }
+
+    float get_start_time() const {
+        return start_time;
+    }
+
+    float get_end_time() const {
+        return end_time;
+    }
+
+    float get_duration() const {
+        return end_time - start_time;
+    }
+};
+
+/**
+ * @brief 하나의 TransformHierarchy 에 여러 클립을 가중치로 섞어 적용합니다.
+ * @details 캐릭터(인스턴스)마다 하나씩 만듭니다. 레이어마다 트랙별 키 위치(cursor)를 기억하므로
+ * 시간이 앞으로 흐르는 일반적인 재생에서는 키 탐색이 상수 시간입니다.
+ * 같은 노드의 같은 성분에 기록하는 레이어들은 가중치 합으로 정규화해 섞으며, 클립이 기록하지 않는 성분은 그대로 둡니다.
+ */
+class AnimationMixer {
+
+public:
+
+    struct Layer {
+        std::shared_ptr<const AnimationClip> clip;
+        float time = 0.0f;      // 클립 시간 (start_time 기준 아님, 클립의 키 시간과 같은 단위)
+        float weight = 1.0f;
+        float speed = 1.0f;
+        bool loop = true;
+        std::vector<uint32_t> cursors;  // 트랙별 마지막 키 인덱스
+    };
+
+private:
+
+    std::shared_ptr<TransformHierarchy> target;
+
+    std::vector<Layer> layers;
+
+    /** 노드별 가중 합. 이번 apply 에서 기록된 노드만 사용 후 초기화 */
+    std::vector<float> accum_translations[3];
+
+    std::vector<float> accum_rotations[4];
+
+    std::vector<float> accum_scales[3];
+
+    std::vector<float> translation_weights;
+
+    std::vector<float> rotation_weights;
+
+    std::vector<float> scale_weights;
+
+    std::vector<uint32_t> touched_nodes;
+
+    std::vector<uint8_t> touched;
+
+    /** LINEAR 회전 트랙을 모아 한 번에 보간하기 위한 SoA 배열 (q0, q1, t, node) */
+    std::vector<float> batch_from[4];
+
+    std::vector<float> batch_to[4];
+
+    std::vector<float> batch_t;
+
+    std::vector<uint32_t> batch_nodes;
+
+    void touch(uint32_t node);
+
+    void accumulate(uint32_t node, AnimationClip::Path path, const float value[4], float weight);
+
+    void sample_layer(Layer& layer);
+
+public:
+
+    explicit AnimationMixer(std::shared_ptr<TransformHierarchy> target);
+
+    /**
+     * @return 레이어 인덱스
+     */
+    uint32_t add_layer(std::shared_ptr<const AnimationClip> clip, float weight = 1.0f, bool loop = true);
+
+    void clear_layers() {
+        layers.clear();
+    }
+
+    Layer& get_layer(uint32_t index) {
+        return layers[index];
+    }
+
+    size_t get_layer_count() const {
+        return layers.size();
+    }
+
+    const std::shared_ptr<TransformHierarchy>& get_target() const {
+        return target;
+    }
+
+    /**
+     * @brief 레이어 시간을 speed 만큼 진행합니다. loop 가 아니면 클립 구간에서 멈춥니다.
+     */
+    void advance(float delta_time);
+
+    /**
+     * @brief 가중치가 0 보다 큰 레이어를 샘플링해 섞은 결과를 target 의 TRS 배열에 기록하고 dirty 로 표시합니다.
+     * @details 월드 행렬 갱신은 target->update 로 따로 수행합니다.
+     */
+    void apply();
+};
+
+/**
+ * @brief 여러 mixer 를 진행, 적용하고 각 target 의 월드 행렬까지 갱신합니다.
+ * @details mixer 단위로 여러 스레드에 나누며 각 hierarchy 갱신은 해당 스레드에서 수행합니다.
+ * 여러 mixer 가 같은 target 을 공유하면 안 됩니다.
+ */
+void update_animations(const std::vector<std::shared_ptr<AnimationMixer>>& mixers, float delta_time, bool parallel = true);
+
+namespace animation {
+
+/**
+ * @brief 현재 빌드에서 사용되는 SIMD 구현 이름 ("sse2", "neon", "scalar")
+ */
+const char* simd_backend();
+
+/**
+ * @brief count 개의 쿼터니언 쌍을 구면 보간에 가깝게 보간합니다. (SoA, 결과는 dst 에 정규화되어 기록)
+ * @details 짧은 경로를 따르도록 부호를 맞춘 뒤 보정된 nlerp 를 사용하므로 slerp 와의 각도 오차는 1e-3 rad 이하입니다.
+ * dst 는 from 과 같아도 됩니다.
+ */
+void interpolate_quaternions(float* const dst[4], const float* const from[4], const float* const to[4],
+    const float* t, size_t count);
+
+namespace scalar {
+
+void interpolate_quaternions(float* const dst[4], const float* const from[4], const float* const to[4],
+    const float* t, size_t count);
+
+}
+
+}
+
+}
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "ev-device.h"
+#include "ev-buffer.h"
+#include "ev-texture.h"
+#include "ev-pipeline.h"
+#include "ev-descriptor_set.h"
+#include "ev-command_buffer.h"
+#include "ev-memory_allocator.h"
+#include "ev-logger.h"
+#include "tools/ev-gltf.h"
+
+namespace ev::tools::gltf {
+
+/**
+ * @brief 모든 머티리얼 텍스처를 하나의 partially bound 텍스처 배열에, 머티리얼 파라미터를 하나의 storage buffer 에 모은 bindless 머티리얼 셋
+ * @details 디스크립터 셋은 한 프레임에 한 번 bind 로 바인딩하고, 각 draw 는 RenderFlag::BINDLESS 로 머티리얼 번호만 push constant 로 전달합니다.
+ * 텍스처 배열은 UPDATE_AFTER_BIND 로 만들기 때문에 새 모델을 등록해도 이미 기록된 커맨드 버퍼를 다시 만들 필요가 없습니다.
+ * 텍스처와 머티리얼 번호는 참조 수를 세며 remove_model 로 참조가 사라진 번호는 그 프레임이 끝났다고 retire_frames 로 알린 뒤에 재사용합니다.
+ * 모든 함수는 여러 스레드에서 호출할 수 있습니다.
+ * Vulkan 1.2 또는 VK_EXT_descriptor_indexing 의 descriptor indexing 기능(Device::is_descriptor_indexing_enabled)이 필요합니다.
+ * 셰이더 레이아웃:
+ * - binding 0: sampler2D textures[] (nonuniformEXT 로 인덱싱)
+ * - binding 1: readonly buffer Materials { MaterialData materials[]; }
+ */
+class BindlessMaterials {
+
+public:
+
+    static constexpr uint32_t NO_TEXTURE = 0xFFFFFFFFu;
+
+    static constexpr uint32_t TEXTURE_BINDING = 0;
+
+    static constexpr uint32_t MATERIAL_BINDING = 1;
+
+    /** 셰이더의 MaterialData 와 같은 std430 레이아웃. 텍스처 번호가 NO_TEXTURE 면 factor 만 사용 */
+    struct MaterialData {
+        glm::vec4 base_color_factor;
+        float metallic_factor;
+        float roughness_factor;
+        float alpha_cutoff;
+        uint32_t alpha_mode;            // Material::AlphaMode
+        uint32_t base_color_texture;
+        uint32_t metallic_roughness_texture;
+        uint32_t normal_texture;
+        uint32_t occlusion_texture;
+        uint32_t emissive_texture;
+        uint32_t double_sided;
+        uint32_t padding[2];
+    };
+
+private:
+
+    /** 텍스처 참조는 그 텍스처를 쓰는 머티리얼 수. 머티리얼이 해제될 때 함께 줄어듭니다. */
+    struct TextureSlot {
+        std::shared_ptr<ev::Texture> texture;
+        uint32_t references = 0;
+    };
+
+    struct MaterialSlot {
+        std::shared_ptr<Material> material;
+        uint32_t references = 0;
+        /** 참조가 0 이 된 프레임. retire_frames 가 이 프레임까지 끝났다고 알리면 번호를 재사용 */
+        uint64_t released_frame = 0;
+    };
+
+    struct PendingRelease {
+        uint64_t frame;
+        uint32_t index;
+    };
+
+    std::shared_ptr<ev::Device> device;
+
+    std::shared_ptr<ev::MemoryAllocator> memory_allocator;
+
+    std::shared_ptr<ev::DescriptorSetLayout> descriptor_set_layout = nullptr;
+
+    std::shared_ptr<ev::DescriptorPool> descriptor_pool = nullptr;
+
+    std::shared_ptr<ev::DescriptorSet> descriptor_set = nullptr;
+
+    /** host visible, 생성 시 max_materials 개로 고정 */
+    std::shared_ptr<ev::Buffer> material_buffer = nullptr;
+
+    uint32_t max_textures;
+
+    uint32_t max_materials;
+
+    mutable std::mutex mutex;
+
+    std::vector<TextureSlot> textures;
+
+    std::unordered_map<const ev::Texture*, uint32_t> texture_indices;
+
+    std::vector<MaterialSlot> materials;
+
+    std::unordered_map<const Material*, uint32_t> material_indices;
+
+    /** 재사용할 수 있는 번호 */
+    std::vector<uint32_t> free_textures;
+
+    std::vector<uint32_t> free_materials;
+
+    /** 참조가 사라졌지만 GPU 가 아직 읽을 수 있는 머티리얼 번호 (프레임 순서) */
+    std::deque<PendingRelease> pending_materials;
+
+    /** 디스크립터 셋 / 머티리얼 버퍼에 아직 반영하지 않은 번호 */
+    std::vector<uint32_t> dirty_textures;
+
+    std::vector<uint32_t> dirty_materials;
+
+    uint64_t current_frame = 0;
+
+    uint32_t get_texture_index(const std::shared_ptr<ev::Texture>& texture) const;
+
+    uint32_t register_texture_locked(const std::shared_ptr<ev::Texture>& texture);
+
+    uint32_t register_material_locked(const std::shared_ptr<Material>& material);
+
+    /**
+     * @brief 텍스처 참조를 줄이고 0 이 되면 번호를 바로 비웁니다. 텍스처를 쓰던 머티리얼 번호가 이미 해제된 뒤에만 호출합니다.
+     */
+    void release_texture(const std::shared_ptr<ev::Texture>& texture);
+
+    void release_material(const std::shared_ptr<Material>& material);
+
+    /**
+     * @brief 머티리얼 번호를 비우고 그 텍스처 참조를 반환합니다. 이미 끝난 프레임에서만 호출합니다.
+     */
+    void free_material(uint32_t index);
+
+    VkResult update_locked();
+
+public:
+
+    /**
+     * @param max_textures 텍스처 배열 크기. maxDescriptorSetUpdateAfterBindSampledImages 이하여야 합니다.
+     * @param max_materials 머티리얼 버퍼에 담을 수 있는 머티리얼 수
+     */
+    explicit BindlessMaterials(std::shared_ptr<ev::Device> device,
+        std::shared_ptr<ev::MemoryAllocator> memory_allocator,
+        uint32_t max_textures = 4096,
+        uint32_t max_materials = 4096
+    );
+
+    BindlessMaterials(const BindlessMaterials&) = delete;
+
+    BindlessMaterials& operator=(const BindlessMaterials&) = delete;
+
+    /**
+     * @brief 텍스처를 배열에 등록하고 참조 수를 늘립니다. 이미 등록된 텍스처는 기존 번호를 반환합니다.
+     * @return 배열 번호. 배열이 가득 찼으면 NO_TEXTURE
+     */
+    uint32_t register_texture(const std::shared_ptr<ev::Texture>& texture);
+
+    /**
+     * @brief 머티리얼과 그 텍스처를 등록하고 Material::set_material_index 로 번호를 기록합니다. 이미 등록된 머티리얼은 참조 수만 늘립니다.
+     * @return 머티리얼 번호. 버퍼가 가득 찼으면 0 번(기본 머티리얼)을 사용합니다.
+     */
+    uint32_t register_material(const std::shared_ptr<Material>& material);
+
+    /**
+     * @brief 모델의 모든 머티리얼을 등록하고 update 합니다.
+     */
+    void add_model(const std::shared_ptr<Model>& model);
+
+    /**
+     * @brief add_model 로 늘린 모델 머티리얼의 참조를 줄입니다. 모델의 머티리얼 번호는 0 번(기본 머티리얼)이 됩니다.
+     * @details 참조가 사라진 머티리얼과 텍스처는 현재 프레임(set_current_frame)이 끝났다고 retire_frames 로 알린 뒤에 해제되고 번호가 재사용됩니다.
+     * GLTFModelManager 는 ModelAssetCache 가 모델을 버릴 때 호출합니다.
+     */
+    void remove_model(const std::shared_ptr<Model>& model);
+
+    /**
+     * @brief 이후 remove_model 로 해제하는 번호가 기다릴 프레임 번호. 프레임마다 증가하는 값을 전달합니다.
+     */
+    void set_current_frame(uint64_t frame);
+
+    /**
+     * @brief completed_frame 이하 프레임의 제출이 모두 끝났음을 알립니다. 그 프레임까지 해제한 번호를 재사용할 수 있게 됩니다.
+     */
+    void retire_frames(uint64_t completed_frame);
+
+    /**
+     * @brief 새로 등록하거나 재사용한 번호의 텍스처를 디스크립터 셋에, 머티리얼을 버퍼에 기록합니다.
+     * @details 실행 중인 커맨드 버퍼가 읽는 번호는 다시 쓰지 않으므로 해당 셋을 사용하는 커맨드 버퍼가 실행 중이어도 호출할 수 있습니다.
+     */
+    VkResult update();
+
+    /**
+     * @brief 텍스처 배열과 머티리얼 버퍼 셋을 set_index 에 바인딩합니다. 이후 draw 사이에는 다시 바인딩할 필요가 없습니다.
+     */
+    void bind(std::shared_ptr<ev::CommandBuffer> command_buffer,
+        std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+        uint32_t set_index,
+        VkPipelineBindPoint bind_point = VK_PIPELINE_BIND_POINT_GRAPHICS
+    );
+
+    /**
+     * @brief 파이프라인 레이아웃 생성 시 사용할 디스크립터 셋 레이아웃
+     */
+    const std::shared_ptr<ev::DescriptorSetLayout>& get_descriptor_set_layout() const {
+        return descriptor_set_layout;
+    }
+
+    const std::shared_ptr<ev::DescriptorSet>& get_descriptor_set() const {
+        return descriptor_set;
+    }
+
+    /**
+     * @brief 사용 중이거나 해제를 기다리는 텍스처 번호 수
+     */
+    uint32_t get_texture_count() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return static_cast<uint32_t>(textures.size() - free_textures.size());
+    }
+
+    /**
+     * @brief 사용 중이거나 해제를 기다리는 머티리얼 번호 수 (기본 머티리얼 포함)
+     */
+    uint32_t get_material_count() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return static_cast<uint32_t>(materials.size() - free_materials.size());
+    }
+
+    void destroy();
+
+    ~BindlessMaterials();
+};
+
+}
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "ev-command_buffer.h"
+#include "ev-descriptor_set.h"
+#include "ev-pipeline.h"
+#include "ev-logger.h"
+#include "tools/ev-gltf.h"
+#include "tools/ev-frustum_culling.h"
+
+namespace ev::tools::gltf {
+
+/**
+ * @brief 모델 노드 트리를 미리 평탄화해 상태 키로 정렬한 draw 목록
+ * @details 모델을 추가할 때 머티리얼 alpha mode 필터링과 인덱스 구간 계산을 끝내 두고,
+ * record 는 정렬된 배열을 한 번 순회하면서 값이 바뀐 파이프라인, 정점/인덱스 버퍼, 디스크립터 셋만 바인딩합니다.
+ * 모델이나 노드 구성이 바뀌었을 때만 invalidate 후 다시 구축하며, 노드 변환은 메시 uniform 버퍼를 통해 반영되므로 재구축이 필요 없습니다.
+ * LOD 선택은 시점마다 달라지므로 Model::draw 에 남겨 두고 여기서는 LOD 0 을 그립니다.
+ * 정렬 키는 파이프라인 > 모델(정점/인덱스 버퍼) > 머티리얼 > 메시 순서이므로 ALPHA_BLEND 목록은 깊이 순서를 보장하지 않습니다.
+ * GeometryHeap 에 올라간 모델들은 하나의 버퍼 그룹으로 정렬되어 모델이 달라도 버퍼를 다시 바인딩하지 않습니다.
+ * cull 을 호출하면 이후 record 는 FrustumCuller 가 남긴 항목만 정렬 순서대로 그립니다.
+ * RenderFlag::BINDLESS 로 추가한 모델은 머티리얼 셋 대신 값이 바뀔 때만 머티리얼 번호를 push 합니다.
+ * 구간 record 를 ParallelRecorder 와 함께 쓰면 정렬 순서를 유지한 채 여러 secondary 커맨드 버퍼에 나누어 기록할 수 있습니다.
+ */
+class DrawList {
+
+public:
+
+    /** instance_set_index 로 전달하면 메시 uniform 디스크립터 셋을 바인딩하지 않습니다. */
+    static constexpr uint32_t NO_SET = 0xFFFFFFFFu;
+
+    struct Item {
+        uint64_t key;
+        std::shared_ptr<ev::GraphicsPipeline> pipeline;
+        std::shared_ptr<ev::DescriptorSet> material_set;   // RenderFlag::BIND_IMAGE 가 없거나 BINDLESS 면 nullptr
+        uint32_t material_index;                           // RenderFlag::BINDLESS 일 때 push 할 머티리얼 번호, 아니면 NO_SET
+        std::shared_ptr<ev::DescriptorSet> instance_set;   // 메시 uniform (노드 변환, joint_offset)
+        Model* model;                                      // 정점/인덱스 버퍼 소유자
+        Node* node;                                        // 컬링용 월드 행렬
+        glm::vec4 bounds;                                  // 프리미티브 로컬 bounding sphere (LOD 0)
+        uint32_t first_index;
+        uint32_t index_count;
+        int32_t vertex_offset;
+        uint32_t vertex_pass;
+    };
+
+    /** 마지막 record 에서 실제로 기록한 명령 수 */
+    struct Stats {
+        uint32_t draws = 0;
+        uint32_t pipeline_binds = 0;
+        uint32_t buffer_binds = 0;
+        uint32_t material_binds = 0;
+        uint32_t instance_binds = 0;
+    };
+
+private:
+
+    struct Source {
+        std::shared_ptr<Model> model;
+        std::shared_ptr<ev::GraphicsPipeline> pipeline;
+        uint32_t render_flags;
+        uint32_t vertex_pass;
+    };
+
+    std::vector<Source> sources;
+
+    std::vector<Item> items;
+
+    /** 정렬 키에 넣을 작은 번호. 처음 등장한 순서로 부여 */
+    std::unordered_map<const void*, uint32_t> pipeline_ids;
+
+    std::unordered_map<const void*, uint32_t> material_ids;
+
+    std::unordered_map<const void*, uint32_t> mesh_ids;
+
+    bool dirty = true;
+
+    /** items 와 같은 순서의 bounding sphere / 월드 행렬 */
+    ev::tools::FrustumCuller culler;
+
+    std::vector<uint32_t> visible_items;
+
+    bool culled = false;
+
+    Stats stats;
+
+    static uint32_t get_id(std::unordered_map<const void*, uint32_t>& ids, const void* object);
+
+    void bake_node(const Source& source, uint32_t model_id, const std::shared_ptr<Node>& node);
+
+    /**
+     * @brief 그릴 항목 중 [begin, end) 를 기록하고 명령 수를 out_stats 에 더합니다. 바인딩 상태는 구간마다 새로 시작합니다.
+     */
+    void record_range(const std::shared_ptr<ev::CommandBuffer>& command_buffer,
+        uint32_t begin,
+        uint32_t end,
+        const std::shared_ptr<ev::PipelineLayout>& pipeline_layout,
+        uint32_t material_set_index,
+        uint32_t instance_set_index,
+        Stats& out_stats
+    ) const;
+
+public:
+
+    DrawList() = default;
+
+    /**
+     * @brief model 의 모든 노드를 pipeline 으로 그리도록 추가합니다. 같은 모델을 다른 파이프라인/플래그로 여러 번 추가할 수 있습니다.
+     * @param render_flags Model::draw 와 같은 RenderFlag 조합
+     */
+    void add_model(std::shared_ptr<Model> model,
+        std::shared_ptr<ev::GraphicsPipeline> pipeline,
+        uint32_t render_flags = RenderFlag::OPAQUE | RenderFlag::BIND_IMAGE,
+        uint32_t vertex_pass = VertexPass::ALL_ATTRIBUTES
+    );
+
+    /**
+     * @brief model 을 그리는 모든 항목을 제거합니다.
+     */
+    void remove_model(const std::shared_ptr<Model>& model);
+
+    void clear();
+
+    /**
+     * @brief 모델의 노드/메시/머티리얼 구성이 바뀌었을 때 호출합니다. 다음 build 또는 record 에서 다시 구축합니다.
+     */
+    void invalidate() {
+        dirty = true;
+    }
+
+    bool is_dirty() const {
+        return dirty;
+    }
+
+    /**
+     * @brief 변경이 있을 때만 항목을 다시 만들고 정렬합니다.
+     */
+    void build();
+
+    /**
+     * @brief 노드 월드 행렬을 다시 읽어 보이는 항목을 고릅니다. 필요하면 먼저 build 합니다.
+     * @param view_projection 노드 월드 공간 -> clip 행렬 (모델 변환을 push constant 로 전달한다면 그것까지 곱한 행렬)
+     * @return 보이는 항목 수
+     */
+    size_t cull(const glm::mat4& view_projection, bool parallel = true);
+
+    /**
+     * @brief 이후 record 가 모든 항목을 그리도록 컬링 결과를 버립니다.
+     */
+    void reset_culling() {
+        culled = false;
+    }
+
+    /**
+     * @brief 정렬된 항목(cull 이후에는 보이는 항목)을 기록합니다. 필요하면 먼저 build 합니다.
+     * @param pipeline_layout 디스크립터 셋을 바인딩할 레이아웃. 추가한 파이프라인들과 호환되어야 합니다.
+     * @param material_set_index 머티리얼 디스크립터 셋 번호 (Model::draw 의 bind_image_set)
+     * @param instance_set_index 메시 uniform 디스크립터 셋 번호. NO_SET 이면 바인딩하지 않음
+     */
+    void record(std::shared_ptr<ev::CommandBuffer> command_buffer,
+        std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+        uint32_t material_set_index = 1,
+        uint32_t instance_set_index = NO_SET
+    );
+
+    /**
+     * @brief 그릴 항목 중 [begin, end) 만 기록합니다. ParallelRecorder 로 구간마다 다른 secondary 커맨드 버퍼에 기록할 때 사용합니다.
+     * @details build 하지 않으므로 먼저 get_draw_count 를 호출해야 하며, 여러 스레드에서 서로 다른 구간을 동시에 기록할 수 있습니다.
+     * 구간의 명령 수는 get_stats 에 반영되지 않습니다.
+     */
+    void record(std::shared_ptr<ev::CommandBuffer> command_buffer,
+        uint32_t begin,
+        uint32_t end,
+        std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+        uint32_t material_set_index = 1,
+        uint32_t instance_set_index = NO_SET
+    ) const;
+
+    /**
+     * @return record 가 그릴 항목 수 (cull 이후에는 보이는 항목 수). 필요하면 먼저 build 합니다.
+     */
+    uint32_t get_draw_count();
+
+    const std::vector<Item>& get_items() const {
+        return items;
+    }
+
+    const Stats& get_stats() const {
+        return stats;
+    }
+};
+
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace ev::tools {
+
+/**
+ * @brief 로컬 bounding sphere 와 월드 행렬을 SoA 배열로 보관하고 절두체 평면 6 개로 한 번에 컬링합니다.
+ * @details 행렬은 열 우선 float[16] (glm::mat4 와 같은 레이아웃) 으로 받아 마지막 행을 제외한 12 개 성분만 보관합니다.
+ * 월드 반지름은 로컬 반지름에 가장 큰 축 스케일을 곱한 보수적인 값입니다.
+ * cull 은 AVX2 는 8 개, SSE/NEON 은 4 개씩 검사하며 큰 장면은 구간을 나누어 여러 스레드에서 처리합니다.
+ */
+class FrustumCuller {
+
+private:
+
+    /** 로컬 bounding sphere */
+    std::vector<float> centers[3];
+
+    std::vector<float> radii;
+
+    /** 성분별 월드 행렬. [열 * 3 + 행], 3 번 열은 이동 */
+    std::vector<float> matrices[12];
+
+    /** 스레드 구간별 결과. 구간 순서대로 이어 붙이므로 결과는 항상 오름차순 */
+    std::vector<std::vector<uint32_t>> chunk_results;
+
+public:
+
+    FrustumCuller() = default;
+
+    /**
+     * @param matrix 월드 행렬. nullptr 이면 단위 행렬
+     * @return 객체 번호
+     */
+    uint32_t add(const float center[3], float radius, const float matrix[16] = nullptr);
+
+    void set_sphere(uint32_t index, const float center[3], float radius);
+
+    void set_matrix(uint32_t index, const float matrix[16]);
+
+    void reserve(size_t count);
+
+    void clear();
+
+    size_t size() const {
+        return radii.size();
+    }
+
+    /**
+     * @brief 보이는 객체 번호를 오름차순으로 visible 에 기록합니다.
+     * @param planes 정규화되지 않아도 되는 평면 6 개 (a, b, c, d). ax + by + cz + d >= 0 이 안쪽
+     * @return 보이는 객체 수
+     */
+    size_t cull(const float planes[24], std::vector<uint32_t>& visible, bool parallel = true);
+
+    /**
+     * @brief 월드 -> clip 행렬(열 우선)에서 월드 공간 절두체 평면을 정규화해 추출합니다. (Gribb-Hartmann, z 범위 [0, 1] 에도 보수적)
+     */
+    static void extract_planes(const float view_projection[16], float planes[24]);
+};
+
+namespace culling {
+
+/**
+ * @brief 현재 빌드에서 사용되는 SIMD 구현 이름 ("avx2", "sse2", "neon", "scalar")
+ */
+const char* simd_backend();
+
+/**
+ * @brief [begin, end) 의 sphere 를 월드로 변환해 평면과 비교하고 보이는 번호를 visible 에 기록합니다.
+ * @details planes 는 정규화되어 있어야 합니다.
+ * @return 기록한 개수. visible 은 end - begin 개를 담을 수 있어야 합니다.
+ */
+size_t cull_spheres(const float* const matrices[12], const float* const centers[3], const float* radii,
+    const float planes[24], uint32_t begin, uint32_t end, uint32_t* visible);
+
+namespace scalar {
+
+size_t cull_spheres(const float* const matrices[12], const float* const centers[3], const float* radii,
+    const float planes[24], uint32_t begin, uint32_t end, uint32_t* visible);
+
+}
+
+}
+
+}
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "ev-device.h"
+#include "ev-buffer.h"
+#include "ev-command_buffer.h"
+#include "ev-memory_allocator.h"
+#include "ev-logger.h"
+#include "tools/ev-gltf.h"
+#include "tools/ev-range_allocator.h"
+
+namespace ev::tools::gltf {
+
+class GeometryHeap;
+
+/**
+ * @brief GeometryHeap 안에서 모델 하나가 차지하는 정점/인덱스 구간
+ * @details 마지막 참조가 사라지면 구간을 힙에 반환합니다. 반환한 구간은 GeometryHeap::retire_frames 로 그 프레임이 끝났다고 알린 뒤에 재사용됩니다.
+ */
+class GeometryAllocation {
+
+private:
+
+    std::weak_ptr<GeometryHeap> heap;
+
+    uint32_t first_vertex;
+
+    uint32_t vertex_count;
+
+    uint32_t first_index;
+
+    uint32_t index_count;
+
+public:
+
+    GeometryAllocation(std::weak_ptr<GeometryHeap> heap,
+        uint32_t first_vertex,
+        uint32_t vertex_count,
+        uint32_t first_index,
+        uint32_t index_count
+    ) : heap(std::move(heap)), first_vertex(first_vertex), vertex_count(vertex_count), first_index(first_index), index_count(index_count) {}
+
+    GeometryAllocation(const GeometryAllocation&) = delete;
+
+    GeometryAllocation& operator=(const GeometryAllocation&) = delete;
+
+    ~GeometryAllocation();
+
+    uint32_t get_first_vertex() const {
+        return first_vertex;
+    }
+
+    uint32_t get_vertex_count() const {
+        return vertex_count;
+    }
+
+    uint32_t get_first_index() const {
+        return first_index;
+    }
+
+    uint32_t get_index_count() const {
+        return index_count;
+    }
+};
+
+/**
+ * @brief 모든 모델이 나누어 쓰는 device local 정점 버퍼와 인덱스 버퍼
+ * @details 정점 버퍼는 VertexLayout 의 스트림마다 vertex_capacity 개 정점 영역을 두고, 모델마다 정점/인덱스 구간을 할당합니다.
+ * GLTFModelManager::set_geometry_heap 으로 연결하면 로드한 모델의 프리미티브 first_vertex / first_index 가 힙 기준으로 바뀌므로,
+ * 힙의 모델들은 bind 한 번으로 그릴 수 있고 GPUCuller 나 DrawList 의 indirect draw 하나에 여러 모델을 담을 수 있습니다.
+ * 인덱스는 프리미티브 로컬이므로 16bit 인덱스 힙도 프리미티브 정점 수만 제한합니다.
+ * 구간은 best fit 으로 할당하며 모델이 해제되면 재사용됩니다. 버퍼 크기는 고정입니다.
+ * 해제한 구간은 해제 시점의 프레임(set_current_frame)을 기록해 두고, 그 프레임의 제출이 끝났다고 retire_frames 로 알릴 때까지
+ * 다른 모델에 주지 않으므로 실행 중인 커맨드 버퍼가 읽는 정점을 덮어쓰지 않습니다.
+ */
+class GeometryHeap : public std::enable_shared_from_this<GeometryHeap> {
+
+private:
+
+    std::shared_ptr<ev::Device> device;
+
+    VertexLayout vertex_layout;
+
+    VkIndexType index_type;
+
+    uint32_t vertex_capacity;
+
+    uint32_t index_capacity;
+
+    std::shared_ptr<ev::Buffer> vertex_buffer = nullptr;
+
+    std::shared_ptr<ev::Buffer> index_buffer = nullptr;
+
+    /** 정점 버퍼 안 스트림별 시작 오프셋 */
+    std::vector<VkDeviceSize> vertex_stream_offsets;
+
+    /** 해제했지만 GPU 가 아직 읽을 수 있는 구간 */
+    struct PendingRelease {
+        uint64_t frame;
+        uint32_t first_vertex;
+        uint32_t vertex_count;
+        uint32_t first_index;
+        uint32_t index_count;
+    };
+
+    /** 모델 로드와 해제가 여러 스레드에서 일어날 수 있으므로 할당기를 보호 */
+    mutable std::mutex mutex;
+
+    ev::tools::RangeAllocator vertices;
+
+    ev::tools::RangeAllocator indices;
+
+    /** 프레임 순서 */
+    std::deque<PendingRelease> pending_releases;
+
+    uint64_t current_frame = 0;
+
+    friend class GeometryAllocation;
+
+    void release(const GeometryAllocation& allocation);
+
+public:
+
+    /**
+     * @param vertex_layout 힙에 올릴 모델이 사용하는 정점 레이아웃
+     * @param vertex_capacity 모든 모델 정점 수의 최대 합
+     * @param index_capacity 모든 모델 인덱스 수의 최대 합
+     * @param index_type VK_INDEX_TYPE_UINT16 이면 프리미티브당 정점이 0xFFFF 개 미만인 모델만 힙에 올라갑니다.
+     */
+    explicit GeometryHeap(std::shared_ptr<ev::Device> device,
+        std::shared_ptr<ev::MemoryAllocator> memory_allocator,
+        const VertexLayout& vertex_layout,
+        uint32_t vertex_capacity,
+        uint32_t index_capacity,
+        VkIndexType index_type = VK_INDEX_TYPE_UINT32
+    );
+
+    GeometryHeap(const GeometryHeap&) = delete;
+
+    GeometryHeap& operator=(const GeometryHeap&) = delete;
+
+    /**
+     * @brief 정점 vertex_count 개와 인덱스 index_count 개 구간을 할당합니다. GeometryHeap 은 shared_ptr 로 관리되어야 합니다.
+     * @return 공간이 부족하면 nullptr
+     */
+    std::shared_ptr<GeometryAllocation> allocate(uint32_t vertex_count, uint32_t index_count);
+
+    /**
+     * @brief 모든 스트림과 인덱스 버퍼를 바인딩합니다. 힙의 모델은 Model::bind_buffers 대신 사용할 수 있습니다.
+     * @param vertex_pass 패스가 읽는 속성 마스크 (VertexPass)
+     */
+    void bind(std::shared_ptr<ev::CommandBuffer> command_buffer, uint32_t vertex_pass = VertexPass::ALL_ATTRIBUTES) const;
+
+    /**
+     * @brief 이후 해제되는 구간이 기다릴 프레임 번호. 프레임마다 증가하는 값을 전달합니다.
+     */
+    void set_current_frame(uint64_t frame);
+
+    /**
+     * @brief completed_frame 이하 프레임의 제출이 모두 끝났음을 알립니다. 그 프레임까지 해제한 구간을 재사용할 수 있게 됩니다.
+     * @return 반환한 구간 수
+     */
+    size_t retire_frames(uint64_t completed_frame);
+
+    /**
+     * @brief 정점 버퍼 안에서 stream 의 first_vertex 번째 정점 위치 (bytes)
+     */
+    VkDeviceSize get_vertex_offset(uint32_t stream, uint32_t first_vertex) const {
+        return vertex_stream_offsets[stream] + static_cast<VkDeviceSize>(first_vertex) * vertex_layout.get_stream_stride(stream);
+    }
+
+    /**
+     * @brief 인덱스 버퍼 안에서 first_index 번째 인덱스 위치 (bytes)
+     */
+    VkDeviceSize get_index_offset(uint32_t first_index) const {
+        return static_cast<VkDeviceSize>(first_index) * get_index_size();
+    }
+
+    VkDeviceSize get_index_size() const {
+        return index_type == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t);
+    }
+
+    const std::shared_ptr<ev::Buffer>& get_vertex_buffer() const {
+        return vertex_buffer;
+    }
+
+    const std::shared_ptr<ev::Buffer>& get_index_buffer() const {
+        return index_buffer;
+    }
+
+    const std::vector<VkDeviceSize>& get_vertex_stream_offsets() const {
+        return vertex_stream_offsets;
+    }
+
+    const VertexLayout& get_vertex_layout() const {
+        return vertex_layout;
+    }
+
+    VkIndexType get_index_type() const {
+        return index_type;
+    }
+
+    uint32_t get_vertex_capacity() const {
+        return vertex_capacity;
+    }
+
+    uint32_t get_index_capacity() const {
+        return index_capacity;
+    }
+
+    uint32_t get_free_vertex_count() const;
+
+    uint32_t get_free_index_count() const;
+
+    /**
+     * @brief retire_frames 를 기다리는 구간 수
+     */
+    size_t get_pending_release_count() const;
+
+    /**
+     * @brief 버퍼를 해제합니다. 남아 있는 GeometryAllocation 은 해제 시 아무 일도 하지 않습니다.
+     */
+    void destroy();
+
+    ~GeometryHeap();
+};
+
+}
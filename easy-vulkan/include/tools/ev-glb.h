@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+namespace ev::tools::glb {
+
+static constexpr uint32_t MAGIC = 0x46546C67;       // "glTF"
+static constexpr uint32_t VERSION = 2;
+static constexpr uint32_t CHUNK_JSON = 0x4E4F534A;  // "JSON"
+static constexpr uint32_t CHUNK_BIN = 0x004E4942;   // "BIN\0"
+
+/**
+ * @brief .glb 컨테이너의 JSON 청크와 BIN 청크 위치
+ * @details 입력 메모리를 가리킬 뿐 복사하지 않으므로 입력(보통 MappedFile)이 살아 있는 동안만 유효합니다.
+ */
+struct Container {
+    std::string_view json;
+
+    /** BIN 청크가 없으면 nullptr */
+    const uint8_t* bin = nullptr;
+
+    size_t bin_size = 0;
+};
+
+/**
+ * @return 데이터가 glb 헤더로 시작하면 true
+ */
+bool is_glb(const uint8_t* data, size_t size);
+
+/**
+ * @brief glb 헤더와 청크 목록을 검사하고 JSON / BIN 청크를 찾습니다.
+ * @details 첫 청크는 JSON 이어야 하며, 그 뒤의 첫 BIN 청크를 사용하고 알 수 없는 청크는 건너뜁니다.
+ * @return 헤더나 청크 길이가 잘못되었으면 false
+ */
+bool parse(const uint8_t* data, size_t size, Container& container);
+
+}
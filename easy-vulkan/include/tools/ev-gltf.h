@@ -2,6 +2,15 @@
 #include <vector>
 #include <memory>
 #include <filesystem>
+#include <optional>
+#include <algorithm>
+#include <functional>
+#include <span>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <future>
+#include <condition_variable>
 #include "ev-logger.h"
 #include "ev-device.h"
 #include "ev-texture.h"
@@ -15,6 +24,14 @@
 #include "ev-image_view.h"
 #include "ev-sampler.h"
 #include "ev-descriptor_set.h"
+#include "tools/ev-pixel_unpacker.h"
+#include "tools/ev-staging_buffer.h"
+#include "tools/ev-gltf_cache.h"
+#include "tools/ev-transform_hierarchy.h"
+#include "tools/ev-animation.h"
+#include "tools/ev-texture_cache.h"
+#include "tools/ev-mapped_file.h"
+#include "tools/ev-parallel.h"
 // #define GLM_FORCE_RADIANS
 // #define GLM_FORCE_DEPTH_ZERO_TO_ONE
 #include <glm/glm.hpp>
@@ -36,6 +53,13 @@ class Indices;
 class Mesh;
 class Skin;
 class Animation;
+class BindlessMaterials;
+
+class ModelInstance;
+
+class GeometryHeap;
+
+class GeometryAllocation;
 
 enum VertexType {
     Position,
@@ -47,6 +71,10 @@ enum VertexType {
     Tangent
 };
 
+constexpr uint32_t VERTEX_TYPE_COUNT = 7;
+
+class VertexLayout;
+
 struct Vertex {
     glm::vec3 pos;
     glm::vec3 normal;
@@ -70,6 +98,186 @@ struct Vertex {
         std::vector<VertexType> types
     );
     static VkPipelineVertexInputStateCreateInfo* get_pipeline_vertex_input_state(const std::vector<VertexType> types);
+
+    /**
+     * @brief layout 으로 인코딩된 정점 버퍼용 입력 상태를 생성합니다.
+     * @details 스트림이 나뉜 레이아웃은 스트림 번호를 binding 으로 사용하며, types 가 참조하는 스트림의 binding 만 생성합니다.
+     * @param types 셰이더 location 순서대로 나열한 속성. 모두 layout 에 포함되어 있어야 합니다.
+     */
+    static std::vector<VkVertexInputBindingDescription> vertex_binding_descriptions;
+    static VkVertexInputBindingDescription input_binding_description(uint32_t binding, const VertexLayout& layout, uint32_t stream = 0);
+    static VkVertexInputAttributeDescription input_attribute_description(
+        uint32_t binding,
+        uint32_t location,
+        VertexType type,
+        const VertexLayout& layout
+    );
+    static std::vector<VkVertexInputAttributeDescription> input_attribute_descriptions(
+        uint32_t binding,
+        std::vector<VertexType> types,
+        const VertexLayout& layout
+    );
+    static VkPipelineVertexInputStateCreateInfo* get_pipeline_vertex_input_state(const VertexLayout& layout, const std::vector<VertexType> types);
+
+    /**
+     * @brief Model::draw_instanced 용 입력 상태를 생성합니다.
+     * @details layout 의 입력 상태 뒤에 인스턴스 행렬 binding(스트림 수와 같은 번호, VK_VERTEX_INPUT_RATE_INSTANCE)을 추가하고,
+     * 행렬의 열마다 vec4 하나씩 location types.size() 부터 4 개를 사용합니다.
+     */
+    static VkPipelineVertexInputStateCreateInfo* get_instanced_pipeline_vertex_input_state(const VertexLayout& layout, const std::vector<VertexType> types);
+};
+
+/**
+ * @brief 정점 속성 인코딩
+ * @details Quantized 는 속성별로 아래 포맷을 사용합니다. Position 외의 속성은 셰이더 입력 타입만 맞추면 됩니다.
+ * - Position: R16G16B16A16_SNORM, 메시 bounds 기준 정규화 (pos = position_offset + in_pos.xyz * position_scale, Mesh::Uniform 참고)
+ * - Normal: R16G16_SNORM, octahedral
+ * - UV: R16G16_SFLOAT
+ * - Color: R8G8B8A8_UNORM
+ * - Joint: R8G8B8A8_UINT (uvec4, 255 초과 인덱스는 잘림)
+ * - Weight: R8G8B8A8_UNORM, 합이 정확히 1 이 되도록 반올림
+ * - Tangent: R8G8B8A8_SNORM, xy 는 octahedral, w 는 bitangent 부호
+ */
+enum class VertexEncoding : uint32_t {
+    Float,
+    Quantized
+};
+
+/**
+ * @brief 정점 속성을 버퍼 스트림(binding)에 나누는 방식
+ * @details depth prepass, shadow, outline mask 처럼 위치만 필요한 패스는 SplitPosition 으로 위치 스트림만 읽을 수 있습니다.
+ */
+enum class VertexStreams : uint32_t {
+    Interleaved,    // 모든 속성을 하나의 스트림에 interleave
+    SplitPosition,  // 0: Position, 1: 나머지 속성
+    PerAttribute    // 속성마다 별도 스트림
+};
+
+/**
+ * @brief 모델 정점 버퍼의 레이아웃
+ * @details 포함된 속성만 VertexType 순서대로 각 스트림에 interleave 합니다. 기본 생성자는 Vertex 구조체와 같은 레이아웃입니다.
+ * 정적 메시처럼 일부 속성만 필요한 경우 속성을 줄이거나 Quantized 인코딩을 사용해 vertex fetch 대역폭을 줄일 수 있습니다.
+ * 스트림은 하나의 정점 버퍼 안에 순서대로 배치되며 각 스트림의 시작 위치는 get_stream_offset 으로 구합니다.
+ */
+class VertexLayout {
+
+private:
+
+    uint32_t attribute_mask = 0;
+
+    VertexEncoding encoding = VertexEncoding::Float;
+
+    VertexStreams streams = VertexStreams::Interleaved;
+
+    uint32_t stride = 0;
+
+    uint32_t stream_count = 0;
+
+    uint32_t offsets[VERTEX_TYPE_COUNT] = {};
+
+    uint32_t attribute_streams[VERTEX_TYPE_COUNT] = {};
+
+    uint32_t stream_strides[VERTEX_TYPE_COUNT] = {};
+
+    void build();
+
+public:
+
+    static constexpr VkDeviceSize STREAM_ALIGNMENT = 16;
+
+    VertexLayout();
+
+    explicit VertexLayout(const std::vector<VertexType>& attributes,
+        VertexEncoding encoding = VertexEncoding::Float,
+        VertexStreams streams = VertexStreams::Interleaved
+    );
+
+    /**
+     * @brief get_key 로 얻은 값으로 레이아웃을 복원합니다. (모델 캐시)
+     */
+    static VertexLayout from_key(uint32_t key);
+
+    uint32_t get_key() const {
+        return attribute_mask | (static_cast<uint32_t>(encoding) << 16) | (static_cast<uint32_t>(streams) << 20);
+    }
+
+    bool has(VertexType type) const {
+        return (attribute_mask & (1u << type)) != 0;
+    }
+
+    VertexEncoding get_encoding() const {
+        return encoding;
+    }
+
+    VertexStreams get_streams() const {
+        return streams;
+    }
+
+    /**
+     * @brief 정점 하나가 모든 스트림에서 차지하는 바이트 수
+     */
+    uint32_t get_stride() const {
+        return stride;
+    }
+
+    uint32_t get_stream_count() const {
+        return stream_count;
+    }
+
+    uint32_t get_stream_stride(uint32_t stream) const {
+        return stream_strides[stream];
+    }
+
+    /**
+     * @brief 속성이 속한 스트림 번호
+     */
+    uint32_t get_stream(VertexType type) const {
+        return attribute_streams[type];
+    }
+
+    /**
+     * @brief 스트림 내 속성 오프셋
+     */
+    uint32_t get_offset(VertexType type) const {
+        return offsets[type];
+    }
+
+    /**
+     * @brief (1u << VertexType) 조합의 속성 마스크가 필요로 하는 스트림들의 비트 마스크
+     */
+    uint32_t get_stream_mask(uint32_t attribute_mask) const;
+
+    /**
+     * @brief vertex_count 개 정점을 담은 정점 버퍼에서 stream 의 시작 오프셋. stream == get_stream_count() 이면 버퍼 끝
+     */
+    VkDeviceSize get_stream_offset(uint32_t stream, uint32_t vertex_count) const;
+
+    VkDeviceSize get_buffer_size(uint32_t vertex_count) const;
+
+    VkFormat get_format(VertexType type) const;
+
+    /**
+     * @brief Vertex 구조체와 같은 메모리 레이아웃인지 여부. 같으면 변환 없이 그대로 기록합니다.
+     */
+    bool is_native() const;
+
+    /**
+     * @brief Vertex 배열을 이 레이아웃으로 인코딩합니다.
+     * @param position_offset, position_scale Quantized 위치 정규화에 사용할 메시 bounds 의 중심과 반 크기
+     * @param dst 스트림별 출력 위치 (get_stream_count() 개, 각각 count * get_stream_stride(stream) bytes)
+     * @param encode_mask 인코딩할 속성 (1u << VertexType). 이미 기록된 속성은 제외합니다.
+     */
+    void encode(const Vertex* src,
+        size_t count,
+        const glm::vec3& position_offset,
+        const glm::vec3& position_scale,
+        uint8_t* const* dst,
+        uint32_t encode_mask = (1u << VERTEX_TYPE_COUNT) - 1
+    ) const;
+
+    bool operator==(const VertexLayout& other) const {
+        return get_key() == other.get_key();
+    }
 };
 
 class Skin {
@@ -249,6 +457,9 @@ private:
 
     std::shared_ptr<ev::DescriptorSet> descriptor_set = nullptr;
 
+    /** BindlessMaterials 에 등록된 머티리얼 SSBO 번호 */
+    uint32_t material_index = 0;
+
 public:
     
     Material(std::shared_ptr<ev::Device> device)
@@ -319,6 +530,14 @@ public:
         return descriptor_set;
     }
 
+    void set_material_index(uint32_t index) {
+        material_index = index;
+    }
+
+    uint32_t get_material_index() const {
+        return material_index;
+    }
+
     AlphaMode get_alpha_mode() const {
         return alpha_mode;
     }
@@ -374,6 +593,32 @@ public:
 
 class Primitive {
 
+public:
+
+    struct Dimensions {
+
+        glm::vec3 min = glm::vec3(FLT_MAX);
+
+        glm::vec3 max = glm::vec3(-FLT_MAX);
+
+        glm::vec3 size;
+
+        glm::vec3 center;
+
+        float radius = 0.0f;
+    };
+
+    /**
+     * @brief 단순화된 LOD 인덱스 구간. 정점은 원본(LOD 0)과 공유합니다.
+     */
+    struct Lod {
+        uint32_t first_index;
+        uint32_t index_count;
+        float error;    // 원본 대비 최대 오차 (메시 로컬 좌표 거리)
+    };
+
+private:
+
     uint32_t first_index;
 
     uint32_t index_count;
@@ -384,18 +629,15 @@ class Primitive {
 
     std::shared_ptr<Material> material;
 
-    struct Dimensions {
-
-        glm::vec3 min = glm::vec3(FLT_MAX);
-
-        glm::vec3 max = glm::vec3(-FLT_MAX);
+    Dimensions dimensions;
 
-        glm::vec3 size;
+    /** LOD 1 부터 오차가 커지는 순서. LOD 0 은 first_index / index_count */
+    std::vector<Lod> lods;
 
-        glm::vec3 center;
+    /** Model::get_meshlets() 안의 LOD 0 meshlet 구간 */
+    uint32_t first_meshlet = 0;
 
-        float radius = 0.0f;
-    } dimensions;
+    uint32_t meshlet_count = 0;
 
 public: 
 
@@ -408,7 +650,17 @@ public:
 
     void set_dimensions(const glm::vec3 min, const glm::vec3 max);
 
-    const std::shared_ptr<Material> get_material() const {
+    /**
+     * @brief 메시 최적화로 정점/인덱스 수가 바뀐 뒤 버퍼 내 구간을 다시 설정합니다.
+     */
+    void set_range(uint32_t first_index, uint32_t index_count, uint32_t first_vertex, uint32_t vertex_count) {
+        this->first_index = first_index;
+        this->index_count = index_count;
+        this->first_vertex = first_vertex;
+        this->vertex_count = vertex_count;
+    }
+
+    const std::shared_ptr<Material>& get_material() const {
         return material;
     }
 
@@ -427,6 +679,42 @@ public:
     const uint32_t get_vertex_count() const {
         return vertex_count;
     }
+
+    const Dimensions& get_dimensions() const {
+        return dimensions;
+    }
+
+    void add_lod(const Lod& lod) {
+        lods.push_back(lod);
+    }
+
+    const std::vector<Lod>& get_lods() const {
+        return lods;
+    }
+
+    /**
+     * @brief LOD 를 포함한 정점/인덱스 구간을 버퍼 안에서 옮깁니다. (GeometryHeap 구간 기준으로 변경)
+     */
+    void offset_range(int64_t vertex_offset, int64_t index_offset) {
+        first_vertex = static_cast<uint32_t>(first_vertex + vertex_offset);
+        first_index = static_cast<uint32_t>(first_index + index_offset);
+        for ( Lod& lod : lods ) {
+            lod.first_index = static_cast<uint32_t>(lod.first_index + index_offset);
+        }
+    }
+
+    void set_meshlets(uint32_t first_meshlet, uint32_t meshlet_count) {
+        this->first_meshlet = first_meshlet;
+        this->meshlet_count = meshlet_count;
+    }
+
+    uint32_t get_first_meshlet() const {
+        return first_meshlet;
+    }
+
+    uint32_t get_meshlet_count() const {
+        return meshlet_count;
+    }
 };
 
 class Mesh {
@@ -439,8 +727,13 @@ public:
 
     struct Uniform {
         glm::mat4 matrix;
-        glm::mat4 joint_matrix[64]{};
-        float joint_count = 0.0f;
+        // 관절 행렬은 SkinningSystem 의 palette storage buffer 에 모아 두며, 여기에는 시작 위치만 보관
+        uint32_t joint_offset = 0xFFFFFFFFu;
+        uint32_t joint_count = 0;
+        uint32_t padding[2]{};
+        // VertexEncoding::Quantized 위치 복원용 메시 bounds (std140 에서 vec4 정렬)
+        glm::vec4 position_offset = glm::vec4(0.0f);
+        glm::vec4 position_scale = glm::vec4(1.0f);
     };
 
 private:
@@ -496,8 +789,19 @@ public:
     Uniform& get_uniform_data() {
         return uniform_data;
     }
+
+    /**
+     * @brief uniform_data 를 uniform 버퍼에 기록합니다. 버퍼는 처음 기록할 때 매핑하여 유지합니다.
+     * @details 버퍼를 프레임마다 따로 두지 않으므로 이 메시를 그리는 이전 제출이 끝난 뒤에 호출해야 합니다.
+     */
+    void upload_uniform();
 };
 
+/**
+ * @brief 모델 노드
+ * @details Model::build_transform_hierarchy 이후에는 변환을 모델의 TransformHierarchy 에 보관하며 노드는 그 항목을 가리키는 뷰가 됩니다.
+ * 연결 전(로딩 중)에는 노드가 직접 변환을 보관합니다.
+ */
 class Node : public std::enable_shared_from_this<Node> {
 
 private:
@@ -520,7 +824,7 @@ private:
 
     uint32_t index;
 
-    glm::mat4 matrix;
+    glm::mat4 matrix{1.0f};
 
     glm::vec3 translation{};
 
@@ -528,6 +832,10 @@ private:
 
     glm::vec3 scale{1.0f};
 
+    std::shared_ptr<ev::tools::TransformHierarchy> transforms = nullptr;
+
+    uint32_t transform_index = 0;
+
 public:
 
     explicit Node(uint32_t index);
@@ -550,16 +858,29 @@ public:
     }
 
     void set_translation(const glm::vec3& translation) {
+        if ( transforms ) {
+            transforms->set_translation(transform_index, glm::value_ptr(translation));
+            return;
+        }
         this->translation = translation;
         update_matrix();
     }
 
     void set_rotation(const glm::quat& rotation) {
+        if ( transforms ) {
+            const float xyzw[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+            transforms->set_rotation(transform_index, xyzw);
+            return;
+        }
         this->rotation = rotation;
         update_matrix();
     }
 
     void set_scale(const glm::vec3& scale) {
+        if ( transforms ) {
+            transforms->set_scale(transform_index, glm::value_ptr(scale));
+            return;
+        }
         this->scale = scale;
         update_matrix();
     }
@@ -573,6 +894,10 @@ public:
     }
 
     void set_matrix(const glm::mat4& matrix) {
+        if ( transforms ) {
+            transforms->set_local_matrix(transform_index, glm::value_ptr(matrix));
+            return;
+        }
         this->matrix = matrix;
     }
 
@@ -583,14 +908,74 @@ public:
         matrix = glm::scale(matrix, scale);
     }
 
+    /**
+     * @brief 변환을 hierarchy 의 transform_index 항목으로 옮기고 이후 접근을 그 항목으로 전달합니다.
+     */
+    void attach_transform(const std::shared_ptr<ev::tools::TransformHierarchy>& hierarchy, uint32_t transform_index);
+
+    const std::shared_ptr<ev::tools::TransformHierarchy>& get_transform_hierarchy() const {
+        return transforms;
+    }
+
+    uint32_t get_transform_index() const {
+        return transform_index;
+    }
+
     std::weak_ptr<Node>& get_parent() {
         return parent;
     }
 
-    const glm::mat4& get_matrix() const {
+    glm::vec3 get_translation() const {
+        if ( transforms ) {
+            glm::vec3 value;
+            transforms->get_translation(transform_index, glm::value_ptr(value));
+            return value;
+        }
+        return translation;
+    }
+
+    glm::quat get_rotation() const {
+        if ( transforms ) {
+            float xyzw[4];
+            transforms->get_rotation(transform_index, xyzw);
+            return glm::quat(xyzw[3], xyzw[0], xyzw[1], xyzw[2]);
+        }
+        return rotation;
+    }
+
+    glm::vec3 get_scale() const {
+        if ( transforms ) {
+            glm::vec3 value;
+            transforms->get_scale(transform_index, glm::value_ptr(value));
+            return value;
+        }
+        return scale;
+    }
+
+    /**
+     * @brief 로컬 행렬. hierarchy 에 연결된 경우 마지막 update 시점의 값입니다.
+     */
+    glm::mat4 get_matrix() const {
+        if ( transforms ) {
+            return glm::make_mat4(transforms->get_local_matrix(transform_index));
+        }
         return matrix;
     }
 
+    /**
+     * @brief 모델 공간 행렬. hierarchy 에 연결되지 않은 경우 부모를 따라 올라가며 계산합니다.
+     */
+    glm::mat4 get_world_matrix() const {
+        if ( transforms ) {
+            return glm::make_mat4(transforms->get_world_matrix(transform_index));
+        }
+        glm::mat4 world = matrix;
+        for ( auto node = parent.lock() ; node ; node = node->parent.lock() ) {
+            world = node->matrix * world;
+        }
+        return world;
+    }
+
     const std::string& get_name() const {
         return name;
     }
@@ -629,7 +1014,75 @@ enum RenderFlag {
     BIND_IMAGE = 0x01,
     OPAQUE = 0x02,
     ALPHA_MASK = 0x04,
-    ALPHA_BLEND = 0x08
+    ALPHA_BLEND = 0x08,
+    BINDLESS = 0x10     // 머티리얼 디스크립터 셋 대신 Material::get_material_index 를 push constant 로 전달
+};
+
+/**
+ * @brief render_flags 의 알파 모드 조건에 맞지 않는 머티리얼이면 true
+ */
+bool skip_material(const Material& material, uint32_t render_flags);
+
+/**
+ * @brief 로컬 -> clip 행렬에서 절두체 평면 6 개를 추출합니다. (Gribb-Hartmann)
+ * @details 평면을 행렬의 입력 공간에서 정규화하므로 로컬 bounding sphere 와 바로 비교할 수 있습니다.
+ * near 평면은 -w <= z 로 잡아 깊이 범위가 [0, 1] 인 투영에서도 보수적으로 동작합니다.
+ */
+void extract_frustum_planes(const glm::mat4& matrix, glm::vec4 planes[6]);
+
+/**
+ * @brief Model::bind_buffers / draw 에서 패스가 읽는 정점 속성. (1u << VertexType) 조합으로도 지정할 수 있습니다.
+ */
+enum VertexPass : uint32_t {
+    POSITION_ONLY = 1u << Position,                 // depth prepass, shadow, outline mask
+    ALL_ATTRIBUTES = (1u << VERTEX_TYPE_COUNT) - 1
+};
+
+/**
+ * @brief Model::draw 에서 LOD 선택과 meshlet 컬링에 사용하는 카메라 정보
+ * @details 프리미티브의 bounding sphere 를 화면에 투영한 크기로 LOD 오차를 픽셀 단위로 환산하여,
+ * 오차가 pixel_error 이하인 가장 단순한 LOD 를 그립니다.
+ * draw_meshlets / draw_mesh_tasks 는 view_projection 으로 절두체 컬링을 하므로 반드시 설정해야 합니다.
+ */
+struct DrawView {
+    glm::mat4 model_matrix = glm::mat4(1.0f);   // push constant 등으로 셰이더에 전달하는 모델 변환
+    glm::mat4 view_projection = glm::mat4(1.0f);
+    glm::vec3 camera_position = glm::vec3(0.0f);
+    float projection_scale = 0.0f;              // 화면 높이(px) * 0.5 * proj[1][1]. 0 이면 항상 LOD 0
+    float pixel_error = 1.0f;
+};
+
+/**
+ * @brief meshlet 레코드. GPU meshlet 버퍼와 같은 레이아웃입니다. (std430, 64 bytes)
+ * @details 좌표는 메시 로컬 공간입니다. meshlet 의 삼각형은 인덱스 버퍼의 [first_index, first_index + triangle_count * 3)
+ * 구간과 같으므로 meshlet 하나를 VkDrawIndexedIndirectCommand 하나로 그릴 수 있습니다.
+ */
+struct MeshletData {
+    glm::vec4 bounds;           // xyz: bounding sphere 중심, w: 반지름
+    glm::vec4 cone;             // xyz: 법선 cone 축, w: cutoff (1 이면 cone 컬링 안 함)
+    uint32_t vertex_offset;     // Model::get_meshlet_vertices() 시작 위치. 값은 프리미티브 로컬 정점 인덱스
+    uint32_t triangle_offset;   // Model::get_meshlet_triangles() 의 삼각형 단위 시작 위치
+    uint32_t vertex_count;
+    uint32_t triangle_count;
+    uint32_t first_index;       // 인덱스 버퍼 위치
+    uint32_t first_vertex;      // Primitive::get_first_vertex()
+    uint32_t padding[2];
+};
+
+static_assert(sizeof(MeshletData) == 64);
+
+/** @brief task shader 워크그룹 하나가 컬링하는 meshlet 수 (shaders/tools/meshlet.task 의 local_size_x) */
+constexpr uint32_t MESHLET_TASK_GROUP_SIZE = 32;
+
+/**
+ * @brief Model::draw_mesh_tasks 가 프리미티브마다 task/mesh shader 에 전달하는 push constant (96 bytes)
+ */
+struct MeshletPushConstants {
+    glm::mat4 matrix;               // 메시 로컬 -> clip
+    glm::vec4 camera_position;      // 메시 로컬 카메라 위치, w 가 0 이면 cone 컬링 안 함 (양면 머티리얼)
+    uint32_t first_meshlet;
+    uint32_t meshlet_count;
+    uint32_t padding[2];
 };
 
 class Model {
@@ -650,74 +1103,219 @@ private :
 
     std::vector<std::shared_ptr<ev::Texture>> textures;
 
+    /** textures 와 같은 순서의 원본 이미지 경로 (모델 캐시에서 사용) */
+    std::vector<std::string> texture_sources;
+
     std::shared_ptr<ev::Buffer> vertex_buffer = nullptr;
 
     std::shared_ptr<ev::Buffer> index_buffer = nullptr;
 
+    VertexLayout vertex_layout;
+
+    /** 정점 버퍼 안 스트림별 시작 오프셋 */
+    std::vector<VkDeviceSize> vertex_stream_offsets;
+
+    uint32_t vertex_count = 0;
+
+    /** 인덱스는 프리미티브 로컬이며 draw 시 first_vertex 를 vertexOffset 으로 사용 */
+    VkIndexType index_type = VK_INDEX_TYPE_UINT32;
+
+    /** GeometryHeap 에 올라간 경우의 구간. vertex_buffer / index_buffer 는 힙의 버퍼이며 프리미티브 구간은 힙 기준 */
+    std::shared_ptr<GeometryAllocation> geometry_allocation = nullptr;
+
     std::vector<std::shared_ptr<ev::DescriptorSetLayout>> descriptor_set_layouts;
 
     bool buffer_bound = false;
 
-    void bind_node_descriptor_sets(
-        std::shared_ptr<ev::CommandBuffer> command_buffer, 
-        const std::shared_ptr<Node>& node
-    );
+    DrawView draw_view;
 
-    void draw_node(
-        std::shared_ptr<ev::CommandBuffer> command_buffer,
-        const std::shared_ptr<Node> node,
-        uint32_t render_flags = RenderFlag::OPAQUE | RenderFlag::BIND_IMAGE,
-        std::shared_ptr<ev::PipelineLayout> pipeline_layout = nullptr,
-        uint32_t bind_image_set = 1
-    );
+    /** RenderFlag::BINDLESS 일 때 머티리얼 번호(uint32)를 기록할 push constant 위치. 기본값은 모델 행렬(mat4) 바로 뒤 */
+    VkShaderStageFlags material_index_stages = VK_SHADER_STAGE_FRAGMENT_BIT;
 
-public:
+    uint32_t material_index_offset = sizeof(glm::mat4);
 
-    explicit Model(std::shared_ptr<ev::Device> device)
-        : device(std::move(device)) {
-        if (!this->device) {
-            ev_log_error("[ev::tools::gltf::Model] Device is null");
-            exit(EXIT_FAILURE);
-        }
-    }
+    /** draw 경로가 메시 uniform 디스크립터 셋을 바인딩할 번호. NO_MESH_SET 이면 바인딩하지 않음 */
+    uint32_t mesh_set_index = 0xFFFFFFFFu;
 
-    void set_nodes(const std::vector<std::shared_ptr<Node>>& nodes) {
-        this->nodes = nodes;
-    }
+    /** 컬링은 CPU 에서 하므로 meshlet 레코드는 GPU 버퍼와 별도로 보관 */
+    std::vector<MeshletData> meshlets;
 
-    void set_skins(const std::vector<std::shared_ptr<Skin>>& skins) {
-        this->skins = skins;
-    }
+    std::vector<uint32_t> meshlet_vertices;
 
-    void set_materials(const std::vector<std::shared_ptr<Material>>& materials) {
-        this->materials = materials;
-    }
+    /** 삼각형마다 meshlet 내부 정점 번호 3 개. 4 바이트 단위로 패딩 */
+    std::vector<uint8_t> meshlet_triangles;
 
-    void set_animations(const std::vector<std::shared_ptr<Animation>>& animations) {
-        this->animations = animations;
-    }
+    std::shared_ptr<ev::Buffer> meshlet_buffer = nullptr;
 
-    void set_textures(const std::vector<std::shared_ptr<ev::Texture>>& textures) {
-        this->textures = textures;
-    }
+    std::shared_ptr<ev::Buffer> meshlet_vertex_buffer = nullptr;
 
-    const std::vector<std::shared_ptr<Node>>& get_nodes() const {
-        return nodes;
-    }
+    std::shared_ptr<ev::Buffer> meshlet_triangle_buffer = nullptr;
 
-    const std::shared_ptr<Node> get_node_by_index(uint32_t index) const;
+    /**
+     * @brief draw_meshlets 가 프레임마다 컬링 결과를 기록하는 host visible indirect 버퍼
+     * @details GPU 가 읽는 동안 덮어쓰지 않도록 frame_index 마다 따로 둡니다. buffer 가 memory 보다 먼저 해제되어야 합니다.
+     */
+    struct IndirectFrame {
+        std::shared_ptr<ev::Memory> memory = nullptr;
+        std::shared_ptr<ev::Buffer> buffer = nullptr;
+        uint32_t capacity = 0;
+    };
 
-    const std::vector<std::shared_ptr<Skin>>& get_skins() const {
-        return skins;
-    }
+    std::vector<IndirectFrame> indirect_frames;
 
-    const std::vector<std::shared_ptr<Material>>& get_materials() const {
-        return materials;
-    }
+    /** update_instances 가 묶음 순서대로 노드 월드 행렬을 기록하는 정점(인스턴스) 버퍼. indirect 버퍼와 같은 규칙으로 frame_index 마다 둡니다. */
+    std::vector<IndirectFrame> instance_frames;
 
-    const std::vector<std::shared_ptr<Animation>>& get_animations() const {
-        return animations;
-    }
+    /** 모든 노드의 변환. 노드는 이 hierarchy 의 항목을 가리키는 뷰 */
+    std::shared_ptr<ev::tools::TransformHierarchy> transform_hierarchy = nullptr;
+
+    /** transform_hierarchy 와 같은 순서(전위 순회)의 노드 */
+    std::vector<std::shared_ptr<Node>> transform_nodes;
+
+    /** animations 를 transform_hierarchy 노드 인덱스로 변환한 클립 (중복 제거된 animations 순서) */
+    std::vector<std::shared_ptr<ev::tools::AnimationClip>> animation_clips;
+
+    void build_animation_clips();
+
+    /**
+     * @brief transform_nodes 에서 같은 메시와 스킨을 참조하는 노드를 묶습니다.
+     */
+    void build_instance_groups();
+
+    /**
+     * @brief frame_index 의 indirect 버퍼가 count 개 이상의 명령을 담을 수 있도록 하고 매핑된 주소를 반환합니다.
+     */
+    VkDrawIndexedIndirectCommand* reserve_indirect_commands(uint32_t frame_index, uint32_t count);
+
+    /**
+     * @brief draw_meshlets 한 번에 기록될 수 있는 최대 indirect 명령 수
+     */
+    uint32_t count_meshlet_draws(const std::shared_ptr<Node>& node) const;
+
+    /**
+     * @brief draw_view 기준으로 프리미티브의 인덱스 구간을 고릅니다.
+     */
+    void select_lod(
+        const glm::mat4& matrix,
+        const Primitive& primitive,
+        uint32_t& first_index,
+        uint32_t& index_count
+    ) const;
+
+    /**
+     * @brief render_flags 에 따라 머티리얼 디스크립터 셋을 바인딩하거나(BIND_IMAGE) 머티리얼 번호를 push 합니다.(BINDLESS)
+     */
+    void bind_material(
+        std::shared_ptr<ev::CommandBuffer> command_buffer,
+        const Material& material,
+        uint32_t render_flags,
+        std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+        uint32_t bind_image_set
+    );
+
+    /**
+     * @brief mesh_set_index 가 설정되어 있으면 메시 uniform 디스크립터 셋을 바인딩합니다.
+     */
+    void bind_mesh_descriptor_set(
+        std::shared_ptr<ev::CommandBuffer> command_buffer,
+        Mesh& mesh,
+        std::shared_ptr<ev::PipelineLayout> pipeline_layout
+    );
+
+    void draw_node(
+        std::shared_ptr<ev::CommandBuffer> command_buffer,
+        const std::shared_ptr<Node>& node,
+        uint32_t render_flags = RenderFlag::OPAQUE | RenderFlag::BIND_IMAGE,
+        std::shared_ptr<ev::PipelineLayout> pipeline_layout = nullptr,
+        uint32_t bind_image_set = 1
+    );
+
+    void draw_meshlet_node(
+        std::shared_ptr<ev::CommandBuffer> command_buffer,
+        const std::shared_ptr<Node>& node,
+        uint32_t render_flags,
+        std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+        uint32_t bind_image_set,
+        uint32_t frame_index,
+        VkDrawIndexedIndirectCommand* commands,
+        uint32_t& command_count
+    );
+
+    void draw_mesh_task_node(
+        std::shared_ptr<ev::CommandBuffer> command_buffer,
+        const std::shared_ptr<Node>& node,
+        uint32_t render_flags,
+        std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+        uint32_t bind_image_set
+    );
+
+public:
+
+    /**
+     * @brief 같은 메시(프리미티브와 머티리얼이 모두 같음)와 스킨을 참조하는 노드 묶음
+     * @details 인스턴스 버퍼에서 [first_instance, first_instance + nodes.size()) 구간을 사용합니다.
+     */
+    struct InstanceGroup {
+        std::shared_ptr<Mesh> mesh;
+        std::shared_ptr<Skin> skin;
+        std::vector<std::shared_ptr<Node>> nodes;
+        uint32_t first_instance = 0;
+    };
+
+private:
+
+    std::vector<InstanceGroup> instance_groups;
+
+    uint32_t instance_count = 0;
+
+public:
+
+    explicit Model(std::shared_ptr<ev::Device> device)
+        : device(std::move(device)) {
+        if (!this->device) {
+            ev_log_error("[ev::tools::gltf::Model] Device is null");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    void set_nodes(const std::vector<std::shared_ptr<Node>>& nodes) {
+        this->nodes = nodes;
+    }
+
+    void set_skins(const std::vector<std::shared_ptr<Skin>>& skins) {
+        this->skins = skins;
+    }
+
+    void set_materials(const std::vector<std::shared_ptr<Material>>& materials) {
+        this->materials = materials;
+    }
+
+    void set_animations(const std::vector<std::shared_ptr<Animation>>& animations) {
+        this->animations = animations;
+    }
+
+    void set_textures(const std::vector<std::shared_ptr<ev::Texture>>& textures) {
+        this->textures = textures;
+        texture_sources.assign(textures.size(), "");
+    }
+
+    const std::vector<std::shared_ptr<Node>>& get_nodes() const {
+        return nodes;
+    }
+
+    const std::shared_ptr<Node> get_node_by_index(uint32_t index) const;
+
+    const std::vector<std::shared_ptr<Skin>>& get_skins() const {
+        return skins;
+    }
+
+    const std::vector<std::shared_ptr<Material>>& get_materials() const {
+        return materials;
+    }
+
+    const std::vector<std::shared_ptr<Animation>>& get_animations() const {
+        return animations;
+    }
 
     const std::vector<std::shared_ptr<ev::Texture>>& get_textures() const {
         return textures;
@@ -743,21 +1341,157 @@ public:
         animations.emplace_back(animation);
     }
 
-    void add_texture(const std::shared_ptr<ev::Texture>& texture) {
+    void add_texture(const std::shared_ptr<ev::Texture>& texture, const std::string& source = "") {
         textures.emplace_back(texture);
+        texture_sources.resize(textures.size());
+        texture_sources.back() = source;
+    }
+
+    const std::vector<std::string>& get_texture_sources() const {
+        return texture_sources;
     }
 
     void add_linear_node(const std::shared_ptr<Node>& node) {
         linear_nodes.emplace_back(node);
     }
 
+    /**
+     * @brief 모델에 연결된 모든 노드(메시가 없는 부모, 스킨 관절 포함)를 전위 순회 순서의 TransformHierarchy 로 옮깁니다.
+     * @details 노드의 현재 행렬을 로컬 행렬로 사용하며, 이후 노드 변환 접근은 hierarchy 로 전달됩니다.
+     * 메시 uniform 의 matrix 를 월드(모델 공간) 행렬로 갱신합니다. 노드 계층을 바꾼 뒤에는 다시 호출해야 합니다.
+     */
+    void build_transform_hierarchy();
+
+    /**
+     * @brief 변경된 노드의 월드 행렬을 갱신하고 메시 uniform 의 matrix 에 반영한 뒤 uniform 버퍼에 기록합니다.
+     * @return 월드 행렬이 갱신된 노드 수
+     */
+    uint32_t update_transforms(bool parallel = true);
+
+    const std::shared_ptr<ev::tools::TransformHierarchy>& get_transform_hierarchy() const {
+        return transform_hierarchy;
+    }
+
+    const std::vector<std::shared_ptr<Node>>& get_transform_nodes() const {
+        return transform_nodes;
+    }
+
+    /**
+     * @brief build_transform_hierarchy 에서 만든 재생용 클립
+     * @details 캐릭터마다 transform_hierarchy 를 복사해 AnimationMixer 의 target 으로 사용하면 클립을 공유할 수 있습니다.
+     */
+    const std::vector<std::shared_ptr<ev::tools::AnimationClip>>& get_animation_clips() const {
+        return animation_clips;
+    }
+
+    /**
+     * @brief 이름으로 클립을 찾습니다. 없으면 nullptr
+     */
+    std::shared_ptr<ev::tools::AnimationClip> get_animation_clip(const std::string& name) const;
+
     void add_descriptor_set_layout(std::shared_ptr<ev::DescriptorSetLayout> layout);
 
-    void bind_buffers(std::shared_ptr<ev::CommandBuffer> command_buffer);
+    /**
+     * @brief 정점/인덱스 버퍼를 바인딩합니다.
+     * @param vertex_pass 패스가 읽는 속성 마스크. 해당 속성이 들어 있는 스트림만 (binding = 스트림 번호) 바인딩합니다.
+     */
+    void bind_buffers(std::shared_ptr<ev::CommandBuffer> command_buffer, uint32_t vertex_pass = VertexPass::ALL_ATTRIBUTES);
 
     void draw(std::shared_ptr<ev::CommandBuffer> command_buffer, 
         uint32_t render_flags = RenderFlag::OPAQUE | RenderFlag::BIND_IMAGE,
         std::shared_ptr<ev::PipelineLayout> pipeline_layout = nullptr,
+        uint32_t bind_image_set = 1,
+        uint32_t vertex_pass = VertexPass::ALL_ATTRIBUTES
+    );
+
+    /**
+     * @brief build_transform_hierarchy 에서 만든 인스턴스 묶음 (노드 전위 순서로 처음 등장한 순서)
+     */
+    const std::vector<InstanceGroup>& get_instance_groups() const {
+        return instance_groups;
+    }
+
+    uint32_t get_instance_count() const {
+        return instance_count;
+    }
+
+    /**
+     * @brief draw_instanced 가 인스턴스 버퍼를 바인딩하는 번호. 정점 스트림 바로 다음 binding 입니다.
+     */
+    uint32_t get_instance_binding() const {
+        return vertex_layout.get_stream_count();
+    }
+
+    /**
+     * @brief 모든 묶음의 노드 월드 행렬을 frame_index 의 인스턴스 버퍼에 기록합니다.
+     * @details update_transforms 또는 애니메이션 적용 이후, draw_instanced 를 기록하기 전에 호출합니다.
+     * @param frame_index 인스턴스 버퍼 번호. 같은 번호의 이전 제출이 완료된 뒤에 호출해야 합니다.
+     */
+    void update_instances(uint32_t frame_index);
+
+    /**
+     * @brief 묶음의 프리미티브마다 draw_indexed 로 모든 노드를 그립니다.
+     * @details 파이프라인은 Vertex::get_instanced_pipeline_vertex_input_state 로 만들어야 하며 셰이더는 인스턴스 행렬을 노드 월드 행렬로 사용합니다.
+     * LOD 는 인스턴스마다 고르며, 같은 LOD 가 이어지는 인스턴스 구간마다 draw_indexed 를 한 번씩 기록합니다. 메시 uniform 디스크립터 셋은 set_mesh_set_index 가 설정된 경우 묶음마다 바인딩하며,
+     * 묶음의 노드가 공유하므로 행렬 대신 position_offset / position_scale, joint_offset 만 의미가 있습니다.
+     * @param frame_index update_instances 에 전달한 번호
+     */
+    void draw_instanced(std::shared_ptr<ev::CommandBuffer> command_buffer,
+        uint32_t frame_index,
+        uint32_t render_flags = RenderFlag::OPAQUE | RenderFlag::BIND_IMAGE,
+        std::shared_ptr<ev::PipelineLayout> pipeline_layout = nullptr,
+        uint32_t bind_image_set = 1,
+        uint32_t vertex_pass = VertexPass::ALL_ATTRIBUTES
+    );
+
+    /**
+     * @brief 다른 인스턴스 버퍼로 그립니다. (ModelInstance 처럼 GPU 리소스를 공유하면서 노드 변환만 따로 가지는 경우)
+     * @param instance_buffer write_instances 순서로 get_instance_count 개의 mat4 를 담은 정점 버퍼
+     * @param matrices LOD 선택에 사용할 instance_buffer 의 CPU 측 내용. nullptr 이면 LOD 0
+     */
+    void draw_instanced(std::shared_ptr<ev::CommandBuffer> command_buffer,
+        const std::shared_ptr<ev::Buffer>& instance_buffer,
+        const glm::mat4* matrices,
+        uint32_t render_flags = RenderFlag::OPAQUE | RenderFlag::BIND_IMAGE,
+        std::shared_ptr<ev::PipelineLayout> pipeline_layout = nullptr,
+        uint32_t bind_image_set = 1,
+        uint32_t vertex_pass = VertexPass::ALL_ATTRIBUTES
+    );
+
+    /**
+     * @brief transforms(get_transform_hierarchy 의 복사본)의 월드 행렬에 model_matrix 를 곱해 인스턴스 순서대로 matrices 에 기록합니다.
+     * @param matrices get_instance_count 개를 담을 수 있어야 합니다.
+     */
+    void write_instances(const ev::tools::TransformHierarchy& transforms, const glm::mat4& model_matrix, glm::mat4* matrices) const;
+
+    /**
+     * @brief 정점/인덱스/meshlet 버퍼와 텍스처 이미지가 차지하는 메모리 크기. 모델 캐시 budget 계산에 사용합니다.
+     */
+    uint64_t get_resource_bytes() const;
+
+    /**
+     * @brief meshlet 단위로 절두체/backface cone 컬링한 뒤 남은 meshlet 을 indirect draw 로 그립니다.
+     * @details draw 와 같은 파이프라인을 사용합니다. meshlet 이 없는 프리미티브와 LOD 1 이상이 선택된 프리미티브는 통째로 그립니다.
+     * multiDrawIndirect 기능이 없으면 프리미티브마다 명령을 하나씩 실행합니다.
+     * @param frame_index indirect 버퍼 번호. 같은 번호의 이전 제출이 완료된 뒤에 호출해야 하며,
+     * 한 프레임에서 여러 패스를 그리면 패스마다 다른 번호를 사용합니다. (예: frame * pass_count + pass)
+     */
+    void draw_meshlets(std::shared_ptr<ev::CommandBuffer> command_buffer,
+        uint32_t frame_index,
+        uint32_t render_flags = RenderFlag::OPAQUE | RenderFlag::BIND_IMAGE,
+        std::shared_ptr<ev::PipelineLayout> pipeline_layout = nullptr,
+        uint32_t bind_image_set = 1,
+        uint32_t vertex_pass = VertexPass::ALL_ATTRIBUTES
+    );
+
+    /**
+     * @brief VK_EXT_mesh_shader 경로. 프리미티브마다 MeshletPushConstants 를 push 하고 task shader 워크그룹을 실행합니다.
+     * @details 파이프라인은 shaders/tools/meshlet.task, meshlet.mesh 처럼 meshlet 버퍼와 정점 버퍼를 storage buffer 로 읽어야 하며,
+     * 정점 버퍼는 Vertex 구조체 레이아웃이어야 합니다. 디스크립터 셋은 호출자가 미리 바인딩합니다. meshlet 이 있는 LOD 0 만 그립니다.
+     */
+    void draw_mesh_tasks(std::shared_ptr<ev::CommandBuffer> command_buffer,
+        std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+        uint32_t render_flags = RenderFlag::OPAQUE | RenderFlag::BIND_IMAGE,
         uint32_t bind_image_set = 1
     );
 
@@ -776,6 +1510,154 @@ public:
     void set_index_buffer(std::shared_ptr<ev::Buffer> buffer) {
         index_buffer = std::move(buffer);
     }
+
+    /**
+     * @brief GeometryHeap 에 올라간 모델이면 힙 안의 정점/인덱스 구간, 아니면 nullptr
+     */
+    const std::shared_ptr<GeometryAllocation>& get_geometry_allocation() const {
+        return geometry_allocation;
+    }
+
+    /**
+     * @brief 모델을 GeometryHeap 구간으로 옮깁니다. 모든 프리미티브의 정점/인덱스 구간을 힙 기준으로 바꾸고 힙 버퍼를 사용합니다.
+     * @param stream_offsets 힙 정점 버퍼 안 스트림별 시작 오프셋
+     */
+    void set_geometry_allocation(std::shared_ptr<GeometryAllocation> allocation,
+        std::shared_ptr<ev::Buffer> vertex_buffer,
+        std::shared_ptr<ev::Buffer> index_buffer,
+        const std::vector<VkDeviceSize>& stream_offsets
+    );
+
+    /**
+     * @brief 정점 버퍼의 레이아웃. 파이프라인 생성 시 Vertex::get_pipeline_vertex_input_state 에 전달합니다.
+     */
+    const VertexLayout& get_vertex_layout() const {
+        return vertex_layout;
+    }
+
+    void set_vertex_layout(const VertexLayout& layout) {
+        vertex_layout = layout;
+    }
+
+    const std::vector<VkDeviceSize>& get_vertex_stream_offsets() const {
+        return vertex_stream_offsets;
+    }
+
+    void set_vertex_stream_offsets(const std::vector<VkDeviceSize>& offsets) {
+        vertex_stream_offsets = offsets;
+    }
+
+    uint32_t get_vertex_count() const {
+        return vertex_count;
+    }
+
+    void set_vertex_count(uint32_t count) {
+        vertex_count = count;
+    }
+
+    VkIndexType get_index_type() const {
+        return index_type;
+    }
+
+    /**
+     * @brief RenderFlag::BINDLESS 로 그릴 때 머티리얼 번호를 기록할 push constant 범위를 설정합니다.
+     * @details 파이프라인 레이아웃의 push constant 범위에 offset 부터 4 bytes 가 stages 로 포함되어 있어야 합니다.
+     */
+    void set_material_index_push_constant(VkShaderStageFlags stages, uint32_t offset) {
+        material_index_stages = stages;
+        material_index_offset = offset;
+    }
+
+    void push_material_index(std::shared_ptr<ev::CommandBuffer> command_buffer,
+        std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+        uint32_t material_index
+    );
+
+    static constexpr uint32_t NO_MESH_SET = 0xFFFFFFFFu;
+
+    /**
+     * @brief draw, draw_instanced, draw_meshlets 가 메시마다 메시 uniform 디스크립터 셋(Mesh::Uniform)을 바인딩할 셋 번호를 설정합니다.
+     * @details VertexEncoding::Quantized 레이아웃은 셰이더가 이 셋의 position_offset / position_scale 로 위치를 복원해야 합니다.
+     * 기본값 NO_MESH_SET 이면 바인딩하지 않습니다.
+     */
+    void set_mesh_set_index(uint32_t set_index) {
+        mesh_set_index = set_index;
+    }
+
+    uint32_t get_mesh_set_index() const {
+        return mesh_set_index;
+    }
+
+    /**
+     * @brief 모든 메시의 Mesh::Uniform 을 uniform 버퍼에 기록합니다. update_transforms 는 행렬이 바뀌면 자동으로 호출합니다.
+     */
+    void upload_mesh_uniforms();
+
+    /**
+     * @brief 이후 draw 에서 사용할 LOD 선택 / 컬링 기준을 설정합니다. 같은 모델을 여러 번 그릴 때는 draw 전마다 설정합니다.
+     */
+    void set_draw_view(const DrawView& view) {
+        draw_view = view;
+    }
+
+    const DrawView& get_draw_view() const {
+        return draw_view;
+    }
+
+    void set_meshlets(std::vector<MeshletData> meshlets,
+        std::vector<uint32_t> meshlet_vertices,
+        std::vector<uint8_t> meshlet_triangles
+    ) {
+        this->meshlets = std::move(meshlets);
+        this->meshlet_vertices = std::move(meshlet_vertices);
+        this->meshlet_triangles = std::move(meshlet_triangles);
+    }
+
+    const std::vector<MeshletData>& get_meshlets() const {
+        return meshlets;
+    }
+
+    const std::vector<uint32_t>& get_meshlet_vertices() const {
+        return meshlet_vertices;
+    }
+
+    const std::vector<uint8_t>& get_meshlet_triangles() const {
+        return meshlet_triangles;
+    }
+
+    void set_meshlet_buffers(std::shared_ptr<ev::Buffer> meshlets,
+        std::shared_ptr<ev::Buffer> vertices,
+        std::shared_ptr<ev::Buffer> triangles
+    ) {
+        meshlet_buffer = std::move(meshlets);
+        meshlet_vertex_buffer = std::move(vertices);
+        meshlet_triangle_buffer = std::move(triangles);
+    }
+
+    /**
+     * @brief MeshletData[] storage buffer
+     */
+    const std::shared_ptr<ev::Buffer> get_meshlet_buffer() const {
+        return meshlet_buffer;
+    }
+
+    /**
+     * @brief uint[] storage buffer. 프리미티브 로컬 정점 인덱스
+     */
+    const std::shared_ptr<ev::Buffer> get_meshlet_vertex_buffer() const {
+        return meshlet_vertex_buffer;
+    }
+
+    /**
+     * @brief uint8 x 3 삼각형을 uint[] 로 묶은 storage buffer
+     */
+    const std::shared_ptr<ev::Buffer> get_meshlet_triangle_buffer() const {
+        return meshlet_triangle_buffer;
+    }
+
+    void set_index_type(VkIndexType type) {
+        index_type = type;
+    }
 };
 
 
@@ -784,6 +1666,24 @@ enum DescriptorBindingFlags {
     ImageNormalMap = 0x02
 };
 
+/**
+ * @brief 로드 후 적용할 메시 최적화 단계
+ */
+enum MeshOptimizeFlags : uint32_t {
+    OptimizeNone = 0x00,
+    DeduplicateVertices = 0x01,     // 바이트 단위로 같은 정점 병합
+    OptimizeVertexCache = 0x02,     // post-transform 캐시 기준 삼각형 재정렬 (Tipsify)
+    OptimizeVertexFetch = 0x04,     // 처음 참조되는 순서로 정점 재배치, 사용되지 않는 정점 제거
+    CompactIndices = 0x08,          // 모든 프리미티브가 65536 개 미만 정점이면 16bit 인덱스 사용
+    OptimizeAll = 0x0F
+};
+
+/**
+ * @brief 정규화한 경로와 수정 시간으로 로드한 Model 을 공유하는 캐시
+ * @details ModelInstance 가 참조하는 동안은 유지되며, 참조가 없는 모델은 Model::get_resource_bytes 합이 budget 을 넘을 때 오래된 순서로 해제됩니다.
+ */
+using ModelAssetCache = ev::tools::ResourceCache<Model>;
+
 /**
  * @brief GLTFModelManager GLTF 모델을 반환하는 객체입니다.
  */
@@ -801,29 +1701,358 @@ private:
 
     std::shared_ptr<ev::Queue> transfer_queue = nullptr;
 
-    std::filesystem::path resource_path;
+    /** 모델 캐시 경로와 save_model 이 쓰는 스테이징 버퍼. load_mutex 가 보호 */
+    std::shared_ptr<ev::tools::StagingBuffer> staging_buffer = nullptr;
+
+    /** 업로드가 끝난 DecodedModel 의 스테이징 버퍼. 다음 디코딩이 다시 사용하며 MAX_SPARE_STAGING 개까지 큰 순서로 보관 */
+    std::vector<std::shared_ptr<ev::tools::StagingBuffer>> spare_staging;
+
+    static constexpr size_t MAX_SPARE_STAGING = 4;
+
+    /** 이미지 픽셀용 스테이징 버퍼의 최소 크기. 이미지는 파싱 중에 하나씩 디코딩되므로 크기를 미리 알 수 없음 */
+    static constexpr VkDeviceSize IMAGE_STAGING_SIZE = 16 * 1024 * 1024;
+
+    std::mutex staging_mutex;
+
+    /**
+     * @brief 모델 하나를 로드하는 동안 사용하는 설정
+     * @details 설정 함수는 load_settings 를 바꾸고, 로드는 시작할 때 복사한 값만 읽습니다.
+     * 따라서 로더 스레드가 디코딩하는 중에 소유 스레드에서 설정을 바꿔도 진행 중인 로드에는 영향이 없습니다.
+     */
+    struct LoadSettings {
+        VertexLayout vertex_layout;
+        uint32_t mesh_optimize_flags = MeshOptimizeFlags::OptimizeAll;
+        bool premultiply_alpha = false;
+        uint32_t lod_levels = 1;
+        float lod_reduction = 0.5f;
+        bool meshlets_enabled = false;
+        std::shared_ptr<ev::tools::PixelUnpacker> pixel_unpacker = nullptr;
+        /** 설정되면 원본 이미지 바이트가 같은 텍스처를 모델 간에 공유 */
+        std::shared_ptr<ev::tools::TextureCache> texture_cache = nullptr;
+        std::shared_ptr<GeometryHeap> geometry_heap = nullptr;
+        std::filesystem::path cache_directory;
+    };
+
+    /** 설정 함수가 바꾸는 현재 설정. 소유 스레드에서만 접근 */
+    LoadSettings load_settings;
+
+    /**
+     * @brief 프리미티브 하나의 정점/인덱스 변환 작업
+     * @details load_nodes 단계에서 출력 위치(prefix sum)만 정해 두고, 실제 변환은 convert_geometry 에서 병렬로 수행합니다.
+     */
+    struct PrimitiveTask {
+        const tinygltf::Primitive* primitive = nullptr;
+        Mesh* mesh = nullptr;
+        Primitive* target = nullptr;
+        uint32_t vertex_start = 0;
+        uint32_t index_start = 0;
+        uint32_t vertex_count = 0;
+        uint32_t index_count = 0;
+        /** optimize_geometry 결과. GeometryStream::optimized 일 때만 채워짐. indices 는 LOD 0 뒤에 LOD 구간이 이어짐 */
+        std::vector<Vertex> vertices;
+        std::vector<uint32_t> indices;
+        /** first_index 는 index_start 기준 */
+        std::vector<Primitive::Lod> lods;
+        /** generate_meshlets 결과. 오프셋은 이 프리미티브 기준 */
+        std::vector<MeshletData> meshlets;
+        std::vector<uint32_t> meshlet_vertices;
+        std::vector<uint8_t> meshlet_triangles;
+    };
+
+    /**
+     * @brief load_nodes 가 수집한 변환 작업과 모델 전체 정점/인덱스 수
+     */
+    struct GeometryStream {
+        std::vector<PrimitiveTask> tasks;
+        uint32_t vertex_count = 0;
+        uint32_t index_count = 0;
+        VkIndexType index_type = VK_INDEX_TYPE_UINT32;
+        bool optimized = false;
+    };
 
     DescriptorBindingFlags descriptor_binding_flags = DescriptorBindingFlags::ImageBaseColor;
 
-    std::shared_ptr<ev::Texture> load_texture(tinygltf::Image& image, std::string& file_path);
+    /** 설정되면 머티리얼마다 디스크립터 셋을 만들지 않고 여기에 등록 */
+    std::shared_ptr<BindlessMaterials> bindless_materials = nullptr;
+
+    std::shared_ptr<ModelAssetCache> model_asset_cache = nullptr;
+
+    /**
+     * @brief 로드 중인 glTF 의 버퍼별 데이터
+     * @details tinygltf::Buffer::data 나 매핑된 .glb 의 BIN 청크를 가리키며, accessor 는 모두 여기서 읽습니다. decode_model 동안만 유효하며 decode_mutex 가 보호합니다.
+     */
+    std::vector<std::span<const uint8_t>> buffer_data;
+
+    /**
+     * @brief 메모리 매핑한 .glb 파일과 tinygltf 에 넘길 JSON
+     * @details BIN 청크를 가리키는 버퍼와 이미지는 1 바이트 data URI 로 바꿔 tinygltf 가 BIN 청크를 복사하지 않게 하고,
+     * 실제 데이터는 매핑된 파일에서 바로 읽습니다. 정점/인덱스는 페이지 캐시에서 스테이징 버퍼로 한 번만 복사됩니다.
+     */
+    struct GLBSource {
+        std::unique_ptr<ev::tools::MappedFile> file;
+        std::string json;
+        /** 버퍼별 BIN 청크 구간. BIN 청크가 아닌 버퍼는 비어 있음 */
+        std::vector<std::span<const uint8_t>> buffers;
+        /** 이미지별 BIN 청크 구간. 비어 있으면 tinygltf 가 읽은 이미지 */
+        struct Image {
+            std::span<const uint8_t> data;
+            std::string mime_type;
+            int buffer_view = -1;
+        };
+        std::vector<Image> images;
+    };
+
+    /**
+     * @brief .glb 를 매핑하고 JSON 청크만 파싱해 GLBSource 를 채웁니다.
+     * @return 파일이 없거나 glb 형식이 잘못되었으면 false
+     */
+    bool open_glb(const std::string& file_path, GLBSource& source) const;
+
+    /** decode_model 의 buffer_data 를 보호하므로 디코딩은 한 번에 하나씩 수행 */
+    std::mutex decode_mutex;
+
+    /** GPU 단계(upload_model, finish_upload, 모델 캐시, save_model)가 쓰는 staging_buffer, command_pool, descriptor_pool 을 보호 */
+    std::mutex load_mutex;
+
+    /**
+     * @brief load_model_async 요청
+     */
+    struct LoadRequest {
+        std::string file_path;
+        /** load_model_async 를 호출할 때의 load_settings */
+        LoadSettings settings;
+        std::promise<std::shared_ptr<Model>> promise;
+    };
+
+    /** 첫 load_model_async 호출 때 시작하는 로더 스레드 */
+    std::thread loader_thread;
+
+    std::mutex loader_mutex;
+
+    std::condition_variable loader_condition;
+
+    std::deque<LoadRequest> load_requests;
+
+    bool loader_stopping = false;
+
+    /**
+     * @brief 요청이 들어오는 대로 decode_model 을 실행하고 결과를 decoded_loads 에 넘깁니다. 실패하면 promise 를 nullptr 로 완료합니다.
+     * @details 로더 스레드는 전용 WorkerPool 을 사용합니다. 공용 풀은 한 번에 하나의 parallel_for 만 받으므로, 공유하면 디코딩하는 동안
+     * 렌더 스레드의 컬링과 커맨드 기록이 호출한 스레드에서만 실행됩니다.
+     */
+    void run_loader();
+
+    /**
+     * @brief glTF 파싱 중 이미지 로더가 계산한 이미지별 캐시 키와 캐시 적중 결과
+     * @details 적중한 이미지는 디코딩하지 않으므로 load_textures 까지 hits 가 텍스처를 붙잡아 해제를 막습니다.
+     */
+    struct CachedImages {
+        std::vector<ev::tools::ResourceKey> keys;
+        std::vector<bool> hashed;
+        std::vector<std::shared_ptr<ev::Texture>> hits;
+        std::vector<std::vector<uint8_t>> embedded;     // 모델 캐시에 기록할 uri 없는 이미지의 인코딩된 바이트
+    };
+
+    /**
+     * @brief decode_image 가 디코딩한 이미지 하나의 픽셀
+     */
+    struct StagedImage {
+        /** RGBA8 픽셀이 기록된 스테이징 버퍼와 영역 */
+        std::shared_ptr<ev::tools::StagingBuffer> staging;
+        ev::tools::StagingBuffer::Allocation pixels;
+        /** pixel_unpacker 로 GPU 에서 확장할 stb 디코딩 결과 (원본 채널, 8/16bit) */
+        std::shared_ptr<void> packed;
+
+        bool empty() const {
+            return !pixels && !packed;
+        }
+    };
+
+    /**
+     * @brief CPU 단계(decode_model)의 결과. GPU 단계(upload_model)가 끝날 때까지 glTF 데이터와 스테이징 메모리를 유지합니다.
+     * @details 정점/인덱스, meshlet 은 디코딩 중에 전용 스테이징 버퍼에 기록되고 RGBA8 텍스처 픽셀은 이미지 로더가 stb 결과에서 image_staging 으로 바로 기록하므로
+     * 업로드는 복사 명령만 기록합니다.
+     * 모델 캐시에서 복원한 경우에도 같은 방식으로 채워지며, gltf_model 에는 텍스처별 이미지 크기와 원본 경로만 있고 머티리얼 텍스처는 cached_materials 로 연결합니다.
+     */
+    struct DecodedModel {
+        std::string file_path;
+        /** 이 로드의 설정. decode_model 부터 finish_upload 까지 같은 값을 사용 */
+        LoadSettings settings;
+        std::filesystem::path resource_path;
+        /** 모델 캐시(.evmc)에서 복원했으면 그 경로 */
+        std::filesystem::path cached_model_path;
+        /** 모델 캐시의 머티리얼 레코드. 업로드한 텍스처를 머티리얼에 연결할 때 사용 */
+        std::vector<cache::MaterialRecord> cached_materials;
+        tinygltf::Model gltf_model;
+        GLBSource glb;
+        CachedImages cached_images;
+        std::shared_ptr<Model> model;
+        /** 새로 기록할 모델 캐시 경로. 비어 있으면 기록하지 않음 */
+        std::filesystem::path cache_path;
+        uint64_t source_hash = 0;
+        std::shared_ptr<ev::tools::StagingBuffer> staging;
+        ev::tools::StagingBuffer::Allocation vertices;
+        ev::tools::StagingBuffer::Allocation indices;
+        /** glTF 이미지별 픽셀. 텍스처 캐시 적중 이미지는 비어 있음 */
+        std::vector<StagedImage> images;
+        /** images 가 가리키는 스테이징 버퍼. 가득 차면 새 버퍼를 추가 */
+        std::vector<std::shared_ptr<ev::tools::StagingBuffer>> image_staging;
+        /** 텍스처 인덱스별 glTF 이미지 인덱스. upload_model 이 채움 */
+        std::vector<uint32_t> texture_images;
+    };
+
+    /**
+     * @brief upload_model 이 제출한 업로드
+     */
+    struct PendingUpload {
+        std::shared_ptr<ev::CommandBuffer> command_buffer;
+        std::shared_ptr<ev::Fence> fence;
+        /** 업로드가 끝난 뒤 texture_cache 에 등록할 텍스처. 복사가 끝나기 전에 다른 모델이 공유하지 않도록 늦게 등록 */
+        std::vector<std::pair<ev::tools::ResourceKey, std::shared_ptr<ev::Texture>>> new_textures;
+    };
+
+    /**
+     * @brief 디코딩이 끝났거나 업로드 중인 비동기 로드
+     */
+    struct AsyncLoad {
+        std::unique_ptr<DecodedModel> decoded;
+        PendingUpload upload;
+        std::promise<std::shared_ptr<Model>> promise;
+    };
+
+    /** 로더 스레드가 디코딩을 끝내고 update_async_loads 를 기다리는 로드. loader_mutex 가 보호 */
+    std::deque<AsyncLoad> decoded_loads;
+
+    /** 업로드 fence 를 기다리는 로드. load_mutex 가 보호 */
+    std::deque<AsyncLoad> uploading_loads;
+
+    /**
+     * @brief 파일을 읽고 glTF 파싱, 이미지 디코딩, 노드/애니메이션/스킨 구성, 메시 최적화, 정점 변환을 수행합니다.
+     * 유효한 모델 캐시가 있으면 decode_cached_model 로 복원하고, 캐시가 오래되었거나 손상되었으면 원본을 디코딩합니다.
+     * @details GPU 리소스를 만들거나 공유 객체(memory_allocator, descriptor_pool, command_pool, GeometryHeap, BindlessMaterials)를 사용하지 않으므로 어느 스레드에서나 호출할 수 있습니다.
+     * @param settings 로드 설정. decoded.settings 로 복사되어 이후 단계도 같은 값을 사용합니다.
+     * @param pool 메시 최적화와 정점 변환에 사용할 작업 풀
+     * @return 파일이 없거나 형식이 잘못되었거나 스테이징 메모리를 확보하지 못하면 false
+     */
+    bool decode_model(
+        const std::string& file_path,
+        const LoadSettings& settings,
+        ev::tools::WorkerPool& pool,
+        DecodedModel& decoded
+    );
+
+    /**
+     * @brief 텍스처, 정점/인덱스, meshlet 버퍼를 만들고 모든 복사를 하나의 커맨드 버퍼로 기록해 fence 와 함께 제출합니다.
+     * @details load_mutex 를 잡은 상태에서 호출합니다.
+     * @return 리소스 할당이나 제출에 실패하면 false
+     */
+    bool upload_model(DecodedModel& decoded, PendingUpload& upload);
+
+    /**
+     * @brief 업로드 fence 가 신호된 뒤 텍스처 캐시 등록과 디스크립터 셋 준비를 마치고 모델을 반환합니다. load_mutex 를 잡은 상태에서 호출합니다.
+     * @return 디스크립터 셋 레이아웃을 만들지 못하면 nullptr
+     */
+    std::shared_ptr<Model> finish_upload(DecodedModel& decoded, PendingUpload& upload);
+
+    /**
+     * @brief spare_staging 에서 capacity 를 담을 수 있는 가장 작은 버퍼를 가져와 비웁니다. 없으면 가장 큰 버퍼를 늘리거나 새로 만듭니다.
+     * @return 메모리를 확보하지 못하면 nullptr
+     */
+    std::shared_ptr<ev::tools::StagingBuffer> acquire_staging(VkDeviceSize capacity);
+
+    /**
+     * @brief 업로드가 끝난 스테이징 버퍼를 다음 디코딩을 위해 보관합니다. MAX_SPARE_STAGING 개를 넘으면 가장 작은 버퍼를 버립니다.
+     */
+    void recycle_staging(std::shared_ptr<ev::tools::StagingBuffer> staging);
+
+    /**
+     * @brief decoded 의 정점/인덱스 스테이징과 이미지 스테이징을 모두 recycle_staging 으로 돌려줍니다.
+     */
+    void recycle_staging(DecodedModel& decoded);
+
+    /**
+     * @brief image_staging 의 마지막 버퍼에서 size 만큼 할당합니다. 남은 공간이 부족하면 acquire_staging 으로 버퍼를 추가합니다.
+     */
+    bool allocate_image_staging(
+        std::vector<std::shared_ptr<ev::tools::StagingBuffer>>& image_staging,
+        VkDeviceSize size,
+        StagedImage& staged
+    );
+
+    /**
+     * @brief 인코딩된 이미지를 stb 로 디코딩하여 RGBA8 픽셀을 스테이징 메모리에 바로 기록합니다. (TextureLoader 와 같은 방식)
+     * @details stb 결과에서 스테이징으로 RGB 확장과 premultiply_alpha 를 적용하며 한 번만 복사하고, image 에는 크기와 채널 수, 비트 깊이만 기록합니다.
+     * pixel_unpacker 가 있으면 RGBA8 이 아닌 이미지는 원본 채널 그대로 staged.packed 에 보관해 GPU 에서 확장합니다.
+     * @return 디코딩하지 못하거나 스테이징 메모리를 확보하지 못하면 false
+     */
+    bool decode_image(
+        const LoadSettings& settings,
+        const uint8_t* bytes,
+        size_t size,
+        tinygltf::Image& image,
+        StagedImage& staged,
+        std::vector<std::shared_ptr<ev::tools::StagingBuffer>>& image_staging
+    );
+
+    /**
+     * @brief 원본 이미지 바이트와 텍스처 로드 설정(포맷, 채널 보존, premultiply, 샘플러)으로 캐시 키를 만듭니다.
+     */
+    ev::tools::ResourceKey make_texture_key(const LoadSettings& settings, const void* source, size_t size) const;
+
+    /**
+     * @brief 파일 경로와 이 관리자의 모델 로드 설정으로 model_asset_cache 키를 만듭니다.
+     * @return 파일이 없으면 false
+     */
+    bool make_model_key(const std::string& file_path, ev::tools::ResourceKey& key) const;
 
-    void load_textures(tinygltf::Model& gltf_model, std::shared_ptr<Model> model);
+    /**
+     * @brief 텍스처 이미지와 뷰, 샘플러를 만들고 업로드와 mip 생성 명령을 command_buffer 에 기록합니다.
+     * @param image decode_image 가 기록한 크기와 채널 수
+     * @param staged RGBA8 픽셀이 기록된 스테이징 영역. 패킹된 픽셀이면 pixel_unpacker 로 GPU 에서 확장합니다.
+     * @return 실패하면 nullptr
+     */
+    std::shared_ptr<ev::Texture> record_texture(
+        const LoadSettings& settings,
+        const tinygltf::Image& image,
+        const std::string& file_path,
+        const StagedImage& staged,
+        std::shared_ptr<ev::CommandBuffer> command_buffer
+    );
 
+    /**
+     * @brief 디코딩한 이미지를 텍스처로 만들고 업로드를 command_buffer 에 기록합니다.
+     * @param image_indices 텍스처 인덱스별 glTF 이미지 인덱스
+     * @return 텍스처를 만들지 못하면 false
+     */
+    bool load_textures(DecodedModel& decoded, PendingUpload& upload, std::vector<uint32_t>& image_indices);
+
+    /**
+     * @brief 머티리얼 factor 와 alpha 설정을 읽습니다. 텍스처는 업로드 후 bind_material_textures 로 연결합니다.
+     */
     void load_materials(tinygltf::Model& gltf_model, std::shared_ptr<Model> model);
 
+    /**
+     * @brief load_materials 로 만든 머티리얼에 load_textures 로 만든 텍스처를 연결합니다.
+     */
+    void bind_material_textures(tinygltf::Model& gltf_model, std::shared_ptr<Model> model);
+
+    /**
+     * @brief 재사용하는 스테이징 버퍼를 비우고 최소 capacity 만큼 확보합니다. 이전 할당은 모두 무효가 됩니다.
+     * @return 메모리를 확보하지 못하면 false
+     */
+    bool reset_staging(VkDeviceSize capacity);
+
     void load_node_meshes(
         tinygltf::Model& gltf_model,
         std::shared_ptr<ev::tools::gltf::Model> model,
         tinygltf::Node& node,
         std::shared_ptr<Node> new_node,
-        std::vector<Vertex> &h_vertices,
-        std::vector<uint32_t> &h_indices
+        GeometryStream& geometry
     );
 
     void load_nodes(tinygltf::Model& gltf_model, 
         std::shared_ptr<Model> model,
-        std::vector<Vertex> &h_vertices,
-        std::vector<uint32_t> &h_indices,
+        GeometryStream& geometry,
         float scale_factor = 1.0f
     );
 
@@ -838,35 +2067,96 @@ private:
         std::shared_ptr<Model> model,
         tinygltf::Node& node,
         uint32_t node_idx,
-        std::vector<Vertex> &h_vertices,
-        std::vector<uint32_t> &h_indices,
+        GeometryStream& geometry,
         float scale_factor = 1.0f
     );
 
+    /**
+     * @brief 프리미티브의 accessor 를 Vertex 로 변환하여 dst 에 기록합니다. 읽기 전용이므로 여러 스레드에서 호출할 수 있습니다.
+     * @details 성분 타입, normalized, byteStride 를 따르므로 KHR_mesh_quantization 이나 interleave 된 정점도 읽을 수 있습니다.
+     * @param skip_mask 읽지 않을 속성 (1u << VertexType). copy_mesh_attributes 로 이미 기록한 속성
+     */
     void add_mesh_vertices(
-        tinygltf::Model& gltf_model,
-        tinygltf::Mesh& mesh,
+        const tinygltf::Model& gltf_model,
         const tinygltf::Primitive& primitive,
-        std::vector<Vertex> &h_vertices,
-        glm::vec3 &min_pos,
-        glm::vec3 &max_pos,
-        uint32_t& vertex_start,
-        uint32_t& vertex_count
+        Vertex* dst,
+        uint32_t skip_mask = 0
     );
 
+    /**
+     * @brief accessor 데이터 포맷이 vertex_layout 의 속성 포맷과 같으면 float 로 변환하지 않고 스트림에 그대로 복사합니다.
+     * @details 예: Quantized 레이아웃의 UNSIGNED_BYTE 색상, 관절, 가중치. 메시 bounds 나 octahedral 로 변환하는 속성은 제외합니다.
+     * @param dst 프리미티브 첫 정점의 스트림별 출력 위치
+     * @return 복사한 속성 마스크 (1u << VertexType)
+     */
+    uint32_t copy_mesh_attributes(
+        const VertexLayout& vertex_layout,
+        const tinygltf::Model& gltf_model,
+        const tinygltf::Primitive& primitive,
+        uint8_t* const* dst
+    );
+
+    /**
+     * @brief 프리미티브의 인덱스를 프리미티브 로컬 인덱스로 dst 에 기록합니다. 여러 스레드에서 호출할 수 있습니다.
+     */
     void add_mesh_indices(
-        tinygltf::Model& gltf_model,
-        std::shared_ptr<ev::tools::gltf::Model> model,
-        tinygltf::Mesh& mesh,
-        std::shared_ptr<ev::tools::gltf::Mesh> new_mesh,
+        const tinygltf::Model& gltf_model,
         const tinygltf::Primitive& primitive,
-        std::vector<uint32_t> &h_indices,
-        uint32_t& vertex_start,
-        uint32_t& vertex_count,
-        uint32_t& index_start,
-        uint32_t& index_count,
-        glm::vec3 &min_pos,
-        glm::vec3 &max_pos
+        uint32_t* dst
+    );
+
+    /**
+     * @brief 프리미티브의 정점/인덱스를 task.vertices / task.indices 로 읽어옵니다. 여러 스레드에서 호출할 수 있습니다.
+     */
+    void read_primitive(
+        const tinygltf::Model& gltf_model,
+        PrimitiveTask& task
+    );
+
+    /**
+     * @brief mesh_optimize_flags 에 따라 프리미티브별 최적화를 병렬로 수행하고 출력 위치와 인덱스 타입을 다시 정합니다.
+     * @details 정점 중복 제거와 재배치는 프리미티브 안에서만 일어나므로 다른 프리미티브와 정점을 공유하지 않습니다.
+     */
+    void optimize_geometry(
+        const LoadSettings& settings,
+        ev::tools::WorkerPool& pool,
+        const tinygltf::Model& gltf_model,
+        GeometryStream& geometry
+    );
+
+    /**
+     * @brief lod_levels 가 2 이상이면 프리미티브마다 LOD 인덱스 구간을 만들어 LOD 0 뒤에 붙이고 인덱스 출력 위치를 다시 정합니다.
+     */
+    void generate_lods(
+        const LoadSettings& settings,
+        ev::tools::WorkerPool& pool,
+        const tinygltf::Model& gltf_model,
+        GeometryStream& geometry
+    );
+
+    /**
+     * @brief meshlets_enabled 이면 프리미티브마다 LOD 0 을 meshlet 으로 나누고 bounds 를 계산하여 모델에 설정합니다.
+     * @details 인덱스 순서를 바꾸지 않으므로 generate_lods 뒤, 인덱스 출력 위치가 확정된 다음 호출합니다.
+     */
+    void generate_meshlets(
+        const LoadSettings& settings,
+        ev::tools::WorkerPool& pool,
+        const tinygltf::Model& gltf_model,
+        GeometryStream& geometry,
+        std::shared_ptr<Model> model
+    );
+
+    /**
+     * @brief load_nodes 가 수집한 모든 프리미티브를 프리미티브 단위로 병렬 변환하여 미리 할당된 배열에 기록합니다.
+     * @param indices geometry.index_type 에 맞는 인덱스 배열
+     */
+    void convert_geometry(
+        const LoadSettings& settings,
+        ev::tools::WorkerPool& pool,
+        const tinygltf::Model& gltf_model,
+        const GeometryStream& geometry,
+        uint8_t* vertices,
+        void* indices
     );
 
     void load_skins(tinygltf::Model& gltf_model, std::shared_ptr<Model> model);
@@ -875,30 +2165,108 @@ private:
 
     std::shared_ptr<ev::Texture> get_texture(std::shared_ptr<Model> model, uint32_t idx);
 
-    void setup_vertex_buffer(
-        std::shared_ptr<ev::tools::gltf::Model> model, 
-        std::vector<Vertex> &h_vertices
+    /**
+     * @brief device local 정점/인덱스 버퍼를 만들고 스테이징 영역에서 복사하는 명령을 command_buffer 에 기록합니다.
+     * @return 버퍼 메모리를 할당하지 못하면 false
+     */
+    bool setup_geometry_buffers(
+        const LoadSettings& settings,
+        std::shared_ptr<ev::tools::gltf::Model> model,
+        const std::shared_ptr<ev::tools::StagingBuffer>& staging,
+        const ev::tools::StagingBuffer::Allocation& vertices,
+        const ev::tools::StagingBuffer::Allocation& indices,
+        std::shared_ptr<ev::CommandBuffer> command_buffer
     );
 
-    void setup_index_buffer(
-        std::shared_ptr<ev::tools::gltf::Model> model, 
-        std::vector<uint32_t> &h_indices
+    /**
+     * @brief setup_geometry_buffers 의 GeometryHeap 경로. 힙 구간을 할당해 스트림별 복사를 기록하고 프리미티브 구간을 힙 기준으로 바꿉니다.
+     * @return 힙에 올릴 수 없는 모델이면 false (모델별 버퍼 사용)
+     */
+    bool upload_to_heap(
+        const std::shared_ptr<GeometryHeap>& geometry_heap,
+        std::shared_ptr<ev::tools::gltf::Model> model,
+        const std::shared_ptr<ev::tools::StagingBuffer>& staging,
+        const ev::tools::StagingBuffer::Allocation& vertices,
+        const ev::tools::StagingBuffer::Allocation& indices,
+        std::shared_ptr<ev::CommandBuffer> command_buffer
+    );
+
+    /**
+     * @brief meshlet 레코드, 정점, 삼각형 배열에 필요한 스테이징 크기 (정렬 여유 포함)
+     */
+    static VkDeviceSize get_meshlet_staging_size(const Model& model);
+
+    /**
+     * @brief 모델의 meshlet 배열을 staging 에 복사하고 device local storage buffer 로 옮기는 명령을 command_buffer 에 기록합니다.
+     * @return staging 용량이 부족하거나 버퍼 메모리를 할당하지 못하면 false
+     */
+    bool setup_meshlet_buffers(
+        std::shared_ptr<ev::tools::gltf::Model> model,
+        const std::shared_ptr<ev::tools::StagingBuffer>& staging,
+        std::shared_ptr<ev::CommandBuffer> command_buffer
     );
 
-    void prepare_material_descriptor_sets(
+    /**
+     * @return 디스크립터 셋 레이아웃을 만들지 못하면 false
+     */
+    bool prepare_material_descriptor_sets(
         std::shared_ptr<ev::tools::gltf::Model> model
     );
 
-    void prepare_node_descriptor_set(
+    bool prepare_node_descriptor_set(
         std::shared_ptr<ev::tools::gltf::Model> model, 
         std::shared_ptr<Node> node, 
         std::shared_ptr<DescriptorSetLayout> layout
     );
 
-    void prepare_node_descriptor_sets(
+    /**
+     * @brief 메시마다 uniform 버퍼와 디스크립터 셋을 만들고 uniform 을 기록합니다.
+     * @return 레이아웃이나 uniform 버퍼를 만들지 못하면 false
+     */
+    bool prepare_node_descriptor_sets(
         std::shared_ptr<ev::tools::gltf::Model> model
     );
 
+    /**
+     * @brief 모델 캐시 파일을 검증하고 decoded 를 채웁니다. decode_model 의 모델 캐시 경로이며 GPU 리소스를 만들지 않습니다.
+     * @details 파싱과 정점 변환 없이 mmap 한 레코드에서 노드, 메시, 애니메이션, 스킨을 만들고, 텍스처 이미지는 decode_image 로,
+     * 정점/인덱스는 매핑한 파일에서 스테이징 메모리로 한 번만 복사하므로 upload_model 은 복사 명령만 기록합니다.
+     * @param expected_hash 지정되면 캐시의 원본 해시와 의존 파일 해시가 모두 일치해야 합니다.
+     * @return 캐시가 없거나 손상, 버전 불일치, 원본 변경, 디코딩 실패 시 false
+     */
+    bool decode_cached_model(
+        const std::filesystem::path& cache_path,
+        std::optional<uint64_t> expected_hash,
+        DecodedModel& decoded
+    );
+
+    /**
+     * @brief decode_cached_model 이 만든 머티리얼에 load_textures 로 만든 텍스처를 cached_materials 의 인덱스대로 연결합니다.
+     */
+    void bind_cached_material_textures(DecodedModel& decoded);
+
+    /**
+     * @brief 모델 캐시가 버리는 모델의 머티리얼을 bindless_materials 에서 빼도록 evict callback 을 설정합니다.
+     */
+    void connect_model_eviction();
+
+    /**
+     * @brief 모델과 CPU 측 정점/인덱스 데이터를 캐시 파일로 기록합니다.
+     * @param dependencies 캐시 유효성 검사에 포함할 외부 파일 경로
+     * @param texture_images 텍스처 인덱스별 인코딩된 이미지 바이트. 원본 파일 경로가 없는 텍스처(.glb, data URI)만 사용합니다.
+     */
+    bool write_model_cache(
+        std::shared_ptr<Model> model,
+        const std::filesystem::path& cache_path,
+        uint64_t source_hash,
+        const std::vector<std::string>& dependencies,
+        const std::vector<std::span<const uint8_t>>& texture_images,
+        const void* vertices,
+        VkDeviceSize vertex_bytes,
+        const void* indices,
+        VkDeviceSize index_bytes
+    );
+
 public: 
   
     /**
@@ -918,17 +2286,160 @@ public:
         // std::filesystem::path resource_path = std::filesystem::current_path() / "resources"
     );
 
-    ~GLTFModelManager() = default;
+    GLTFModelManager(const GLTFModelManager&) = delete;
+
+    GLTFModelManager& operator=(const GLTFModelManager&) = delete;
+
+    /**
+     * @brief 로더 스레드를 종료합니다. 진행 중인 디코딩과 제출한 업로드는 끝날 때까지 기다리고, 처리되지 않은 요청은 nullptr 로 완료합니다.
+     */
+    ~GLTFModelManager();
 
+    /**
+     * @brief glTF 모델을 로드합니다. 디코딩과 업로드를 호출한 스레드에서 모두 수행합니다.
+     * @details 파일을 읽거나 업로드하지 못하면 프로그램을 종료합니다. 실패를 직접 처리하려면 try_load_model 을 사용합니다.
+     * @param file_path .gltf / .glb 파일 또는 save_model 로 저장한 .evmc 캐시 파일 경로
+     */
     std::shared_ptr<Model> load_model(
         const std::string file_path
     );
 
+    /**
+     * @brief load_model 과 같지만 실패하면 오류를 기록하고 nullptr 를 반환합니다.
+     */
+    std::shared_ptr<Model> try_load_model(
+        const std::string& file_path
+    );
+
+    /**
+     * @brief 로더 스레드에서 모델을 디코딩하고 호출한 스레드는 바로 반환합니다.
+     * @details 파일 읽기, 파싱, 이미지 디코딩, 정점 변환처럼 CPU 만 사용하는 단계는 로더 스레드와 로더 전용 작업 풀에서 수행하므로 렌더 스레드의 parallel_for 와 경쟁하지 않습니다.
+     * GPU 리소스 생성, memory_allocator / descriptor_pool / command_pool 사용, GeometryHeap 과 BindlessMaterials 등록은
+     * 관리자를 소유한 스레드가 update_async_loads 를 호출할 때 수행하므로 이 객체들을 렌더링과 공유해도 됩니다.
+     * future 는 업로드 fence 가 신호된 뒤의 update_async_loads 에서 준비되므로, 렌더 스레드는 매 프레임 update_async_loads 를 호출하고
+     * wait_for(std::chrono::seconds(0)) 으로 확인하여 준비될 때까지 대체 모델을 그리면 됩니다.
+     * 모델 캐시(.evmc, set_cache_directory)에서 복원하는 모델도 검증, 이미지 디코딩, 정점 복사를 로더 스레드에서 마치고 update_async_loads 는 복사 명령만 제출합니다.
+     * 로드 설정(set_vertex_layout, set_texture_cache 등)은 호출 시점의 값을 복사해 사용하므로, 이후 설정을 바꿔도 이미 요청한 로드에는 적용되지 않습니다.
+     * @return 로드한 모델을 받을 future. 로드에 실패했거나 관리자가 먼저 소멸되면 nullptr
+     */
+    std::shared_future<std::shared_ptr<Model>> load_model_async(
+        const std::string& file_path
+    );
+
+    /**
+     * @brief 디코딩이 끝난 비동기 로드를 transfer_queue 에 제출하고, 업로드가 끝난 로드는 디스크립터 셋을 만들어 future 를 완료합니다.
+     * @details 관리자를 소유한 스레드에서 매 프레임 호출합니다. fence 를 기다리지 않고 상태만 확인합니다.
+     * pixel_unpacker 로 확장하는 이미지는 업로드 완료를 기다리므로 이 호출 안에서 끝납니다.
+     * @return 이번 호출에서 완료한 future 수 (실패 포함)
+     */
+    uint32_t update_async_loads();
+
+    /**
+     * @brief 모델을 캐시에서 찾아 노드 변환과 애니메이션 상태만 새로 가지는 인스턴스를 만듭니다.
+     * @details 정규화한 경로와 수정 시간, 로드 설정(정점 레이아웃, 메시 최적화, LOD, meshlet, 지오메트리 힙, 텍스처 설정)이 같으면
+     * 정점/인덱스 버퍼, 머티리얼, 텍스처를 다시 로드하지 않고 공유합니다.
+     * set_model_asset_cache 로 캐시를 설정하지 않았으면 매번 load_model 로 로드합니다.
+     */
+    std::shared_ptr<ModelInstance> load_model_instance(
+        const std::string& file_path
+    );
+
+    /**
+     * @brief load_model_instance 가 사용할 모델 캐시를 설정합니다. 여러 관리자가 같은 캐시를 공유할 수 있습니다.
+     * @details bindless 머티리얼도 설정되어 있으면 캐시가 모델을 버릴 때 BindlessMaterials::remove_model 을 호출하도록 연결합니다.
+     * 캐시의 evict callback 은 하나이므로 캐시를 공유하는 관리자들은 같은 BindlessMaterials 를 사용해야 합니다.
+     */
+    void set_model_asset_cache(std::shared_ptr<ModelAssetCache> cache);
+
     void set_descriptor_binding_flags(DescriptorBindingFlags flags) {
         descriptor_binding_flags = flags;
     }
 
-    // void save_model(std::shared_ptr<Model> model, const std::string save_path);
+    /**
+     * @brief 이후 로드하는 모델의 머티리얼을 materials 에 등록합니다. 머티리얼별 디스크립터 셋은 만들지 않으므로 RenderFlag::BINDLESS 로 그려야 합니다.
+     * @param materials nullptr 이면 머티리얼별 디스크립터 셋 방식으로 돌아갑니다.
+     */
+    void set_bindless_materials(std::shared_ptr<BindlessMaterials> materials);
+
+    /**
+     * @brief 이후 로드하는 모델이 사용할 텍스처 캐시를 설정합니다. 여러 관리자와 모델이 같은 캐시를 공유할 수 있습니다.
+     * @details 캐시에 있는 이미지는 디코딩과 업로드를 생략하고 같은 ev::Texture 를 공유합니다. nullptr 이면 모델마다 로드합니다.
+     */
+    void set_texture_cache(std::shared_ptr<ev::tools::TextureCache> cache) {
+        load_settings.texture_cache = std::move(cache);
+    }
+
+    /**
+     * @brief 이후 로드하는 모델의 정점/인덱스를 heap 에 올립니다. 정점 레이아웃도 heap 의 레이아웃으로 설정합니다.
+     * @details 스킨이나 meshlet 이 있는 모델, 레이아웃이나 인덱스 형식이 다른 캐시 파일, heap 공간이 부족한 경우에는 모델별 버퍼를 사용합니다.
+     * nullptr 이면 모델마다 버퍼를 만듭니다.
+     */
+    void set_geometry_heap(std::shared_ptr<GeometryHeap> heap);
+
+    /**
+     * @brief 텍스처의 GPU 채널 확장 업로드 경로를 설정합니다.
+     * @details 설정되면 이미지의 원본 채널 수를 유지한 채 로드하며, RGBA8 이 아닌 이미지(RGB, grayscale, 16bit)는 GPU 에서 확장됩니다.
+     */
+    void set_pixel_unpacker(std::shared_ptr<ev::tools::PixelUnpacker> unpacker) {
+        load_settings.pixel_unpacker = std::move(unpacker);
+    }
+
+    /**
+     * @brief 이후 로드하는 텍스처의 RGB 에 알파를 미리 곱해 업로드할지 설정합니다. 기본값은 false 입니다.
+     * @details premultiplied alpha 로 블렌딩하는 파이프라인에 사용합니다. 텍스처 캐시 키에 포함되므로 설정이 다른 텍스처는 공유되지 않습니다.
+     */
+    void set_premultiply_alpha(bool enabled) {
+        load_settings.premultiply_alpha = enabled;
+    }
+
+    /**
+     * @brief 이후 로드하는 모델의 정점 버퍼 레이아웃을 설정합니다. 기본값은 Vertex 구조체 전체입니다.
+     */
+    void set_vertex_layout(const VertexLayout& layout) {
+        load_settings.vertex_layout = layout;
+    }
+
+    /**
+     * @brief 이후 로드하는 모델에 적용할 메시 최적화 단계(MeshOptimizeFlags 조합)를 설정합니다. 기본값은 OptimizeAll 입니다.
+     */
+    void set_mesh_optimize_flags(uint32_t flags) {
+        load_settings.mesh_optimize_flags = flags;
+    }
+
+    /**
+     * @brief 이후 로드하는 모델의 프리미티브마다 만들 LOD 수(LOD 0 포함)를 설정합니다. 기본값 1 은 LOD 를 만들지 않습니다.
+     * @param reduction LOD 한 단계마다 남길 삼각형 비율
+     */
+    void set_lod_levels(uint32_t levels, float reduction = 0.5f) {
+        load_settings.lod_levels = std::max(levels, 1u);
+        load_settings.lod_reduction = reduction;
+    }
+
+    /**
+     * @brief 이후 로드하는 모델에 meshlet(최대 64 정점, 124 삼각형)을 만들지 설정합니다. 기본값은 false 입니다.
+     * @details Model::draw_meshlets / draw_mesh_tasks 에 필요합니다. 정점 버퍼에 storage buffer 용도가 추가됩니다.
+     */
+    void set_meshlets_enabled(bool enabled) {
+        load_settings.meshlets_enabled = enabled;
+    }
+
+    /**
+     * @brief 바이너리 모델 캐시를 저장할 디렉토리를 설정합니다.
+     * @details 설정되면 load_model 은 원본 파일의 hash64 로 캐시(<stem>-<hash>.evmc)를 찾아,
+     * 있으면 JSON 파싱과 정점 변환 없이 로드하고 없으면 원본을 로드한 뒤 캐시를 생성합니다.
+     * 빈 경로를 넘기면 캐시를 사용하지 않습니다.
+     */
+    void set_cache_directory(const std::filesystem::path& directory) {
+        load_settings.cache_directory = directory;
+    }
+
+    /**
+     * @brief 모델을 바이너리 캐시 포맷으로 저장합니다.
+     * @details 정점/인덱스 버퍼는 GPU 에서 읽어옵니다. 저장한 파일(.evmc)은 load_model 로 바로 로드할 수 있습니다.
+     * 원본 해시가 없으므로 자동 캐시 검사에는 사용되지 않습니다.
+     * @return 파일 저장에 실패하거나 파일에서 읽은 텍스처가 아닌 텍스처가 있으면 false
+     */
+    bool save_model(std::shared_ptr<Model> model, const std::string save_path);
 };
 
 }
\ No newline at end of file
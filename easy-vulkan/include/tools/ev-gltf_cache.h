@@ -0,0 +1,206 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief GLTFModelManager 의 바이너리 모델 캐시 포맷 (*.evmc)
+ * @details 파일 전체를 mmap 하여 각 섹션을 레코드 배열로 바로 참조할 수 있도록 모든 레코드는 POD 이며,
+ * 섹션은 SECTION_ALIGNMENT 단위로 정렬됩니다. 정점/인덱스 섹션은 GPU 버퍼와 같은 레이아웃이므로
+ * 스테이징 메모리로 한 번 복사하면 업로드됩니다. 노드, 스킨, 애니메이션은 레코드 인덱스로 서로를 참조하며,
+ * 인덱스 목록(루트, 선형 노드, 자식, 조인트, 애니메이션 목록)은 REFS 섹션의 구간으로 저장합니다.
+ * 레이아웃이 바뀌면 VERSION 을 올려야 합니다. 버전이 다른 캐시는 무시되고 원본에서 다시 생성됩니다.
+ */
+namespace ev::tools::gltf::cache {
+
+constexpr uint32_t MAGIC = 0x434D5645; // "EVMC"
+
+constexpr uint32_t VERSION = 8;
+
+constexpr uint64_t SECTION_ALIGNMENT = 16;
+
+constexpr int32_t NONE = -1;
+
+enum Section : uint32_t {
+    VERTICES,       // VertexLayout 으로 인코딩된 정점 스트림들
+    INDICES,        // uint16_t[] 또는 uint32_t[] (Header::index_type), 프리미티브 로컬 인덱스
+    STRINGS,        // char[], StringRef 가 참조
+    REFS,           // uint32_t[], 레코드 인덱스 목록
+    DEPENDENCIES,   // DependencyRecord[]
+    TEXTURES,       // TextureRecord[]
+    MATERIALS,      // MaterialRecord[]
+    MESHES,         // MeshRecord[]
+    PRIMITIVES,     // PrimitiveRecord[]
+    NODES,          // NodeRecord[]
+    SKINS,          // SkinRecord[]
+    MATRICES,       // float[16][], inverse bind matrix
+    ANIMATIONS,     // AnimationRecord[]
+    SAMPLERS,       // SamplerRecord[]
+    FLOATS,         // float[], sampler 입력 시간
+    VEC4S,          // float[4][], sampler 출력값
+    CHANNELS,       // ChannelRecord[]
+    LODS,           // LodRecord[]
+    MESHLETS,           // MeshletRecord[], GPU meshlet 버퍼와 같은 레이아웃
+    MESHLET_VERTICES,   // uint32_t[], 프리미티브 로컬 정점 인덱스
+    MESHLET_TRIANGLES,  // uint8_t[], meshlet 내부 정점 번호 3 개씩
+    IMAGES,             // uint8_t[], 원본 파일이 없는 텍스처(.glb, data URI)의 인코딩된 이미지
+    SECTION_COUNT
+};
+
+struct SectionEntry {
+    uint64_t offset;
+    uint64_t size;
+};
+
+struct StringRef {
+    uint32_t offset;
+    uint32_t length;
+};
+
+/** @brief REFS 섹션의 구간 */
+struct RefRange {
+    uint32_t first;
+    uint32_t count;
+};
+
+struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t source_hash;       // 원본 .gltf 파일의 hash64, 0 이면 save_model 로 직접 저장한 캐시
+    uint32_t vertex_size;       // VertexLayout::get_stride()
+    uint32_t vertex_layout;     // VertexLayout::get_key()
+    uint32_t vertex_count;      // 스트림별 위치는 VertexLayout::get_stream_offset(stream, vertex_count)
+    uint32_t index_type;        // VkIndexType, VK_INDEX_TYPE_UINT16 또는 VK_INDEX_TYPE_UINT32
+    RefRange roots;             // Model::get_nodes()
+    RefRange linear_nodes;      // Model::get_linear_nodes()
+    RefRange animations;        // Model::get_animations(), ANIMATIONS 레코드 인덱스
+    SectionEntry sections[SECTION_COUNT];
+};
+
+/** @brief 캐시 유효성 검사에 쓰는 외부 파일 (.bin 버퍼, 이미지) */
+struct DependencyRecord {
+    StringRef path;
+    uint64_t hash;
+};
+
+/** @brief source 가 비어 있으면 IMAGES 섹션의 [image_offset, image_offset + image_size) 에서 디코딩 */
+struct TextureRecord {
+    StringRef source;
+    uint64_t image_offset;
+    uint64_t image_size;
+};
+
+struct MaterialRecord {
+    enum TextureSlot : uint32_t {
+        BASE_COLOR,
+        METALLIC_ROUGHNESS,
+        NORMAL,
+        OCCLUSION,
+        EMISSIVE,
+        DIFFUSE,
+        SPECULAR,
+        TEXTURE_SLOT_COUNT
+    };
+
+    uint32_t alpha_mode;
+    float alpha_cutoff;
+    float metallic_factor;
+    float roughness_factor;
+    float base_color_factor[4];
+    uint32_t double_sided;
+    int32_t textures[TEXTURE_SLOT_COUNT];   // TEXTURES 레코드 인덱스 또는 NONE
+};
+
+struct PrimitiveRecord {
+    uint32_t first_index;
+    uint32_t index_count;
+    uint32_t first_vertex;
+    uint32_t vertex_count;
+    int32_t material;
+    float min[3];
+    float max[3];
+    uint32_t first_lod;         // LODS 레코드 인덱스
+    uint32_t lod_count;
+    uint32_t first_meshlet;     // MESHLETS 레코드 인덱스
+    uint32_t meshlet_count;
+};
+
+/** @brief Primitive::Lod */
+struct LodRecord {
+    uint32_t first_index;
+    uint32_t index_count;
+    float error;
+};
+
+/** @brief MeshletData */
+struct MeshletRecord {
+    float bounds[4];
+    float cone[4];
+    uint32_t vertex_offset;
+    uint32_t triangle_offset;
+    uint32_t vertex_count;
+    uint32_t triangle_count;
+    uint32_t first_index;
+    uint32_t first_vertex;
+    uint32_t padding[2];
+};
+
+struct MeshRecord {
+    StringRef name;
+    uint32_t first_primitive;
+    uint32_t primitive_count;
+    float matrix[16];
+    float position_offset[3];   // Mesh::Uniform, 양자화 위치 복원용
+    float position_scale[3];
+};
+
+struct NodeRecord {
+    StringRef name;
+    uint32_t index;
+    uint32_t skin_index;
+    int32_t parent;
+    int32_t mesh;
+    int32_t skin;
+    RefRange children;
+    float translation[3];
+    float rotation[4];          // x, y, z, w
+    float scale[3];
+    float matrix[16];
+};
+
+struct SkinRecord {
+    StringRef name;
+    int32_t skeleton_root;
+    RefRange joints;
+    uint32_t first_matrix;
+    uint32_t matrix_count;
+};
+
+struct AnimationRecord {
+    StringRef name;
+    float start;
+    float end;
+    uint32_t first_sampler;
+    uint32_t sampler_count;
+    uint32_t first_channel;
+    uint32_t channel_count;
+};
+
+struct SamplerRecord {
+    uint32_t method;
+    uint32_t first_time;
+    uint32_t time_count;
+    uint32_t first_output;
+    uint32_t output_count;
+};
+
+struct ChannelRecord {
+    uint32_t path_type;
+    int32_t target_node;
+    uint32_t sampler_index;
+};
+
+static_assert(std::is_trivially_copyable_v<Header>);
+static_assert(sizeof(NodeRecord) % 4 == 0 && sizeof(MaterialRecord) % 4 == 0);
+
+}
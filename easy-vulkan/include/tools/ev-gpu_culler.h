@@ -0,0 +1,190 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "ev-device.h"
+#include "ev-buffer.h"
+#include "ev-shader.h"
+#include "ev-pipeline.h"
+#include "ev-descriptor_set.h"
+#include "ev-command_buffer.h"
+#include "ev-sync.h"
+#include "ev-memory_allocator.h"
+#include "ev-logger.h"
+#include "tools/ev-gltf.h"
+
+namespace ev::tools::gltf {
+
+/**
+ * @brief compute shader(shaders/tools/gpu_cull.comp)로 인스턴스 bounding sphere 를 절두체 컬링하고
+ * 남은 인스턴스의 VkDrawIndexedIndirectCommand 와 개수를 GPU 에서 기록합니다.
+ * @details 인스턴스의 변환과 bounds 는 storage buffer 에 상주하며 set_matrix 로 바뀐 구간만 프레임마다 복사하므로,
+ * 정적인 장면에서는 인스턴스 수와 무관하게 CPU 비용이 dispatch 한 번과 indirect draw 한 번입니다.
+ * 모든 인스턴스는 같은 정점/인덱스 버퍼(Model::bind_buffers)를 사용해야 하며, GeometryHeap 에 올라간 모델들은 함께 추가해 indirect draw 하나로 그릴 수 있습니다.
+ * 명령의 firstInstance 는 인스턴스 번호이므로(drawIndirectFirstInstance 기능 필요) 정점 셰이더는 get_instance_buffer 를 gl_InstanceIndex 로 읽어 변환을 얻습니다.
+ * drawIndirectCount 를 지원하지 않는 장치에서는 압축하지 않고 컬링된 슬롯의 instanceCount 를 0 으로 기록하며,
+ * multiDrawIndirect 도 없으면 명령을 하나씩 indirect draw 합니다.
+ */
+class GPUCuller {
+
+public:
+
+    static constexpr uint32_t WORKGROUP_SIZE = 64;
+
+    /** storage buffer 레코드 (std430, 96 bytes) */
+    struct Instance {
+        glm::mat4 matrix;           // 로컬 -> 월드
+        glm::vec4 bounds;           // 로컬 bounding sphere. xyz: 중심, w: 반지름
+        uint32_t first_index;
+        uint32_t index_count;
+        int32_t vertex_offset;
+        uint32_t padding;
+    };
+
+    static_assert(sizeof(Instance) == 96);
+
+    struct PushConstants {
+        glm::vec4 planes[6];        // 월드 공간 절두체 평면
+        uint32_t instance_count;
+        uint32_t compact;           // 1 이면 보이는 인스턴스만 앞쪽에 모아 기록
+        uint32_t padding[2];
+    };
+
+private:
+
+    struct Frame {
+        std::shared_ptr<ev::Buffer> instance_buffer = nullptr;
+        std::shared_ptr<ev::Buffer> command_buffer = nullptr;
+        std::shared_ptr<ev::Buffer> count_buffer = nullptr;
+        std::shared_ptr<ev::DescriptorSet> descriptor_set = nullptr;
+        uint32_t capacity = 0;
+        /** 마지막 cull 에서 검사한 인스턴스 수 (indirect 명령 최대 개수) */
+        uint32_t draw_count = 0;
+        /** 이 프레임 버퍼에 아직 복사하지 않은 인스턴스 구간 [dirty_begin, dirty_end) */
+        uint32_t dirty_begin = 0;
+        uint32_t dirty_end = 0;
+        /** reserve 로 버퍼를 다시 만들 때마다 증가 */
+        uint32_t generation = 0;
+    };
+
+    std::shared_ptr<ev::Device> device;
+
+    std::shared_ptr<ev::MemoryAllocator> memory_allocator;
+
+    std::vector<Instance> instances;
+
+    std::vector<Frame> frames;
+
+    std::shared_ptr<ev::DescriptorSetLayout> descriptor_set_layout = nullptr;
+
+    std::shared_ptr<ev::DescriptorPool> descriptor_pool = nullptr;
+
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout = nullptr;
+
+    std::shared_ptr<ev::ComputePipeline> pipeline = nullptr;
+
+    bool compact = false;
+
+    bool multi_draw = false;
+
+    void setup_pipeline(std::shared_ptr<ev::Shader> shader, uint32_t frame_count);
+
+    void mark_dirty(uint32_t begin, uint32_t end);
+
+    /**
+     * @brief frame 의 버퍼가 현재 인스턴스 수를 담을 수 있도록 다시 만들고 디스크립터 셋을 갱신합니다.
+     * @details 다시 만들면 generation 이 증가하므로 get_instance_buffer 를 바인딩한 쪽은 디스크립터를 다시 기록해야 합니다.
+     */
+    void reserve(Frame& frame);
+
+public:
+
+    /**
+     * @param shader gpu_cull.comp 로 생성한 compute shader
+     * @param frame_count 동시에 진행할 수 있는 프레임 수
+     */
+    explicit GPUCuller(std::shared_ptr<ev::Device> device,
+        std::shared_ptr<ev::MemoryAllocator> memory_allocator,
+        std::shared_ptr<ev::Shader> shader,
+        uint32_t frame_count
+    );
+
+    GPUCuller(const GPUCuller&) = delete;
+
+    GPUCuller& operator=(const GPUCuller&) = delete;
+
+    /**
+     * @return 인스턴스 번호
+     */
+    uint32_t add_instance(const Instance& instance);
+
+    /**
+     * @brief model 의 메시 노드 프리미티브를 인스턴스로 추가합니다. 변환은 model_matrix * 노드 월드 행렬입니다.
+     * @return 추가한 첫 인스턴스 번호. 노드 순서(전위)와 프리미티브 순서대로 이어집니다.
+     */
+    uint32_t add_model(const Model& model,
+        const glm::mat4& model_matrix = glm::mat4(1.0f),
+        uint32_t render_flags = RenderFlag::OPAQUE
+    );
+
+    void set_matrix(uint32_t index, const glm::mat4& matrix);
+
+    void clear();
+
+    /**
+     * @brief 바뀐 인스턴스를 복사하고 컬링 compute 를 기록합니다. render pass 밖에서 호출해야 합니다.
+     * @param view_projection 월드 -> clip 행렬
+     */
+    void cull(std::shared_ptr<ev::CommandBuffer> command_buffer, uint32_t frame_index, const glm::mat4& view_projection);
+
+    /**
+     * @brief cull 결과를 indirect draw 로 그립니다. 정점/인덱스 버퍼와 파이프라인은 미리 바인딩되어 있어야 합니다.
+     * @details 압축하지 않고 multiDrawIndirect 기능도 없으면 인스턴스마다 indirect draw 를 하나씩 기록합니다.
+     */
+    void draw(std::shared_ptr<ev::CommandBuffer> command_buffer, uint32_t frame_index);
+
+    /**
+     * @brief 정점 셰이더가 읽을 인스턴스 storage buffer
+     * @details 인스턴스가 용량보다 많아지면 cull 에서 버퍼를 새로 만들므로, 이 버퍼를 디스크립터 셋에 기록했다면
+     * cull 이후 get_instance_buffer_generation 이 바뀌었을 때 다시 기록해야 합니다.
+     */
+    const std::shared_ptr<ev::Buffer>& get_instance_buffer(uint32_t frame_index) const {
+        return frames[frame_index].instance_buffer;
+    }
+
+    /**
+     * @brief frame_index 의 버퍼를 다시 만든 횟수. 값이 바뀌면 get_instance_buffer 가 다른 버퍼를 반환합니다.
+     */
+    uint32_t get_instance_buffer_generation(uint32_t frame_index) const {
+        return frames[frame_index].generation;
+    }
+
+    /**
+     * @brief 마지막 cull 결과 (VkDrawIndexedIndirectCommand 배열). 압축하면 get_draw_count_buffer 에 기록된 개수만큼 앞쪽만 유효합니다.
+     */
+    const std::shared_ptr<ev::Buffer>& get_command_buffer(uint32_t frame_index) const {
+        return frames[frame_index].command_buffer;
+    }
+
+    const std::shared_ptr<ev::Buffer>& get_draw_count_buffer(uint32_t frame_index) const {
+        return frames[frame_index].count_buffer;
+    }
+
+    uint32_t get_instance_count() const {
+        return static_cast<uint32_t>(instances.size());
+    }
+
+    bool is_compacting() const {
+        return compact;
+    }
+
+    bool is_multi_draw_enabled() const {
+        return multi_draw;
+    }
+
+    void destroy();
+
+    ~GPUCuller();
+};
+
+}
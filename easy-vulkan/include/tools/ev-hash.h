@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+
+namespace ev::tools {
+
+/**
+ * @brief 64bit 비암호화 해시 (XXH64)
+ * @details 캐시 키 용도로 사용합니다. 같은 입력과 seed 에 대해 플랫폼과 관계없이 같은 값을 반환합니다.
+ */
+uint64_t hash64(const void* data, size_t size, uint64_t seed = 0);
+
+/**
+ * @brief 파일 내용을 mmap 하여 hash64 를 계산합니다.
+ * @param hash 계산된 해시값
+ * @return 파일을 열 수 없으면 false
+ */
+bool hash_file(const std::filesystem::path& path, uint64_t& hash, uint64_t seed = 0);
+
+}
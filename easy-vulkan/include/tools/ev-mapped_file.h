@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+#include "ev-logger.h"
+
+namespace ev::tools {
+
+/**
+ * @brief 파일을 읽기 전용으로 메모리에 매핑합니다.
+ * @details POSIX 에서는 mmap, Windows 에서는 MapViewOfFile 을 사용합니다.
+ * 파일 내용을 중간 버퍼로 읽지 않고 페이지 캐시에서 바로 참조하므로, 스테이징 메모리로의 복사 한 번으로 업로드할 수 있습니다.
+ */
+class MappedFile {
+
+private:
+
+    const uint8_t* data = nullptr;
+
+    size_t size = 0;
+
+#if defined(_WIN32)
+    void* file_handle = nullptr;
+
+    void* mapping_handle = nullptr;
+#else
+    int fd = -1;
+#endif
+
+public:
+
+    /**
+     * @brief 생성자
+     * @param path 매핑할 파일 경로
+     * @details 실패하면 is_open() 이 false 를 반환합니다. 빈 파일은 열리지만 get_data() 가 nullptr 입니다.
+     */
+    explicit MappedFile(const std::filesystem::path& path);
+
+    MappedFile(const MappedFile&) = delete;
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool is_open() const {
+#if defined(_WIN32)
+        return file_handle != nullptr;
+#else
+        return fd >= 0;
+#endif
+    }
+
+    const uint8_t* get_data() const {
+        return data;
+    }
+
+    size_t get_size() const {
+        return size;
+    }
+
+    void close();
+
+    ~MappedFile();
+};
+
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief 인덱스 메시 최적화 함수들
+ * @details 모든 함수는 프리미티브 로컬 인덱스(0 ~ vertex_count - 1)의 삼각형 리스트를 대상으로 합니다.
+ * 입력과 출력 버퍼가 같아도 됩니다.
+ */
+
+namespace ev::tools::mesh_optimizer {
+
+/** @brief 사용되지 않는 정점을 나타내는 remap 값 */
+constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+/** @brief post-transform 캐시 시뮬레이션 기본 크기 */
+constexpr uint32_t DEFAULT_CACHE_SIZE = 16;
+
+/** @brief meshlet 하나의 최대 정점 수 / 삼각형 수 (mesh shader 출력 한도에 맞춘 권장값) */
+constexpr uint32_t MAX_MESHLET_VERTICES = 64;
+
+constexpr uint32_t MAX_MESHLET_TRIANGLES = 124;
+
+/**
+ * @brief 인덱스 버퍼를 나눈 삼각형 묶음
+ * @details 삼각형은 인덱스 버퍼 순서를 유지하므로 meshlet 의 삼각형은 원본 인덱스 버퍼에서도
+ * [triangle_offset * 3, (triangle_offset + triangle_count) * 3) 구간에 연속으로 놓입니다.
+ */
+struct Meshlet {
+    uint32_t vertex_offset;     // meshlet_vertices 시작 위치
+    uint32_t triangle_offset;   // 삼각형 단위 시작 위치 (meshlet_triangles 는 * 3 바이트)
+    uint32_t vertex_count;
+    uint32_t triangle_count;
+};
+
+/**
+ * @brief meshlet 의 bounding sphere 와 법선 cone
+ * @details cone_cutoff 는 sin(cone 반각)이며, 삼각형 법선이 반구 이상 퍼져 있으면 1 입니다. (컬링하지 않음)
+ */
+struct MeshletBounds {
+    float center[3];
+    float radius;
+    float cone_axis[3];
+    float cone_cutoff;
+};
+
+/**
+ * @brief 바이트 단위로 같은 정점을 하나로 합치는 remap 테이블을 만듭니다.
+ * @details 처음 등장한 순서대로 새 인덱스를 부여합니다.
+ * @param remap vertex_count 개. remap[old] = new
+ * @return 중복 제거 후 정점 수
+ */
+uint32_t generate_vertex_remap(uint32_t* remap, const void* vertices, size_t vertex_count, size_t vertex_size);
+
+/**
+ * @brief remap 테이블에 따라 정점을 재배치합니다. INVALID_INDEX 인 정점은 버립니다.
+ * @details dst 는 src 와 겹치면 안 됩니다.
+ */
+void remap_vertices(void* dst, const void* src, size_t vertex_count, size_t vertex_size, const uint32_t* remap);
+
+void remap_indices(uint32_t* dst, const uint32_t* indices, size_t index_count, const uint32_t* remap);
+
+/**
+ * @brief post-transform 캐시 적중률이 높아지도록 삼각형 순서를 바꿉니다. (Tipsify, Sander et al. 2007)
+ * @details 삼각형 내부 정점 순서는 유지하므로 winding 이 바뀌지 않습니다. 선형 시간에 동작합니다.
+ */
+void optimize_vertex_cache(uint32_t* dst, const uint32_t* indices, size_t index_count, size_t vertex_count,
+    uint32_t cache_size = DEFAULT_CACHE_SIZE);
+
+/**
+ * @brief 인덱스 버퍼에서 처음 참조되는 순서대로 정점을 배치하는 remap 테이블을 만듭니다.
+ * @details 참조되지 않는 정점은 INVALID_INDEX 가 됩니다.
+ * @return 참조되는 정점 수
+ */
+uint32_t optimize_vertex_fetch_remap(uint32_t* remap, const uint32_t* indices, size_t index_count, size_t vertex_count);
+
+/**
+ * @brief FIFO 캐시 시뮬레이션으로 ACMR(삼각형당 평균 캐시 미스 수)을 계산합니다.
+ * @details 0.5 에 가까울수록 좋고 3.0 이 최악입니다. 삼각형이 없으면 0 입니다.
+ */
+float compute_acmr(const uint32_t* indices, size_t index_count, size_t vertex_count,
+    uint32_t cache_size = DEFAULT_CACHE_SIZE);
+
+/**
+ * @brief quadric error metric 기반 edge collapse 로 삼각형 수를 줄인 인덱스 버퍼를 만듭니다.
+ * @details 정점을 기존 정점 위치로만 합치므로(half-edge collapse) 원본 정점 버퍼를 그대로 공유할 수 있습니다.
+ * 메시 경계와 같은 위치에 정점이 여러 개인 속성 seam 은 고정하여 프리미티브 사이 균열과 UV 깨짐을 막습니다.
+ * 고정된 정점 때문에 target_index_count 에 도달하지 못할 수 있습니다.
+ * @param positions 정점 위치(float3) 배열, position_stride 간격
+ * @param result_error 합쳐진 정점들의 최대 오차 (위치와 같은 단위의 거리)
+ * @return dst 에 기록한 인덱스 수. dst 는 index_count 개를 담을 수 있어야 합니다.
+ */
+size_t simplify(uint32_t* dst, const uint32_t* indices, size_t index_count,
+    const float* positions, size_t vertex_count, size_t position_stride,
+    size_t target_index_count, float* result_error = nullptr);
+
+/**
+ * @brief 인덱스 버퍼를 순서대로 훑으며 정점/삼각형 한도를 넘기 전까지 삼각형을 meshlet 에 담습니다.
+ * @details optimize_vertex_cache 로 정렬된 인덱스 버퍼를 사용하면 정점 공유가 많은 meshlet 이 만들어집니다.
+ * 결과는 각 배열 뒤에 추가됩니다. meshlet_vertices 는 입력 인덱스 값, meshlet_triangles 는 meshlet 내부 정점 번호입니다.
+ * @return 추가된 meshlet 수
+ */
+size_t build_meshlets(std::vector<Meshlet>& meshlets,
+    std::vector<uint32_t>& meshlet_vertices,
+    std::vector<uint8_t>& meshlet_triangles,
+    const uint32_t* indices, size_t index_count, size_t vertex_count,
+    uint32_t max_vertices = MAX_MESHLET_VERTICES,
+    uint32_t max_triangles = MAX_MESHLET_TRIANGLES);
+
+MeshletBounds compute_meshlet_bounds(const Meshlet& meshlet,
+    const uint32_t* meshlet_vertices,
+    const uint8_t* meshlet_triangles,
+    const float* positions, size_t position_stride);
+
+/**
+ * @brief 카메라에서 meshlet 의 모든 삼각형이 뒷면이면 true
+ * @param camera_position bounds 와 같은 좌표계의 카메라 위치
+ */
+bool is_cone_backfacing(const MeshletBounds& bounds, const float camera_position[3]);
+
+}
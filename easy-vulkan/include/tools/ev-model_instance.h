@@ -0,0 +1,151 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ev-device.h"
+#include "ev-buffer.h"
+#include "ev-memory.h"
+#include "ev-command_buffer.h"
+#include "ev-pipeline.h"
+#include "ev-logger.h"
+#include "tools/ev-gltf.h"
+#include "tools/ev-animation.h"
+#include "tools/ev-skinning.h"
+#include "tools/ev-transform_hierarchy.h"
+
+namespace ev::tools::gltf {
+
+/**
+ * @brief 같은 Model 의 정점/인덱스 버퍼, 머티리얼, 텍스처를 공유하면서 노드 변환과 애니메이션 상태만 따로 가지는 모델 인스턴스
+ * @details 생성 시 모델의 TransformHierarchy 를 복사하며, 노드 변환은 Node::get_transform_index 번호로 get_transforms 에서 읽고 씁니다.
+ * 모델의 Node 객체는 원본 hierarchy 를 가리키므로 인스턴스 변환을 바꾸는 데 사용하지 않습니다.
+ * 그리기는 Model::draw_instanced 와 같은 파이프라인(Vertex::get_instanced_pipeline_vertex_input_state)을 사용합니다.
+ * 스킨이 있는 모델은 enable_skinning 으로 이 인스턴스의 hierarchy 에서 관절 행렬을 계산해야 인스턴스마다 다른 자세로 그려집니다.
+ */
+class ModelInstance {
+
+private:
+
+    /** GPU 가 읽는 동안 덮어쓰지 않도록 frame_index 마다 둡니다. buffer 가 memory 보다 먼저 해제되어야 합니다. */
+    struct Frame {
+        std::shared_ptr<ev::Memory> memory = nullptr;
+        std::shared_ptr<ev::Buffer> buffer = nullptr;
+    };
+
+    std::shared_ptr<ev::Device> device;
+
+    std::shared_ptr<Model> model;
+
+    std::shared_ptr<ev::tools::TransformHierarchy> transforms;
+
+    std::shared_ptr<ev::tools::AnimationMixer> mixer;
+
+    glm::mat4 model_matrix = glm::mat4(1.0f);
+
+    std::vector<Frame> frames;
+
+    /** enable_skinning 으로 만든 이 인스턴스의 palette. 스킨이 없거나 사용하지 않으면 nullptr */
+    std::shared_ptr<SkinningSystem> skinning = nullptr;
+
+    uint32_t skinned_binding = 0;
+
+public:
+
+    /**
+     * @param model build_transform_hierarchy 가 끝난 모델
+     */
+    explicit ModelInstance(std::shared_ptr<ev::Device> device, std::shared_ptr<Model> model);
+
+    ModelInstance(const ModelInstance&) = delete;
+
+    ModelInstance& operator=(const ModelInstance&) = delete;
+
+    const std::shared_ptr<Model>& get_model() const {
+        return model;
+    }
+
+    /**
+     * @brief 이 인스턴스의 노드 변환. 값을 바꾼 뒤에는 update 를 호출합니다.
+     */
+    const std::shared_ptr<ev::tools::TransformHierarchy>& get_transforms() const {
+        return transforms;
+    }
+
+    /**
+     * @brief get_transforms 를 target 으로 하는 애니메이션 mixer. ev::tools::update_animations 에 모아 한 번에 갱신할 수도 있습니다.
+     */
+    const std::shared_ptr<ev::tools::AnimationMixer>& get_mixer() const {
+        return mixer;
+    }
+
+    void set_model_matrix(const glm::mat4& matrix) {
+        model_matrix = matrix;
+    }
+
+    const glm::mat4& get_model_matrix() const {
+        return model_matrix;
+    }
+
+    /**
+     * @brief 이 인스턴스의 hierarchy 로 관절 행렬을 계산하는 SkinningSystem 을 만듭니다.
+     * @details update_instances 가 같은 frame_index 의 palette 를 갱신합니다. 정점 셰이더에서 스키닝하면 get_skinning 의 palette 를 바인딩하고,
+     * shader 로 미리 스키닝하면 render pass 전에 get_skinning()->dispatch 를 기록하면 draw 가 skinned_binding 에 스키닝된 정점 버퍼를 바인딩합니다.
+     * @param frame_count update_instances 에 전달할 frame_index 의 수
+     * @param shader skinning.comp 로 생성한 compute shader. nullptr 이면 palette 만 갱신합니다.
+     * @param skinned_binding 미리 스키닝된 정점을 바인딩할 번호 (SkinningSystem::input_binding_description 참고)
+     * @return 모델에 스킨이 없으면 false
+     */
+    bool enable_skinning(std::shared_ptr<ev::MemoryAllocator> memory_allocator,
+        uint32_t frame_count,
+        std::shared_ptr<ev::Shader> shader = nullptr,
+        uint32_t skinned_binding = 0
+    );
+
+    const std::shared_ptr<SkinningSystem>& get_skinning() const {
+        return skinning;
+    }
+
+    /**
+     * @brief 모델의 클립을 이름으로 찾아 mixer 레이어로 추가합니다.
+     * @return 레이어 인덱스. 클립이 없으면 UINT32_MAX
+     */
+    uint32_t play(const std::string& clip_name, float weight = 1.0f, bool loop = true);
+
+    /**
+     * @brief 애니메이션을 delta_time 만큼 진행해 적용하고 변경된 노드의 월드 행렬을 갱신합니다.
+     */
+    void update(float delta_time, bool parallel = true);
+
+    /**
+     * @brief 노드 월드 행렬에 model_matrix 를 곱해 frame_index 의 인스턴스 버퍼에 기록하고, 스키닝을 사용하면 palette 도 갱신합니다.
+     * @param frame_index 같은 번호의 이전 제출이 완료된 뒤에 호출해야 합니다.
+     */
+    void update_instances(uint32_t frame_index);
+
+    /**
+     * @brief 공유 모델의 버퍼와 머티리얼로 이 인스턴스의 변환을 그립니다. 미리 스키닝한 정점이 있으면 함께 바인딩합니다.
+     * @param frame_index update_instances 에 전달한 번호
+     */
+    void draw(std::shared_ptr<ev::CommandBuffer> command_buffer,
+        uint32_t frame_index,
+        uint32_t render_flags = RenderFlag::OPAQUE | RenderFlag::BIND_IMAGE,
+        std::shared_ptr<ev::PipelineLayout> pipeline_layout = nullptr,
+        uint32_t bind_image_set = 1,
+        uint32_t vertex_pass = VertexPass::ALL_ATTRIBUTES
+    );
+
+    void destroy();
+
+    ~ModelInstance();
+};
+
+/**
+ * @brief 모델 에셋 캐시 키. 파일이 바뀌면 수정 시간이 달라지므로 이전 항목은 참조가 사라진 뒤 budget 에 따라 해제됩니다.
+ * @param params 로드 결과를 바꾸는 설정 바이트 (정점 레이아웃, 최적화, LOD 등). 설정이 다르면 같은 파일도 다른 항목이 됩니다.
+ * @return 파일이 없으면 false
+ */
+bool make_model_key(const std::filesystem::path& path, const void* params, size_t params_size, ev::tools::ResourceKey& key);
+
+}
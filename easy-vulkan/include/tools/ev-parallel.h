@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ev::tools {
+
+/**
+ * @brief 작업에 사용할 수 있는 CPU 스레드 수 (최소 1)
+ */
+uint32_t get_worker_count();
+
+/**
+ * @brief 한 번 만든 작업 스레드를 계속 재사용하는 스레드 풀
+ * @details 작업 스레드는 생성 시 만들어 소멸 시까지 대기하며, parallel_for 는 스레드 생성/join 없이 대기 중인 스레드를 깨워 구간을 나눕니다.
+ * 호출한 스레드도 작업에 참여하므로 스레드 수가 n 인 풀은 최대 n + 1 개 스레드로 실행합니다.
+ * 작업 안에서 다시 parallel_for 를 호출하거나, 다른 스레드가 이미 풀을 사용 중이면 호출한 스레드에서 바로 실행합니다.
+ */
+class WorkerPool {
+
+private:
+
+    struct Job {
+        const std::function<void(uint32_t begin, uint32_t end)>* func = nullptr;
+        uint32_t count = 0;
+        uint32_t grain = 1;
+        uint32_t chunk_count = 0;
+        std::atomic<uint32_t> next_chunk = 0;
+    };
+
+    std::vector<std::thread> threads;
+
+    std::mutex mutex;
+
+    /** 새 작업 또는 종료를 작업 스레드에 알림 */
+    std::condition_variable work_condition;
+
+    /** 작업에 참여한 스레드가 모두 끝났음을 호출한 스레드에 알림 */
+    std::condition_variable done_condition;
+
+    /** 한 번에 하나의 parallel_for 만 풀을 사용 */
+    std::mutex dispatch_mutex;
+
+    Job* job = nullptr;
+
+    uint64_t generation = 0;
+
+    uint32_t active_workers = 0;
+
+    bool stopping = false;
+
+    void run_worker();
+
+    static void run_job(Job& job);
+
+public:
+
+    /**
+     * @param thread_count 작업 스레드 수. 0 이면 호출한 스레드만 사용합니다.
+     */
+    explicit WorkerPool(uint32_t thread_count);
+
+    WorkerPool(const WorkerPool&) = delete;
+
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * @brief 대기 중인 작업 스레드를 종료하고 join 합니다. 실행 중인 parallel_for 가 없을 때 소멸해야 합니다.
+     */
+    ~WorkerPool();
+
+    /**
+     * @brief [0, count) 구간을 작업 스레드에 나누어 실행하고 모두 끝날 때까지 대기합니다.
+     * @details 각 스레드는 grain 개씩 구간을 가져가므로 항목별 작업량이 달라도 부하가 고르게 분산됩니다.
+     * @param func [begin, end) 구간을 처리하는 함수. 서로 다른 구간에 대해 동시에 호출됩니다.
+     * @param grain 한 번에 가져갈 항목 수
+     */
+    void parallel_for(uint32_t count, const std::function<void(uint32_t begin, uint32_t end)>& func, uint32_t grain = 1);
+
+    /**
+     * @brief 호출한 스레드를 제외한 작업 스레드 수
+     */
+    uint32_t get_thread_count() const {
+        return static_cast<uint32_t>(threads.size());
+    }
+
+    /**
+     * @brief parallel_for 가 사용하는 프로세스 공용 풀. get_worker_count() - 1 개 작업 스레드로 처음 사용할 때 생성됩니다.
+     */
+    static WorkerPool& get_default();
+};
+
+/**
+ * @brief [0, count) 구간을 공용 WorkerPool 에서 나누어 실행하고 모두 끝날 때까지 대기합니다.
+ * @details 항목이 하나뿐이거나 스레드가 하나면 호출한 스레드에서 바로 실행합니다.
+ * @param func [begin, end) 구간을 처리하는 함수. 서로 다른 구간에 대해 동시에 호출됩니다.
+ * @param grain 한 번에 가져갈 항목 수
+ */
+void parallel_for(uint32_t count, const std::function<void(uint32_t begin, uint32_t end)>& func, uint32_t grain = 1);
+
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "ev-device.h"
+#include "ev-command_pool.h"
+#include "ev-command_buffer.h"
+#include "ev-renderpass.h"
+#include "ev-framebuffer.h"
+#include "ev-logger.h"
+
+namespace ev::tools {
+
+/**
+ * @brief 하나의 subpass 에 들어갈 명령을 여러 스레드에서 secondary 커맨드 버퍼로 나누어 기록합니다.
+ * @details 커맨드 풀은 외부 동기화가 필요하므로 프레임과 슬라이스마다 풀을 따로 두고, 슬라이스 i 는 항상 i 번째 풀에서 기록합니다.
+ * 항목 [0, count) 를 순서를 유지한 연속 구간으로 나누므로, 반환한 버퍼를 그대로 execute_commands 하면 단일 스레드로 기록한 것과 같은 순서로 그려집니다.
+ * 프레임의 풀은 record 때마다 reset 하므로 frame 은 해당 프레임의 fence 를 기다린 뒤 사용해야 합니다.
+ *
+ * @code
+ * auto secondaries = recorder.record(frame, render_pass, 0, framebuffer, draw_list.get_draw_count(), [&](auto cb, uint32_t begin, uint32_t end) {
+ *     cb->set_viewport(...); cb->set_scissor(...);
+ *     draw_list.record(cb, begin, end, pipeline_layout);
+ * });
+ * primary->begin_render_pass(render_pass, framebuffer, clear_values, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+ * primary->execute_commands(secondaries);
+ * primary->end_render_pass();
+ * @endcode
+ */
+class ParallelRecorder {
+
+public:
+
+    /**
+     * @brief 슬라이스 하나를 기록하는 함수. begin_secondary 이후, end 이전에 호출됩니다. 서로 다른 슬라이스에 대해 동시에 호출됩니다.
+     */
+    using RecordFunction = std::function<void(std::shared_ptr<ev::CommandBuffer> command_buffer, uint32_t begin, uint32_t end)>;
+
+private:
+
+    std::shared_ptr<ev::Device> device;
+
+    uint32_t frame_count;
+
+    uint32_t thread_count;
+
+    /** [frame][slice] 커맨드 풀 */
+    std::vector<std::vector<std::shared_ptr<ev::CommandPool>>> pools;
+
+    /** [frame][slice] 풀 reset 후 다시 기록하는 secondary 커맨드 버퍼 */
+    std::vector<std::vector<std::shared_ptr<ev::CommandBuffer>>> command_buffers;
+
+public:
+
+    /**
+     * @param queue_flags secondary 를 실행할 primary 가 제출될 큐의 종류
+     * @param frame_count 동시에 GPU 에서 실행될 수 있는 프레임 수
+     * @param thread_count 최대 슬라이스 수. 0 이면 사용할 수 있는 CPU 스레드 수
+     */
+    explicit ParallelRecorder(std::shared_ptr<ev::Device> device,
+        VkQueueFlags queue_flags = VK_QUEUE_GRAPHICS_BIT,
+        uint32_t frame_count = 2,
+        uint32_t thread_count = 0
+    );
+
+    ParallelRecorder(const ParallelRecorder&) = delete;
+
+    ParallelRecorder& operator=(const ParallelRecorder&) = delete;
+
+    /**
+     * @brief item_count 개 항목을 슬라이스로 나누어 병렬로 기록합니다.
+     * @param frame 이번 프레임 번호 (0 ~ frame_count - 1)
+     * @param render_pass secondary 가 실행될 render pass. nullptr 이면 render pass 밖에서 실행할 버퍼를 기록
+     * @param framebuffer 실행할 프레임버퍼. 모르면 nullptr
+     * @param min_items_per_slice 슬라이스당 최소 항목 수. 슬라이스는 공유 작업 풀의 parallel_for 로 실행되므로, 항목이 적으면 작업 분배와 동기화 비용이 기록 시간보다 커지지 않도록 슬라이스 수를 줄입니다.
+     * @return 기록 순서대로 정렬된 secondary 커맨드 버퍼. item_count 가 0 이면 비어 있음
+     */
+    std::vector<std::shared_ptr<ev::CommandBuffer>> record(uint32_t frame,
+        std::shared_ptr<ev::RenderPass> render_pass,
+        uint32_t subpass,
+        std::shared_ptr<ev::Framebuffer> framebuffer,
+        uint32_t item_count,
+        const RecordFunction& func,
+        uint32_t min_items_per_slice = 64
+    );
+
+    uint32_t get_frame_count() const {
+        return frame_count;
+    }
+
+    uint32_t get_thread_count() const {
+        return thread_count;
+    }
+
+    void destroy();
+
+    ~ParallelRecorder();
+};
+
+}
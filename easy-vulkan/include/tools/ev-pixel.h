@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief 텍스처 업로드 전에 사용하는 픽셀 포맷 변환 커널들
+ * @details 컴파일 시점에 활성화된 명령어 집합(AVX2, SSE, NEON)에 맞는 구현이 선택되며,
+ * 지원되지 않는 환경에서는 scalar 구현으로 동작합니다.
+ * 모든 함수는 src/dst 가 서로 겹치지 않는다고 가정합니다. (premultiply_rgba8 제외)
+ */
+
+namespace ev::tools::pixel {
+
+/**
+ * @brief 현재 빌드에서 사용되는 SIMD 구현 이름을 반환합니다.
+ * @return "avx2", "ssse3", "sse2", "neon", "scalar" 중 하나
+ */
+const char* simd_backend();
+
+/**
+ * @brief RGB8 픽셀을 RGBA8 로 확장합니다.
+ * @param src RGB8 픽셀 데이터 (pixel_count * 3 bytes)
+ * @param dst RGBA8 출력 버퍼 (pixel_count * 4 bytes)
+ * @param pixel_count 픽셀 수
+ * @param alpha 채워 넣을 알파 값 (기본값: 255)
+ */
+void rgb8_to_rgba8(const uint8_t* src, uint8_t* dst, size_t pixel_count, uint8_t alpha = 0xFF);
+
+/**
+ * @brief RGBA8 픽셀의 RGB 채널에 알파를 미리 곱합니다. (in-place)
+ * @param pixels RGBA8 픽셀 데이터 (pixel_count * 4 bytes)
+ * @param pixel_count 픽셀 수
+ * @details c' = round(c * a / 255) 로 계산하며, 알파 채널은 유지됩니다.
+ */
+void premultiply_rgba8(uint8_t* pixels, size_t pixel_count);
+
+/**
+ * @brief 32bit float 값을 16bit half float 로 변환합니다. (round to nearest even)
+ * @param src float 데이터
+ * @param dst half float 출력 버퍼
+ * @param count 변환할 값의 수
+ */
+void r32f_to_r16f(const float* src, uint16_t* dst, size_t count);
+
+/**
+ * @brief RGBA8 픽셀에서 휘도(Rec.709)를 추출합니다.
+ * @param src RGBA8 픽셀 데이터 (pixel_count * 4 bytes)
+ * @param dst 8bit 휘도 출력 버퍼 (pixel_count bytes)
+ * @param pixel_count 픽셀 수
+ * @details Y = (54 * R + 183 * G + 19 * B + 128) >> 8
+ */
+void rgba8_to_luminance8(const uint8_t* src, uint8_t* dst, size_t pixel_count);
+
+/**
+ * @brief SIMD 구현과 비교하기 위한 scalar 기준 구현들
+ */
+namespace scalar {
+
+void rgb8_to_rgba8(const uint8_t* src, uint8_t* dst, size_t pixel_count, uint8_t alpha = 0xFF);
+
+void premultiply_rgba8(uint8_t* pixels, size_t pixel_count);
+
+void r32f_to_r16f(const float* src, uint16_t* dst, size_t count);
+
+void rgba8_to_luminance8(const uint8_t* src, uint8_t* dst, size_t pixel_count);
+
+}
+
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <memory>
+#include "ev-device.h"
+#include "ev-buffer.h"
+#include "ev-image.h"
+#include "ev-shader.h"
+#include "ev-pipeline.h"
+#include "ev-descriptor_set.h"
+#include "ev-command_pool.h"
+#include "ev-command_buffer.h"
+#include "ev-queue.h"
+#include "ev-sync.h"
+#include "ev-memory_allocator.h"
+#include "ev-logger.h"
+
+namespace ev::tools {
+
+/**
+ * @brief 패킹된 픽셀 데이터를 GPU 에서 이미지 포맷으로 확장하여 업로드합니다.
+ * @details RGB8 처럼 이미지 포맷으로 바로 쓸 수 없는 데이터를 그대로 스테이징하고,
+ * compute shader(shaders/tools/unpack_pixels.comp)로 device local 버퍼에 확장한 뒤 이미지로 복사합니다.
+ * CPU 에서 패딩하는 방식에 비해 PCIe 전송량과 스테이징 메모리가 줄어듭니다.
+ * 지원하는 대상 포맷은 supports() 를 참고하세요. (8/16bit UNORM, 32bit float, 1~4 채널)
+ * RGB(A) 입력을 단일 채널 포맷으로 올리면 CPU 경로와 같은 휘도(Rec.709)를 기록합니다.
+ * command_pool 과 queue 는 compute 를 지원해야 합니다.
+ */
+class PixelUnpacker {
+
+private:
+
+    struct PushConstants {
+        uint32_t dst_word_count;
+        uint32_t pixel_count;
+        uint32_t src_channels;
+        uint32_t src_bytes;
+        uint32_t dst_channels;
+        uint32_t dst_bytes;
+        uint32_t replicate_gray;
+        uint32_t alpha;
+        uint32_t premultiply_alpha;
+    };
+
+    static constexpr uint32_t WORKGROUP_SIZE = 256;
+
+    std::shared_ptr<ev::Device> device;
+
+    std::shared_ptr<ev::MemoryAllocator> memory_allocator;
+
+    std::shared_ptr<ev::CommandPool> command_pool;
+
+    std::shared_ptr<ev::Queue> queue;
+
+    std::shared_ptr<ev::DescriptorSetLayout> descriptor_set_layout;
+
+    std::shared_ptr<ev::DescriptorPool> descriptor_pool;
+
+    std::shared_ptr<ev::DescriptorSet> descriptor_set;
+
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout;
+
+    std::shared_ptr<ev::ComputePipeline> pipeline;
+
+public:
+
+    /**
+     * @brief 대상 이미지 포맷의 채널 수와 채널당 바이트 수
+     */
+    struct FormatLayout {
+        uint32_t channels = 0;
+        uint32_t bytes_per_channel = 0;
+    };
+
+    /**
+     * @brief 생성자
+     * @param device Vulkan Device Wrapper
+     * @param memory_allocator 스테이징/중간 버퍼 할당에 사용할 메모리 할당자
+     * @param command_pool compute 를 지원하는 큐 패밀리의 커맨드 풀
+     * @param queue compute 를 지원하는 큐
+     * @param shader unpack_pixels.comp 로 생성한 compute shader
+     */
+    explicit PixelUnpacker(std::shared_ptr<ev::Device> device,
+        std::shared_ptr<ev::MemoryAllocator> memory_allocator,
+        std::shared_ptr<ev::CommandPool> command_pool,
+        std::shared_ptr<ev::Queue> queue,
+        std::shared_ptr<ev::Shader> shader
+    );
+
+    PixelUnpacker(const PixelUnpacker&) = delete;
+
+    PixelUnpacker& operator=(const PixelUnpacker&) = delete;
+
+    /**
+     * @brief 포맷이 unpack 대상으로 지원되는지와 그 레이아웃을 반환합니다.
+     * @return 지원하지 않는 포맷이면 channels 가 0 인 FormatLayout
+     */
+    static FormatLayout get_format_layout(VkFormat format);
+
+    static bool supports(VkFormat format) {
+        return get_format_layout(format).channels != 0;
+    }
+
+    /**
+     * @brief 패킹된 픽셀을 이미지의 mip level 0 에 업로드합니다. 완료될 때까지 대기합니다.
+     * @param image 대상 이미지 (TRANSFER_DST usage, 메모리 할당 완료 상태)
+     * @param data 패킹된 픽셀 데이터 (width * height * src_channels * src_bytes_per_channel bytes)
+     * @param width 이미지 너비
+     * @param height 이미지 높이
+     * @param src_channels 입력 채널 수 (1 ~ 4)
+     * @param src_bytes_per_channel 입력 채널당 바이트 수 (1: unorm8, 2: unorm16)
+     * @param final_layout 업로드 후 이미지 레이아웃 (모든 mip level 에 적용)
+     * @param replicate_gray 단일 채널 입력을 RGB 로 복제할지 여부
+     * @param premultiply_alpha 4 채널 출력의 RGB 에 알파를 미리 곱할지 여부 (ev::tools::pixel::premultiply_rgba8 과 같은 결과)
+     */
+    VkResult upload(std::shared_ptr<ev::Image> image,
+        const void* data,
+        uint32_t width,
+        uint32_t height,
+        uint32_t src_channels,
+        uint32_t src_bytes_per_channel = 1,
+        VkImageLayout final_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        bool replicate_gray = false,
+        bool premultiply_alpha = false
+    );
+
+    void destroy();
+
+    ~PixelUnpacker();
+};
+
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <map>
+
+namespace ev::tools {
+
+/**
+ * @brief 고정 크기 구간 [0, capacity) 을 가변 길이 구간으로 나누어 주는 free list 할당기
+ * @details 빈 구간을 시작 위치 순으로 보관하며, 요청을 담을 수 있는 가장 작은 빈 구간을 사용합니다(best fit).
+ * 해제한 구간은 앞뒤 빈 구간과 합쳐지므로 모두 해제하면 다시 하나의 구간이 됩니다.
+ * 단위(바이트, 정점 수 등)는 호출자가 정하며, 스레드 동기화는 호출자가 담당합니다.
+ */
+class RangeAllocator {
+
+public:
+
+    static constexpr uint64_t INVALID_OFFSET = UINT64_MAX;
+
+private:
+
+    uint64_t capacity = 0;
+
+    uint64_t free_size = 0;
+
+    /** 시작 위치 -> 크기 */
+    std::map<uint64_t, uint64_t> free_ranges;
+
+public:
+
+    explicit RangeAllocator(uint64_t capacity = 0);
+
+    /**
+     * @brief size 만큼의 구간을 할당합니다.
+     * @return 구간 시작 위치. 담을 수 있는 빈 구간이 없으면 INVALID_OFFSET
+     */
+    uint64_t allocate(uint64_t size);
+
+    /**
+     * @brief allocate 로 받은 구간을 반환합니다.
+     * @return 범위를 벗어나거나 빈 구간과 겹치면 오류를 기록하고 false
+     */
+    bool free(uint64_t offset, uint64_t size);
+
+    /**
+     * @brief 모든 할당을 버리고 capacity 크기의 빈 구간 하나로 되돌립니다.
+     */
+    void reset(uint64_t capacity);
+
+    uint64_t get_capacity() const {
+        return capacity;
+    }
+
+    uint64_t get_free_size() const {
+        return free_size;
+    }
+
+    uint64_t get_used_size() const {
+        return capacity - free_size;
+    }
+
+    /**
+     * @brief 한 번에 할당할 수 있는 최대 크기
+     */
+    uint64_t get_largest_free_range() const;
+
+    size_t get_free_range_count() const {
+        return free_ranges.size();
+    }
+};
+
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "ev-device.h"
+#include "ev-buffer.h"
+#include "ev-shader.h"
+#include "ev-pipeline.h"
+#include "ev-descriptor_set.h"
+#include "ev-command_buffer.h"
+#include "ev-sync.h"
+#include "ev-memory_allocator.h"
+#include "ev-logger.h"
+#include "tools/ev-gltf.h"
+#include "tools/ev-transform_hierarchy.h"
+
+namespace ev::tools::gltf {
+
+/**
+ * @brief 모델의 모든 스킨 메시 관절 행렬을 프레임마다 하나의 storage buffer(palette)에 모아 올리고,
+ * 선택적으로 compute shader(shaders/tools/skinning.comp)로 위치/법선을 미리 스키닝합니다.
+ * @details 스킨 메시 노드마다 palette 안의 시작 위치(Mesh::Uniform::joint_offset)를 가지며 관절 행렬은
+ * inverse(메시 노드 월드) * 관절 월드 * inverse bind matrix 이므로, 스키닝 결과는 메시 노드 로컬 공간입니다.
+ * 미리 스키닝한 정점 버퍼는 모델 정점 버퍼와 같은 인덱스를 사용하므로 그림자, 외곽선, 메인 패스가
+ * 같은 draw 호출에 bind_skinned_vertices 만 추가해 재사용할 수 있습니다. 스킨이 없는 정점은 처음 한 번 그대로 복사됩니다.
+ * GPU 가 읽는 동안 덮어쓰지 않도록 버퍼는 frame_index 마다 따로 둡니다.
+ * 노드 월드 행렬은 transforms 에서 읽으므로, ModelInstance 처럼 hierarchy 를 복사해 따로 움직이는 인스턴스는 자신의 hierarchy 로 만든 SkinningSystem 을 사용해야 합니다.
+ */
+class SkinningSystem {
+
+public:
+
+    static constexpr uint32_t NO_JOINTS = 0xFFFFFFFFu;
+
+    static constexpr uint32_t WORKGROUP_SIZE = 64;
+
+    struct PushConstants {
+        uint32_t first_vertex;
+        uint32_t vertex_count;
+        uint32_t joint_offset;  // NO_JOINTS 면 그대로 복사
+        uint32_t joint_count;
+    };
+
+    /** 미리 스키닝된 정점. 메시 노드 로컬 공간 */
+    struct SkinnedVertex {
+        glm::vec4 position;
+        glm::vec4 normal;
+    };
+
+private:
+
+    struct SkinnedNode {
+        std::shared_ptr<Node> node;
+        uint32_t joint_offset;
+    };
+
+    struct Frame {
+        std::shared_ptr<ev::Buffer> palette_buffer = nullptr;
+        std::shared_ptr<ev::Buffer> skinned_buffer = nullptr;
+        std::shared_ptr<ev::DescriptorSet> descriptor_set = nullptr;
+        bool initialized = false;
+    };
+
+    std::shared_ptr<ev::Device> device;
+
+    std::shared_ptr<ev::MemoryAllocator> memory_allocator;
+
+    std::shared_ptr<Model> model;
+
+    /** 관절 행렬을 계산할 노드 월드 행렬. 모델의 hierarchy 이거나 그 복사본 */
+    std::shared_ptr<ev::tools::TransformHierarchy> transforms;
+
+    std::vector<SkinnedNode> skinned_nodes;
+
+    /** 스킨 메시 프리미티브 (매 프레임) / 스킨이 없는 프리미티브 (프레임 버퍼마다 처음 한 번) */
+    std::vector<PushConstants> skinned_dispatches;
+
+    std::vector<PushConstants> static_dispatches;
+
+    uint32_t joint_count = 0;
+
+    std::vector<Frame> frames;
+
+    std::shared_ptr<ev::DescriptorSetLayout> descriptor_set_layout = nullptr;
+
+    std::shared_ptr<ev::DescriptorPool> descriptor_pool = nullptr;
+
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout = nullptr;
+
+    std::shared_ptr<ev::ComputePipeline> pipeline = nullptr;
+
+    void collect_skinned_nodes();
+
+    void setup_frames(uint32_t frame_count);
+
+    void setup_pipeline(std::shared_ptr<ev::Shader> shader);
+
+    void record_dispatches(std::shared_ptr<ev::CommandBuffer> command_buffer, const std::vector<PushConstants>& dispatches);
+
+    glm::mat4 get_world_matrix(const Node& node) const;
+
+public:
+
+    /**
+     * @param model build_transform_hierarchy 가 끝난 모델
+     * @param frame_count 동시에 진행할 수 있는 프레임 수
+     * @param shader skinning.comp 로 생성한 compute shader. nullptr 이면 palette 만 갱신합니다.
+     * 미리 스키닝하려면 정점 버퍼가 Vertex 구조체 레이아웃이어야 합니다.
+     * @param transforms 관절 월드 행렬을 읽을 hierarchy. 모델 hierarchy 의 복사본이어야 하며 nullptr 이면 모델의 hierarchy 를 사용합니다.
+     */
+    explicit SkinningSystem(std::shared_ptr<ev::Device> device,
+        std::shared_ptr<ev::MemoryAllocator> memory_allocator,
+        std::shared_ptr<Model> model,
+        uint32_t frame_count,
+        std::shared_ptr<ev::Shader> shader = nullptr,
+        std::shared_ptr<ev::tools::TransformHierarchy> transforms = nullptr
+    );
+
+    SkinningSystem(const SkinningSystem&) = delete;
+
+    SkinningSystem& operator=(const SkinningSystem&) = delete;
+
+    /**
+     * @brief 현재 노드 월드 행렬로 관절 행렬을 계산해 frame_index 의 palette 에 기록합니다.
+     * @details transforms 의 update(또는 애니메이션 갱신) 이후에 호출합니다.
+     */
+    void update(uint32_t frame_index, bool parallel = true);
+
+    /**
+     * @brief 미리 스키닝 compute 를 기록하고 vertex input 이 읽을 수 있도록 barrier 를 추가합니다.
+     * @details render pass 밖에서 호출해야 합니다. compute shader 가 없으면 아무것도 하지 않습니다.
+     */
+    void dispatch(std::shared_ptr<ev::CommandBuffer> command_buffer, uint32_t frame_index);
+
+    /**
+     * @brief 미리 스키닝된 정점 버퍼를 binding 에 바인딩합니다. (input_attribute_descriptions 참고)
+     */
+    void bind_skinned_vertices(std::shared_ptr<ev::CommandBuffer> command_buffer, uint32_t frame_index, uint32_t binding);
+
+    static VkVertexInputBindingDescription input_binding_description(uint32_t binding);
+
+    /**
+     * @brief SkinnedVertex 의 position, normal 을 vec4 로 읽는 입력 속성
+     */
+    static std::vector<VkVertexInputAttributeDescription> input_attribute_descriptions(uint32_t binding,
+        uint32_t position_location = 0,
+        uint32_t normal_location = 1
+    );
+
+    bool is_pre_skinning_enabled() const {
+        return pipeline != nullptr;
+    }
+
+    uint32_t get_joint_count() const {
+        return joint_count;
+    }
+
+    uint32_t get_frame_count() const {
+        return static_cast<uint32_t>(frames.size());
+    }
+
+    /**
+     * @brief 관절 행렬(mat4) 배열. 정점 셰이더에서 직접 스키닝할 때 Mesh::Uniform::joint_offset 과 함께 사용합니다.
+     */
+    const std::shared_ptr<ev::Buffer>& get_palette_buffer(uint32_t frame_index) const {
+        return frames[frame_index].palette_buffer;
+    }
+
+    const std::shared_ptr<ev::Buffer>& get_skinned_vertex_buffer(uint32_t frame_index) const {
+        return frames[frame_index].skinned_buffer;
+    }
+
+    void destroy();
+
+    ~SkinningSystem();
+};
+
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <memory>
+#include "ev-device.h"
+#include "ev-memory.h"
+#include "ev-buffer.h"
+#include "ev-logger.h"
+
+namespace ev::tools {
+
+/**
+ * @brief 영구 매핑된 스테이징 버퍼
+ * @details 전용 HOST_VISIBLE | HOST_COHERENT 메모리를 한 번 매핑해 두고 선형으로 나누어 씁니다.
+ * 디코더나 변환 커널이 할당 영역에 직접 기록하므로, 중간 버퍼 없이 한 번의 복사로 GPU 에 올릴 수 있습니다.
+ * 메모리 풀과 VkDeviceMemory 를 공유하지 않으므로 다른 버퍼의 map/unmap 과 충돌하지 않습니다.
+ * 할당 영역은 reset() 또는 reserve() 전까지 유효하며, 두 함수는 GPU 가 버퍼를 읽는 중에 호출하면 안 됩니다.
+ * TRANSFER_DST 로도 쓸 수 있으므로 GPU 버퍼를 읽어오는 readback 용도로도 사용할 수 있습니다.
+ */
+class StagingBuffer {
+
+private:
+
+    std::shared_ptr<ev::Device> device;
+
+    std::shared_ptr<ev::Memory> memory;
+
+    std::shared_ptr<ev::Buffer> buffer;
+
+    uint8_t* mapped = nullptr;
+
+    VkDeviceSize capacity = 0;
+
+    VkDeviceSize head = 0;
+
+    VkResult create(VkDeviceSize capacity);
+
+public:
+
+    /**
+     * @brief 스테이징 버퍼의 한 영역
+     * @details data 는 버퍼 시작 주소로부터 offset 만큼 떨어진 매핑 주소입니다.
+     */
+    struct Allocation {
+        VkDeviceSize offset = 0;
+        VkDeviceSize size = 0;
+        void* data = nullptr;
+
+        explicit operator bool() const {
+            return data != nullptr;
+        }
+    };
+
+    /**
+     * @brief 생성자
+     * @param device Vulkan Device Wrapper
+     * @param capacity 초기 용량 (bytes)
+     */
+    explicit StagingBuffer(std::shared_ptr<ev::Device> device, VkDeviceSize capacity);
+
+    StagingBuffer(const StagingBuffer&) = delete;
+
+    StagingBuffer& operator=(const StagingBuffer&) = delete;
+
+    /**
+     * @brief 선형으로 영역을 할당합니다.
+     * @param size 크기 (bytes)
+     * @param alignment offset 정렬 (2의 거듭제곱)
+     * @return 용량이 부족하면 data 가 nullptr 인 Allocation
+     */
+    Allocation allocate(VkDeviceSize size, VkDeviceSize alignment = 16);
+
+    /**
+     * @brief 최소 capacity 만큼의 용량을 확보합니다.
+     * @details 용량이 늘어나면 버퍼를 다시 만들며, 이전 할당 영역은 모두 무효가 됩니다.
+     */
+    VkResult reserve(VkDeviceSize capacity);
+
+    /**
+     * @brief 모든 할당을 해제합니다. 매핑은 유지됩니다.
+     */
+    void reset() {
+        head = 0;
+    }
+
+    std::shared_ptr<ev::Buffer> get_buffer() const {
+        return buffer;
+    }
+
+    VkDeviceSize get_capacity() const {
+        return capacity;
+    }
+
+    VkDeviceSize get_used_size() const {
+        return head;
+    }
+
+    void destroy();
+
+    ~StagingBuffer();
+};
+
+}
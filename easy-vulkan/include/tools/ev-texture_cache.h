@@ -0,0 +1,274 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ev {
+class Texture;
+}
+
+namespace ev::tools {
+
+/**
+ * @brief 원본 바이트의 내용 해시와 로드 파라미터(포맷, 샘플러 등) 해시로 이루어진 캐시 키
+ */
+struct ResourceKey {
+    uint64_t content_hash = 0;
+    uint64_t params_hash = 0;
+
+    bool operator==(const ResourceKey& other) const = default;
+};
+
+struct ResourceKeyHash {
+    size_t operator()(const ResourceKey& key) const {
+        return static_cast<size_t>(key.content_hash ^ (key.params_hash * 0x9E3779B97F4A7C15ull));
+    }
+};
+
+/**
+ * @brief source 바이트와 params 바이트를 각각 hash64 로 해시해 키를 만듭니다.
+ * @param params 패딩이 없는 POD 구조체처럼 같은 파라미터면 같은 바이트가 되는 값
+ */
+ResourceKey make_resource_key(const void* source, size_t source_size, const void* params = nullptr, size_t params_size = 0);
+
+/**
+ * @brief 내용 해시로 공유 리소스를 찾아 재사용하는 캐시
+ * @details 캐시는 항목마다 shared_ptr 를 하나 보관하며, 그 외의 참조가 없는(use_count 가 1 인) 항목만 해제 대상입니다.
+ * 등록된 항목 크기의 합이 budget 을 넘으면 가장 오래 사용하지 않은 해제 대상부터 버립니다.
+ * 참조 중인 항목은 budget 을 넘어도 유지합니다. 모든 함수는 여러 스레드에서 호출할 수 있습니다.
+ * set_evict_callback 으로 항목을 버릴 때 리소스가 등록된 다른 시스템에서도 빼낼 수 있습니다.
+ */
+template <typename Resource>
+class ResourceCache {
+
+public:
+
+    /** 버리는 리소스를 받는 함수. 캐시 잠금 밖에서, 항목을 버린 스레드에서 호출됩니다. */
+    using EvictCallback = std::function<void(const std::shared_ptr<Resource>& resource)>;
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+    };
+
+private:
+
+    /** 최근에 사용한 키가 앞 */
+    using LruList = std::list<ResourceKey>;
+
+    struct Entry {
+        std::shared_ptr<Resource> resource;
+        uint64_t bytes;
+        typename LruList::iterator lru;
+    };
+
+    mutable std::mutex mutex;
+
+    std::unordered_map<ResourceKey, Entry, ResourceKeyHash> entries;
+
+    LruList lru;
+
+    uint64_t budget;
+
+    uint64_t resident_bytes = 0;
+
+    Stats stats;
+
+    EvictCallback evict_callback;
+
+    void touch(Entry& entry) {
+        lru.splice(lru.begin(), lru, entry.lru);
+    }
+
+    /**
+     * @param evicted 버린 리소스. 잠금을 푼 뒤 notify_evicted 로 전달합니다.
+     */
+    size_t trim_locked(std::vector<std::shared_ptr<Resource>>& evicted) {
+        const size_t first = evicted.size();
+        for ( auto it = lru.end() ; resident_bytes > budget && it != lru.begin() ; ) {
+            --it;
+            auto entry = entries.find(*it);
+            if ( entry->second.resource.use_count() > 1 ) {
+                continue;
+            }
+            resident_bytes -= entry->second.bytes;
+            evicted.push_back(std::move(entry->second.resource));
+            entries.erase(entry);
+            it = lru.erase(it);
+        }
+        stats.evictions += evicted.size() - first;
+        return evicted.size() - first;
+    }
+
+    void notify_evicted(const std::vector<std::shared_ptr<Resource>>& evicted) {
+        if ( evicted.empty() ) {
+            return;
+        }
+        EvictCallback callback;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            callback = evict_callback;
+        }
+        if ( callback ) {
+            for ( const auto& resource : evicted ) {
+                callback(resource);
+            }
+        }
+    }
+
+public:
+
+    /**
+     * @param budget 참조되지 않는 항목을 유지할 최대 크기 (bytes)
+     */
+    explicit ResourceCache(uint64_t budget = 256ull * 1024 * 1024)
+        : budget(budget) {}
+
+    ResourceCache(const ResourceCache&) = delete;
+
+    ResourceCache& operator=(const ResourceCache&) = delete;
+
+    /**
+     * @brief key 에 해당하는 리소스를 반환합니다. 없으면 nullptr
+     */
+    std::shared_ptr<Resource> find(const ResourceKey& key) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if ( it == entries.end() ) {
+            ++stats.misses;
+            return nullptr;
+        }
+        ++stats.hits;
+        touch(it->second);
+        return it->second.resource;
+    }
+
+    bool contains(const ResourceKey& key) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.find(key) != entries.end();
+    }
+
+    /**
+     * @brief 리소스를 등록합니다. 다른 스레드가 같은 키를 먼저 등록했으면 그 리소스를 반환합니다.
+     * @param bytes budget 계산에 사용할 크기
+     */
+    std::shared_ptr<Resource> insert(const ResourceKey& key, std::shared_ptr<Resource> resource, uint64_t bytes) {
+        if ( !resource ) {
+            return nullptr;
+        }
+        std::vector<std::shared_ptr<Resource>> evicted;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = entries.find(key);
+            if ( it != entries.end() ) {
+                touch(it->second);
+                return it->second.resource;
+            }
+            lru.push_front(key);
+            entries.emplace(key, Entry{ resource, bytes, lru.begin() });
+            resident_bytes += bytes;
+            trim_locked(evicted);
+        }
+        notify_evicted(evicted);
+        return resource;
+    }
+
+    /**
+     * @brief key 에 해당하는 리소스를 반환하고, 없으면 load 로 만들어 등록합니다.
+     * @param load std::pair<std::shared_ptr<Resource>, uint64_t bytes> 를 반환하는 함수. 잠금 밖에서 호출됩니다.
+     */
+    template <typename Loader>
+    std::shared_ptr<Resource> acquire(const ResourceKey& key, Loader&& load) {
+        if ( std::shared_ptr<Resource> resource = find(key) ) {
+            return resource;
+        }
+        auto [resource, bytes] = load();
+        return insert(key, std::move(resource), bytes);
+    }
+
+    /**
+     * @brief budget 을 넘는 만큼 참조되지 않는 항목을 오래된 순서로 해제합니다.
+     * @return 해제한 항목 수
+     */
+    size_t trim() {
+        std::vector<std::shared_ptr<Resource>> evicted;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            trim_locked(evicted);
+        }
+        notify_evicted(evicted);
+        return evicted.size();
+    }
+
+    void set_budget(uint64_t bytes) {
+        std::vector<std::shared_ptr<Resource>> evicted;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            budget = bytes;
+            trim_locked(evicted);
+        }
+        notify_evicted(evicted);
+    }
+
+    void set_evict_callback(EvictCallback callback) {
+        std::lock_guard<std::mutex> lock(mutex);
+        evict_callback = std::move(callback);
+    }
+
+    uint64_t get_budget() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return budget;
+    }
+
+    /** 참조 여부와 관계없이 등록된 모든 항목 크기의 합 */
+    uint64_t get_resident_bytes() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return resident_bytes;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.size();
+    }
+
+    Stats get_stats() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return stats;
+    }
+
+    /**
+     * @brief 모든 항목의 캐시 참조를 버립니다. 사용 중인 리소스는 마지막 참조가 사라질 때 해제됩니다.
+     * @details 참조되지 않던 항목만 evict callback 으로 전달합니다.
+     */
+    void clear() {
+        std::vector<std::shared_ptr<Resource>> evicted;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for ( auto& [key, entry] : entries ) {
+                if ( entry.resource.use_count() == 1 ) {
+                    evicted.push_back(std::move(entry.resource));
+                }
+            }
+            entries.clear();
+            lru.clear();
+            resident_bytes = 0;
+        }
+        notify_evicted(evicted);
+    }
+};
+
+/**
+ * @brief 여러 모델이 같은 이미지를 공유할 때 디코딩, 업로드, VRAM 을 한 번만 사용하도록 하는 텍스처 캐시
+ * @details GLTFModelManager::set_texture_cache 로 연결하면 원본 이미지 바이트의 해시가 같은 텍스처를 재사용합니다.
+ */
+using TextureCache = ResourceCache<ev::Texture>;
+
+}
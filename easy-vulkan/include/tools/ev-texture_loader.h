@@ -12,6 +12,10 @@
 #include "ev-command_buffer.h"
 #include "ev-queue.h"
 #include "ev-memory_allocator.h"
+#include "tools/ev-pixel.h"
+#include "tools/ev-pixel_unpacker.h"
+#include "tools/ev-mapped_file.h"
+#include "tools/ev-staging_buffer.h"
 
 #ifndef STB_IMAGE_IMPLEMENTATION
     #define STB_IMAGE_IMPLEMENTATION
@@ -31,6 +35,12 @@ class TextureLoader {
 
     std::shared_ptr<ev::MemoryAllocator> m_memory_allocator;
 
+    std::shared_ptr<PixelUnpacker> m_pixel_unpacker = nullptr;
+
+    std::shared_ptr<StagingBuffer> m_staging_buffer = nullptr;
+
+    bool m_premultiply_alpha = false;
+
     TextureLoader(std::shared_ptr<ev::Device> device, 
                     std::shared_ptr<ev::CommandPool> command_pool,
                     std::shared_ptr<ev::Queue> transfer_queue,
@@ -40,9 +50,81 @@ class TextureLoader {
           m_transfer_queue(std::move(transfer_queue)), 
           m_memory_allocator(std::move(memory_allocator)) {}
 
-    std::vector<uint8_t> load_data(std::filesystem::path file_path, int& width, int& height, int& channels);
+    /**
+     * @brief stb_image 가 디코딩한 픽셀 버퍼. 복사하지 않고 소유권만 보관합니다.
+     */
+    struct DecodedImage {
+        std::unique_ptr<void, void(*)(void*)> pixels{ nullptr, stbi_image_free };
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        int bytes_per_channel = 1;
+        bool is_float = false;
+
+        size_t size() const {
+            return static_cast<size_t>(width) * height * channels * (is_float ? sizeof(float) : bytes_per_channel);
+        }
+    };
+
+    /**
+     * @brief 파일을 mmap 하여 stb_image 로 디코딩합니다.
+     * @param keep_packed true 면 채널 수와 비트 깊이(8/16bit)를 그대로 유지합니다. (GPU 채널 확장 경로)
+     * @details half float 포맷은 float 로 디코딩됩니다. 실패하면 pixels 가 nullptr 입니다.
+     */
+    DecodedImage decode(const std::filesystem::path& file_path, VkFormat format, bool keep_packed);
+
+    /**
+     * @brief convert_pixels 가 format 에 맞춰 기록할 바이트 수를 반환합니다.
+     */
+    static VkDeviceSize converted_size(const DecodedImage& image, VkFormat format);
+
+    /**
+     * @brief 디코딩된 픽셀을 format 에 맞게 변환하면서 dst 에 기록합니다.
+     * @details RGB8 -> RGBA8 확장, RGBA8 -> R8 휘도 추출, HDR -> 16bit float 변환을 ev::tools::pixel 커널로 처리합니다.
+     * dst 는 보통 스테이징 버퍼의 매핑 영역이며, 이 변환이 GPU 로 가는 유일한 CPU 복사입니다.
+     * premultiply_alpha 가 true 면 알파가 있는 RGBA8 출력의 RGB 에 알파를 곱합니다.
+     */
+    static void convert_pixels(const DecodedImage& image, VkFormat format, void* dst, bool premultiply_alpha = false);
+
+    /**
+     * @brief 재사용하는 스테이징 버퍼에서 size 만큼 할당합니다. 이전 할당은 모두 해제됩니다.
+     */
+    StagingBuffer::Allocation acquire_staging(VkDeviceSize size);
+
+    /**
+     * @brief 스테이징 영역을 이미지의 mip level 0 에 복사하고 final_layout 으로 전환합니다. 완료될 때까지 대기합니다.
+     */
+    void upload_staging(std::shared_ptr<ev::Image> image, const StagingBuffer::Allocation& allocation, VkImageLayout final_layout);
+
+    /**
+     * @brief format 으로 mip 체인을 blit 생성할 수 있는지 반환합니다. (BLIT_SRC, BLIT_DST, linear filter)
+     */
+    bool supports_mip_generation(VkFormat format) const;
+
+    /**
+     * @brief TRANSFER_SRC_OPTIMAL 상태의 mip level 0 에서 나머지 level 을 blit 으로 만들고 모든 level 을 final_layout 으로 전환합니다.
+     * @details 완료될 때까지 대기합니다. blit 은 graphics 큐에서만 가능하므로 transfer_queue 가 graphics 를 지원해야 합니다.
+     */
+    void generate_mipmaps(std::shared_ptr<ev::Image> image, VkImageLayout final_layout);
 
     public :
+
+    /**
+     * @brief GPU 채널 확장 업로드 경로를 설정합니다.
+     * @details 설정되면 RGB8, 16bit grayscale 등 포맷과 레이아웃이 다른 이미지는 패킹된 채로 업로드되어 GPU 에서 확장됩니다.
+     * nullptr 을 넘기면 CPU 변환 경로를 사용합니다.
+     */
+    void set_pixel_unpacker(std::shared_ptr<PixelUnpacker> pixel_unpacker) {
+        m_pixel_unpacker = std::move(pixel_unpacker);
+    }
+
+    /**
+     * @brief 이후 로드하는 RGBA8 텍스처의 RGB 에 알파를 미리 곱해 업로드할지 설정합니다. 기본값은 false 입니다.
+     * @details premultiplied alpha 블렌딩(ONE, ONE_MINUS_SRC_ALPHA)용 텍스처에 사용하며, CPU 변환 경로와 GPU 채널 확장 경로 모두에 적용됩니다.
+     */
+    void set_premultiply_alpha(bool premultiply_alpha) {
+        m_premultiply_alpha = premultiply_alpha;
+    }
     
     virtual std::shared_ptr<ev::Texture> load_from_file(
         std::filesystem::path file_path,
@@ -66,6 +148,12 @@ class Texture2DLoader : public TextureLoader {
         uint32_t mip_levels = 0
     );
 
+    std::shared_ptr<ev::Texture> make_texture(
+        std::shared_ptr<ev::Image> image,
+        VkFormat format,
+        uint32_t mip_levels
+    );
+
     public: 
 
     explicit Texture2DLoader(std::shared_ptr<ev::Device> device,
@@ -84,7 +172,8 @@ class Texture2DLoader : public TextureLoader {
      * @param usage_flags 이미지 사용 플래그 (기본값: VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT)
      * @param final_layout 최종 이미지 레이아웃 (기본값: VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
      * @return std::shared_ptr<ev::Texture> 로드된 텍스처 객체
-     * @details mip map은 자동으로 계산되며, Device Local 메모리에 할당됩니다.  
+     * @details mip map 은 level 0 에서 blit 으로 생성되며, Device Local 메모리에 할당됩니다.
+     * 포맷이 blit 이나 linear filter 를 지원하지 않으면 mip level 1 로 로드합니다.
      */
     std::shared_ptr<ev::Texture> load_from_file(
         std::filesystem::path file_path,
@@ -109,6 +198,26 @@ class Texture2DLoader : public TextureLoader {
         VkImageLayout final_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
     );
 
+    /**
+     * @brief 헤더 없이 texel 만 저장된 파일을 로드합니다.
+     * @param file_path 파일 경로 (width * height 개의 format texel, 행 패딩 없음)
+     * @param width 이미지 너비
+     * @param height 이미지 높이
+     * @param format 이미지 포맷 (파일의 texel 포맷과 같아야 합니다)
+     * @param usage_flags 이미지 사용 플래그 (기본값: VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT)
+     * @param final_layout 최종 이미지 레이아웃 (기본값: VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+     * @return std::shared_ptr<ev::Texture> 로드된 텍스처 객체, 파일 크기가 맞지 않으면 nullptr
+     * @details 파일을 mmap 하여 스테이징 버퍼로 한 번만 복사합니다. mip level 은 1 입니다.
+     */
+    std::shared_ptr<ev::Texture> load_from_raw_data(
+        std::filesystem::path file_path,
+        uint32_t width,
+        uint32_t height,
+        VkFormat format = VK_FORMAT_R8G8B8A8_UNORM,
+        VkImageUsageFlags usage_flags = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+        VkImageLayout final_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+    );
+
     /**
      * @brief 유니폼 텍스처로 사용하기 위한 이미지 로더입니다.
      * @param format 이미지 포맷 (기본값: VK_FORMAT_R8G8B8A8_UNORM)
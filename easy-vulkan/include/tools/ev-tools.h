@@ -1,5 +1,28 @@
 #pragma once
 
+#include "ev-accessor.h"
+#include "ev-animation.h"
+#include "ev-bindless_materials.h"
 #include "ev-bitmap.h"
+#include "ev-draw_list.h"
+#include "ev-frustum_culling.h"
+#include "ev-geometry_heap.h"
+#include "ev-glb.h"
 #include "ev-gltf.h"
-#include "ev-texture_loader.h"
\ No newline at end of file
+#include "ev-gltf_cache.h"
+#include "ev-gpu_culler.h"
+#include "ev-hash.h"
+#include "ev-mapped_file.h"
+#include "ev-mesh_optimizer.h"
+#include "ev-model_instance.h"
+#include "ev-parallel.h"
+#include "ev-parallel_recorder.h"
+#include "ev-pixel.h"
+#include "ev-pixel_unpacker.h"
+#include "ev-range_allocator.h"
+#include "ev-skinning.h"
+#include "ev-staging_buffer.h"
+#include "ev-texture_cache.h"
+#include "ev-texture_loader.h"
+#include "ev-transform_hierarchy.h"
+#include "ev-vertex_quantize.h"
\ No newline at end of file
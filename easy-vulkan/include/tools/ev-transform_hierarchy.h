@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace ev::tools {
+
+/**
+ * @brief 노드 계층의 변환을 전위 순회 순서의 SoA 배열로 보관하고, 변경된 노드만 모아서 월드 행렬을 갱신합니다.
+ * @details TRS 는 성분별 float 배열, 행렬은 열 우선 float[16] (glm::mat4 와 같은 레이아웃) 배열입니다.
+ * 노드 순서가 전위 순회이므로 부모는 항상 자식보다 앞에 있고, 노드 i 의 서브트리는 [i, i + subtree_size) 구간입니다.
+ * update 는 서로 겹치지 않는 서브트리 구간을 여러 스레드에 나누어 처리합니다.
+ */
+class TransformHierarchy {
+
+public:
+
+    static constexpr uint32_t NO_PARENT = 0xFFFFFFFFu;
+
+    enum Axis : uint32_t {
+        X,
+        Y,
+        Z,
+        W
+    };
+
+private:
+
+    std::vector<uint32_t> parents;
+
+    std::vector<uint32_t> subtree_sizes;
+
+    /** TRS 성분별 배열 */
+    std::vector<float> translations[3];
+
+    std::vector<float> rotations[4];
+
+    std::vector<float> scales[3];
+
+    std::vector<float> local_matrices;
+
+    std::vector<float> world_matrices;
+
+    /** TRS 또는 로컬 행렬이 바뀐 노드 */
+    std::vector<uint8_t> dirty;
+
+    /** set_local_matrix 로 직접 지정되어 TRS 로 다시 계산하지 않는 노드 */
+    std::vector<uint8_t> matrix_overrides;
+
+    /** update 중 월드 행렬이 다시 계산된 노드. 자식은 부모의 값을 보고 갱신 여부를 정함 */
+    std::vector<uint8_t> world_updated;
+
+    bool any_dirty = false;
+
+    /** 병렬 update 전에 한 스레드에서 처리하는 얕은 노드들과, 그 아래에서 병렬로 처리하는 서브트리 루트 */
+    std::vector<uint32_t> serial_nodes;
+
+    std::vector<uint32_t> task_roots;
+
+    void plan_tasks();
+
+    void update_local(uint32_t begin, uint32_t end);
+
+    void update_world(uint32_t node);
+
+public:
+
+    TransformHierarchy() = default;
+
+    /**
+     * @param parents 노드별 부모 인덱스(루트는 NO_PARENT). 전위 순회 순서여야 합니다.
+     * @details 순서가 잘못되면 오류를 기록하고 종료합니다. 모든 노드는 단위 변환으로 시작합니다.
+     */
+    explicit TransformHierarchy(const std::vector<uint32_t>& parents);
+
+    size_t size() const {
+        return parents.size();
+    }
+
+    uint32_t get_parent(uint32_t node) const {
+        return parents[node];
+    }
+
+    uint32_t get_subtree_size(uint32_t node) const {
+        return subtree_sizes[node];
+    }
+
+    void set_translation(uint32_t node, const float translation[3]);
+
+    /**
+     * @param rotation 단위 쿼터니언 (x, y, z, w)
+     */
+    void set_rotation(uint32_t node, const float rotation[4]);
+
+    void set_scale(uint32_t node, const float scale[3]);
+
+    /**
+     * @brief 로컬 행렬을 직접 지정합니다. 이후 TRS 를 설정하기 전까지 TRS 로 다시 계산하지 않습니다.
+     */
+    void set_local_matrix(uint32_t node, const float matrix[16]);
+
+    void get_translation(uint32_t node, float translation[3]) const;
+
+    void get_rotation(uint32_t node, float rotation[4]) const;
+
+    void get_scale(uint32_t node, float scale[3]) const;
+
+    /**
+     * @brief 성분 배열을 직접 기록하는 경우(애니메이션 등) 기록한 노드를 표시합니다.
+     */
+    void mark_dirty(uint32_t node) {
+        dirty[node] = 1;
+        matrix_overrides[node] = 0;
+        any_dirty = true;
+    }
+
+    /**
+     * @brief 성분별 배열. 기록한 노드는 mark_dirty 로 표시해야 합니다.
+     */
+    float* get_translations(Axis axis) {
+        return translations[axis].data();
+    }
+
+    float* get_rotations(Axis axis) {
+        return rotations[axis].data();
+    }
+
+    float* get_scales(Axis axis) {
+        return scales[axis].data();
+    }
+
+    /**
+     * @brief 열 우선 float[16]. update 이후 값이 유효합니다.
+     */
+    const float* get_local_matrix(uint32_t node) const {
+        return &local_matrices[static_cast<size_t>(node) * 16];
+    }
+
+    const float* get_world_matrix(uint32_t node) const {
+        return &world_matrices[static_cast<size_t>(node) * 16];
+    }
+
+    bool is_dirty() const {
+        return any_dirty;
+    }
+
+    /**
+     * @brief 변경된 노드의 로컬 행렬을 다시 계산하고, 변경된 노드와 그 자손의 월드 행렬만 갱신합니다.
+     * @param parallel false 면 호출한 스레드에서만 처리합니다.
+     * @return 월드 행렬이 갱신된 노드 수
+     */
+    uint32_t update(bool parallel = true);
+};
+
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief 정점 속성 양자화 함수들
+ * @details GPU 의 SNORM/UNORM 포맷 복원 규칙(snorm: max(v / (2^(n-1) - 1), -1), unorm: v / (2^n - 1))에 맞춰 반올림합니다.
+ */
+
+namespace ev::tools::quantize {
+
+int16_t float_to_snorm16(float value);
+
+int8_t float_to_snorm8(float value);
+
+uint8_t float_to_unorm8(float value);
+
+/**
+ * @brief 단위 벡터를 octahedral 매핑으로 2 성분([-1, 1])으로 인코딩합니다.
+ * @details 길이가 0 인 벡터는 +Z 로 취급합니다.
+ */
+void octahedral_encode(const float normal[3], float encoded[2]);
+
+/**
+ * @brief octahedral_encode 의 역변환. 정규화된 벡터를 반환합니다.
+ */
+void octahedral_decode(const float encoded[2], float normal[3]);
+
+/**
+ * @brief 스키닝 가중치 4 개를 합이 정확히 255 가 되도록 UNORM8 로 양자화합니다.
+ * @details 반올림 오차는 가장 큰 가중치에 더하거나 빼서 보정합니다. 가중치 합이 0 이면 모두 0 입니다.
+ */
+void weights_to_unorm8(const float weights[4], uint8_t quantized[4]);
+
+}
@@ -0,0 +1,128 @@
+#include "tools/ev-accessor.h"
+#include <algorithm>
+#include <cstring>
+
+using namespace ev::tools::accessor;
+
+namespace {
+
+template <typename T>
+T load(const uint8_t* src) {
+    // bufferView 오프셋과 stride 는 성분 크기 정렬이 보장되지 않으므로 memcpy 로 읽음
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    return value;
+}
+
+}
+
+uint32_t ev::tools::accessor::component_size(ComponentType type) {
+    switch ( type ) {
+        case ComponentType::Byte:
+        case ComponentType::UnsignedByte:
+            return 1;
+        case ComponentType::Short:
+        case ComponentType::UnsignedShort:
+            return 2;
+        case ComponentType::UnsignedInt:
+        case ComponentType::Float:
+            return 4;
+    }
+    return 0;
+}
+
+bool View::is_valid(size_t offset, size_t buffer_size) const {
+    const uint32_t element_size = get_element_size();
+    if ( element_size == 0 || components == 0 || get_stride() < element_size || offset > buffer_size ) {
+        return false;
+    }
+    if ( count == 0 ) {
+        return true;
+    }
+    const size_t last = static_cast<size_t>(count - 1) * get_stride();
+    return last / get_stride() == count - 1 && last + element_size <= buffer_size - offset;
+}
+
+float ev::tools::accessor::dequantize(double value, ComponentType type, bool normalized) {
+    if ( !normalized ) {
+        return static_cast<float>(value);
+    }
+    switch ( type ) {
+        case ComponentType::Byte:
+            return std::max(static_cast<float>(value) / 127.0f, -1.0f);
+        case ComponentType::UnsignedByte:
+            return static_cast<float>(value) / 255.0f;
+        case ComponentType::Short:
+            return std::max(static_cast<float>(value) / 32767.0f, -1.0f);
+        case ComponentType::UnsignedShort:
+            return static_cast<float>(value) / 65535.0f;
+        case ComponentType::UnsignedInt:
+            return static_cast<float>(value / 4294967295.0);
+        default:
+            return static_cast<float>(value);
+    }
+}
+
+float ev::tools::accessor::read_float(const View& view, size_t index, uint32_t component) {
+    const uint8_t* src = view.element(index) + component * component_size(view.component_type);
+    switch ( view.component_type ) {
+        case ComponentType::Byte: return dequantize(load<int8_t>(src), view.component_type, view.normalized);
+        case ComponentType::UnsignedByte: return dequantize(load<uint8_t>(src), view.component_type, view.normalized);
+        case ComponentType::Short: return dequantize(load<int16_t>(src), view.component_type, view.normalized);
+        case ComponentType::UnsignedShort: return dequantize(load<uint16_t>(src), view.component_type, view.normalized);
+        case ComponentType::UnsignedInt: return dequantize(load<uint32_t>(src), view.component_type, view.normalized);
+        case ComponentType::Float: return load<float>(src);
+    }
+    return 0.0f;
+}
+
+uint32_t ev::tools::accessor::read_uint(const View& view, size_t index, uint32_t component) {
+    const uint8_t* src = view.element(index) + component * component_size(view.component_type);
+    switch ( view.component_type ) {
+        case ComponentType::Byte: return static_cast<uint32_t>(std::max<int8_t>(load<int8_t>(src), 0));
+        case ComponentType::UnsignedByte: return load<uint8_t>(src);
+        case ComponentType::Short: return static_cast<uint32_t>(std::max<int16_t>(load<int16_t>(src), 0));
+        case ComponentType::UnsignedShort: return load<uint16_t>(src);
+        case ComponentType::UnsignedInt: return load<uint32_t>(src);
+        case ComponentType::Float: return static_cast<uint32_t>(std::max(load<float>(src), 0.0f));
+    }
+    return 0;
+}
+
+void ev::tools::accessor::read_floats(const View& view, float* dst, size_t dst_stride, uint32_t dst_components, const float* defaults) {
+    const uint32_t read_components = std::min(view.components, dst_components);
+    uint8_t* out = reinterpret_cast<uint8_t*>(dst);
+
+    if ( view.component_type == ComponentType::Float ) {
+        // float 는 변환 없이 성분 구간만 복사
+        for ( size_t i = 0 ; i < view.count ; ++i ) {
+            float* element = reinterpret_cast<float*>(out + i * dst_stride);
+            std::memcpy(element, view.element(i), read_components * sizeof(float));
+            for ( uint32_t c = read_components ; c < dst_components ; ++c ) {
+                element[c] = defaults ? defaults[c] : 0.0f;
+            }
+        }
+        return;
+    }
+
+    for ( size_t i = 0 ; i < view.count ; ++i ) {
+        float* element = reinterpret_cast<float*>(out + i * dst_stride);
+        for ( uint32_t c = 0 ; c < read_components ; ++c ) {
+            element[c] = read_float(view, i, c);
+        }
+        for ( uint32_t c = read_components ; c < dst_components ; ++c ) {
+            element[c] = defaults ? defaults[c] : 0.0f;
+        }
+    }
+}
+
+void ev::tools::accessor::copy_elements(const View& view, uint8_t* dst, size_t dst_stride) {
+    const uint32_t element_size = view.get_element_size();
+    if ( view.get_stride() == element_size && dst_stride == element_size ) {
+        std::memcpy(dst, view.data, view.count * element_size);
+        return;
+    }
+    for ( size_t i = 0 ; i < view.count ; ++i ) {
+        std::memcpy(dst + i * dst_stride, view.element(i), element_size);
+    }
+}
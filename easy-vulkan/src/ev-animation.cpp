@@ -0,0 +1,468 @@
+#include "tools/ev-animation.h"
+#include "tools/ev-parallel.h"
+#include "ev-logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define EV_ANIMATION_SSE2 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define EV_ANIMATION_NEON 1
+#endif
+
+using namespace ev::tools;
+
+namespace {
+
+/** cursor 에서 이 횟수 이상 앞으로 이동해야 하면 이진 탐색으로 전환 */
+constexpr uint32_t CURSOR_SCAN = 4;
+
+/** 한 스레드가 한 번에 가져갈 mixer 수 */
+constexpr uint32_t MIXER_GRAIN = 8;
+
+/**
+ * @brief time 을 포함하는 키 구간 [key, key + 1] 을 찾고 cursor 를 갱신합니다.
+ * @details 이전 위치에서 앞으로 몇 칸만 확인하므로 재생 중에는 상수 시간이며, 되감거나 크게 건너뛴 경우에만 이진 탐색합니다.
+ * 범위 밖의 시간은 처음/마지막 키로 고정합니다. (alpha 0 또는 1)
+ */
+inline uint32_t find_key(const float* times, uint32_t count, float time, uint32_t& cursor, float& alpha) {
+    if ( count < 2 || time <= times[0] ) {
+        cursor = 0;
+        alpha = 0.0f;
+        return 0;
+    }
+    const uint32_t last = count - 1;
+    if ( time >= times[last] ) {
+        cursor = last - 1;
+        alpha = 1.0f;
+        return last - 1;
+    }
+
+    uint32_t key = std::min(cursor, last - 1);
+    if ( time < times[key] ) {
+        key = static_cast<uint32_t>(std::upper_bound(times, times + count, time) - times) - 1;
+    } else {
+        for ( uint32_t steps = 0 ; time >= times[key + 1] ; ++steps ) {
+            if ( steps == CURSOR_SCAN ) {
+                key = static_cast<uint32_t>(std::upper_bound(times + key, times + count, time) - times) - 1;
+                break;
+            }
+            ++key;
+        }
+    }
+    cursor = key;
+    alpha = (time - times[key]) / (times[key + 1] - times[key]);
+    return key;
+}
+
+inline void normalize_quaternion(float q[4]) {
+    const float length = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    if ( length > 0.0f ) {
+        const float inverse = 1.0f / length;
+        for ( int c = 0 ; c < 4 ; ++c ) {
+            q[c] *= inverse;
+        }
+    }
+}
+
+}
+
+const char* animation::simd_backend() {
+#if defined(EV_ANIMATION_SSE2)
+    return "sse2";
+#elif defined(EV_ANIMATION_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+/*
+ * 보정된 nlerp (Kapoulkine, "Approximating slerp")
+ * nlerp 는 구간 가운데에서 각속도가 빨라지므로 두 쿼터니언 사이 각도(d = |cos|)에 따라 t 를 3 차식으로 보정합니다.
+ */
+void animation::scalar::interpolate_quaternions(float* const dst[4], const float* const from[4], const float* const to[4],
+    const float* t, size_t count) {
+    for ( size_t i = 0 ; i < count ; ++i ) {
+        const float dot = from[0][i] * to[0][i] + from[1][i] * to[1][i] + from[2][i] * to[2][i] + from[3][i] * to[3][i];
+        const float sign = dot < 0.0f ? -1.0f : 1.0f;
+        const float d = std::fabs(dot);
+        const float a = 1.0904f + d * (-3.2452f + d * (3.55645f - d * 1.43519f));
+        const float b = 0.848013f + d * (-1.06021f + d * 0.215638f);
+        const float centered = t[i] - 0.5f;
+        const float k = a * centered * centered + b;
+        const float ot = t[i] + t[i] * centered * (t[i] - 1.0f) * k;
+
+        float q[4];
+        for ( int c = 0 ; c < 4 ; ++c ) {
+            q[c] = from[c][i] + (to[c][i] * sign - from[c][i]) * ot;
+        }
+        normalize_quaternion(q);
+        for ( int c = 0 ; c < 4 ; ++c ) {
+            dst[c][i] = q[c];
+        }
+    }
+}
+
+void animation::interpolate_quaternions(float* const dst[4], const float* const from[4], const float* const to[4],
+    const float* t, size_t count) {
+    size_t i = 0;
+#if defined(EV_ANIMATION_SSE2)
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 three_halves = _mm_set1_ps(1.5f);
+    for ( ; i + 4 <= count ; i += 4 ) {
+        __m128 a[4], b[4];
+        for ( int c = 0 ; c < 4 ; ++c ) {
+            a[c] = _mm_loadu_ps(from[c] + i);
+            b[c] = _mm_loadu_ps(to[c] + i);
+        }
+        __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[0], b[0]), _mm_mul_ps(a[1], b[1])),
+            _mm_add_ps(_mm_mul_ps(a[2], b[2]), _mm_mul_ps(a[3], b[3])));
+        const __m128 sign = _mm_and_ps(dot, sign_mask);
+        const __m128 d = _mm_andnot_ps(sign_mask, dot);
+
+        __m128 ka = _mm_sub_ps(_mm_set1_ps(3.55645f), _mm_mul_ps(d, _mm_set1_ps(1.43519f)));
+        ka = _mm_add_ps(_mm_set1_ps(-3.2452f), _mm_mul_ps(d, ka));
+        ka = _mm_add_ps(_mm_set1_ps(1.0904f), _mm_mul_ps(d, ka));
+        __m128 kb = _mm_add_ps(_mm_set1_ps(-1.06021f), _mm_mul_ps(d, _mm_set1_ps(0.215638f)));
+        kb = _mm_add_ps(_mm_set1_ps(0.848013f), _mm_mul_ps(d, kb));
+
+        const __m128 tv = _mm_loadu_ps(t + i);
+        const __m128 centered = _mm_sub_ps(tv, half);
+        const __m128 k = _mm_add_ps(_mm_mul_ps(ka, _mm_mul_ps(centered, centered)), kb);
+        const __m128 ot = _mm_add_ps(tv, _mm_mul_ps(_mm_mul_ps(tv, centered), _mm_mul_ps(_mm_sub_ps(tv, one), k)));
+
+        __m128 q[4];
+        __m128 length2 = _mm_setzero_ps();
+        for ( int c = 0 ; c < 4 ; ++c ) {
+            const __m128 target = _mm_xor_ps(b[c], sign);
+            q[c] = _mm_add_ps(a[c], _mm_mul_ps(_mm_sub_ps(target, a[c]), ot));
+            length2 = _mm_add_ps(length2, _mm_mul_ps(q[c], q[c]));
+        }
+        // rsqrt 근사값에 Newton-Raphson 1 회
+        __m128 inverse = _mm_rsqrt_ps(length2);
+        inverse = _mm_mul_ps(inverse, _mm_sub_ps(three_halves, _mm_mul_ps(_mm_mul_ps(half, length2), _mm_mul_ps(inverse, inverse))));
+        for ( int c = 0 ; c < 4 ; ++c ) {
+            _mm_storeu_ps(dst[c] + i, _mm_mul_ps(q[c], inverse));
+        }
+    }
+#elif defined(EV_ANIMATION_NEON)
+    const uint32x4_t sign_mask = vdupq_n_u32(0x80000000u);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    for ( ; i + 4 <= count ; i += 4 ) {
+        float32x4_t a[4], b[4];
+        for ( int c = 0 ; c < 4 ; ++c ) {
+            a[c] = vld1q_f32(from[c] + i);
+            b[c] = vld1q_f32(to[c] + i);
+        }
+        float32x4_t dot = vmulq_f32(a[0], b[0]);
+        dot = vmlaq_f32(dot, a[1], b[1]);
+        dot = vmlaq_f32(dot, a[2], b[2]);
+        dot = vmlaq_f32(dot, a[3], b[3]);
+        const uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(dot), sign_mask);
+        const float32x4_t d = vabsq_f32(dot);
+
+        float32x4_t ka = vmlsq_f32(vdupq_n_f32(3.55645f), d, vdupq_n_f32(1.43519f));
+        ka = vmlaq_f32(vdupq_n_f32(-3.2452f), d, ka);
+        ka = vmlaq_f32(vdupq_n_f32(1.0904f), d, ka);
+        float32x4_t kb = vmlaq_f32(vdupq_n_f32(-1.06021f), d, vdupq_n_f32(0.215638f));
+        kb = vmlaq_f32(vdupq_n_f32(0.848013f), d, kb);
+
+        const float32x4_t tv = vld1q_f32(t + i);
+        const float32x4_t centered = vsubq_f32(tv, half);
+        const float32x4_t k = vmlaq_f32(kb, ka, vmulq_f32(centered, centered));
+        const float32x4_t ot = vmlaq_f32(tv, vmulq_f32(tv, centered), vmulq_f32(vsubq_f32(tv, one), k));
+
+        float32x4_t q[4];
+        float32x4_t length2 = vdupq_n_f32(0.0f);
+        for ( int c = 0 ; c < 4 ; ++c ) {
+            const float32x4_t target = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(b[c]), sign));
+            q[c] = vmlaq_f32(a[c], vsubq_f32(target, a[c]), ot);
+            length2 = vmlaq_f32(length2, q[c], q[c]);
+        }
+        float32x4_t inverse = vrsqrteq_f32(length2);
+        inverse = vmulq_f32(inverse, vrsqrtsq_f32(vmulq_f32(length2, inverse), inverse));
+        inverse = vmulq_f32(inverse, vrsqrtsq_f32(vmulq_f32(length2, inverse), inverse));
+        for ( int c = 0 ; c < 4 ; ++c ) {
+            vst1q_f32(dst[c] + i, vmulq_f32(q[c], inverse));
+        }
+    }
+#endif
+    if ( i < count ) {
+        float* const dst_tail[4] = { dst[0] + i, dst[1] + i, dst[2] + i, dst[3] + i };
+        const float* const from_tail[4] = { from[0] + i, from[1] + i, from[2] + i, from[3] + i };
+        const float* const to_tail[4] = { to[0] + i, to[1] + i, to[2] + i, to[3] + i };
+        scalar::interpolate_quaternions(dst_tail, from_tail, to_tail, t + i, count - i);
+    }
+}
+
+void AnimationClip::add_track(uint32_t node, Path path, Interpolation interpolation,
+    const float* times, uint32_t key_count, const float* values) {
+    if ( key_count == 0 ) {
+        return;
+    }
+    const uint32_t value_count = interpolation == CUBICSPLINE ? key_count * 3 : key_count;
+    if ( tracks.empty() ) {
+        start_time = times[0];
+        end_time = times[key_count - 1];
+    } else {
+        start_time = std::min(start_time, times[0]);
+        end_time = std::max(end_time, times[key_count - 1]);
+    }
+
+    Track track;
+    track.node = node;
+    track.path = path;
+    track.interpolation = interpolation;
+    track.first_key = static_cast<uint32_t>(this->times.size());
+    track.key_count = key_count;
+    track.first_value = static_cast<uint32_t>(this->values.size() / 4);
+    tracks.push_back(track);
+
+    this->times.insert(this->times.end(), times, times + key_count);
+    this->values.insert(this->values.end(), values, values + static_cast<size_t>(value_count) * 4);
+}
+
+AnimationMixer::AnimationMixer(std::shared_ptr<TransformHierarchy> target)
+    : target(std::move(target)) {
+    if ( !this->target ) {
+        ev_log_error("[ev::tools::AnimationMixer::AnimationMixer] Target transform hierarchy is null.");
+        exit(EXIT_FAILURE);
+    }
+    const size_t count = this->target->size();
+    for ( auto& axis : accum_translations ) axis.assign(count, 0.0f);
+    for ( auto& axis : accum_rotations ) axis.assign(count, 0.0f);
+    for ( auto& axis : accum_scales ) axis.assign(count, 0.0f);
+    translation_weights.assign(count, 0.0f);
+    rotation_weights.assign(count, 0.0f);
+    scale_weights.assign(count, 0.0f);
+    touched.assign(count, 0);
+}
+
+uint32_t AnimationMixer::add_layer(std::shared_ptr<const AnimationClip> clip, float weight, bool loop) {
+    for ( const auto& track : clip->get_tracks() ) {
+        if ( track.node >= target->size() ) {
+            ev_log_error("[ev::tools::AnimationMixer::add_layer] Clip %s targets node %u out of %zu.",
+                clip->get_name().c_str(), track.node, target->size());
+            exit(EXIT_FAILURE);
+        }
+    }
+    Layer layer;
+    layer.time = clip->get_start_time();
+    layer.weight = weight;
+    layer.loop = loop;
+    layer.cursors.assign(clip->get_tracks().size(), 0);
+    layer.clip = std::move(clip);
+    layers.push_back(std::move(layer));
+    return static_cast<uint32_t>(layers.size() - 1);
+}
+
+void AnimationMixer::advance(float delta_time) {
+    for ( auto& layer : layers ) {
+        const float start = layer.clip->get_start_time();
+        const float duration = layer.clip->get_duration();
+        layer.time += delta_time * layer.speed;
+        if ( duration <= 0.0f ) {
+            layer.time = start;
+        } else if ( layer.loop ) {
+            layer.time = start + std::fmod(layer.time - start, duration);
+            if ( layer.time < start ) {
+                layer.time += duration;
+            }
+        } else {
+            layer.time = std::clamp(layer.time, start, layer.clip->get_end_time());
+        }
+    }
+}
+
+void AnimationMixer::touch(uint32_t node) {
+    if ( !touched[node] ) {
+        touched[node] = 1;
+        touched_nodes.push_back(node);
+    }
+}
+
+void AnimationMixer::accumulate(uint32_t node, AnimationClip::Path path, const float value[4], float weight) {
+    touch(node);
+    switch ( path ) {
+        case AnimationClip::TRANSLATION:
+            for ( int c = 0 ; c < 3 ; ++c ) {
+                accum_translations[c][node] += value[c] * weight;
+            }
+            translation_weights[node] += weight;
+            break;
+        case AnimationClip::ROTATION: {
+            // q 와 -q 는 같은 회전이므로 누적값과 같은 반구로 맞춘 뒤 더함
+            float dot = 0.0f;
+            for ( int c = 0 ; c < 4 ; ++c ) {
+                dot += accum_rotations[c][node] * value[c];
+            }
+            const float signed_weight = dot < 0.0f ? -weight : weight;
+            for ( int c = 0 ; c < 4 ; ++c ) {
+                accum_rotations[c][node] += value[c] * signed_weight;
+            }
+            rotation_weights[node] += weight;
+            break;
+        }
+        case AnimationClip::SCALE:
+            for ( int c = 0 ; c < 3 ; ++c ) {
+                accum_scales[c][node] += value[c] * weight;
+            }
+            scale_weights[node] += weight;
+            break;
+    }
+}
+
+void AnimationMixer::sample_layer(Layer& layer) {
+    const AnimationClip& clip = *layer.clip;
+    const auto& tracks = clip.get_tracks();
+    for ( int c = 0 ; c < 4 ; ++c ) {
+        batch_from[c].resize(tracks.size());
+        batch_to[c].resize(tracks.size());
+    }
+    batch_t.resize(tracks.size());
+    batch_nodes.resize(tracks.size());
+    size_t batch_count = 0;
+
+    for ( size_t i = 0 ; i < tracks.size() ; ++i ) {
+        const AnimationClip::Track& track = tracks[i];
+        const float* times = clip.get_times(track);
+        const float* values = clip.get_values(track);
+        const bool cubic = track.interpolation == AnimationClip::CUBICSPLINE;
+        float alpha;
+        const uint32_t key = find_key(times, track.key_count, layer.time, layer.cursors[i], alpha);
+
+        float value[4];
+        if ( track.key_count == 1 || track.interpolation == AnimationClip::STEP ) {
+            const uint32_t index = alpha >= 1.0f ? key + 1 : key;
+            const float* v = values + static_cast<size_t>(cubic ? index * 3 + 1 : index) * 4;
+            std::copy(v, v + 4, value);
+        } else if ( cubic ) {
+            // Hermite spline, 접선은 키 간격으로 스케일 (glTF 2.0 Appendix C)
+            const float dt = times[key + 1] - times[key];
+            const float* p0 = values + static_cast<size_t>(key * 3 + 1) * 4;
+            const float* m0 = values + static_cast<size_t>(key * 3 + 2) * 4;
+            const float* p1 = values + static_cast<size_t>((key + 1) * 3 + 1) * 4;
+            const float* m1 = values + static_cast<size_t>((key + 1) * 3) * 4;
+            const float s2 = alpha * alpha;
+            const float s3 = s2 * alpha;
+            const float h00 = 2.0f * s3 - 3.0f * s2 + 1.0f;
+            const float h10 = (s3 - 2.0f * s2 + alpha) * dt;
+            const float h01 = -2.0f * s3 + 3.0f * s2;
+            const float h11 = (s3 - s2) * dt;
+            for ( int c = 0 ; c < 4 ; ++c ) {
+                value[c] = h00 * p0[c] + h10 * m0[c] + h01 * p1[c] + h11 * m1[c];
+            }
+            if ( track.path == AnimationClip::ROTATION ) {
+                normalize_quaternion(value);
+            }
+        } else if ( track.path == AnimationClip::ROTATION ) {
+            const float* q0 = values + static_cast<size_t>(key) * 4;
+            const float* q1 = q0 + 4;
+            for ( int c = 0 ; c < 4 ; ++c ) {
+                batch_from[c][batch_count] = q0[c];
+                batch_to[c][batch_count] = q1[c];
+            }
+            batch_t[batch_count] = alpha;
+            batch_nodes[batch_count] = track.node;
+            ++batch_count;
+            continue;
+        } else {
+            const float* v0 = values + static_cast<size_t>(key) * 4;
+            const float* v1 = v0 + 4;
+            for ( int c = 0 ; c < 4 ; ++c ) {
+                value[c] = v0[c] + (v1[c] - v0[c]) * alpha;
+            }
+        }
+        accumulate(track.node, track.path, value, layer.weight);
+    }
+
+    // LINEAR 회전은 모아서 SIMD 로 보간
+    float* const rotations[4] = { batch_from[0].data(), batch_from[1].data(), batch_from[2].data(), batch_from[3].data() };
+    const float* const targets[4] = { batch_to[0].data(), batch_to[1].data(), batch_to[2].data(), batch_to[3].data() };
+    animation::interpolate_quaternions(rotations, rotations, targets, batch_t.data(), batch_count);
+    for ( size_t i = 0 ; i < batch_count ; ++i ) {
+        const float value[4] = { rotations[0][i], rotations[1][i], rotations[2][i], rotations[3][i] };
+        accumulate(batch_nodes[i], AnimationClip::ROTATION, value, layer.weight);
+    }
+}
+
+void AnimationMixer::apply() {
+    for ( auto& layer : layers ) {
+        if ( layer.weight > 0.0f ) {
+            sample_layer(layer);
+        }
+    }
+
+    float* translations[3] = {
+        target->get_translations(TransformHierarchy::X),
+        target->get_translations(TransformHierarchy::Y),
+        target->get_translations(TransformHierarchy::Z)
+    };
+    float* rotations[4] = {
+        target->get_rotations(TransformHierarchy::X),
+        target->get_rotations(TransformHierarchy::Y),
+        target->get_rotations(TransformHierarchy::Z),
+        target->get_rotations(TransformHierarchy::W)
+    };
+    float* scales[3] = {
+        target->get_scales(TransformHierarchy::X),
+        target->get_scales(TransformHierarchy::Y),
+        target->get_scales(TransformHierarchy::Z)
+    };
+
+    for ( uint32_t node : touched_nodes ) {
+        if ( translation_weights[node] > 0.0f ) {
+            const float inverse = 1.0f / translation_weights[node];
+            for ( int c = 0 ; c < 3 ; ++c ) {
+                translations[c][node] = accum_translations[c][node] * inverse;
+                accum_translations[c][node] = 0.0f;
+            }
+            translation_weights[node] = 0.0f;
+        }
+        if ( rotation_weights[node] > 0.0f ) {
+            float q[4] = { accum_rotations[0][node], accum_rotations[1][node], accum_rotations[2][node], accum_rotations[3][node] };
+            normalize_quaternion(q);
+            for ( int c = 0 ; c < 4 ; ++c ) {
+                rotations[c][node] = q[c];
+                accum_rotations[c][node] = 0.0f;
+            }
+            rotation_weights[node] = 0.0f;
+        }
+        if ( scale_weights[node] > 0.0f ) {
+            const float inverse = 1.0f / scale_weights[node];
+            for ( int c = 0 ; c < 3 ; ++c ) {
+                scales[c][node] = accum_scales[c][node] * inverse;
+                accum_scales[c][node] = 0.0f;
+            }
+            scale_weights[node] = 0.0f;
+        }
+        target->mark_dirty(node);
+        touched[node] = 0;
+    }
+    touched_nodes.clear();
+}
+
+void ev::tools::update_animations(const std::vector<std::shared_ptr<AnimationMixer>>& mixers, float delta_time, bool parallel) {
+    auto update_range = [&](uint32_t begin, uint32_t end) {
+        for ( uint32_t i = begin ; i < end ; ++i ) {
+            AnimationMixer& mixer = *mixers[i];
+            mixer.advance(delta_time);
+            mixer.apply();
+            mixer.get_target()->update(false);
+        }
+    };
+    if ( parallel ) {
+        parallel_for(static_cast<uint32_t>(mixers.size()), update_range, MIXER_GRAIN);
+    } else {
+        update_range(0, static_cast<uint32_t>(mixers.size()));
+    }
+}
@@ -0,0 +1,313 @@
+#include "tools/ev-bindless_materials.h"
+#include "ev-macro.h"
+
+using namespace ev::tools::gltf;
+
+BindlessMaterials::BindlessMaterials(
+    std::shared_ptr<ev::Device> device,
+    std::shared_ptr<ev::MemoryAllocator> memory_allocator,
+    uint32_t max_textures,
+    uint32_t max_materials
+) : device(std::move(device)),
+    memory_allocator(std::move(memory_allocator)),
+    max_textures(max_textures),
+    max_materials(max_materials) {
+    ev_log_info("[ev::tools::gltf::BindlessMaterials::BindlessMaterials] Creating BindlessMaterials.");
+
+    if ( !this->device || !this->memory_allocator || max_textures == 0 || max_materials == 0 ) {
+        ev_log_error("[ev::tools::gltf::BindlessMaterials::BindlessMaterials] Invalid parameters provided for BindlessMaterials creation.");
+        exit(EXIT_FAILURE);
+    }
+    if ( !this->device->is_descriptor_indexing_enabled() ) {
+        ev_log_error("[ev::tools::gltf::BindlessMaterials::BindlessMaterials] Descriptor indexing is not enabled on this device.");
+        exit(EXIT_FAILURE);
+    }
+
+    // 텍스처 배열은 일부만 채운 채로 바인딩하고, 바인딩 이후에도 사용하지 않는 원소는 갱신할 수 있어야 함
+    descriptor_set_layout = std::make_shared<ev::DescriptorSetLayout>(this->device, VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT);
+    descriptor_set_layout->add_binding(VK_SHADER_STAGE_FRAGMENT_BIT, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, TEXTURE_BINDING, max_textures);
+    descriptor_set_layout->add_binding(VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, MATERIAL_BINDING);
+    descriptor_set_layout->set_binding_flags(TEXTURE_BINDING,
+        VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT
+        | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT
+        | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT
+    );
+    CHECK_RESULT(descriptor_set_layout->create_layout());
+
+    descriptor_pool = std::make_shared<ev::DescriptorPool>(this->device);
+    descriptor_pool->add(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, max_textures);
+    descriptor_pool->add(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1);
+    CHECK_RESULT(descriptor_pool->create_pool(1,
+        VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT | VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT));
+    descriptor_set = descriptor_pool->allocate(descriptor_set_layout);
+
+    const VkDeviceSize buffer_size = static_cast<VkDeviceSize>(max_materials) * sizeof(MaterialData);
+    material_buffer = std::make_shared<ev::Buffer>(this->device, buffer_size, ev::buffer_type::READONLY_STORAGE_BUFFER);
+    CHECK_RESULT(this->memory_allocator->allocate_buffer(material_buffer, ev::memory_type::HOST_READABLE));
+    CHECK_RESULT(material_buffer->map(buffer_size));
+    descriptor_set->write_buffer(MATERIAL_BINDING, material_buffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    CHECK_RESULT(descriptor_set->update());
+
+    // 0 번은 텍스처가 없는 흰색 기본 머티리얼. 해제되지 않도록 참조 하나를 유지
+    materials.push_back({ nullptr, 1, 0 });
+    dirty_materials.push_back(0);
+    CHECK_RESULT(update());
+}
+
+uint32_t BindlessMaterials::get_texture_index(const std::shared_ptr<ev::Texture>& texture) const {
+    if ( !texture ) {
+        return NO_TEXTURE;
+    }
+    auto it = texture_indices.find(texture.get());
+    return it != texture_indices.end() ? it->second : NO_TEXTURE;
+}
+
+uint32_t BindlessMaterials::register_texture(const std::shared_ptr<ev::Texture>& texture) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return register_texture_locked(texture);
+}
+
+uint32_t BindlessMaterials::register_texture_locked(const std::shared_ptr<ev::Texture>& texture) {
+    if ( !texture ) {
+        return NO_TEXTURE;
+    }
+    auto it = texture_indices.find(texture.get());
+    if ( it != texture_indices.end() ) {
+        ++textures[it->second].references;
+        return it->second;
+    }
+    uint32_t index;
+    if ( !free_textures.empty() ) {
+        index = free_textures.back();
+        free_textures.pop_back();
+    } else if ( textures.size() < max_textures ) {
+        index = static_cast<uint32_t>(textures.size());
+        textures.emplace_back();
+    } else {
+        ev_log_warn("[ev::tools::gltf::BindlessMaterials::register_texture] Texture array is full (%u), texture ignored.", max_textures);
+        return NO_TEXTURE;
+    }
+    textures[index].texture = texture;
+    textures[index].references = 1;
+    texture_indices.emplace(texture.get(), index);
+    dirty_textures.push_back(index);
+    return index;
+}
+
+uint32_t BindlessMaterials::register_material(const std::shared_ptr<Material>& material) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return register_material_locked(material);
+}
+
+uint32_t BindlessMaterials::register_material_locked(const std::shared_ptr<Material>& material) {
+    if ( !material ) {
+        return 0;
+    }
+    auto it = material_indices.find(material.get());
+    if ( it != material_indices.end() ) {
+        // 해제를 기다리던 번호면 그대로 다시 사용
+        ++materials[it->second].references;
+        material->set_material_index(it->second);
+        return it->second;
+    }
+    uint32_t index;
+    if ( !free_materials.empty() ) {
+        index = free_materials.back();
+        free_materials.pop_back();
+    } else if ( materials.size() < max_materials ) {
+        index = static_cast<uint32_t>(materials.size());
+        materials.emplace_back();
+    } else {
+        ev_log_warn("[ev::tools::gltf::BindlessMaterials::register_material] Material buffer is full (%u), default material used.", max_materials);
+        material->set_material_index(0);
+        return 0;
+    }
+    register_texture_locked(material->get_base_color_texture());
+    register_texture_locked(material->get_metallic_roughness_texture());
+    register_texture_locked(material->get_normal_texture());
+    register_texture_locked(material->get_occlusion_texture());
+    register_texture_locked(material->get_emissive_texture());
+
+    materials[index].material = material;
+    materials[index].references = 1;
+    material_indices.emplace(material.get(), index);
+    dirty_materials.push_back(index);
+    material->set_material_index(index);
+    return index;
+}
+
+void BindlessMaterials::release_texture(const std::shared_ptr<ev::Texture>& texture) {
+    if ( !texture ) {
+        return;
+    }
+    auto it = texture_indices.find(texture.get());
+    if ( it == texture_indices.end() || textures[it->second].references == 0 ) {
+        return;
+    }
+    const uint32_t index = it->second;
+    if ( --textures[index].references == 0 ) {
+        texture_indices.erase(it);
+        textures[index].texture.reset();
+        free_textures.push_back(index);
+    }
+}
+
+void BindlessMaterials::release_material(const std::shared_ptr<Material>& material) {
+    if ( !material ) {
+        return;
+    }
+    auto it = material_indices.find(material.get());
+    if ( it == material_indices.end() || materials[it->second].references == 0 ) {
+        return;
+    }
+    MaterialSlot& slot = materials[it->second];
+    if ( --slot.references == 0 ) {
+        slot.released_frame = current_frame;
+        pending_materials.push_back({ current_frame, it->second });
+    }
+}
+
+void BindlessMaterials::free_material(uint32_t index) {
+    MaterialSlot& slot = materials[index];
+    std::shared_ptr<Material> material = std::move(slot.material);
+    material_indices.erase(material.get());
+    free_materials.push_back(index);
+
+    // 텍스처 번호는 머티리얼 데이터로만 참조되므로 이 머티리얼로만 쓰인 텍스처도 바로 해제할 수 있음
+    release_texture(material->get_base_color_texture());
+    release_texture(material->get_metallic_roughness_texture());
+    release_texture(material->get_normal_texture());
+    release_texture(material->get_occlusion_texture());
+    release_texture(material->get_emissive_texture());
+}
+
+void BindlessMaterials::add_model(const std::shared_ptr<Model>& model) {
+    if ( !model ) {
+        ev_log_error("[ev::tools::gltf::BindlessMaterials::add_model] Model is null.");
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    for ( const auto& material : model->get_materials() ) {
+        register_material_locked(material);
+    }
+    CHECK_RESULT(update_locked());
+    ev_log_debug("[ev::tools::gltf::BindlessMaterials::add_model] %zu textures, %zu materials registered.",
+        textures.size() - free_textures.size(), materials.size() - free_materials.size());
+}
+
+void BindlessMaterials::remove_model(const std::shared_ptr<Model>& model) {
+    if ( !model ) {
+        ev_log_error("[ev::tools::gltf::BindlessMaterials::remove_model] Model is null.");
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    for ( const auto& material : model->get_materials() ) {
+        if ( material && material_indices.count(material.get()) ) {
+            release_material(material);
+            material->set_material_index(0);
+        }
+    }
+    ev_log_debug("[ev::tools::gltf::BindlessMaterials::remove_model] %zu materials waiting for frame %llu.",
+        pending_materials.size(), static_cast<unsigned long long>(current_frame));
+}
+
+void BindlessMaterials::set_current_frame(uint64_t frame) {
+    std::lock_guard<std::mutex> lock(mutex);
+    current_frame = frame;
+}
+
+void BindlessMaterials::retire_frames(uint64_t completed_frame) {
+    std::lock_guard<std::mutex> lock(mutex);
+    // 다시 등록되었거나 더 늦은 프레임에 다시 해제된 번호는 건너뜀
+    while ( !pending_materials.empty() && pending_materials.front().frame <= completed_frame ) {
+        const PendingRelease release = pending_materials.front();
+        pending_materials.pop_front();
+        const MaterialSlot& slot = materials[release.index];
+        if ( slot.material && slot.references == 0 && slot.released_frame == release.frame ) {
+            free_material(release.index);
+        }
+    }
+}
+
+VkResult BindlessMaterials::update() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return update_locked();
+}
+
+VkResult BindlessMaterials::update_locked() {
+    MaterialData* data = static_cast<MaterialData*>(material_buffer->get_mapped_ptr());
+    for ( uint32_t index : dirty_materials ) {
+        MaterialData& dst = data[index];
+        dst = {};
+        dst.base_color_factor = glm::vec4(1.0f);
+        dst.metallic_factor = 1.0f;
+        dst.roughness_factor = 1.0f;
+        dst.alpha_cutoff = 0.5f;
+        dst.base_color_texture = NO_TEXTURE;
+        dst.metallic_roughness_texture = NO_TEXTURE;
+        dst.normal_texture = NO_TEXTURE;
+        dst.occlusion_texture = NO_TEXTURE;
+        dst.emissive_texture = NO_TEXTURE;
+
+        const std::shared_ptr<Material>& material = materials[index].material;
+        if ( !material ) {
+            continue;
+        }
+        dst.base_color_factor = material->get_base_color_factor();
+        dst.metallic_factor = material->get_metallic_factor();
+        dst.roughness_factor = material->get_roughness_factor();
+        dst.alpha_cutoff = material->get_alpha_cutoff();
+        dst.alpha_mode = static_cast<uint32_t>(material->get_alpha_mode());
+        dst.base_color_texture = get_texture_index(material->get_base_color_texture());
+        dst.metallic_roughness_texture = get_texture_index(material->get_metallic_roughness_texture());
+        dst.normal_texture = get_texture_index(material->get_normal_texture());
+        dst.occlusion_texture = get_texture_index(material->get_occlusion_texture());
+        dst.emissive_texture = get_texture_index(material->get_emissive_texture());
+        dst.double_sided = material->is_double_sided() ? 1u : 0u;
+    }
+    dirty_materials.clear();
+
+    if ( dirty_textures.empty() ) {
+        return VK_SUCCESS;
+    }
+    for ( uint32_t index : dirty_textures ) {
+        if ( textures[index].texture ) {
+            descriptor_set->write_texture_element(TEXTURE_BINDING, index, textures[index].texture);
+        }
+    }
+    dirty_textures.clear();
+    return descriptor_set->update();
+}
+
+void BindlessMaterials::bind(std::shared_ptr<ev::CommandBuffer> command_buffer,
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+    uint32_t set_index,
+    VkPipelineBindPoint bind_point
+) {
+    command_buffer->bind_descriptor_sets(bind_point, pipeline_layout, {descriptor_set}, set_index, {});
+}
+
+void BindlessMaterials::destroy() {
+    std::lock_guard<std::mutex> lock(mutex);
+    descriptor_set.reset();
+    if ( material_buffer ) {
+        material_buffer->unmap();
+    }
+    material_buffer.reset();
+    descriptor_pool.reset();
+    descriptor_set_layout.reset();
+    textures.clear();
+    texture_indices.clear();
+    materials.clear();
+    material_indices.clear();
+    free_textures.clear();
+    free_materials.clear();
+    pending_materials.clear();
+    dirty_textures.clear();
+    dirty_materials.clear();
+    ev_log_debug("[ev::tools::gltf::BindlessMaterials::destroy] BindlessMaterials destroyed.");
+}
+
+BindlessMaterials::~BindlessMaterials() {
+    destroy();
+}
@@ -1 +1,23 @@
-#include "ev-sync.h"
\ No newline at end of file
+#include "ev-sync.h"
+
+using namespace ev;
+
+BufferMemoryBarrier::BufferMemoryBarrier(
+    std::shared_ptr<ev::Buffer> buffer,
+    VkAccessFlags src_access_mask,
+    VkAccessFlags dst_access_mask,
+    VkDeviceSize size,
+    uint32_t src_queue_family_index,
+    uint32_t dst_queue_family_index,
+    void* next
+) {
+    buffer_memory_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    buffer_memory_barrier.pNext = next;
+    buffer_memory_barrier.srcAccessMask = src_access_mask;
+    buffer_memory_barrier.dstAccessMask = dst_access_mask;
+    buffer_memory_barrier.srcQueueFamilyIndex = src_queue_family_index;
+    buffer_memory_barrier.dstQueueFamilyIndex = dst_queue_family_index;
+    buffer_memory_barrier.buffer = *buffer;
+    buffer_memory_barrier.offset = 0;
+    buffer_memory_barrier.size = size;
+}
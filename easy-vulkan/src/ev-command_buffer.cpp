@@ -34,10 +34,11 @@ CommandBuffer::CommandBuffer(shared_ptr<Device> _device, VkCommandPool command_p
  * @param _device : Device 객체의 shared_ptr
  * @param command_pool : CommandPool 객체의 VkCommandPool 핸들
  * @param command_buffer : 이미 할당된 VkCommandBuffer 핸들
+ * @param level : command_buffer 를 할당할 때 사용한 레벨
  * 이 생성자는 한번에 대량의 CommandPool을 이용하여 VkCommandBuffer를 할당하는 경우 사용합니다.
  */
-CommandBuffer::CommandBuffer(shared_ptr<Device> _device, VkCommandPool command_pool, VkCommandBuffer command_buffer)
-: device(std::move(_device)), command_pool(command_pool), command_buffer(command_buffer) {
+CommandBuffer::CommandBuffer(shared_ptr<Device> _device, VkCommandPool command_pool, VkCommandBuffer command_buffer, VkCommandBufferLevel level)
+: device(std::move(_device)), command_buffer(command_buffer), command_pool(command_pool), level(level) {
     if (!device) {
         ev_log_error("[CommandBuffer::CommandBuffer] : Invalid device provided for CommandBuffer creation.");
         exit(EXIT_FAILURE);
@@ -201,6 +202,19 @@ void CommandBuffer::copy_buffer(
     vkCmdCopyBuffer(command_buffer, *src_buffer, *dst_buffer, 1, &copy_region);
 }
 
+void CommandBuffer::fill_buffer(
+    shared_ptr<Buffer> buffer,
+    VkDeviceSize offset,
+    VkDeviceSize size,
+    uint32_t data
+) {
+    if (command_buffer == VK_NULL_HANDLE) {
+        ev_log_error("[CommandBuffer::fill_buffer] : Command buffer is not allocated.");
+        exit(EXIT_FAILURE);
+    }
+    vkCmdFillBuffer(command_buffer, *buffer, offset, size, data);
+}
+
 void CommandBuffer::copy_buffer_to_image(
     shared_ptr<Image> dst_image, 
     shared_ptr<Buffer> src_buffer, 
@@ -285,6 +299,58 @@ void CommandBuffer::draw_indexed(uint32_t index_count,
     vkCmdDrawIndexed(command_buffer, index_count, instance_count, first_index, vertex_offset, first_instance);
 }
 
+void CommandBuffer::draw_indexed_indirect(shared_ptr<Buffer> buffer,
+    VkDeviceSize offset,
+    uint32_t draw_count,
+    uint32_t stride) {
+    if (command_buffer == VK_NULL_HANDLE) {
+        ev_log_error("[CommandBuffer::draw_indexed_indirect] : Command buffer is not allocated.");
+        exit(EXIT_FAILURE);
+    }
+    if (!buffer) {
+        ev_log_error("[CommandBuffer::draw_indexed_indirect] : Indirect buffer is null.");
+        exit(EXIT_FAILURE);
+    }
+    vkCmdDrawIndexedIndirect(command_buffer, *buffer, offset, draw_count, stride);
+}
+
+void CommandBuffer::draw_indexed_indirect_count(shared_ptr<Buffer> buffer,
+    VkDeviceSize offset,
+    shared_ptr<Buffer> count_buffer,
+    VkDeviceSize count_offset,
+    uint32_t max_draw_count,
+    uint32_t stride) {
+    if (command_buffer == VK_NULL_HANDLE) {
+        ev_log_error("[CommandBuffer::draw_indexed_indirect_count] : Command buffer is not allocated.");
+        exit(EXIT_FAILURE);
+    }
+    if (!buffer || !count_buffer) {
+        ev_log_error("[CommandBuffer::draw_indexed_indirect_count] : Indirect or count buffer is null.");
+        exit(EXIT_FAILURE);
+    }
+    PFN_vkCmdDrawIndexedIndirectCount cmd_draw_indexed_indirect_count = device->get_cmd_draw_indexed_indirect_count();
+    if (cmd_draw_indexed_indirect_count == nullptr) {
+        ev_log_error("[CommandBuffer::draw_indexed_indirect_count] : drawIndirectCount is not enabled on the device.");
+        exit(EXIT_FAILURE);
+    }
+    cmd_draw_indexed_indirect_count(command_buffer, *buffer, offset, *count_buffer, count_offset, max_draw_count, stride);
+}
+
+void CommandBuffer::draw_mesh_tasks(uint32_t group_count_x,
+    uint32_t group_count_y,
+    uint32_t group_count_z) {
+    if (command_buffer == VK_NULL_HANDLE) {
+        ev_log_error("[CommandBuffer::draw_mesh_tasks] : Command buffer is not allocated.");
+        exit(EXIT_FAILURE);
+    }
+    PFN_vkCmdDrawMeshTasksEXT cmd_draw_mesh_tasks = device->get_cmd_draw_mesh_tasks();
+    if (cmd_draw_mesh_tasks == nullptr) {
+        ev_log_error("[CommandBuffer::draw_mesh_tasks] : VK_EXT_mesh_shader is not enabled on the device.");
+        exit(EXIT_FAILURE);
+    }
+    cmd_draw_mesh_tasks(command_buffer, group_count_x, group_count_y, group_count_z);
+}
+
 void CommandBuffer::set_viewport(
     float x,
     float y,
@@ -406,6 +472,55 @@ VkResult CommandBuffer::begin(VkCommandBufferUsageFlags flags) {
     return vkBeginCommandBuffer(command_buffer, &begin_info);
 }
 
+VkResult CommandBuffer::begin_secondary(shared_ptr<RenderPass> render_pass,
+    uint32_t subpass,
+    shared_ptr<Framebuffer> framebuffer,
+    VkCommandBufferUsageFlags flags
+) {
+    if (command_buffer == VK_NULL_HANDLE) {
+        ev_log_error("[CommandBuffer::begin_secondary] : Command buffer is not allocated.");
+        return VK_SUCCESS;
+    }
+    if (level != VK_COMMAND_BUFFER_LEVEL_SECONDARY) {
+        ev_log_error("[CommandBuffer::begin_secondary] : Command buffer is not a secondary command buffer.");
+        exit(EXIT_FAILURE);
+    }
+
+    VkCommandBufferInheritanceInfo inheritance_info = {};
+    inheritance_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    if (render_pass) {
+        inheritance_info.renderPass = *render_pass;
+        inheritance_info.subpass = subpass;
+        inheritance_info.framebuffer = framebuffer ? VkFramebuffer(*framebuffer) : VK_NULL_HANDLE;
+        flags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    }
+
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.flags = flags;
+    begin_info.pInheritanceInfo = &inheritance_info;
+    return vkBeginCommandBuffer(command_buffer, &begin_info);
+}
+
+void CommandBuffer::execute_commands(const vector<shared_ptr<CommandBuffer>>& command_buffers) {
+    if (command_buffer == VK_NULL_HANDLE) {
+        ev_log_error("[CommandBuffer::execute_commands] : Command buffer is not allocated.");
+        exit(EXIT_FAILURE);
+    }
+
+    vector<VkCommandBuffer> secondaries;
+    secondaries.reserve(command_buffers.size());
+    for (const auto& secondary : command_buffers) {
+        if (secondary) {
+            secondaries.push_back(*secondary);
+        }
+    }
+    if (secondaries.empty()) {
+        return;
+    }
+    vkCmdExecuteCommands(command_buffer, static_cast<uint32_t>(secondaries.size()), secondaries.data());
+}
+
 void CommandBuffer::bind_compute_pipeline(std::shared_ptr<ComputePipeline> &pipeline) {
     if (command_buffer == VK_NULL_HANDLE) {
         ev_log_error("[CommandBuffer::bind_compute_pipeline] : Command buffer is not allocated.");
@@ -52,11 +52,19 @@ vector<shared_ptr<CommandBuffer>> CommandPool::allocate(size_t nr_commands, VkCo
     CHECK_RESULT(result);
     vector<shared_ptr<CommandBuffer>> command_buffer_objects(nr_commands);
     for (size_t i = 0; i < nr_commands; ++i) {
-        command_buffer_objects[i] = make_shared<CommandBuffer>(device, command_pool, command_buffers[i]);
+        command_buffer_objects[i] = make_shared<CommandBuffer>(device, command_pool, command_buffers[i], level);
     }
     return command_buffer_objects;
 }
 
+VkResult CommandPool::reset(VkCommandPoolResetFlags flags) {
+    if (command_pool == VK_NULL_HANDLE) {
+        ev_log_error("Command pool is not created.");
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    return vkResetCommandPool(*device, command_pool, flags);
+}
+
 void CommandPool::destroy() {
     if (command_pool != VK_NULL_HANDLE) {
         ev_log_info("[CommandPool::destroy] : Destroying CommandPool.");
@@ -4,7 +4,7 @@ using namespace std;
 using namespace ev;
 
 DescriptorSetLayout::DescriptorSetLayout(shared_ptr<Device> _device, VkDescriptorSetLayoutCreateFlags _flags)
-    : device(std::move(_device)) {
+    : device(std::move(_device)), flags(_flags) {
     if (!device) {
         ev_log_error("[ev::DescriptorSetLayout] Invalid device provided for DescriptorSetLayout creation.");
         exit(EXIT_FAILURE);
@@ -37,9 +37,24 @@ void DescriptorSetLayout::add_binding(VkShaderStageFlags flags,
         }
     }
     bindings.push_back(layout_binding);
+    binding_flags.push_back(0);
     ev_log_debug("[ev::DescriptorSetLayout] Binding added: %d, type: %d, count: %d, flags: %d", static_cast<int>(binding), static_cast<int>(type), static_cast<int>(count), static_cast<int>(flags));
 }
 
+void DescriptorSetLayout::set_binding_flags(uint32_t binding, VkDescriptorBindingFlags flags) {
+    if ( layout != VK_NULL_HANDLE ) {
+        ev_log_warn("[ev::DescriptorSetLayout] DescriptorSetLayout already created. can not change binding flags.");
+        return;
+    }
+    for ( size_t i = 0 ; i < bindings.size() ; ++i ) {
+        if ( bindings[i].binding == binding ) {
+            binding_flags[i] = flags;
+            return;
+        }
+    }
+    ev_log_warn("[ev::DescriptorSetLayout] Binding %d does not exist, binding flags ignored.", static_cast<int>(binding));
+}
+
 VkResult DescriptorSetLayout::create_layout() {
     if (layout != VK_NULL_HANDLE) {
         ev_log_warn("[ev::DescriptorSetLayout] DescriptorSetLayout already created, destroying the old layout.");
@@ -57,6 +72,14 @@ VkResult DescriptorSetLayout::create_layout() {
     layout_info.pBindings = bindings.data();
     layout_info.flags = flags;
 
+    VkDescriptorSetLayoutBindingFlagsCreateInfo binding_flags_info = {};
+    binding_flags_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+    binding_flags_info.bindingCount = static_cast<uint32_t>(binding_flags.size());
+    binding_flags_info.pBindingFlags = binding_flags.data();
+    if ( std::any_of(binding_flags.begin(), binding_flags.end(), [](VkDescriptorBindingFlags f) { return f != 0; }) ) {
+        layout_info.pNext = &binding_flags_info;
+    }
+
     VkResult result = vkCreateDescriptorSetLayout(*device, &layout_info, nullptr, &layout);
     if (result != VK_SUCCESS) {
         ev_log_error("[ev::DescriptorSetLayout] Failed to create DescriptorSetLayout: %d", static_cast<int>(result));
@@ -146,6 +169,23 @@ void DescriptorSet::write_texture(uint32_t binding,
     ev_log_debug("[ev::DescriptorSet::write_texture] Writing texture to descriptor set with binding: %d, type: %d", static_cast<int>(binding), static_cast<int>(type));
 }
 
+void DescriptorSet::write_texture_element(uint32_t binding,
+    uint32_t array_element,
+    shared_ptr<ev::Texture> texture,
+    VkDescriptorType type
+) {
+    if (!texture || !texture->image || !texture->image_view || !texture->sampler) {
+        ev_log_error("[ev::DescriptorSet::write_texture_element] Invalid image, view, or sampler provided for DescriptorSet texture write.");
+        return;
+    }
+
+    image_infos.emplace_back( texture->get_descriptor() );
+    WriteInfo write_info = {binding, type, static_cast<uint32_t>(image_infos.size() - 1), array_element};
+    image_write_infos.emplace_back(write_info);
+    ev_log_debug("[ev::DescriptorSet::write_texture_element] Writing texture to descriptor set with binding: %d, element: %d, type: %d",
+        static_cast<int>(binding), static_cast<int>(array_element), static_cast<int>(type));
+}
+
 VkResult DescriptorSet::update() {
     ev_log_debug("[ev::DescriptorSet::update] Updating DescriptorSet with %d buffer writes and %d image writes.", static_cast<int>(buffer_write_infos.size()), static_cast<int>(image_write_infos.size()));
 
@@ -172,6 +212,7 @@ VkResult DescriptorSet::update() {
         write_set.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         write_set.dstSet = descriptor_set;
         write_set.dstBinding = image_write_info.binding;
+        write_set.dstArrayElement = image_write_info.array_element;
         write_set.descriptorCount = 1; // Assuming one image per binding
         write_set.descriptorType = image_write_info.type;
         write_set.pImageInfo = &image_infos[image_write_info.resource_index];
@@ -1,5 +1,6 @@
 #include "ev-device.h"
 #include <string>
+#include <algorithm>
 using namespace ev;
 
 Device::Device(
@@ -30,11 +31,103 @@ Device::Device(
     queue_ci.queueCount = 1;
     queue_ci.pQueuePriorities = &queue_priority;
     device_ci.pQueueCreateInfos = &queue_ci;
-    device_ci.pNext = nullptr; // No additional structures
+    device_ci.pNext = nullptr; // 아래에서 기능 구조체를 연결
+
+    // indirect count draw 는 VK_KHR_draw_indirect_count 확장을 요청했으면 확장으로, 아니면 Vulkan 1.2 core 기능으로 사용
+    const bool draw_indirect_count_extension = std::any_of(enabled_extensions.begin(), enabled_extensions.end(),
+        [](const char* name) { return strcmp(name, VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME) == 0; });
+    const bool descriptor_indexing_extension = std::any_of(enabled_extensions.begin(), enabled_extensions.end(),
+        [](const char* name) { return strcmp(name, VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME) == 0; });
+    bool draw_indirect_count_core = false;
+    VkPhysicalDeviceVulkan12Features vulkan12_features = {};
+    vulkan12_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+    VkPhysicalDeviceDescriptorIndexingFeatures descriptor_indexing_features = {};
+    descriptor_indexing_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+    if ( pdevice->get_properties().apiVersion >= VK_API_VERSION_1_2 ) {
+        VkPhysicalDeviceFeatures2 features2 = {};
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features2.pNext = &vulkan12_features;
+        vkGetPhysicalDeviceFeatures2(*pdevice, &features2);
+        draw_indirect_count_core = !draw_indirect_count_extension && vulkan12_features.drawIndirectCount == VK_TRUE;
+        descriptor_indexing_enabled = vulkan12_features.runtimeDescriptorArray
+            && vulkan12_features.descriptorBindingPartiallyBound
+            && vulkan12_features.shaderSampledImageArrayNonUniformIndexing
+            && vulkan12_features.descriptorBindingSampledImageUpdateAfterBind
+            && vulkan12_features.descriptorBindingUpdateUnusedWhilePending;
+        // 다른 1.2 기능은 켜지 않음
+        vulkan12_features = {};
+        vulkan12_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        if ( draw_indirect_count_core ) {
+            vulkan12_features.drawIndirectCount = VK_TRUE;
+        }
+        if ( descriptor_indexing_enabled ) {
+            vulkan12_features.descriptorIndexing = descriptor_indexing_extension ? VK_TRUE : VK_FALSE;
+            vulkan12_features.runtimeDescriptorArray = VK_TRUE;
+            vulkan12_features.descriptorBindingPartiallyBound = VK_TRUE;
+            vulkan12_features.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+            vulkan12_features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+            vulkan12_features.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+        }
+        if ( draw_indirect_count_core || descriptor_indexing_enabled ) {
+            device_ci.pNext = &vulkan12_features;
+        }
+    } else if ( descriptor_indexing_extension ) {
+        // 1.2 이전에는 VK_EXT_descriptor_indexing 기능 구조체로 켬
+        VkPhysicalDeviceFeatures2 features2 = {};
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features2.pNext = &descriptor_indexing_features;
+        vkGetPhysicalDeviceFeatures2(*pdevice, &features2);
+        descriptor_indexing_enabled = descriptor_indexing_features.runtimeDescriptorArray
+            && descriptor_indexing_features.descriptorBindingPartiallyBound
+            && descriptor_indexing_features.shaderSampledImageArrayNonUniformIndexing
+            && descriptor_indexing_features.descriptorBindingSampledImageUpdateAfterBind
+            && descriptor_indexing_features.descriptorBindingUpdateUnusedWhilePending;
+        descriptor_indexing_features = {};
+        descriptor_indexing_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+        if ( descriptor_indexing_enabled ) {
+            descriptor_indexing_features.runtimeDescriptorArray = VK_TRUE;
+            descriptor_indexing_features.descriptorBindingPartiallyBound = VK_TRUE;
+            descriptor_indexing_features.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+            descriptor_indexing_features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+            descriptor_indexing_features.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+            device_ci.pNext = &descriptor_indexing_features;
+        }
+    }
+
+    // VK_EXT_mesh_shader 는 확장 외에 기능 구조체로 task/mesh shader 를 켜야 함
+    VkPhysicalDeviceMeshShaderFeaturesEXT mesh_shader_features = {};
+    mesh_shader_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT;
+    const bool mesh_shader_requested = std::any_of(enabled_extensions.begin(), enabled_extensions.end(),
+        [](const char* name) { return strcmp(name, VK_EXT_MESH_SHADER_EXTENSION_NAME) == 0; });
+    if ( mesh_shader_requested ) {
+        VkPhysicalDeviceFeatures2 features2 = {};
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features2.pNext = &mesh_shader_features;
+        vkGetPhysicalDeviceFeatures2(*pdevice, &features2);
+        // multiview, fragment shading rate 와 연동되는 부가 기능은 해당 기능도 켜야 하므로 task/mesh shader 만 사용
+        mesh_shader_features.multiviewMeshShader = VK_FALSE;
+        mesh_shader_features.primitiveFragmentShadingRateMeshShader = VK_FALSE;
+        mesh_shader_features.meshShaderQueries = VK_FALSE;
+        if ( mesh_shader_features.taskShader && mesh_shader_features.meshShader ) {
+            mesh_shader_features.pNext = const_cast<void*>(device_ci.pNext);
+            device_ci.pNext = &mesh_shader_features;
+            mesh_shader_enabled = true;
+        } else {
+            ev_log_warn("[ev::Device] %s is available but task/mesh shader features are not supported.", VK_EXT_MESH_SHADER_EXTENSION_NAME);
+        }
+    }
     device_ci.enabledLayerCount = 0; // Layers are deprecated in Vulkan 1.2+
     device_ci.ppEnabledLayerNames = nullptr; // No layers enabled
     device_ci.pEnabledFeatures = &pdevice->get_features(); // Use physical device features
     CHECK_RESULT(vkCreateDevice(*pdevice, &device_ci, nullptr, &device));
+    if ( mesh_shader_enabled ) {
+        cmd_draw_mesh_tasks = reinterpret_cast<PFN_vkCmdDrawMeshTasksEXT>(vkGetDeviceProcAddr(device, "vkCmdDrawMeshTasksEXT"));
+        mesh_shader_enabled = cmd_draw_mesh_tasks != nullptr;
+    }
+    if ( draw_indirect_count_extension || draw_indirect_count_core ) {
+        cmd_draw_indexed_indirect_count = reinterpret_cast<PFN_vkCmdDrawIndexedIndirectCount>(vkGetDeviceProcAddr(device,
+            draw_indirect_count_extension ? "vkCmdDrawIndexedIndirectCountKHR" : "vkCmdDrawIndexedIndirectCount"));
+    }
     ev_log_info("[ev::Device] Vulkan device created successfully.");
 }
 
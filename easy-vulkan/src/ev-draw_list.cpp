@@ -0,0 +1,260 @@
+#include "tools/ev-draw_list.h"
+#include "tools/ev-parallel.h"
+#include <algorithm>
+#include <unordered_set>
+#include <glm/gtc/type_ptr.hpp>
+
+using namespace ev::tools::gltf;
+
+namespace {
+
+/** 정렬 키 비트 배치 (상위부터): 파이프라인 12, 모델 12, 머티리얼 20, 메시 20 */
+constexpr uint32_t PIPELINE_SHIFT = 52;
+constexpr uint32_t MODEL_SHIFT = 40;
+constexpr uint32_t MATERIAL_SHIFT = 20;
+constexpr uint64_t ID_MASK_12 = (1ull << 12) - 1;
+constexpr uint64_t ID_MASK_20 = (1ull << 20) - 1;
+
+/** 컬링 전 월드 행렬을 복사할 때 한 스레드가 가져갈 항목 수 */
+constexpr uint32_t MATRIX_GRAIN = 1024;
+
+}
+
+uint32_t DrawList::get_id(std::unordered_map<const void*, uint32_t>& ids, const void* object) {
+    auto it = ids.find(object);
+    if ( it != ids.end() ) {
+        return it->second;
+    }
+    const uint32_t id = static_cast<uint32_t>(ids.size());
+    ids.emplace(object, id);
+    return id;
+}
+
+void DrawList::add_model(std::shared_ptr<Model> model,
+    std::shared_ptr<ev::GraphicsPipeline> pipeline,
+    uint32_t render_flags,
+    uint32_t vertex_pass
+) {
+    if ( !model ) {
+        ev_log_error("[ev::tools::gltf::DrawList::add_model] Model is null.");
+        return;
+    }
+    sources.push_back({ std::move(model), std::move(pipeline), render_flags, vertex_pass });
+    dirty = true;
+}
+
+void DrawList::remove_model(const std::shared_ptr<Model>& model) {
+    const size_t count = sources.size();
+    sources.erase(
+        std::remove_if(sources.begin(), sources.end(), [&](const Source& source) { return source.model == model; }),
+        sources.end()
+    );
+    dirty |= sources.size() != count;
+}
+
+void DrawList::clear() {
+    sources.clear();
+    items.clear();
+    pipeline_ids.clear();
+    material_ids.clear();
+    mesh_ids.clear();
+    culler.clear();
+    visible_items.clear();
+    culled = false;
+    dirty = false;
+}
+
+void DrawList::bake_node(const Source& source, uint32_t model_id, const std::shared_ptr<Node>& node) {
+    const std::shared_ptr<Mesh>& mesh = node->get_mesh();
+    if ( !mesh ) {
+        return;
+    }
+    const uint64_t pipeline_id = get_id(pipeline_ids, source.pipeline.get()) & ID_MASK_12;
+    const uint64_t mesh_id = get_id(mesh_ids, mesh.get()) & ID_MASK_20;
+    for ( const auto& primitive : mesh->get_primitives() ) {
+        const auto& material = primitive->get_material();
+        if ( skip_material(*material, source.render_flags) || primitive->get_index_count() == 0 ) {
+            continue;
+        }
+        const uint64_t material_id = get_id(material_ids, material.get()) & ID_MASK_20;
+
+        Item item = {};
+        item.key = (pipeline_id << PIPELINE_SHIFT)
+            | ((static_cast<uint64_t>(model_id) & ID_MASK_12) << MODEL_SHIFT)
+            | (material_id << MATERIAL_SHIFT)
+            | mesh_id;
+        item.pipeline = source.pipeline;
+        const bool bindless = (source.render_flags & RenderFlag::BINDLESS) != 0;
+        item.material_set = (!bindless && (source.render_flags & RenderFlag::BIND_IMAGE)) ? material->get_descriptor_set() : nullptr;
+        item.material_index = bindless ? material->get_material_index() : NO_SET;
+        item.instance_set = mesh->get_descriptor_set();
+        item.model = source.model.get();
+        item.node = node.get();
+        item.bounds = glm::vec4(primitive->get_dimensions().center, primitive->get_dimensions().radius);
+        item.first_index = primitive->get_first_index();
+        item.index_count = primitive->get_index_count();
+        item.vertex_offset = static_cast<int32_t>(primitive->get_first_vertex());
+        item.vertex_pass = source.vertex_pass;
+        items.push_back(std::move(item));
+    }
+}
+
+void DrawList::build() {
+    if ( !dirty ) {
+        return;
+    }
+    items.clear();
+    pipeline_ids.clear();
+    material_ids.clear();
+    mesh_ids.clear();
+
+    std::unordered_map<const void*, uint32_t> model_ids;
+    for ( const Source& source : sources ) {
+        // GeometryHeap 의 모델들은 같은 버퍼를 쓰므로 한 그룹으로 정렬해 버퍼 바인딩을 공유
+        const uint32_t model_id = get_id(model_ids, source.model->get_geometry_allocation()
+            ? static_cast<const void*>(source.model->get_vertex_buffer().get())
+            : static_cast<const void*>(source.model.get()));
+        // 같은 노드가 여러 부모 목록에 걸려 있어도 한 번만 굽기
+        std::unordered_set<const Node*> visited;
+        std::vector<std::shared_ptr<Node>> stack(source.model->get_nodes().rbegin(), source.model->get_nodes().rend());
+        while ( !stack.empty() ) {
+            std::shared_ptr<Node> node = std::move(stack.back());
+            stack.pop_back();
+            if ( !visited.insert(node.get()).second ) {
+                continue;
+            }
+            bake_node(source, model_id, node);
+            const auto& children = node->get_children();
+            stack.insert(stack.end(), children.rbegin(), children.rend());
+        }
+    }
+    // 키가 같으면 추가 순서(노드 전위 순서) 유지
+    std::stable_sort(items.begin(), items.end(), [](const Item& a, const Item& b) { return a.key < b.key; });
+
+    culler.clear();
+    culler.reserve(items.size());
+    for ( const Item& item : items ) {
+        culler.add(glm::value_ptr(item.bounds), item.bounds.w);
+    }
+    culled = false;
+    dirty = false;
+    ev_log_debug("[ev::tools::gltf::DrawList::build] %zu draw items from %zu sources.", items.size(), sources.size());
+}
+
+size_t DrawList::cull(const glm::mat4& view_projection, bool parallel) {
+    build();
+    const uint32_t count = static_cast<uint32_t>(items.size());
+    auto copy_matrices = [&](uint32_t begin, uint32_t end) {
+        for ( uint32_t i = begin ; i < end ; ++i ) {
+            const glm::mat4 matrix = items[i].node->get_world_matrix();
+            culler.set_matrix(i, glm::value_ptr(matrix));
+        }
+    };
+    if ( parallel ) {
+        ev::tools::parallel_for(count, copy_matrices, MATRIX_GRAIN);
+    } else {
+        copy_matrices(0, count);
+    }
+
+    float planes[24];
+    ev::tools::FrustumCuller::extract_planes(glm::value_ptr(view_projection), planes);
+    const size_t visible_count = culler.cull(planes, visible_items, parallel);
+    culled = true;
+    return visible_count;
+}
+
+void DrawList::record(std::shared_ptr<ev::CommandBuffer> command_buffer,
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+    uint32_t material_set_index,
+    uint32_t instance_set_index
+) {
+    build();
+    stats = {};
+    record_range(command_buffer, 0, get_draw_count(), pipeline_layout, material_set_index, instance_set_index, stats);
+    ev_log_debug("[ev::tools::gltf::DrawList::record] %u draws, %u pipeline / %u buffer / %u material / %u instance binds.",
+        stats.draws, stats.pipeline_binds, stats.buffer_binds, stats.material_binds, stats.instance_binds);
+}
+
+void DrawList::record(std::shared_ptr<ev::CommandBuffer> command_buffer,
+    uint32_t begin,
+    uint32_t end,
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+    uint32_t material_set_index,
+    uint32_t instance_set_index
+) const {
+    if ( dirty ) {
+        ev_log_error("[ev::tools::gltf::DrawList::record] Draw list is not built. Call get_draw_count before recording a range.");
+        return;
+    }
+    Stats range_stats;
+    record_range(command_buffer, begin, end, pipeline_layout, material_set_index, instance_set_index, range_stats);
+}
+
+uint32_t DrawList::get_draw_count() {
+    build();
+    return static_cast<uint32_t>(culled ? visible_items.size() : items.size());
+}
+
+void DrawList::record_range(const std::shared_ptr<ev::CommandBuffer>& command_buffer,
+    uint32_t begin,
+    uint32_t end,
+    const std::shared_ptr<ev::PipelineLayout>& pipeline_layout,
+    uint32_t material_set_index,
+    uint32_t instance_set_index,
+    Stats& out_stats
+) const {
+    end = std::min(end, static_cast<uint32_t>(culled ? visible_items.size() : items.size()));
+    const ev::GraphicsPipeline* bound_pipeline = nullptr;
+    const Model* bound_model = nullptr;
+    uint32_t bound_vertex_pass = 0;
+    const ev::DescriptorSet* bound_material_set = nullptr;
+    const ev::DescriptorSet* bound_instance_set = nullptr;
+    uint32_t bound_material_index = NO_SET;
+
+    for ( uint32_t i = begin ; i < end ; ++i ) {
+        const Item& item = items[culled ? visible_items[i] : i];
+        if ( item.pipeline && item.pipeline.get() != bound_pipeline ) {
+            command_buffer->bind_graphics_pipeline(item.pipeline);
+            bound_pipeline = item.pipeline.get();
+            bound_material_index = NO_SET;
+            ++out_stats.pipeline_binds;
+        }
+        const bool same_heap = bound_model && item.model->get_geometry_allocation() && bound_model->get_geometry_allocation()
+            && item.model->get_vertex_buffer() == bound_model->get_vertex_buffer();
+        if ( (item.model != bound_model && !same_heap) || item.vertex_pass != bound_vertex_pass ) {
+            item.model->bind_buffers(command_buffer, item.vertex_pass);
+            bound_model = item.model;
+            bound_vertex_pass = item.vertex_pass;
+            ++out_stats.buffer_binds;
+        }
+        if ( item.material_set && item.material_set.get() != bound_material_set ) {
+            command_buffer->bind_descriptor_sets(
+                VK_PIPELINE_BIND_POINT_GRAPHICS,
+                pipeline_layout,
+                {item.material_set},
+                material_set_index,
+                {}
+            );
+            bound_material_set = item.material_set.get();
+            ++out_stats.material_binds;
+        }
+        if ( item.material_index != NO_SET && item.material_index != bound_material_index ) {
+            item.model->push_material_index(command_buffer, pipeline_layout, item.material_index);
+            bound_material_index = item.material_index;
+            ++out_stats.material_binds;
+        }
+        if ( instance_set_index != NO_SET && item.instance_set && item.instance_set.get() != bound_instance_set ) {
+            command_buffer->bind_descriptor_sets(
+                VK_PIPELINE_BIND_POINT_GRAPHICS,
+                pipeline_layout,
+                {item.instance_set},
+                instance_set_index,
+                {}
+            );
+            bound_instance_set = item.instance_set.get();
+            ++out_stats.instance_binds;
+        }
+        command_buffer->draw_indexed(item.index_count, 1, item.first_index, item.vertex_offset, 0);
+        ++out_stats.draws;
+    }
+}
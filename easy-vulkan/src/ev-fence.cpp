@@ -40,6 +40,14 @@ VkResult Fence::wait(uint64_t timeout) {
     return result;
 }
 
+VkResult Fence::get_status() const {
+    if (fence == VK_NULL_HANDLE) {
+        ev_log_error("[ev::Fence] Fence is not initialized");
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    return vkGetFenceStatus(*device, fence);
+}
+
 VkResult Fence::reset() {
     if (fence == VK_NULL_HANDLE) {
         ev_log_error("Fence is not initialized");
@@ -0,0 +1,320 @@
+#include "tools/ev-frustum_culling.h"
+#include "tools/ev-parallel.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define EV_CULLING_AVX2 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define EV_CULLING_SSE2 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define EV_CULLING_NEON 1
+#endif
+
+using namespace ev::tools;
+
+namespace {
+
+/** 한 스레드가 한 번에 처리할 객체 수. SIMD 폭(8)의 배수 */
+constexpr uint32_t CHUNK_SIZE = 16384;
+
+/**
+ * @brief lane 마스크에서 켜진 번호를 분기 없이 기록합니다.
+ */
+inline size_t emit_visible(uint32_t mask, uint32_t first, uint32_t lanes, uint32_t* visible) {
+    size_t count = 0;
+    for ( uint32_t lane = 0 ; lane < lanes ; ++lane ) {
+        visible[count] = first + lane;
+        count += (mask >> lane) & 1u;
+    }
+    return count;
+}
+
+}
+
+/* ---------------------------------------------------------------------------------------------
+ * FrustumCuller
+ * ------------------------------------------------------------------------------------------- */
+
+uint32_t FrustumCuller::add(const float center[3], float radius, const float matrix[16]) {
+    const uint32_t index = static_cast<uint32_t>(radii.size());
+    for ( int axis = 0 ; axis < 3 ; ++axis ) {
+        centers[axis].push_back(center[axis]);
+    }
+    radii.push_back(radius);
+    for ( int element = 0 ; element < 12 ; ++element ) {
+        // 단위 행렬은 0, 4, 8 번 성분만 1
+        matrices[element].push_back(element % 4 == 0 && element < 9 ? 1.0f : 0.0f);
+    }
+    if ( matrix ) {
+        set_matrix(index, matrix);
+    }
+    return index;
+}
+
+void FrustumCuller::set_sphere(uint32_t index, const float center[3], float radius) {
+    for ( int axis = 0 ; axis < 3 ; ++axis ) {
+        centers[axis][index] = center[axis];
+    }
+    radii[index] = radius;
+}
+
+void FrustumCuller::set_matrix(uint32_t index, const float matrix[16]) {
+    for ( int column = 0 ; column < 4 ; ++column ) {
+        for ( int row = 0 ; row < 3 ; ++row ) {
+            matrices[column * 3 + row][index] = matrix[column * 4 + row];
+        }
+    }
+}
+
+void FrustumCuller::reserve(size_t count) {
+    for ( auto& center : centers ) {
+        center.reserve(count);
+    }
+    radii.reserve(count);
+    for ( auto& element : matrices ) {
+        element.reserve(count);
+    }
+}
+
+void FrustumCuller::clear() {
+    for ( auto& center : centers ) {
+        center.clear();
+    }
+    radii.clear();
+    for ( auto& element : matrices ) {
+        element.clear();
+    }
+}
+
+size_t FrustumCuller::cull(const float planes[24], std::vector<uint32_t>& visible, bool parallel) {
+    const uint32_t count = static_cast<uint32_t>(radii.size());
+    visible.resize(count);
+    if ( count == 0 ) {
+        return 0;
+    }
+
+    float normalized[24];
+    for ( int i = 0 ; i < 6 ; ++i ) {
+        const float* plane = planes + i * 4;
+        const float length = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+        const float scale = length > 0.0f ? 1.0f / length : 1.0f;
+        for ( int c = 0 ; c < 4 ; ++c ) {
+            normalized[i * 4 + c] = plane[c] * scale;
+        }
+    }
+
+    const float* matrix_ptrs[12];
+    for ( int element = 0 ; element < 12 ; ++element ) {
+        matrix_ptrs[element] = matrices[element].data();
+    }
+    const float* center_ptrs[3] = { centers[0].data(), centers[1].data(), centers[2].data() };
+
+    const uint32_t chunk_count = (count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    if ( !parallel || chunk_count == 1 ) {
+        const size_t visible_count = culling::cull_spheres(matrix_ptrs, center_ptrs, radii.data(), normalized, 0, count, visible.data());
+        visible.resize(visible_count);
+        return visible_count;
+    }
+
+    // 구간마다 따로 기록한 뒤 순서대로 이어 붙임
+    chunk_results.resize(chunk_count);
+    ev::tools::parallel_for(chunk_count, [&](uint32_t begin, uint32_t end) {
+        for ( uint32_t chunk = begin ; chunk < end ; ++chunk ) {
+            const uint32_t first = chunk * CHUNK_SIZE;
+            const uint32_t last = std::min(first + CHUNK_SIZE, count);
+            std::vector<uint32_t>& result = chunk_results[chunk];
+            result.resize(last - first);
+            result.resize(culling::cull_spheres(matrix_ptrs, center_ptrs, radii.data(), normalized, first, last, result.data()));
+        }
+    });
+
+    size_t visible_count = 0;
+    for ( const std::vector<uint32_t>& result : chunk_results ) {
+        std::copy(result.begin(), result.end(), visible.begin() + visible_count);
+        visible_count += result.size();
+    }
+    visible.resize(visible_count);
+    return visible_count;
+}
+
+void FrustumCuller::extract_planes(const float view_projection[16], float planes[24]) {
+    // 열 우선 행렬의 행 r = (m[r], m[4 + r], m[8 + r], m[12 + r])
+    auto row = [&](int r, int c) { return view_projection[c * 4 + r]; };
+    for ( int c = 0 ; c < 4 ; ++c ) {
+        planes[0 * 4 + c] = row(3, c) + row(0, c);
+        planes[1 * 4 + c] = row(3, c) - row(0, c);
+        planes[2 * 4 + c] = row(3, c) + row(1, c);
+        planes[3 * 4 + c] = row(3, c) - row(1, c);
+        planes[4 * 4 + c] = row(3, c) + row(2, c);
+        planes[5 * 4 + c] = row(3, c) - row(2, c);
+    }
+    for ( int i = 0 ; i < 6 ; ++i ) {
+        float* plane = planes + i * 4;
+        const float length = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+        if ( length > 0.0f ) {
+            for ( int c = 0 ; c < 4 ; ++c ) {
+                plane[c] /= length;
+            }
+        }
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------
+ * scalar
+ * ------------------------------------------------------------------------------------------- */
+
+size_t culling::scalar::cull_spheres(const float* const m[12], const float* const c[3], const float* radii,
+    const float planes[24], uint32_t begin, uint32_t end, uint32_t* visible) {
+    size_t count = 0;
+    for ( uint32_t i = begin ; i < end ; ++i ) {
+        const float x = m[0][i] * c[0][i] + m[3][i] * c[1][i] + m[6][i] * c[2][i] + m[9][i];
+        const float y = m[1][i] * c[0][i] + m[4][i] * c[1][i] + m[7][i] * c[2][i] + m[10][i];
+        const float z = m[2][i] * c[0][i] + m[5][i] * c[1][i] + m[8][i] * c[2][i] + m[11][i];
+        const float s0 = m[0][i] * m[0][i] + m[1][i] * m[1][i] + m[2][i] * m[2][i];
+        const float s1 = m[3][i] * m[3][i] + m[4][i] * m[4][i] + m[5][i] * m[5][i];
+        const float s2 = m[6][i] * m[6][i] + m[7][i] * m[7][i] + m[8][i] * m[8][i];
+        const float radius = radii[i] * std::sqrt(std::max(s0, std::max(s1, s2)));
+        bool inside = true;
+        for ( int p = 0 ; p < 6 ; ++p ) {
+            const float* plane = planes + p * 4;
+            inside &= plane[0] * x + plane[1] * y + plane[2] * z + plane[3] + radius >= 0.0f;
+        }
+        visible[count] = i;
+        count += inside ? 1 : 0;
+    }
+    return count;
+}
+
+/* ---------------------------------------------------------------------------------------------
+ * dispatch
+ * ------------------------------------------------------------------------------------------- */
+
+const char* culling::simd_backend() {
+#if defined(EV_CULLING_AVX2)
+    return "avx2";
+#elif defined(EV_CULLING_SSE2)
+    return "sse2";
+#elif defined(EV_CULLING_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+size_t culling::cull_spheres(const float* const m[12], const float* const c[3], const float* radii,
+    const float planes[24], uint32_t begin, uint32_t end, uint32_t* visible) {
+    uint32_t i = begin;
+    size_t count = 0;
+#if defined(EV_CULLING_AVX2)
+    {
+        __m256 plane[24];
+        for ( int k = 0 ; k < 24 ; ++k ) {
+            plane[k] = _mm256_set1_ps(planes[k]);
+        }
+        const __m256 zero = _mm256_setzero_ps();
+        for ( ; i + 8 <= end ; i += 8 ) {
+            __m256 e[12];
+            for ( int k = 0 ; k < 12 ; ++k ) {
+                e[k] = _mm256_loadu_ps(m[k] + i);
+            }
+            const __m256 cx = _mm256_loadu_ps(c[0] + i);
+            const __m256 cy = _mm256_loadu_ps(c[1] + i);
+            const __m256 cz = _mm256_loadu_ps(c[2] + i);
+            const __m256 x = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e[0], cx), _mm256_mul_ps(e[3], cy)), _mm256_add_ps(_mm256_mul_ps(e[6], cz), e[9]));
+            const __m256 y = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e[1], cx), _mm256_mul_ps(e[4], cy)), _mm256_add_ps(_mm256_mul_ps(e[7], cz), e[10]));
+            const __m256 z = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e[2], cx), _mm256_mul_ps(e[5], cy)), _mm256_add_ps(_mm256_mul_ps(e[8], cz), e[11]));
+            const __m256 s0 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e[0], e[0]), _mm256_mul_ps(e[1], e[1])), _mm256_mul_ps(e[2], e[2]));
+            const __m256 s1 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e[3], e[3]), _mm256_mul_ps(e[4], e[4])), _mm256_mul_ps(e[5], e[5]));
+            const __m256 s2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e[6], e[6]), _mm256_mul_ps(e[7], e[7])), _mm256_mul_ps(e[8], e[8]));
+            const __m256 radius = _mm256_mul_ps(_mm256_loadu_ps(radii + i), _mm256_sqrt_ps(_mm256_max_ps(s0, _mm256_max_ps(s1, s2))));
+            __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            for ( int p = 0 ; p < 6 ; ++p ) {
+                __m256 distance = _mm256_add_ps(_mm256_mul_ps(plane[p * 4], x), _mm256_mul_ps(plane[p * 4 + 1], y));
+                distance = _mm256_add_ps(distance, _mm256_add_ps(_mm256_mul_ps(plane[p * 4 + 2], z), plane[p * 4 + 3]));
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(distance, radius), zero, _CMP_GE_OQ));
+            }
+            count += emit_visible(static_cast<uint32_t>(_mm256_movemask_ps(inside)), i, 8, visible + count);
+        }
+    }
+#elif defined(EV_CULLING_SSE2)
+    {
+        __m128 plane[24];
+        for ( int k = 0 ; k < 24 ; ++k ) {
+            plane[k] = _mm_set1_ps(planes[k]);
+        }
+        const __m128 zero = _mm_setzero_ps();
+        for ( ; i + 4 <= end ; i += 4 ) {
+            __m128 e[12];
+            for ( int k = 0 ; k < 12 ; ++k ) {
+                e[k] = _mm_loadu_ps(m[k] + i);
+            }
+            const __m128 cx = _mm_loadu_ps(c[0] + i);
+            const __m128 cy = _mm_loadu_ps(c[1] + i);
+            const __m128 cz = _mm_loadu_ps(c[2] + i);
+            const __m128 x = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e[0], cx), _mm_mul_ps(e[3], cy)), _mm_add_ps(_mm_mul_ps(e[6], cz), e[9]));
+            const __m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e[1], cx), _mm_mul_ps(e[4], cy)), _mm_add_ps(_mm_mul_ps(e[7], cz), e[10]));
+            const __m128 z = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e[2], cx), _mm_mul_ps(e[5], cy)), _mm_add_ps(_mm_mul_ps(e[8], cz), e[11]));
+            const __m128 s0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e[0], e[0]), _mm_mul_ps(e[1], e[1])), _mm_mul_ps(e[2], e[2]));
+            const __m128 s1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e[3], e[3]), _mm_mul_ps(e[4], e[4])), _mm_mul_ps(e[5], e[5]));
+            const __m128 s2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e[6], e[6]), _mm_mul_ps(e[7], e[7])), _mm_mul_ps(e[8], e[8]));
+            const __m128 radius = _mm_mul_ps(_mm_loadu_ps(radii + i), _mm_sqrt_ps(_mm_max_ps(s0, _mm_max_ps(s1, s2))));
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for ( int p = 0 ; p < 6 ; ++p ) {
+                __m128 distance = _mm_add_ps(_mm_mul_ps(plane[p * 4], x), _mm_mul_ps(plane[p * 4 + 1], y));
+                distance = _mm_add_ps(distance, _mm_add_ps(_mm_mul_ps(plane[p * 4 + 2], z), plane[p * 4 + 3]));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(distance, radius), zero));
+            }
+            count += emit_visible(static_cast<uint32_t>(_mm_movemask_ps(inside)), i, 4, visible + count);
+        }
+    }
+#elif defined(EV_CULLING_NEON)
+    {
+        float32x4_t plane[24];
+        for ( int k = 0 ; k < 24 ; ++k ) {
+            plane[k] = vdupq_n_f32(planes[k]);
+        }
+        const float32x4_t zero = vdupq_n_f32(0.0f);
+        const uint32x4_t lane_bits = { 1u, 2u, 4u, 8u };
+        for ( ; i + 4 <= end ; i += 4 ) {
+            float32x4_t e[12];
+            for ( int k = 0 ; k < 12 ; ++k ) {
+                e[k] = vld1q_f32(m[k] + i);
+            }
+            const float32x4_t cx = vld1q_f32(c[0] + i);
+            const float32x4_t cy = vld1q_f32(c[1] + i);
+            const float32x4_t cz = vld1q_f32(c[2] + i);
+            const float32x4_t x = vmlaq_f32(vmlaq_f32(vmlaq_f32(e[9], e[0], cx), e[3], cy), e[6], cz);
+            const float32x4_t y = vmlaq_f32(vmlaq_f32(vmlaq_f32(e[10], e[1], cx), e[4], cy), e[7], cz);
+            const float32x4_t z = vmlaq_f32(vmlaq_f32(vmlaq_f32(e[11], e[2], cx), e[5], cy), e[8], cz);
+            const float32x4_t s0 = vmlaq_f32(vmlaq_f32(vmulq_f32(e[0], e[0]), e[1], e[1]), e[2], e[2]);
+            const float32x4_t s1 = vmlaq_f32(vmlaq_f32(vmulq_f32(e[3], e[3]), e[4], e[4]), e[5], e[5]);
+            const float32x4_t s2 = vmlaq_f32(vmlaq_f32(vmulq_f32(e[6], e[6]), e[7], e[7]), e[8], e[8]);
+            const float32x4_t scale2 = vmaxq_f32(s0, vmaxq_f32(s1, s2));
+            // 0 이 아닌 lane 만 rsqrt 로 sqrt 를 구하고 Newton 보정 한 번
+            float32x4_t rsqrt = vrsqrteq_f32(scale2);
+            rsqrt = vmulq_f32(rsqrt, vrsqrtsq_f32(vmulq_f32(scale2, rsqrt), rsqrt));
+            const float32x4_t scale = vbslq_f32(vcgtq_f32(scale2, zero), vmulq_f32(scale2, rsqrt), zero);
+            const float32x4_t radius = vmulq_f32(vld1q_f32(radii + i), scale);
+            uint32x4_t inside = vdupq_n_u32(0xFFFFFFFFu);
+            for ( int p = 0 ; p < 6 ; ++p ) {
+                float32x4_t distance = vmlaq_f32(plane[p * 4 + 3], plane[p * 4], x);
+                distance = vmlaq_f32(vmlaq_f32(distance, plane[p * 4 + 1], y), plane[p * 4 + 2], z);
+                inside = vandq_u32(inside, vcgeq_f32(vaddq_f32(distance, radius), zero));
+            }
+            const uint32x4_t bits = vandq_u32(inside, lane_bits);
+            const uint32_t mask = vgetq_lane_u32(bits, 0) | vgetq_lane_u32(bits, 1) | vgetq_lane_u32(bits, 2) | vgetq_lane_u32(bits, 3);
+            count += emit_visible(mask, i, 4, visible + count);
+        }
+    }
+#endif
+    count += scalar::cull_spheres(m, c, radii, planes, i, end, visible + count);
+    return count;
+}
@@ -0,0 +1,168 @@
+#include "tools/ev-geometry_heap.h"
+#include "ev-macro.h"
+
+using namespace ev::tools::gltf;
+
+GeometryAllocation::~GeometryAllocation() {
+    if ( std::shared_ptr<GeometryHeap> owner = heap.lock() ) {
+        owner->release(*this);
+    }
+}
+
+GeometryHeap::GeometryHeap(std::shared_ptr<ev::Device> device,
+    std::shared_ptr<ev::MemoryAllocator> memory_allocator,
+    const VertexLayout& vertex_layout,
+    uint32_t vertex_capacity,
+    uint32_t index_capacity,
+    VkIndexType index_type
+) : device(std::move(device)),
+    vertex_layout(vertex_layout),
+    index_type(index_type),
+    vertex_capacity(vertex_capacity),
+    index_capacity(index_capacity),
+    vertices(vertex_capacity),
+    indices(index_capacity) {
+    if ( !this->device || !memory_allocator ) {
+        ev_log_error("[ev::tools::gltf::GeometryHeap::GeometryHeap] Invalid parameters provided for GeometryHeap creation.");
+        exit(EXIT_FAILURE);
+    }
+    if ( vertex_capacity == 0 || index_capacity == 0 ) {
+        ev_log_error("[ev::tools::gltf::GeometryHeap::GeometryHeap] Vertex and index capacity must be greater than zero.");
+        exit(EXIT_FAILURE);
+    }
+    if ( index_type != VK_INDEX_TYPE_UINT16 && index_type != VK_INDEX_TYPE_UINT32 ) {
+        ev_log_error("[ev::tools::gltf::GeometryHeap::GeometryHeap] Unsupported index type: %d", index_type);
+        exit(EXIT_FAILURE);
+    }
+
+    for ( uint32_t stream = 0 ; stream < vertex_layout.get_stream_count() ; ++stream ) {
+        vertex_stream_offsets.push_back(vertex_layout.get_stream_offset(stream, vertex_capacity));
+    }
+
+    // save_model 에서 모델 구간을 readback 할 수 있도록 TRANSFER_SRC 포함
+    vertex_buffer = std::make_shared<ev::Buffer>(
+        this->device,
+        vertex_layout.get_buffer_size(vertex_capacity),
+        ev::buffer_type::VERTEX_BUFFER | VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+    );
+    index_buffer = std::make_shared<ev::Buffer>(
+        this->device,
+        static_cast<VkDeviceSize>(index_capacity) * get_index_size(),
+        ev::buffer_type::INDEX_BUFFER | VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+    );
+    CHECK_RESULT(memory_allocator->allocate_buffer(vertex_buffer, ev::memory_type::GPU_ONLY));
+    CHECK_RESULT(memory_allocator->allocate_buffer(index_buffer, ev::memory_type::GPU_ONLY));
+
+    ev_log_info("[ev::tools::gltf::GeometryHeap] Created geometry heap (%u vertices, %u indices, %llu bytes).",
+        vertex_capacity,
+        index_capacity,
+        static_cast<unsigned long long>(vertex_buffer->get_size() + index_buffer->get_size()));
+}
+
+std::shared_ptr<GeometryAllocation> GeometryHeap::allocate(uint32_t vertex_count, uint32_t index_count) {
+    if ( vertex_count == 0 || index_count == 0 ) {
+        ev_log_warn("[ev::tools::gltf::GeometryHeap::allocate] Empty geometry cannot be allocated.");
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if ( !vertex_buffer ) {
+        ev_log_error("[ev::tools::gltf::GeometryHeap::allocate] Geometry heap is destroyed.");
+        return nullptr;
+    }
+    const uint64_t first_vertex = vertices.allocate(vertex_count);
+    if ( first_vertex == ev::tools::RangeAllocator::INVALID_OFFSET ) {
+        ev_log_warn("[ev::tools::gltf::GeometryHeap::allocate] Not enough vertex space (requested %u, largest free %llu).",
+            vertex_count, static_cast<unsigned long long>(vertices.get_largest_free_range()));
+        return nullptr;
+    }
+    const uint64_t first_index = indices.allocate(index_count);
+    if ( first_index == ev::tools::RangeAllocator::INVALID_OFFSET ) {
+        ev_log_warn("[ev::tools::gltf::GeometryHeap::allocate] Not enough index space (requested %u, largest free %llu).",
+            index_count, static_cast<unsigned long long>(indices.get_largest_free_range()));
+        vertices.free(first_vertex, vertex_count);
+        return nullptr;
+    }
+    return std::make_shared<GeometryAllocation>(
+        weak_from_this(),
+        static_cast<uint32_t>(first_vertex),
+        vertex_count,
+        static_cast<uint32_t>(first_index),
+        index_count
+    );
+}
+
+void GeometryHeap::release(const GeometryAllocation& allocation) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if ( !vertex_buffer ) {
+        return;
+    }
+    // 이 프레임까지 기록된 커맨드 버퍼가 구간을 읽을 수 있으므로 retire_frames 까지 보류
+    pending_releases.push_back({
+        current_frame,
+        allocation.get_first_vertex(),
+        allocation.get_vertex_count(),
+        allocation.get_first_index(),
+        allocation.get_index_count()
+    });
+}
+
+void GeometryHeap::set_current_frame(uint64_t frame) {
+    std::lock_guard<std::mutex> lock(mutex);
+    current_frame = frame;
+}
+
+size_t GeometryHeap::retire_frames(uint64_t completed_frame) {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t released = 0;
+    while ( !pending_releases.empty() && pending_releases.front().frame <= completed_frame ) {
+        const PendingRelease& pending = pending_releases.front();
+        vertices.free(pending.first_vertex, pending.vertex_count);
+        indices.free(pending.first_index, pending.index_count);
+        pending_releases.pop_front();
+        ++released;
+    }
+    return released;
+}
+
+void GeometryHeap::bind(std::shared_ptr<ev::CommandBuffer> command_buffer, uint32_t vertex_pass) const {
+    const uint32_t stream_mask = vertex_layout.get_stream_mask(vertex_pass);
+    for ( uint32_t stream = 0 ; stream < vertex_layout.get_stream_count() ; ++stream ) {
+        if ( !(stream_mask & (1u << stream)) ) {
+            continue;
+        }
+        command_buffer->bind_vertex_buffers(stream, {vertex_buffer}, {vertex_stream_offsets[stream]});
+    }
+    command_buffer->bind_index_buffers({index_buffer}, 0, index_type);
+}
+
+uint32_t GeometryHeap::get_free_vertex_count() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return static_cast<uint32_t>(vertices.get_free_size());
+}
+
+uint32_t GeometryHeap::get_free_index_count() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return static_cast<uint32_t>(indices.get_free_size());
+}
+
+size_t GeometryHeap::get_pending_release_count() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return pending_releases.size();
+}
+
+void GeometryHeap::destroy() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if ( !vertex_buffer ) {
+        return;
+    }
+    vertex_buffer.reset();
+    index_buffer.reset();
+    vertices.reset(0);
+    indices.reset(0);
+    pending_releases.clear();
+    ev_log_debug("[ev::tools::gltf::GeometryHeap::destroy] Geometry heap destroyed.");
+}
+
+GeometryHeap::~GeometryHeap() {
+    destroy();
+}
@@ -0,0 +1,69 @@
+#include "tools/ev-glb.h"
+#include "ev-logger.h"
+
+using namespace ev::tools;
+
+namespace {
+
+uint32_t read_u32(const uint8_t* src) {
+    // glb 는 little endian
+    return static_cast<uint32_t>(src[0])
+        | (static_cast<uint32_t>(src[1]) << 8)
+        | (static_cast<uint32_t>(src[2]) << 16)
+        | (static_cast<uint32_t>(src[3]) << 24);
+}
+
+}
+
+bool glb::is_glb(const uint8_t* data, size_t size) {
+    return data != nullptr && size >= 12 && read_u32(data) == MAGIC;
+}
+
+bool glb::parse(const uint8_t* data, size_t size, Container& container) {
+    container = Container();
+    if ( !is_glb(data, size) ) {
+        ev_log_error("[ev::tools::glb::parse] Not a binary glTF file.");
+        return false;
+    }
+    const uint32_t version = read_u32(data + 4);
+    const uint32_t length = read_u32(data + 8);
+    if ( version != VERSION ) {
+        ev_log_error("[ev::tools::glb::parse] Unsupported glb version: %u", version);
+        return false;
+    }
+    if ( length > size ) {
+        ev_log_error("[ev::tools::glb::parse] glb length %u exceeds file size %zu.", length, size);
+        return false;
+    }
+
+    size_t offset = 12;
+    bool first = true;
+    while ( offset + 8 <= length ) {
+        const uint32_t chunk_length = read_u32(data + offset);
+        const uint32_t chunk_type = read_u32(data + offset + 4);
+        offset += 8;
+        if ( chunk_length > length - offset ) {
+            ev_log_error("[ev::tools::glb::parse] Chunk length %u exceeds glb length.", chunk_length);
+            return false;
+        }
+        if ( first ) {
+            if ( chunk_type != CHUNK_JSON ) {
+                ev_log_error("[ev::tools::glb::parse] First chunk is not JSON.");
+                return false;
+            }
+            container.json = std::string_view(reinterpret_cast<const char*>(data + offset), chunk_length);
+            first = false;
+        } else if ( chunk_type == CHUNK_BIN && container.bin == nullptr ) {
+            container.bin = data + offset;
+            container.bin_size = chunk_length;
+        }
+        // 청크는 4 바이트 정렬
+        offset += (static_cast<size_t>(chunk_length) + 3) & ~static_cast<size_t>(3);
+    }
+
+    if ( first ) {
+        ev_log_error("[ev::tools::glb::parse] glb has no JSON chunk.");
+        return false;
+    }
+    return true;
+}
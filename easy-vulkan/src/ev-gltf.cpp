@@ -1,18 +1,102 @@
 #include "tools/ev-gltf.h"
+#include "tools/ev-accessor.h"
+#include "tools/ev-glb.h"
+#include "tools/ev-bindless_materials.h"
+#include "tools/ev-geometry_heap.h"
+#include "tools/ev-pixel.h"
+#include "tools/ev-hash.h"
+#include "tools/ev-mesh_optimizer.h"
+#include "tools/ev-model_instance.h"
+#include "tools/ev-parallel.h"
+#include "tools/ev-vertex_quantize.h"
+#include <algorithm>
+#include <cstring>
 #include <assert.h>
 #include <cstdlib>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace ev::tools::gltf;
 
+bool ev::tools::gltf::skip_material(const Material& material, uint32_t render_flags) {
+    bool skip = false;
+    if ( render_flags & RenderFlag::OPAQUE ) {
+        skip =  material.get_alpha_mode() != Material::AlphaMode::OPAQUE;
+    }
+    if ( render_flags & RenderFlag::ALPHA_MASK ) {
+        skip = material.get_alpha_mode() != Material::AlphaMode::MASK;
+    }
+    if ( render_flags & RenderFlag::ALPHA_BLEND ) {
+        skip = material.get_alpha_mode() != Material::AlphaMode::BLEND;
+    }
+    return skip;
+}
+
+void ev::tools::gltf::extract_frustum_planes(const glm::mat4& matrix, glm::vec4 planes[6]) {
+    const glm::mat4 rows = glm::transpose(matrix);
+    planes[0] = rows[3] + rows[0];
+    planes[1] = rows[3] - rows[0];
+    planes[2] = rows[3] + rows[1];
+    planes[3] = rows[3] - rows[1];
+    planes[4] = rows[3] + rows[2];
+    planes[5] = rows[3] - rows[2];
+    for ( int i = 0 ; i < 6 ; ++i ) {
+        const float length = glm::length(glm::vec3(planes[i]));
+        if ( length > 0.0f ) {
+            planes[i] /= length;
+        }
+    }
+}
+
+namespace {
+
+/**
+ * @brief sphere(xyz: 중심, w: 반지름)가 절두체 평면 하나라도 완전히 벗어나면 true
+ */
+bool outside_frustum(const glm::vec4 planes[6], const glm::vec4& sphere) {
+    for ( int i = 0 ; i < 6 ; ++i ) {
+        if ( glm::dot(glm::vec3(planes[i]), glm::vec3(sphere)) + planes[i].w < -sphere.w ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}
+
 VkVertexInputBindingDescription Vertex::vertex_binding_description = {};
+std::vector<VkVertexInputBindingDescription> Vertex::vertex_binding_descriptions = {};
 std::vector<VkVertexInputAttributeDescription> Vertex::vertex_attribute_descriptions = {};
 VkPipelineVertexInputStateCreateInfo Vertex::vertex_input_state_create_info = {};
 
 
 VkVertexInputBindingDescription Vertex::input_binding_description(uint32_t binding) {
+    return Vertex::input_binding_description(binding, VertexLayout());
+}
+
+VkVertexInputAttributeDescription Vertex::input_attribute_description(
+    uint32_t binding, 
+    uint32_t location,
+    VertexType type
+) {
+    return Vertex::input_attribute_description(binding, location, type, VertexLayout());
+}
+
+std::vector<VkVertexInputAttributeDescription> Vertex::input_attribute_descriptions(
+    uint32_t binding, 
+    std::vector<VertexType> types
+) {
+    return Vertex::input_attribute_descriptions(binding, std::move(types), VertexLayout());
+}
+
+VkPipelineVertexInputStateCreateInfo* Vertex::get_pipeline_vertex_input_state(const std::vector<VertexType> types) {
+    return Vertex::get_pipeline_vertex_input_state(VertexLayout(), types);
+}
+
+VkVertexInputBindingDescription Vertex::input_binding_description(uint32_t binding, const VertexLayout& layout, uint32_t stream) {
     VkVertexInputBindingDescription description{};
-    description.binding = binding;
-    description.stride = sizeof(Vertex);
+    description.binding = binding + stream;
+    description.stride = layout.get_stream_stride(stream);
     description.inputRate = VK_VERTEX_INPUT_RATE_VERTEX; // Vertex input rate is per vertex
     return description;
 }
@@ -20,76 +104,378 @@ VkVertexInputBindingDescription Vertex::input_binding_description(uint32_t bindi
 VkVertexInputAttributeDescription Vertex::input_attribute_description(
     uint32_t binding, 
     uint32_t location,
-    VertexType type
+    VertexType type,
+    const VertexLayout& layout
 ) {
     VkVertexInputAttributeDescription description{};
-    description.binding = binding;
-    description.location = location;
-    description.offset = 0;
-
-    switch (type) {
-        case Position:
-            description.format = VK_FORMAT_R32G32B32_SFLOAT;
-            description.offset = offsetof(Vertex, pos);
-            break;
-        case Normal:
-            description.format = VK_FORMAT_R32G32B32_SFLOAT;
-            description.offset = offsetof(Vertex, normal);
-            break;
-        case UV:
-            description.format = VK_FORMAT_R32G32_SFLOAT;
-            description.offset = offsetof(Vertex, uv);
-            break;
-        case Color:
-            description.format = VK_FORMAT_R32G32B32A32_SFLOAT;
-            description.offset = offsetof(Vertex, color);
-            break;
-        case Joint:
-            description.format = VK_FORMAT_R32G32B32A32_SFLOAT;
-            description.offset = offsetof(Vertex, joint);
-            break;
-        case Weight:
-            description.format = VK_FORMAT_R32G32B32A32_SFLOAT;
-            description.offset = offsetof(Vertex, weight);
-            break;
-        case Tangent:
-            description.format = VK_FORMAT_R32G32B32A32_SFLOAT;
-            description.offset = offsetof(Vertex, tangent);
-            break;
-        default: 
-            description = {};
+    if ( static_cast<uint32_t>(type) >= VERTEX_TYPE_COUNT || !layout.has(type) ) {
+        ev_log_error("[ev::tools::gltf::Vertex] Vertex attribute %d is not part of the vertex layout.", type);
+        return description;
     }
+    description.binding = binding + layout.get_stream(type);
+    description.location = location;
+    description.format = layout.get_format(type);
+    description.offset = layout.get_offset(type);
     return description;
 }
 
 std::vector<VkVertexInputAttributeDescription> Vertex::input_attribute_descriptions(
     uint32_t binding, 
-    std::vector<VertexType> types
+    std::vector<VertexType> types,
+    const VertexLayout& layout
 ) {
     std::vector<VkVertexInputAttributeDescription> descriptions;
     for (size_t i = 0; i < types.size(); ++i) {
-        descriptions.push_back(Vertex::input_attribute_description(binding, static_cast<uint32_t>(i), types[i]));
+        descriptions.push_back(Vertex::input_attribute_description(binding, static_cast<uint32_t>(i), types[i], layout));
     }
     return descriptions;
 }
-VkPipelineVertexInputStateCreateInfo* Vertex::get_pipeline_vertex_input_state(const std::vector<VertexType> types) {
-    vertex_binding_description = Vertex::input_binding_description(0);
-    Vertex::vertex_attribute_descriptions = Vertex::input_attribute_descriptions(0, types);
+
+VkPipelineVertexInputStateCreateInfo* Vertex::get_pipeline_vertex_input_state(const VertexLayout& layout, const std::vector<VertexType> types) {
+    // 사용하는 속성이 들어 있는 스트림의 binding 만 생성
+    uint32_t attribute_mask = 0;
+    for ( VertexType type : types ) {
+        attribute_mask |= 1u << type;
+    }
+    const uint32_t stream_mask = layout.get_stream_mask(attribute_mask);
+    Vertex::vertex_binding_descriptions.clear();
+    for ( uint32_t stream = 0 ; stream < layout.get_stream_count() ; ++stream ) {
+        if ( stream_mask & (1u << stream) ) {
+            Vertex::vertex_binding_descriptions.push_back(Vertex::input_binding_description(0, layout, stream));
+        }
+    }
+    vertex_binding_description = vertex_binding_descriptions.empty() ? VkVertexInputBindingDescription{} : vertex_binding_descriptions.front();
+    Vertex::vertex_attribute_descriptions = Vertex::input_attribute_descriptions(0, types, layout);
     vertex_input_state_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
     vertex_input_state_create_info.pNext = nullptr;
     vertex_input_state_create_info.flags = 0;
-    vertex_input_state_create_info.vertexBindingDescriptionCount = 1;
-    vertex_input_state_create_info.pVertexBindingDescriptions = &Vertex::vertex_binding_description;
+    vertex_input_state_create_info.vertexBindingDescriptionCount = static_cast<uint32_t>(Vertex::vertex_binding_descriptions.size());
+    vertex_input_state_create_info.pVertexBindingDescriptions = Vertex::vertex_binding_descriptions.data();
     vertex_input_state_create_info.vertexAttributeDescriptionCount = static_cast<uint32_t>(Vertex::vertex_attribute_descriptions.size());
     vertex_input_state_create_info.pVertexAttributeDescriptions = Vertex::vertex_attribute_descriptions.data();
-    ev_log_debug("[ev::tools::gltf::Vertex] Vertex input state created with %u attributes.", vertex_input_state_create_info.vertexAttributeDescriptionCount);
+    ev_log_debug("[ev::tools::gltf::Vertex] Vertex input state created with %u attributes in %u bindings.",
+        vertex_input_state_create_info.vertexAttributeDescriptionCount,
+        vertex_input_state_create_info.vertexBindingDescriptionCount);
     return &vertex_input_state_create_info;
 }
 
+VkPipelineVertexInputStateCreateInfo* Vertex::get_instanced_pipeline_vertex_input_state(const VertexLayout& layout, const std::vector<VertexType> types) {
+    Vertex::get_pipeline_vertex_input_state(layout, types);
+
+    // 인스턴스 행렬은 정점 스트림 다음 binding 에서 열마다 vec4 로 읽음
+    const uint32_t binding = layout.get_stream_count();
+    VkVertexInputBindingDescription instance_binding{};
+    instance_binding.binding = binding;
+    instance_binding.stride = sizeof(glm::mat4);
+    instance_binding.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+    Vertex::vertex_binding_descriptions.push_back(instance_binding);
+    for ( uint32_t column = 0 ; column < 4 ; ++column ) {
+        VkVertexInputAttributeDescription description{};
+        description.binding = binding;
+        description.location = static_cast<uint32_t>(types.size()) + column;
+        description.format = VK_FORMAT_R32G32B32A32_SFLOAT;
+        description.offset = sizeof(glm::vec4) * column;
+        Vertex::vertex_attribute_descriptions.push_back(description);
+    }
+    vertex_input_state_create_info.vertexBindingDescriptionCount = static_cast<uint32_t>(Vertex::vertex_binding_descriptions.size());
+    vertex_input_state_create_info.pVertexBindingDescriptions = Vertex::vertex_binding_descriptions.data();
+    vertex_input_state_create_info.vertexAttributeDescriptionCount = static_cast<uint32_t>(Vertex::vertex_attribute_descriptions.size());
+    vertex_input_state_create_info.pVertexAttributeDescriptions = Vertex::vertex_attribute_descriptions.data();
+    return &vertex_input_state_create_info;
+}
+
+namespace {
+
+/**
+ * @brief accessor 의 bufferView 범위를 확인하고 View 로 변환합니다. sparse 값은 적용하지 않습니다.
+ * @param buffers glTF 버퍼별 데이터 (GLTFModelManager::buffer_data)
+ */
+bool make_accessor_view(const tinygltf::Model& gltf_model,
+    const std::vector<std::span<const uint8_t>>& buffers,
+    int accessor_index,
+    ev::tools::accessor::View& view
+) {
+    if ( accessor_index < 0 || accessor_index >= static_cast<int>(gltf_model.accessors.size()) ) {
+        return false;
+    }
+    const tinygltf::Accessor& accessor = gltf_model.accessors[accessor_index];
+    if ( accessor.bufferView < 0 || accessor.bufferView >= static_cast<int>(gltf_model.bufferViews.size()) ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager] Accessor %d has no buffer view.", accessor_index);
+        return false;
+    }
+    const tinygltf::BufferView& buffer_view = gltf_model.bufferViews[accessor.bufferView];
+    if ( buffer_view.buffer < 0 || buffer_view.buffer >= static_cast<int>(buffers.size()) ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager] Accessor %d has invalid buffer.", accessor_index);
+        return false;
+    }
+    const std::span<const uint8_t> buffer = buffers[buffer_view.buffer];
+    if ( accessor.sparse.isSparse ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager] Sparse accessor %d is read without sparse values.", accessor_index);
+    }
+
+    const int components = tinygltf::GetNumComponentsInType(static_cast<uint32_t>(accessor.type));
+    view.count = accessor.count;
+    view.stride = static_cast<uint32_t>(buffer_view.byteStride);
+    view.component_type = static_cast<ev::tools::accessor::ComponentType>(accessor.componentType);
+    view.components = components > 0 ? static_cast<uint32_t>(components) : 0;
+    view.normalized = accessor.normalized;
+    const size_t offset = buffer_view.byteOffset + accessor.byteOffset;
+    const size_t limit = std::min(buffer.size(), buffer_view.byteOffset + buffer_view.byteLength);
+    if ( !view.is_valid(offset, limit) ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager] Accessor %d is out of buffer range or has unsupported type.", accessor_index);
+        return false;
+    }
+    view.data = buffer.data() + offset;
+    return true;
+}
+
+/**
+ * @brief accessor 원본 데이터의 정점 포맷. 대응하는 포맷이 없으면 VK_FORMAT_UNDEFINED
+ */
+VkFormat accessor_format(const ev::tools::accessor::View& view) {
+    using ev::tools::accessor::ComponentType;
+    static constexpr VkFormat FLOAT_FORMATS[] = { VK_FORMAT_R32_SFLOAT, VK_FORMAT_R32G32_SFLOAT, VK_FORMAT_R32G32B32_SFLOAT, VK_FORMAT_R32G32B32A32_SFLOAT };
+    static constexpr VkFormat UNORM8_FORMATS[] = { VK_FORMAT_R8_UNORM, VK_FORMAT_R8G8_UNORM, VK_FORMAT_R8G8B8_UNORM, VK_FORMAT_R8G8B8A8_UNORM };
+    static constexpr VkFormat UINT8_FORMATS[] = { VK_FORMAT_R8_UINT, VK_FORMAT_R8G8_UINT, VK_FORMAT_R8G8B8_UINT, VK_FORMAT_R8G8B8A8_UINT };
+    static constexpr VkFormat SNORM8_FORMATS[] = { VK_FORMAT_R8_SNORM, VK_FORMAT_R8G8_SNORM, VK_FORMAT_R8G8B8_SNORM, VK_FORMAT_R8G8B8A8_SNORM };
+    static constexpr VkFormat UNORM16_FORMATS[] = { VK_FORMAT_R16_UNORM, VK_FORMAT_R16G16_UNORM, VK_FORMAT_R16G16B16_UNORM, VK_FORMAT_R16G16B16A16_UNORM };
+    static constexpr VkFormat UINT16_FORMATS[] = { VK_FORMAT_R16_UINT, VK_FORMAT_R16G16_UINT, VK_FORMAT_R16G16B16_UINT, VK_FORMAT_R16G16B16A16_UINT };
+    static constexpr VkFormat SNORM16_FORMATS[] = { VK_FORMAT_R16_SNORM, VK_FORMAT_R16G16_SNORM, VK_FORMAT_R16G16B16_SNORM, VK_FORMAT_R16G16B16A16_SNORM };
+    if ( view.components == 0 || view.components > 4 ) {
+        return VK_FORMAT_UNDEFINED;
+    }
+    const uint32_t i = view.components - 1;
+    switch ( view.component_type ) {
+        case ComponentType::Float: return FLOAT_FORMATS[i];
+        case ComponentType::UnsignedByte: return view.normalized ? UNORM8_FORMATS[i] : UINT8_FORMATS[i];
+        case ComponentType::Byte: return view.normalized ? SNORM8_FORMATS[i] : VK_FORMAT_UNDEFINED;
+        case ComponentType::UnsignedShort: return view.normalized ? UNORM16_FORMATS[i] : UINT16_FORMATS[i];
+        case ComponentType::Short: return view.normalized ? SNORM16_FORMATS[i] : VK_FORMAT_UNDEFINED;
+        default: return VK_FORMAT_UNDEFINED;
+    }
+}
+
+uint32_t attribute_size(VertexType type, VertexEncoding encoding) {
+    if ( encoding == VertexEncoding::Quantized ) {
+        return type == Position ? 8 : 4;
+    }
+    switch ( type ) {
+        case Position:
+        case Normal:
+            return 12;
+        case UV:
+            return 8;
+        default:
+            return 16;
+    }
+}
+
+}
+
+VertexLayout::VertexLayout() : attribute_mask((1u << VERTEX_TYPE_COUNT) - 1) {
+    build();
+}
+
+VertexLayout::VertexLayout(
+    const std::vector<VertexType>& attributes,
+    VertexEncoding encoding,
+    VertexStreams streams
+) : encoding(encoding), streams(streams) {
+    for ( VertexType type : attributes ) {
+        attribute_mask |= 1u << type;
+    }
+    build();
+}
+
+VertexLayout VertexLayout::from_key(uint32_t key) {
+    VertexLayout layout;
+    layout.attribute_mask = key & ((1u << VERTEX_TYPE_COUNT) - 1);
+    layout.encoding = static_cast<VertexEncoding>((key >> 16) & 0xF);
+    layout.streams = static_cast<VertexStreams>((key >> 20) & 0xF);
+    layout.build();
+    return layout;
+}
+
+void VertexLayout::build() {
+    stride = 0;
+    stream_count = 0;
+    std::fill(std::begin(offsets), std::end(offsets), 0u);
+    std::fill(std::begin(attribute_streams), std::end(attribute_streams), 0u);
+    std::fill(std::begin(stream_strides), std::end(stream_strides), 0u);
+
+    // 속성을 VertexType 순서로 순회하며 그룹이 바뀔 때마다 새 스트림을 연다. (빈 스트림 없음)
+    uint32_t last_group = UINT32_MAX;
+    for ( uint32_t type = 0 ; type < VERTEX_TYPE_COUNT ; ++type ) {
+        if ( !(attribute_mask & (1u << type)) ) {
+            continue;
+        }
+        uint32_t group = 0;
+        switch ( streams ) {
+            case VertexStreams::SplitPosition: group = type == Position ? 0 : 1; break;
+            case VertexStreams::PerAttribute: group = type; break;
+            default: group = 0; break;
+        }
+        if ( group != last_group ) {
+            last_group = group;
+            ++stream_count;
+        }
+        const uint32_t stream = stream_count - 1;
+        const uint32_t size = attribute_size(static_cast<VertexType>(type), encoding);
+        attribute_streams[type] = stream;
+        offsets[type] = stream_strides[stream];
+        stream_strides[stream] += size;
+        stride += size;
+    }
+}
+
+uint32_t VertexLayout::get_stream_mask(uint32_t attribute_mask) const {
+    uint32_t mask = 0;
+    for ( uint32_t type = 0 ; type < VERTEX_TYPE_COUNT ; ++type ) {
+        if ( (attribute_mask & (1u << type)) && has(static_cast<VertexType>(type)) ) {
+            mask |= 1u << attribute_streams[type];
+        }
+    }
+    return mask;
+}
+
+VkDeviceSize VertexLayout::get_stream_offset(uint32_t stream, uint32_t vertex_count) const {
+    VkDeviceSize offset = 0;
+    for ( uint32_t i = 0 ; i < stream && i < stream_count ; ++i ) {
+        offset += static_cast<VkDeviceSize>(vertex_count) * stream_strides[i];
+        if ( i + 1 < stream_count ) {
+            offset = (offset + STREAM_ALIGNMENT - 1) & ~(STREAM_ALIGNMENT - 1);
+        }
+    }
+    return offset;
+}
+
+VkDeviceSize VertexLayout::get_buffer_size(uint32_t vertex_count) const {
+    return get_stream_offset(stream_count, vertex_count);
+}
+
+VkFormat VertexLayout::get_format(VertexType type) const {
+    if ( encoding == VertexEncoding::Quantized ) {
+        switch ( type ) {
+            case Position: return VK_FORMAT_R16G16B16A16_SNORM;
+            case Normal: return VK_FORMAT_R16G16_SNORM;
+            case UV: return VK_FORMAT_R16G16_SFLOAT;
+            case Color: return VK_FORMAT_R8G8B8A8_UNORM;
+            case Joint: return VK_FORMAT_R8G8B8A8_UINT;
+            case Weight: return VK_FORMAT_R8G8B8A8_UNORM;
+            case Tangent: return VK_FORMAT_R8G8B8A8_SNORM;
+        }
+    }
+    switch ( type ) {
+        case Position:
+        case Normal:
+            return VK_FORMAT_R32G32B32_SFLOAT;
+        case UV:
+            return VK_FORMAT_R32G32_SFLOAT;
+        default:
+            return VK_FORMAT_R32G32B32A32_SFLOAT;
+    }
+}
+
+bool VertexLayout::is_native() const {
+    return encoding == VertexEncoding::Float
+        && stream_count == 1
+        && attribute_mask == (1u << VERTEX_TYPE_COUNT) - 1
+        && stride == sizeof(Vertex);
+}
+
+void VertexLayout::encode(
+    const Vertex* src,
+    size_t count,
+    const glm::vec3& position_offset,
+    const glm::vec3& position_scale,
+    uint8_t* const* dst,
+    uint32_t encode_mask
+) const {
+    namespace q = ev::tools::quantize;
+    auto has = [&](VertexType type) {
+        return this->has(type) && (encode_mask & (1u << type)) != 0;
+    };
+    const glm::vec3 inv_scale = 1.0f / position_scale;
+
+    for ( size_t i = 0 ; i < count ; ++i ) {
+        const Vertex& vtx = src[i];
+        auto out = [&](VertexType type) -> uint8_t* {
+            const uint32_t stream = attribute_streams[type];
+            return dst[stream] + i * stream_strides[stream] + offsets[type];
+        };
+
+        if ( encoding == VertexEncoding::Float ) {
+            if ( has(Position) ) std::memcpy(out(Position), &vtx.pos, sizeof(glm::vec3));
+            if ( has(Normal) ) std::memcpy(out(Normal), &vtx.normal, sizeof(glm::vec3));
+            if ( has(UV) ) std::memcpy(out(UV), &vtx.uv, sizeof(glm::vec2));
+            if ( has(Color) ) std::memcpy(out(Color), &vtx.color, sizeof(glm::vec4));
+            if ( has(Joint) ) std::memcpy(out(Joint), &vtx.joint, sizeof(glm::vec4));
+            if ( has(Weight) ) std::memcpy(out(Weight), &vtx.weight, sizeof(glm::vec4));
+            if ( has(Tangent) ) std::memcpy(out(Tangent), &vtx.tangent, sizeof(glm::vec4));
+            continue;
+        }
+
+        if ( has(Position) ) {
+            const glm::vec3 p = (vtx.pos - position_offset) * inv_scale;
+            const int16_t encoded[4] = { q::float_to_snorm16(p.x), q::float_to_snorm16(p.y), q::float_to_snorm16(p.z), 32767 };
+            std::memcpy(out(Position), encoded, sizeof(encoded));
+        }
+        if ( has(Normal) ) {
+            float octahedral[2];
+            q::octahedral_encode(glm::value_ptr(vtx.normal), octahedral);
+            const int16_t encoded[2] = { q::float_to_snorm16(octahedral[0]), q::float_to_snorm16(octahedral[1]) };
+            std::memcpy(out(Normal), encoded, sizeof(encoded));
+        }
+        if ( has(UV) ) {
+            uint16_t encoded[2];
+            ev::tools::pixel::r32f_to_r16f(glm::value_ptr(vtx.uv), encoded, 2);
+            std::memcpy(out(UV), encoded, sizeof(encoded));
+        }
+        if ( has(Color) ) {
+            uint8_t* color = out(Color);
+            for ( int c = 0 ; c < 4 ; ++c ) color[c] = q::float_to_unorm8(vtx.color[c]);
+        }
+        if ( has(Joint) ) {
+            uint8_t* joint = out(Joint);
+            for ( int c = 0 ; c < 4 ; ++c ) joint[c] = static_cast<uint8_t>(std::min(vtx.joint[c], 255.0f));
+        }
+        if ( has(Weight) ) {
+            q::weights_to_unorm8(glm::value_ptr(vtx.weight), out(Weight));
+        }
+        if ( has(Tangent) ) {
+            float octahedral[2];
+            q::octahedral_encode(glm::value_ptr(vtx.tangent), octahedral);
+            int8_t* tangent = reinterpret_cast<int8_t*>(out(Tangent));
+            tangent[0] = q::float_to_snorm8(octahedral[0]);
+            tangent[1] = q::float_to_snorm8(octahedral[1]);
+            tangent[2] = 0;
+            tangent[3] = vtx.tangent.w < 0.0f ? -127 : 127;
+        }
+    }
+}
+
 Node::Node(uint32_t index): index(index) {
 
 }
 
+void Node::attach_transform(const std::shared_ptr<ev::tools::TransformHierarchy>& hierarchy, uint32_t transform_index) {
+    // 다른 hierarchy 에 연결되어 있었다면 그 값을 옮김
+    const glm::vec3 translation = get_translation();
+    const glm::quat rotation = get_rotation();
+    const glm::vec3 scale = get_scale();
+    const glm::mat4 matrix = get_matrix();
+    const float xyzw[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+
+    hierarchy->set_translation(transform_index, glm::value_ptr(translation));
+    hierarchy->set_rotation(transform_index, xyzw);
+    hierarchy->set_scale(transform_index, glm::value_ptr(scale));
+    // glTF 노드는 matrix 또는 TRS 중 하나로 지정되므로 로딩된 행렬을 그대로 사용. TRS 를 다시 설정하면 TRS 로 계산
+    hierarchy->set_local_matrix(transform_index, glm::value_ptr(matrix));
+
+    this->transforms = hierarchy;
+    this->transform_index = transform_index;
+}
+
 void Primitive::set_dimensions(glm::vec3 min_pos, glm::vec3 max_pos) {
     this->dimensions.min = min_pos;
     this->dimensions.max = max_pos;
@@ -98,99 +484,722 @@ void Primitive::set_dimensions(glm::vec3 min_pos, glm::vec3 max_pos) {
     this->dimensions.radius = glm::distance(min_pos, max_pos) * 0.5f;
 }
 
-void Model::bind_buffers(std::shared_ptr<ev::CommandBuffer> command_buffer) {
+void Mesh::upload_uniform() {
+    if ( !uniform_buffer.buffer ) {
+        return;
+    }
+    if ( !uniform_buffer.buffer->get_mapped_ptr() ) {
+        CHECK_RESULT(uniform_buffer.buffer->map(sizeof(Uniform)));
+    }
+    std::memcpy(uniform_buffer.buffer->get_mapped_ptr(), &uniform_data, sizeof(Uniform));
+}
+
+void Model::bind_buffers(std::shared_ptr<ev::CommandBuffer> command_buffer, uint32_t vertex_pass) {
     ev_log_debug("[ev::tools::gltf::Model] Binding vertex and index buffers");
     if (vertex_buffer) {
-        command_buffer->bind_vertex_buffers(
-            0,
-            {this->vertex_buffer},
-            {0}
-        );
+        // 패스가 읽는 속성이 들어 있는 스트림만 바인딩 (binding = 스트림 번호)
+        const uint32_t stream_mask = vertex_layout.get_stream_mask(vertex_pass);
+        for ( uint32_t stream = 0 ; stream < vertex_layout.get_stream_count() ; ++stream ) {
+            if ( !(stream_mask & (1u << stream)) ) {
+                continue;
+            }
+            command_buffer->bind_vertex_buffers(
+                stream,
+                {this->vertex_buffer},
+                {stream < vertex_stream_offsets.size() ? vertex_stream_offsets[stream] : 0}
+            );
+        }
         ev_log_debug("[ev::tools::gltf::Model] Vertex buffer bound successfully.");
     }
     if (index_buffer) {
         command_buffer->bind_index_buffers(
             {this->index_buffer},
             0,
-            VK_INDEX_TYPE_UINT32
+            index_type
         );
         ev_log_debug("[ev::tools::gltf::Model] Index buffer bound successfully.");
     }
     // buffer_bound = true;
 }
 
+void Model::select_lod(
+    const glm::mat4& matrix,
+    const Primitive& primitive,
+    uint32_t& first_index,
+    uint32_t& index_count
+) const {
+    const Primitive::Dimensions& dimensions = primitive.get_dimensions();
+    if ( draw_view.projection_scale <= 0.0f || primitive.get_lods().empty() || dimensions.radius <= 0.0f ) {
+        return;
+    }
+
+    const glm::mat4 world = draw_view.model_matrix * matrix;
+    const glm::vec3 center = glm::vec3(world * glm::vec4(dimensions.center, 1.0f));
+    const float scale = glm::max(glm::length(glm::vec3(world[0])), glm::max(glm::length(glm::vec3(world[1])), glm::length(glm::vec3(world[2]))));
+    const float radius = dimensions.radius * scale;
+    const float distance = glm::distance(center, draw_view.camera_position) - radius;
+    if ( distance <= 0.0f ) {
+        return; // 카메라가 bounding sphere 안에 있음
+    }
+
+    // bounding sphere 의 화면 반지름(px) 에 대한 비율로 LOD 오차를 픽셀로 환산
+    const float projected_radius = radius * draw_view.projection_scale / distance;
+    for ( const Primitive::Lod& lod : primitive.get_lods() ) {
+        if ( lod.error / dimensions.radius * projected_radius > draw_view.pixel_error ) {
+            break;
+        }
+        first_index = lod.first_index;
+        index_count = lod.index_count;
+    }
+}
+
+void Model::push_material_index(std::shared_ptr<ev::CommandBuffer> command_buffer,
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+    uint32_t material_index
+) {
+    command_buffer->bind_push_constants(
+        pipeline_layout,
+        material_index_stages,
+        material_index_offset,
+        &material_index,
+        sizeof(uint32_t)
+    );
+}
+
+void Model::bind_material(
+    std::shared_ptr<ev::CommandBuffer> command_buffer,
+    const Material& material,
+    uint32_t render_flags,
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+    uint32_t bind_image_set
+) {
+    if ( render_flags & RenderFlag::BINDLESS ) {
+        // 텍스처 배열과 머티리얼 SSBO 는 BindlessMaterials::bind 로 한 번만 바인딩
+        push_material_index(command_buffer, pipeline_layout, material.get_material_index());
+    } else if ( render_flags & RenderFlag::BIND_IMAGE ) {
+        command_buffer->bind_descriptor_sets(
+            VK_PIPELINE_BIND_POINT_GRAPHICS,
+            pipeline_layout,
+            {material.get_descriptor_set()},
+            bind_image_set,
+            {}
+        );
+    }
+}
+
+void Model::bind_mesh_descriptor_set(
+    std::shared_ptr<ev::CommandBuffer> command_buffer,
+    Mesh& mesh,
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout
+) {
+    const std::shared_ptr<ev::DescriptorSet>& descriptor_set = mesh.get_descriptor_set();
+    if ( mesh_set_index == NO_MESH_SET || !descriptor_set ) {
+        return;
+    }
+    command_buffer->bind_descriptor_sets(
+        VK_PIPELINE_BIND_POINT_GRAPHICS,
+        pipeline_layout,
+        {descriptor_set},
+        mesh_set_index,
+        {}
+    );
+}
+
 void Model::draw_node(
     std::shared_ptr<ev::CommandBuffer> command_buffer,
-    const std::shared_ptr<Node> node,
+    const std::shared_ptr<Node>& node,
     uint32_t render_flags,
     std::shared_ptr<ev::PipelineLayout> pipeline_layout,
     uint32_t bind_image_set
 ) {
-    if (!node->get_mesh()) {
-        return; // No mesh to draw
-    }
+    if (!node->get_mesh()) {
+        return; // No mesh to draw
+    }
+
+    bind_mesh_descriptor_set(command_buffer, *node->get_mesh(), pipeline_layout);
+    for ( const auto& primitive : node->get_mesh()->get_primitives() ) {
+        const auto& material = primitive->get_material();
+        if ( skip_material(*material, render_flags) ) continue;
+
+        bind_material(command_buffer, *material, render_flags, pipeline_layout, bind_image_set);
+
+        uint32_t first_index = primitive->get_first_index();
+        uint32_t index_count = primitive->get_index_count();
+        select_lod(node->get_mesh()->get_uniform_data().matrix, *primitive, first_index, index_count);
+
+        // 인덱스는 프리미티브 로컬이므로 first_vertex 를 vertexOffset 으로 전달
+        command_buffer->draw_indexed(
+            index_count,
+            1, first_index,
+            static_cast<int32_t>(primitive->get_first_vertex()), 0 // first instance
+        );
+    }
+
+    for ( const auto& node : node->get_children() ) {
+        draw_node(command_buffer, node, render_flags, pipeline_layout, bind_image_set);
+    }
+}
+
+void Model::draw(std::shared_ptr<ev::CommandBuffer> command_buffer, 
+    uint32_t render_flags, 
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+    uint32_t bind_image_set,
+    uint32_t vertex_pass
+) {
+    bind_buffers(command_buffer, vertex_pass);
+    
+    for (const auto& node : nodes) {
+        draw_node(command_buffer, node, render_flags, pipeline_layout, bind_image_set);
+    }
+}
+
+VkDrawIndexedIndirectCommand* Model::reserve_indirect_commands(uint32_t frame_index, uint32_t count) {
+    if ( frame_index >= indirect_frames.size() ) {
+        indirect_frames.resize(frame_index + 1);
+    }
+    IndirectFrame& frame = indirect_frames[frame_index];
+    if ( !frame.buffer || frame.capacity < count ) {
+        // 이 프레임 번호의 이전 제출은 끝났으므로 바로 교체 가능
+        const uint32_t capacity = std::max(count, 64u);
+        const VkDeviceSize size = static_cast<VkDeviceSize>(capacity) * sizeof(VkDrawIndexedIndirectCommand);
+        frame.buffer.reset();
+        frame.memory.reset();
+        frame.buffer = std::make_shared<ev::Buffer>(device, size, ev::buffer_type::INDIRECT_BUFFER);
+        frame.memory = std::make_shared<ev::Memory>(
+            device,
+            size,
+            ev::memory_type::HOST_ONLY,
+            frame.buffer->get_memory_requirements()
+        );
+        CHECK_RESULT(frame.buffer->bind_memory(frame.memory, 0, size));
+        CHECK_RESULT(frame.buffer->map(size));
+        frame.capacity = capacity;
+    }
+    return static_cast<VkDrawIndexedIndirectCommand*>(frame.buffer->get_mapped_ptr());
+}
+
+void Model::update_instances(uint32_t frame_index) {
+    if ( instance_count == 0 ) {
+        return;
+    }
+    if ( frame_index >= instance_frames.size() ) {
+        instance_frames.resize(frame_index + 1);
+    }
+    IndirectFrame& frame = instance_frames[frame_index];
+    if ( !frame.buffer || frame.capacity < instance_count ) {
+        const VkDeviceSize size = static_cast<VkDeviceSize>(instance_count) * sizeof(glm::mat4);
+        frame.buffer.reset();
+        frame.memory.reset();
+        frame.buffer = std::make_shared<ev::Buffer>(device, size, ev::buffer_type::VERTEX_BUFFER);
+        frame.memory = std::make_shared<ev::Memory>(
+            device,
+            size,
+            ev::memory_type::HOST_ONLY,
+            frame.buffer->get_memory_requirements()
+        );
+        CHECK_RESULT(frame.buffer->bind_memory(frame.memory, 0, size));
+        CHECK_RESULT(frame.buffer->map(size));
+        frame.capacity = instance_count;
+    }
+
+    glm::mat4* matrices = static_cast<glm::mat4*>(frame.buffer->get_mapped_ptr());
+    for ( const InstanceGroup& group : instance_groups ) {
+        for ( size_t i = 0 ; i < group.nodes.size() ; ++i ) {
+            matrices[group.first_instance + i] = group.nodes[i]->get_world_matrix();
+        }
+    }
+}
+
+void Model::write_instances(const ev::tools::TransformHierarchy& transforms, const glm::mat4& model_matrix, glm::mat4* matrices) const {
+    for ( const InstanceGroup& group : instance_groups ) {
+        for ( size_t i = 0 ; i < group.nodes.size() ; ++i ) {
+            matrices[group.first_instance + i] = model_matrix * glm::make_mat4(transforms.get_world_matrix(group.nodes[i]->get_transform_index()));
+        }
+    }
+}
+
+void Model::set_geometry_allocation(std::shared_ptr<GeometryAllocation> allocation,
+    std::shared_ptr<ev::Buffer> vertex_buffer,
+    std::shared_ptr<ev::Buffer> index_buffer,
+    const std::vector<VkDeviceSize>& stream_offsets
+) {
+    const int64_t vertex_offset = static_cast<int64_t>(allocation ? allocation->get_first_vertex() : 0)
+        - static_cast<int64_t>(geometry_allocation ? geometry_allocation->get_first_vertex() : 0);
+    const int64_t index_offset = static_cast<int64_t>(allocation ? allocation->get_first_index() : 0)
+        - static_cast<int64_t>(geometry_allocation ? geometry_allocation->get_first_index() : 0);
+    // 여러 노드가 같은 메시를 공유하므로 프리미티브마다 한 번만 옮김
+    std::unordered_set<const Mesh*> visited;
+    for ( const auto& node : linear_nodes ) {
+        const std::shared_ptr<Mesh>& mesh = node->get_mesh();
+        if ( !mesh || !visited.insert(mesh.get()).second ) {
+            continue;
+        }
+        for ( const auto& primitive : mesh->get_primitives() ) {
+            primitive->offset_range(vertex_offset, index_offset);
+        }
+    }
+    this->geometry_allocation = std::move(allocation);
+    this->vertex_buffer = std::move(vertex_buffer);
+    this->index_buffer = std::move(index_buffer);
+    this->vertex_stream_offsets = stream_offsets;
+}
+
+uint64_t Model::get_resource_bytes() const {
+    uint64_t bytes = 0;
+    if ( geometry_allocation ) {
+        // 힙 버퍼는 모든 모델이 공유하므로 이 모델의 구간만 계산
+        const VkDeviceSize index_size = index_type == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t);
+        bytes += static_cast<uint64_t>(geometry_allocation->get_vertex_count()) * vertex_layout.get_stride()
+            + static_cast<uint64_t>(geometry_allocation->get_index_count()) * index_size;
+    }
+    for ( const auto& buffer : { vertex_buffer, index_buffer, meshlet_buffer, meshlet_vertex_buffer, meshlet_triangle_buffer } ) {
+        if ( geometry_allocation && (buffer == vertex_buffer || buffer == index_buffer) ) {
+            continue;
+        }
+        if ( buffer ) {
+            bytes += buffer->get_memory_requirements().size;
+        }
+    }
+    for ( const auto& texture : textures ) {
+        if ( texture && texture->image ) {
+            bytes += texture->image->get_memory_requirements().size;
+        }
+    }
+    return bytes;
+}
+
+void Model::draw_instanced(std::shared_ptr<ev::CommandBuffer> command_buffer,
+    uint32_t frame_index,
+    uint32_t render_flags,
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+    uint32_t bind_image_set,
+    uint32_t vertex_pass
+) {
+    if ( instance_count == 0 ) {
+        return;
+    }
+    if ( frame_index >= instance_frames.size() || !instance_frames[frame_index].buffer ) {
+        ev_log_error("[ev::tools::gltf::Model::draw_instanced] Instance buffer for frame %u is not written. Call update_instances first.", frame_index);
+        return;
+    }
+    const std::shared_ptr<ev::Buffer>& instance_buffer = instance_frames[frame_index].buffer;
+    draw_instanced(command_buffer,
+        instance_buffer,
+        static_cast<const glm::mat4*>(instance_buffer->get_mapped_ptr()),
+        render_flags,
+        pipeline_layout,
+        bind_image_set,
+        vertex_pass
+    );
+}
+
+void Model::draw_instanced(std::shared_ptr<ev::CommandBuffer> command_buffer,
+    const std::shared_ptr<ev::Buffer>& instance_buffer,
+    const glm::mat4* matrices,
+    uint32_t render_flags,
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+    uint32_t bind_image_set,
+    uint32_t vertex_pass
+) {
+    if ( instance_count == 0 ) {
+        return;
+    }
+
+    bind_buffers(command_buffer, vertex_pass);
+    command_buffer->bind_vertex_buffers(get_instance_binding(), {instance_buffer}, {0});
+
+    const Material* bound_material = nullptr;
+    for ( const InstanceGroup& group : instance_groups ) {
+        const uint32_t node_count = static_cast<uint32_t>(group.nodes.size());
+        bind_mesh_descriptor_set(command_buffer, *group.mesh, pipeline_layout);
+        for ( const auto& primitive : group.mesh->get_primitives() ) {
+            const auto& material = primitive->get_material();
+            if ( skip_material(*material, render_flags) ) continue;
+
+            if ( material.get() != bound_material ) {
+                bind_material(command_buffer, *material, render_flags, pipeline_layout, bind_image_set);
+                bound_material = material.get();
+            }
+
+            const int32_t vertex_offset = static_cast<int32_t>(primitive->get_first_vertex());
+            if ( !matrices || primitive->get_lods().empty() ) {
+                command_buffer->draw_indexed(primitive->get_index_count(), node_count, primitive->get_first_index(), vertex_offset, group.first_instance);
+                continue;
+            }
+
+            // 인스턴스마다 LOD 를 고르고 같은 LOD 가 이어지는 구간을 한 번에 그림
+            uint32_t run_begin = 0;
+            uint32_t run_first_index = 0;
+            uint32_t run_index_count = 0;
+            for ( uint32_t i = 0 ; i < node_count ; ++i ) {
+                uint32_t first_index = primitive->get_first_index();
+                uint32_t index_count = primitive->get_index_count();
+                select_lod(matrices[group.first_instance + i], *primitive, first_index, index_count);
+                if ( i > 0 && first_index != run_first_index ) {
+                    command_buffer->draw_indexed(run_index_count, i - run_begin, run_first_index, vertex_offset, group.first_instance + run_begin);
+                    run_begin = i;
+                }
+                run_first_index = first_index;
+                run_index_count = index_count;
+            }
+            command_buffer->draw_indexed(run_index_count, node_count - run_begin, run_first_index, vertex_offset, group.first_instance + run_begin);
+        }
+    }
+}
+
+uint32_t Model::count_meshlet_draws(const std::shared_ptr<Node>& node) const {
+    if ( !node->get_mesh() ) {
+        return 0;
+    }
+    uint32_t count = 0;
+    for ( const auto& primitive : node->get_mesh()->get_primitives() ) {
+        count += std::max(primitive->get_meshlet_count(), 1u);
+    }
+    for ( const auto& child : node->get_children() ) {
+        count += count_meshlet_draws(child);
+    }
+    return count;
+}
+
+void Model::draw_meshlet_node(
+    std::shared_ptr<ev::CommandBuffer> command_buffer,
+    const std::shared_ptr<Node>& node,
+    uint32_t render_flags,
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+    uint32_t bind_image_set,
+    uint32_t frame_index,
+    VkDrawIndexedIndirectCommand* commands,
+    uint32_t& command_count
+) {
+    if (!node->get_mesh()) {
+        return;
+    }
+
+    // 컬링은 메시 로컬 공간에서 수행
+    const glm::mat4& matrix = node->get_mesh()->get_uniform_data().matrix;
+    const glm::mat4 world = draw_view.model_matrix * matrix;
+    glm::vec4 planes[6];
+    extract_frustum_planes(draw_view.view_projection * world, planes);
+    const glm::vec3 camera = glm::vec3(glm::inverse(world) * glm::vec4(draw_view.camera_position, 1.0f));
+    const bool multi_draw = device->get_features().multiDrawIndirect == VK_TRUE;
+    const std::shared_ptr<ev::Buffer>& indirect_buffer = indirect_frames[frame_index].buffer;
+
+    // 모든 프리미티브가 컬링되면 메시 셋도 바인딩하지 않음
+    bool mesh_bound = false;
+    for ( const std::shared_ptr<Primitive>& primitive : node->get_mesh()->get_primitives() ) {
+        auto material = primitive->get_material();
+        if ( skip_material(*material, render_flags) ) continue;
+
+        const Primitive::Dimensions& dimensions = primitive->get_dimensions();
+        if ( dimensions.radius > 0.0f && outside_frustum(planes, glm::vec4(dimensions.center, dimensions.radius)) ) {
+            continue;
+        }
+
+        uint32_t first_index = primitive->get_first_index();
+        uint32_t index_count = primitive->get_index_count();
+        select_lod(matrix, *primitive, first_index, index_count);
+
+        const uint32_t first_command = command_count;
+        if ( primitive->get_meshlet_count() == 0 || first_index != primitive->get_first_index() ) {
+            // meshlet 은 LOD 0 에만 있으므로 단순화된 LOD 는 통째로 그림
+            commands[command_count++] = { index_count, 1, first_index, static_cast<int32_t>(primitive->get_first_vertex()), 0 };
+        } else {
+            // 양면 머티리얼은 뒷면도 보이므로 cone 컬링하지 않음
+            const bool cone_culling = !material->is_double_sided();
+            for ( uint32_t i = 0 ; i < primitive->get_meshlet_count() ; ++i ) {
+                const MeshletData& meshlet = meshlets[primitive->get_first_meshlet() + i];
+                if ( outside_frustum(planes, meshlet.bounds) ) {
+                    continue;
+                }
+                if ( cone_culling ) {
+                    ev::tools::mesh_optimizer::MeshletBounds bounds;
+                    std::memcpy(&bounds, &meshlet.bounds, sizeof(bounds));
+                    if ( ev::tools::mesh_optimizer::is_cone_backfacing(bounds, glm::value_ptr(camera)) ) {
+                        continue;
+                    }
+                }
+                commands[command_count++] = { meshlet.triangle_count * 3, 1, meshlet.first_index, static_cast<int32_t>(meshlet.first_vertex), 0 };
+            }
+        }
+        const uint32_t draw_count = command_count - first_command;
+        if ( draw_count == 0 ) {
+            continue;
+        }
+
+        if ( !mesh_bound ) {
+            bind_mesh_descriptor_set(command_buffer, *node->get_mesh(), pipeline_layout);
+            mesh_bound = true;
+        }
+        bind_material(command_buffer, *material, render_flags, pipeline_layout, bind_image_set);
+        const VkDeviceSize offset = static_cast<VkDeviceSize>(first_command) * sizeof(VkDrawIndexedIndirectCommand);
+        if ( multi_draw ) {
+            command_buffer->draw_indexed_indirect(indirect_buffer, offset, draw_count);
+        } else {
+            for ( uint32_t i = 0 ; i < draw_count ; ++i ) {
+                command_buffer->draw_indexed_indirect(indirect_buffer, offset + i * sizeof(VkDrawIndexedIndirectCommand), 1);
+            }
+        }
+    }
+
+    for ( const auto& child : node->get_children() ) {
+        draw_meshlet_node(command_buffer, child, render_flags, pipeline_layout, bind_image_set, frame_index, commands, command_count);
+    }
+}
+
+void Model::draw_meshlets(std::shared_ptr<ev::CommandBuffer> command_buffer,
+    uint32_t frame_index,
+    uint32_t render_flags,
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+    uint32_t bind_image_set,
+    uint32_t vertex_pass
+) {
+    uint32_t max_commands = 0;
+    for ( const auto& node : nodes ) {
+        max_commands += count_meshlet_draws(node);
+    }
+    if ( max_commands == 0 ) {
+        return;
+    }
+    // host coherent 메모리이므로 flush 없이 제출 시점에 GPU 에서 보임
+    VkDrawIndexedIndirectCommand* commands = reserve_indirect_commands(frame_index, max_commands);
+
+    bind_buffers(command_buffer, vertex_pass);
+    uint32_t command_count = 0;
+    for ( const auto& node : nodes ) {
+        draw_meshlet_node(command_buffer, node, render_flags, pipeline_layout, bind_image_set, frame_index, commands, command_count);
+    }
+    ev_log_debug("[ev::tools::gltf::Model::draw_meshlets] %u / %u draws after culling.", command_count, max_commands);
+}
+
+void Model::draw_mesh_task_node(
+    std::shared_ptr<ev::CommandBuffer> command_buffer,
+    const std::shared_ptr<Node>& node,
+    uint32_t render_flags,
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+    uint32_t bind_image_set
+) {
+    if (!node->get_mesh()) {
+        return;
+    }
+
+    const glm::mat4 world = draw_view.model_matrix * node->get_mesh()->get_uniform_data().matrix;
+    MeshletPushConstants constants = {};
+    constants.matrix = draw_view.view_projection * world;
+    const glm::vec3 camera = glm::vec3(glm::inverse(world) * glm::vec4(draw_view.camera_position, 1.0f));
+
+    for ( const std::shared_ptr<Primitive>& primitive : node->get_mesh()->get_primitives() ) {
+        auto material = primitive->get_material();
+        if ( skip_material(*material, render_flags) || primitive->get_meshlet_count() == 0 ) continue;
+
+        bind_material(command_buffer, *material, render_flags, pipeline_layout, bind_image_set);
+        constants.camera_position = glm::vec4(camera, material->is_double_sided() ? 0.0f : 1.0f);
+        constants.first_meshlet = primitive->get_first_meshlet();
+        constants.meshlet_count = primitive->get_meshlet_count();
+        command_buffer->bind_push_constants(
+            pipeline_layout,
+            VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_MESH_BIT_EXT,
+            0,
+            &constants,
+            sizeof(constants)
+        );
+        command_buffer->draw_mesh_tasks((constants.meshlet_count + MESHLET_TASK_GROUP_SIZE - 1) / MESHLET_TASK_GROUP_SIZE);
+    }
+
+    for ( const auto& child : node->get_children() ) {
+        draw_mesh_task_node(command_buffer, child, render_flags, pipeline_layout, bind_image_set);
+    }
+}
+
+void Model::draw_mesh_tasks(std::shared_ptr<ev::CommandBuffer> command_buffer,
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+    uint32_t render_flags,
+    uint32_t bind_image_set
+) {
+    if ( !device->is_mesh_shader_enabled() ) {
+        ev_log_error("[ev::tools::gltf::Model::draw_mesh_tasks] VK_EXT_mesh_shader is not enabled on the device.");
+        exit(EXIT_FAILURE);
+    }
+    if ( !meshlet_buffer ) {
+        ev_log_warn("[ev::tools::gltf::Model::draw_mesh_tasks] Model has no meshlet buffers, nothing to draw.");
+        return;
+    }
+    for ( const auto& node : nodes ) {
+        draw_mesh_task_node(command_buffer, node, render_flags, pipeline_layout, bind_image_set);
+    }
+}
+
+const std::shared_ptr<Node> Model::get_node_by_index(uint32_t index) const {
+    for (const auto& node : linear_nodes) {
+        if (node->get_index() == index) {
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+void Model::add_descriptor_set_layout(
+    std::shared_ptr<ev::DescriptorSetLayout> descriptor_set_layout
+) {
+    descriptor_set_layouts.emplace_back(std::move(descriptor_set_layout));
+}
 
-    for ( std::shared_ptr<Primitive> primitive : node->get_mesh()->get_primitives() ) {
-        bool skip = false;
-        auto material = primitive->get_material();
-        if ( render_flags & RenderFlag::OPAQUE ) {
-            skip =  material->get_alpha_mode() != Material::AlphaMode::OPAQUE;
+void Model::build_transform_hierarchy() {
+    // 모델 목록에는 메시 노드만 있으므로 부모를 따라 올라가 루트를 찾은 뒤 전위 순회로 모든 노드를 모음
+    std::vector<std::shared_ptr<Node>> roots;
+    std::unordered_set<const Node*> root_set;
+    auto add_root = [&](std::shared_ptr<Node> node) {
+        if ( !node ) {
+            return;
         }
-        if ( render_flags & RenderFlag::ALPHA_MASK ) {
-            skip = material->get_alpha_mode() != Material::AlphaMode::MASK;
+        for ( auto parent = node->get_parent().lock() ; parent ; parent = parent->get_parent().lock() ) {
+            node = parent;
         }
-        if ( render_flags & RenderFlag::ALPHA_BLEND ) {
-            skip = material->get_alpha_mode() != Material::AlphaMode::BLEND;
+        if ( root_set.insert(node.get()).second ) {
+            roots.push_back(node);
         }
-        if(skip) continue;
+    };
+    for ( const auto& node : nodes ) add_root(node);
+    for ( const auto& node : linear_nodes ) add_root(node);
+    for ( const auto& skin : skins ) {
+        add_root(skin->get_skeleton_root());
+        for ( const auto& joint : skin->get_joints() ) add_root(joint);
+    }
 
-        if ( render_flags & RenderFlag::BIND_IMAGE ) {
-            command_buffer->bind_descriptor_sets(
-                VK_PIPELINE_BIND_POINT_GRAPHICS,
-                pipeline_layout,
-                {material->get_descriptor_set()},
-                bind_image_set,
-                {}
-            );
+    // 같은 자식이 여러 번 연결된 경우가 있으므로 처음 방문한 위치만 사용
+    std::vector<std::shared_ptr<Node>> ordered;
+    std::vector<uint32_t> parents;
+    std::unordered_set<const Node*> visited;
+    std::vector<std::pair<std::shared_ptr<Node>, uint32_t>> stack;
+    for ( auto root = roots.rbegin() ; root != roots.rend() ; ++root ) {
+        stack.emplace_back(*root, ev::tools::TransformHierarchy::NO_PARENT);
+    }
+    while ( !stack.empty() ) {
+        auto [node, parent] = std::move(stack.back());
+        stack.pop_back();
+        if ( !visited.insert(node.get()).second ) {
+            continue;
+        }
+        const uint32_t id = static_cast<uint32_t>(ordered.size());
+        ordered.push_back(node);
+        parents.push_back(parent);
+        const auto& children = node->get_children();
+        for ( auto child = children.rbegin() ; child != children.rend() ; ++child ) {
+            stack.emplace_back(*child, id);
         }
+    }
 
-        command_buffer->draw_indexed(
-            primitive->get_index_count(),
-            1, primitive->get_first_index(),
-            0, 0 // first instance
-        );
+    transform_hierarchy = std::make_shared<ev::tools::TransformHierarchy>(parents);
+    for ( uint32_t i = 0 ; i < ordered.size() ; ++i ) {
+        ordered[i]->attach_transform(transform_hierarchy, i);
     }
+    transform_nodes = std::move(ordered);
+    build_animation_clips();
+    build_instance_groups();
+    update_transforms();
+}
 
-    for ( const auto& node : node->get_children() ) {
-        draw_node(command_buffer, node, render_flags, pipeline_layout, bind_image_set);
+void Model::build_instance_groups() {
+    instance_groups.clear();
+    instance_count = 0;
+    // 메시가 같으면 프리미티브와 머티리얼도 같음. 스킨이 다르면 관절 팔레트가 다르므로 따로 묶음
+    std::unordered_map<const Mesh*, std::vector<uint32_t>> groups_by_mesh;
+    for ( const auto& node : transform_nodes ) {
+        const std::shared_ptr<Mesh>& mesh = node->get_mesh();
+        if ( !mesh ) {
+            continue;
+        }
+        std::vector<uint32_t>& candidates = groups_by_mesh[mesh.get()];
+        InstanceGroup* group = nullptr;
+        for ( uint32_t index : candidates ) {
+            if ( instance_groups[index].skin == node->get_skin() ) {
+                group = &instance_groups[index];
+                break;
+            }
+        }
+        if ( !group ) {
+            candidates.push_back(static_cast<uint32_t>(instance_groups.size()));
+            group = &instance_groups.emplace_back();
+            group->mesh = mesh;
+            group->skin = node->get_skin();
+        }
+        group->nodes.push_back(node);
+    }
+    for ( InstanceGroup& group : instance_groups ) {
+        group.first_instance = instance_count;
+        instance_count += static_cast<uint32_t>(group.nodes.size());
     }
+    ev_log_debug("[ev::tools::gltf::Model::build_instance_groups] %u mesh nodes in %zu instance groups.",
+        instance_count, instance_groups.size());
 }
 
-void Model::draw(std::shared_ptr<ev::CommandBuffer> command_buffer, 
-    uint32_t render_flags, 
-    std::shared_ptr<ev::PipelineLayout> pipeline_layout,
-    uint32_t bind_image_set
-) {
-    bind_buffers(command_buffer);
-    
-    for (const auto& node : nodes) {
-        draw_node(command_buffer, node, render_flags, pipeline_layout, bind_image_set);
+void Model::build_animation_clips() {
+    static_assert(static_cast<uint32_t>(Animation::AnimationSampler::CUBICSPLINE) == ev::tools::AnimationClip::CUBICSPLINE);
+    static_assert(static_cast<uint32_t>(Animation::AnimationChannel::SCALE) == ev::tools::AnimationClip::SCALE);
+    animation_clips.clear();
+    std::unordered_set<const Animation*> visited;
+    for ( const auto& animation : animations ) {
+        if ( !visited.insert(animation.get()).second ) {
+            continue;
+        }
+        auto clip = std::make_shared<ev::tools::AnimationClip>(animation->get_name());
+        const auto& samplers = animation->get_samplers();
+        for ( const auto& channel : animation->get_channels() ) {
+            if ( !channel.target_node || channel.target_node->get_transform_hierarchy() != transform_hierarchy
+                || channel.sampler_index >= samplers.size() ) {
+                continue;
+            }
+            const Animation::AnimationSampler& sampler = samplers[channel.sampler_index];
+            const size_t key_count = sampler.input_times.size();
+            const bool cubic = sampler.method == Animation::AnimationSampler::CUBICSPLINE;
+            if ( key_count == 0 || sampler.outputs.size() < (cubic ? key_count * 3 : key_count) ) {
+                ev_log_warn("[ev::tools::gltf::Model::build_animation_clips] Sampler output count mismatch in %s, channel skipped.",
+                    animation->get_name().c_str());
+                continue;
+            }
+            clip->add_track(channel.target_node->get_transform_index(),
+                static_cast<ev::tools::AnimationClip::Path>(channel.path_type),
+                static_cast<ev::tools::AnimationClip::Interpolation>(sampler.method),
+                sampler.input_times.data(),
+                static_cast<uint32_t>(key_count),
+                glm::value_ptr(sampler.outputs.front())
+            );
+        }
+        animation_clips.push_back(std::move(clip));
     }
 }
 
-const std::shared_ptr<Node> Model::get_node_by_index(uint32_t index) const {
-    for (const auto& node : nodes) {
-        if (node->get_index() == index) {
-            return node;
+std::shared_ptr<ev::tools::AnimationClip> Model::get_animation_clip(const std::string& name) const {
+    for ( const auto& clip : animation_clips ) {
+        if ( clip->get_name() == name ) {
+            return clip;
         }
     }
     return nullptr;
 }
 
-void Model::add_descriptor_set_layout(
-    std::shared_ptr<ev::DescriptorSetLayout> descriptor_set_layout
-) {
-    descriptor_set_layouts.emplace_back(std::move(descriptor_set_layout));
+uint32_t Model::update_transforms(bool parallel) {
+    if ( !transform_hierarchy || !transform_hierarchy->is_dirty() ) {
+        return 0;
+    }
+    const uint32_t updated_count = transform_hierarchy->update(parallel);
+    for ( const auto& node : transform_nodes ) {
+        if ( node->get_mesh() ) {
+            node->get_mesh()->get_uniform_data().matrix = node->get_world_matrix();
+        }
+    }
+    upload_mesh_uniforms();
+    return updated_count;
+}
+
+void Model::upload_mesh_uniforms() {
+    // 여러 노드가 같은 메시를 공유하면 마지막 노드의 행렬이 기록됨
+    std::unordered_set<const Mesh*> uploaded;
+    for ( const auto& node : transform_nodes.empty() ? linear_nodes : transform_nodes ) {
+        const std::shared_ptr<Mesh>& mesh = node->get_mesh();
+        if ( mesh && uploaded.insert(mesh.get()).second ) {
+            mesh->upload_uniform();
+        }
+    }
 }
 
 
@@ -230,46 +1239,678 @@ GLTFModelManager::GLTFModelManager(
     }
 }
 
+GLTFModelManager::~GLTFModelManager() {
+    {
+        std::lock_guard<std::mutex> lock(loader_mutex);
+        loader_stopping = true;
+    }
+    loader_condition.notify_all();
+    if ( loader_thread.joinable() ) {
+        loader_thread.join();
+    }
+    for ( LoadRequest& request : load_requests ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager] Pending model load cancelled: %s", request.file_path.c_str());
+        request.promise.set_value(nullptr);
+    }
+    for ( AsyncLoad& load : decoded_loads ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager] Pending model load cancelled: %s", load.decoded->file_path.c_str());
+        load.promise.set_value(nullptr);
+    }
+    // 제출한 업로드는 GPU 가 스테이징 메모리를 다 읽은 뒤에 버림
+    for ( AsyncLoad& load : uploading_loads ) {
+        if ( load.upload.fence ) {
+            load.upload.fence->wait(UINT64_MAX);
+        }
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager] Pending model load cancelled: %s", load.decoded->file_path.c_str());
+        load.promise.set_value(nullptr);
+    }
+}
+
+std::shared_future<std::shared_ptr<Model>> GLTFModelManager::load_model_async(const std::string& file_path) {
+    LoadRequest request;
+    request.file_path = file_path;
+    request.settings = load_settings;
+    std::shared_future<std::shared_ptr<Model>> future = request.promise.get_future().share();
+    {
+        std::lock_guard<std::mutex> lock(loader_mutex);
+        load_requests.push_back(std::move(request));
+        if ( !loader_thread.joinable() ) {
+            loader_thread = std::thread(&GLTFModelManager::run_loader, this);
+        }
+    }
+    loader_condition.notify_one();
+    ev_log_debug("[ev::tools::gltf::GLTFModelManager::load_model_async] Queued model load: %s", file_path.c_str());
+    return future;
+}
+
+void GLTFModelManager::run_loader() {
+    // 공용 풀은 렌더 스레드의 parallel_for 가 사용하도록 비워 둠
+    ev::tools::WorkerPool pool(ev::tools::get_worker_count() - 1);
+    while ( true ) {
+        LoadRequest request;
+        {
+            std::unique_lock<std::mutex> lock(loader_mutex);
+            loader_condition.wait(lock, [&]() { return loader_stopping || !load_requests.empty(); });
+            if ( loader_stopping ) {
+                return;
+            }
+            request = std::move(load_requests.front());
+            load_requests.pop_front();
+        }
+        // CPU 단계만 수행하고 GPU 리소스는 소유 스레드의 update_async_loads 에서 만듦
+        AsyncLoad load;
+        load.decoded = std::make_unique<DecodedModel>();
+        if ( !decode_model(request.file_path, request.settings, pool, *load.decoded) ) {
+            recycle_staging(*load.decoded);
+            ev_log_error("[ev::tools::gltf::GLTFModelManager::run_loader] Failed to decode model: %s", request.file_path.c_str());
+            request.promise.set_value(nullptr);
+            continue;
+        }
+        load.promise = std::move(request.promise);
+        std::lock_guard<std::mutex> lock(loader_mutex);
+        decoded_loads.push_back(std::move(load));
+    }
+}
+
+uint32_t GLTFModelManager::update_async_loads() {
+    std::deque<AsyncLoad> decoded;
+    {
+        std::lock_guard<std::mutex> lock(loader_mutex);
+        decoded.swap(decoded_loads);
+    }
+
+    std::lock_guard<std::mutex> lock(load_mutex);
+    uint32_t completed_count = 0;
+    for ( AsyncLoad& load : decoded ) {
+        if ( upload_model(*load.decoded, load.upload) ) {
+            uploading_loads.push_back(std::move(load));
+            continue;
+        }
+        recycle_staging(*load.decoded);
+        ev_log_error("[ev::tools::gltf::GLTFModelManager::update_async_loads] Failed to upload model: %s", load.decoded->file_path.c_str());
+        load.promise.set_value(nullptr);
+        ++completed_count;
+    }
+
+    // fence 는 기다리지 않고 상태만 확인
+    for ( auto it = uploading_loads.begin() ; it != uploading_loads.end() ; ) {
+        const VkResult status = it->upload.fence->get_status();
+        if ( status == VK_NOT_READY ) {
+            ++it;
+            continue;
+        }
+        std::shared_ptr<Model> model = nullptr;
+        if ( status == VK_SUCCESS ) {
+            model = finish_upload(*it->decoded, it->upload);
+        } else {
+            ev_log_error("[ev::tools::gltf::GLTFModelManager::update_async_loads] Model upload failed (%d): %s", status, it->decoded->file_path.c_str());
+        }
+        it->promise.set_value(model);
+        ++completed_count;
+        it = uploading_loads.erase(it);
+    }
+    return completed_count;
+}
+
+bool GLTFModelManager::open_glb(const std::string& file_path, GLBSource& source) const {
+    // BIN 청크 대신 tinygltf 에 넘기는 1 바이트 버퍼
+    static const char* PLACEHOLDER_URI = "data:application/octet-stream;base64,AA==";
+
+    source.file = std::make_unique<ev::tools::MappedFile>(file_path);
+    ev::tools::glb::Container container;
+    if ( !source.file->is_open() || !ev::tools::glb::parse(source.file->get_data(), source.file->get_size(), container) ) {
+        return false;
+    }
+
+    nlohmann::json document = nlohmann::json::parse(container.json.begin(), container.json.end(), nullptr, false);
+    if ( document.is_discarded() || !document.is_object() ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager::open_glb] Invalid JSON chunk: %s", file_path.c_str());
+        return false;
+    }
+    auto get_size = [](const nlohmann::json& object, const char* key) -> size_t {
+        auto it = object.find(key);
+        return it != object.end() && it->is_number_unsigned() ? it->get<size_t>() : 0;
+    };
+
+    // uri 가 없는 버퍼는 BIN 청크
+    auto buffers = document.find("buffers");
+    if ( buffers != document.end() && buffers->is_array() ) {
+        source.buffers.resize(buffers->size());
+        for ( size_t i = 0 ; i < buffers->size() ; ++i ) {
+            nlohmann::json& buffer = (*buffers)[i];
+            if ( !buffer.is_object() || buffer.contains("uri") ) {
+                continue;
+            }
+            const size_t byte_length = get_size(buffer, "byteLength");
+            if ( container.bin == nullptr || byte_length == 0 || byte_length > container.bin_size ) {
+                ev_log_error("[ev::tools::gltf::GLTFModelManager::open_glb] Buffer %zu does not fit in the BIN chunk: %s", i, file_path.c_str());
+                return false;
+            }
+            source.buffers[i] = std::span<const uint8_t>(container.bin, byte_length);
+            buffer["uri"] = PLACEHOLDER_URI;
+            buffer["byteLength"] = 1;
+        }
+    }
+
+    // BIN 청크에 든 이미지는 이미지 로더가 매핑된 바이트로 디코딩
+    auto images = document.find("images");
+    auto views = document.find("bufferViews");
+    if ( images != document.end() && images->is_array() && views != document.end() && views->is_array() ) {
+        source.images.resize(images->size());
+        for ( size_t i = 0 ; i < images->size() ; ++i ) {
+            nlohmann::json& image = (*images)[i];
+            auto view_it = image.is_object() ? image.find("bufferView") : image.end();
+            if ( !image.is_object() || view_it == image.end() || !view_it->is_number_unsigned() || view_it->get<size_t>() >= views->size() ) {
+                continue;
+            }
+            const size_t view_index = view_it->get<size_t>();
+            const nlohmann::json& view = (*views)[view_index];
+            auto buffer_it = view.is_object() ? view.find("buffer") : view.end();
+            if ( !view.is_object() || buffer_it == view.end() || !buffer_it->is_number_unsigned()
+                || buffer_it->get<size_t>() >= source.buffers.size() || source.buffers[buffer_it->get<size_t>()].empty() ) {
+                continue;
+            }
+            const std::span<const uint8_t> buffer = source.buffers[buffer_it->get<size_t>()];
+            const size_t offset = get_size(view, "byteOffset");
+            const size_t length = get_size(view, "byteLength");
+            if ( offset > buffer.size() || length > buffer.size() - offset ) {
+                ev_log_error("[ev::tools::gltf::GLTFModelManager::open_glb] Image %zu is out of buffer range: %s", i, file_path.c_str());
+                return false;
+            }
+            source.images[i].data = buffer.subspan(offset, length);
+            source.images[i].mime_type = image.value("mimeType", std::string());
+            source.images[i].buffer_view = static_cast<int>(view_index);
+            image.erase("bufferView");
+            image["uri"] = PLACEHOLDER_URI;
+        }
+    }
+
+    source.json = document.dump();
+    ev_log_info("[ev::tools::gltf::GLTFModelManager::open_glb] Mapped glb file (%zu bytes JSON, %zu bytes BIN): %s",
+        container.json.size(), container.bin_size, file_path.c_str());
+    return true;
+}
+
 std::shared_ptr<ev::tools::gltf::Model> GLTFModelManager::load_model(const std::string file_path) {
+    std::shared_ptr<Model> model = try_load_model(file_path);
+    if ( !model ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager] Failed to load model: %s", file_path.c_str());
+        exit(EXIT_FAILURE);
+    }
+    return model;
+}
+
+std::shared_ptr<Model> GLTFModelManager::try_load_model(const std::string& file_path) {
+    DecodedModel decoded;
+    if ( !decode_model(file_path, load_settings, ev::tools::WorkerPool::get_default(), decoded) ) {
+        recycle_staging(decoded);
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(load_mutex);
+    PendingUpload upload;
+    if ( !upload_model(decoded, upload) ) {
+        recycle_staging(decoded);
+        return nullptr;
+    }
+    if ( upload.fence->wait(UINT64_MAX) != VK_SUCCESS ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager] Failed to wait for model upload: %s", file_path.c_str());
+        return nullptr;
+    }
+    return finish_upload(decoded, upload);
+}
+
+bool GLTFModelManager::decode_model(
+    const std::string& file_path,
+    const LoadSettings& settings,
+    ev::tools::WorkerPool& pool,
+    DecodedModel& decoded
+) {
+    decoded.file_path = file_path;
+    decoded.settings = settings;
+    const std::filesystem::path source_path(file_path);
+    if ( source_path.extension() == ".evmc" ) {
+        return decode_cached_model(source_path, std::nullopt, decoded);
+    }
 
-    tinygltf::Model gltf_model;
+    if ( !settings.cache_directory.empty() && ev::tools::hash_file(source_path, decoded.source_hash) ) {
+        char hash_string[17];
+        std::snprintf(hash_string, sizeof(hash_string), "%016llx", static_cast<unsigned long long>(decoded.source_hash));
+        decoded.cache_path = settings.cache_directory / (source_path.stem().string() + "-" + hash_string + ".evmc");
+        if ( std::filesystem::exists(decoded.cache_path) ) {
+            // 캐시 복원이 실패해도 decoded 가 그대로 남도록 따로 채운 뒤 옮김
+            DecodedModel cached;
+            cached.file_path = file_path;
+            cached.settings = settings;
+            if ( decode_cached_model(decoded.cache_path, decoded.source_hash, cached) ) {
+                decoded = std::move(cached);
+                return true;
+            }
+            recycle_staging(cached);
+            ev_log_warn("[ev::tools::gltf::GLTFModelManager] Model cache is stale or invalid, rebuilding: %s", decoded.cache_path.string().c_str());
+        }
+    }
+
+    tinygltf::Model& gltf_model = decoded.gltf_model;
     tinygltf::TinyGLTF ctx;
 
-    bool file_loaded = ctx.LoadASCIIFromFile(&gltf_model, nullptr, nullptr, file_path);
+    // .glb 는 매핑해서 JSON 청크만 tinygltf 로 파싱
+    GLBSource& glb = decoded.glb;
+    const bool is_glb = source_path.extension() == ".glb";
+    if ( is_glb && !open_glb(file_path, glb) ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager] Failed to open glb file: %s", file_path.c_str());
+        return false;
+    }
+
+    CachedImages& cached_images = decoded.cached_images;
+    const std::filesystem::path& cache_path = decoded.cache_path;
+    // tinygltf::LoadImageData 는 image.image 로 복사하므로 사용하지 않고, stb 결과를 스테이징 메모리에 바로 기록
+    ctx.SetImageLoader([&](tinygltf::Image* image, const int image_idx, std::string* err, std::string*,
+        int, int, const unsigned char* bytes, int size, void*) {
+        const size_t index = static_cast<size_t>(image_idx);
+        if ( index < glb.images.size() && glb.images[index].buffer_view >= 0 ) {
+            // 자리표시자 대신 매핑된 BIN 청크의 이미지 바이트를 사용
+            bytes = glb.images[index].data.data();
+            size = static_cast<int>(glb.images[index].data.size());
+        }
+        if ( !cache_path.empty() && image->uri.empty() ) {
+            // 원본 파일이 없는 이미지(.glb, data URI)는 모델 캐시에 인코딩된 바이트를 함께 기록
+            if ( index >= cached_images.embedded.size() ) {
+                cached_images.embedded.resize(index + 1);
+            }
+            cached_images.embedded[index].assign(bytes, bytes + size);
+        }
+        if ( settings.texture_cache ) {
+            // 원본 바이트 해시로 캐시를 먼저 확인하고 이미 있는 이미지는 디코딩하지 않음
+            if ( index >= cached_images.keys.size() ) {
+                cached_images.keys.resize(index + 1);
+                cached_images.hashed.resize(index + 1, false);
+                cached_images.hits.resize(index + 1);
+            }
+            cached_images.keys[index] = make_texture_key(settings, bytes, static_cast<size_t>(size));
+            cached_images.hashed[index] = true;
+            cached_images.hits[index] = settings.texture_cache->find(cached_images.keys[index]);
+            if ( cached_images.hits[index] ) {
+                return true;
+            }
+        }
+        if ( index >= decoded.images.size() ) {
+            decoded.images.resize(index + 1);
+        }
+        if ( !decode_image(settings, bytes, static_cast<size_t>(size), *image, decoded.images[index], decoded.image_staging) ) {
+            if ( err ) {
+                *err += "Failed to decode image " + std::to_string(image_idx) + ": " + image->uri + "\n";
+            }
+            return false;
+        }
+        return true;
+    }, nullptr);
+
+    decoded.resource_path = source_path.parent_path();
+    ev_log_info("[ev::tools::gltf::GLTFModelManager] Resource path set to: %s", decoded.resource_path.string().c_str());
 
-    resource_path = std::filesystem::path(file_path).parent_path();
-    ev_log_info("[ev::tools::gltf::GLTFModelManager] Resource path set to: %s", resource_path.string().c_str());
+    std::string load_error;
+    bool file_loaded = false;
+    if ( is_glb ) {
+        file_loaded = ctx.LoadASCIIFromString(&gltf_model, &load_error, nullptr,
+            glb.json.c_str(), static_cast<unsigned int>(glb.json.size()), decoded.resource_path.string());
+    } else {
+        file_loaded = ctx.LoadASCIIFromFile(&gltf_model, &load_error, nullptr, file_path);
+    }
 
     if (!file_loaded) {
-        ev_log_error("[ev::tools::gltf::GLTFModelManager] Failed to load glTF model from file: %s", file_path.c_str());
-        exit(EXIT_FAILURE);
+        ev_log_error("[ev::tools::gltf::GLTFModelManager] Failed to load glTF model from file: %s (%s)", file_path.c_str(), load_error.c_str());
+        return false;
+    }
+
+    // tinygltf 가 자리표시자로 다시 읽지 않도록 이미지의 bufferView 는 파싱 후에 복원
+    for ( size_t i = 0 ; i < glb.images.size() && i < gltf_model.images.size() ; ++i ) {
+        if ( glb.images[i].buffer_view >= 0 ) {
+            gltf_model.images[i].bufferView = glb.images[i].buffer_view;
+            gltf_model.images[i].mimeType = glb.images[i].mime_type;
+        }
     }
     ev_log_info("[ev::tools::gltf::GLTFModelManager] Successfully loaded glTF model from file: %s", file_path.c_str());
 
     std::shared_ptr<ev::tools::gltf::Model> model = std::make_shared<ev::tools::gltf::Model>(
         device
     );
+    decoded.model = model;
+    load_materials(gltf_model, model);
 
-    std::vector<ev::tools::gltf::Vertex> h_vertices;
-    std::vector<uint32_t> h_indices;
+    decoded.images.resize(gltf_model.images.size());
 
-    load_textures(gltf_model, model);
-    load_materials(gltf_model, model);
-    load_nodes(gltf_model, model, h_vertices, h_indices);
-    load_animations(gltf_model, model);
-    load_skins(gltf_model, model);
-    
-    // TODO: Linear node update
+    {
+        // buffer_data 는 관리자 멤버이므로 동시에 하나의 디코딩만 사용
+        std::lock_guard<std::mutex> lock(decode_mutex);
+        buffer_data.assign(gltf_model.buffers.size(), {});
+        for ( size_t i = 0 ; i < gltf_model.buffers.size() ; ++i ) {
+            const bool mapped = i < glb.buffers.size() && !glb.buffers[i].empty();
+            buffer_data[i] = mapped ? glb.buffers[i] : std::span<const uint8_t>(gltf_model.buffers[i].data);
+        }
+
+        // 1 단계: 노드 계층을 만들면서 프리미티브별 정점/인덱스 출력 위치를 prefix sum 으로 결정
+        GeometryStream geometry;
+        load_nodes(gltf_model, model, geometry);
+        load_animations(gltf_model, model);
+        load_skins(gltf_model, model);
+
+        model->build_transform_hierarchy();
+
+        // 최적화 전 크기 (16bit 인덱스 전환 포함 절감량 보고용)
+        const VkDeviceSize source_bytes = settings.vertex_layout.get_buffer_size(geometry.vertex_count)
+            + static_cast<VkDeviceSize>(geometry.index_count) * sizeof(uint32_t);
+        const uint32_t source_vertex_count = geometry.vertex_count;
+        optimize_geometry(settings, pool, gltf_model, geometry);
+
+        const VkDeviceSize index_size = geometry.index_type == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t);
+        if ( settings.mesh_optimize_flags != MeshOptimizeFlags::OptimizeNone ) {
+            const VkDeviceSize optimized_bytes = settings.vertex_layout.get_buffer_size(geometry.vertex_count)
+                + static_cast<VkDeviceSize>(geometry.index_count) * index_size;
+            ev_log_info("[ev::tools::gltf::GLTFModelManager] Mesh optimization: %u -> %u vertices, %s indices, %lld bytes saved.",
+                source_vertex_count, geometry.vertex_count,
+                index_size == sizeof(uint16_t) ? "16bit" : "32bit",
+                static_cast<long long>(source_bytes) - static_cast<long long>(optimized_bytes));
+        }
+        generate_lods(settings, pool, gltf_model, geometry);
+        generate_meshlets(settings, pool, gltf_model, geometry, model);
+
+        // 2 단계: 정점/인덱스, meshlet 을 담을 스테이징 메모리를 한 번에 확보하고 프리미티브 단위로 병렬 변환
+        model->set_vertex_layout(settings.vertex_layout);
+        model->set_index_type(geometry.index_type);
+        const VkDeviceSize vertex_bytes = settings.vertex_layout.get_buffer_size(geometry.vertex_count);
+        const VkDeviceSize index_bytes = static_cast<VkDeviceSize>(geometry.index_count) * index_size;
+        decoded.staging = acquire_staging(vertex_bytes + index_bytes + 32 + get_meshlet_staging_size(*model));
+        if ( !decoded.staging ) {
+            buffer_data.clear();
+            return false;
+        }
+        decoded.vertices = decoded.staging->allocate(vertex_bytes);
+        decoded.indices = decoded.staging->allocate(index_bytes);
+        std::vector<VkDeviceSize> stream_offsets;
+        for ( uint32_t stream = 0 ; stream < settings.vertex_layout.get_stream_count() ; ++stream ) {
+            stream_offsets.push_back(settings.vertex_layout.get_stream_offset(stream, geometry.vertex_count));
+        }
+        model->set_vertex_stream_offsets(stream_offsets);
+        model->set_vertex_count(geometry.vertex_count);
+        convert_geometry(
+            settings,
+            pool,
+            gltf_model,
+            geometry,
+            static_cast<uint8_t*>(decoded.vertices.data),
+            decoded.indices.data
+        );
+        // 이후 단계는 glTF 버퍼를 읽지 않음. 매핑은 DecodedModel 이 해제될 때 해제
+        buffer_data.clear();
+    }
+    return true;
+}
+
+bool GLTFModelManager::upload_model(DecodedModel& decoded, PendingUpload& upload) {
+    // 모델 캐시 경로도 포함해 텍스처, 정점/인덱스, meshlet 복사를 하나의 커맨드 버퍼에 기록해 한 번만 제출
+    std::shared_ptr<Model> model = decoded.model;
+    upload.command_buffer = command_pool->allocate();
+    upload.command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+    if ( !load_textures(decoded, upload, decoded.texture_images) ) {
+        return false;
+    }
+    if ( decoded.cached_model_path.empty() ) {
+        bind_material_textures(decoded.gltf_model, model);
+    } else {
+        bind_cached_material_textures(decoded);
+    }
+    if ( !setup_geometry_buffers(decoded.settings, model, decoded.staging, decoded.vertices, decoded.indices, upload.command_buffer)
+        || !setup_meshlet_buffers(model, decoded.staging, upload.command_buffer) ) {
+        return false;
+    }
+    if ( upload.command_buffer->end() != VK_SUCCESS ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager::upload_model] Failed to record upload commands: %s", decoded.file_path.c_str());
+        return false;
+    }
 
-    setup_vertex_buffer(model, h_vertices);
-    setup_index_buffer(model, h_indices);
+    upload.fence = std::make_shared<ev::Fence>(device, 0);
+    if ( transfer_queue->submit(upload.command_buffer, {}, {}, nullptr, upload.fence) != VK_SUCCESS ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager::upload_model] Failed to submit upload commands: %s", decoded.file_path.c_str());
+        upload.fence.reset();
+        return false;
+    }
+    return true;
+}
+
+std::shared_ptr<Model> GLTFModelManager::finish_upload(DecodedModel& decoded, PendingUpload& upload) {
+    std::shared_ptr<Model> model = decoded.model;
+    // 복사가 끝난 텍스처만 다른 모델과 공유
+    for ( const auto& [key, texture] : upload.new_textures ) {
+        decoded.settings.texture_cache->insert(key, texture, static_cast<uint64_t>(texture->image->get_memory_requirements().size));
+    }
 
-    prepare_material_descriptor_sets(model);
-    prepare_node_descriptor_sets(model);
+    if ( !prepare_material_descriptor_sets(model) || !prepare_node_descriptor_sets(model) ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager::finish_upload] Failed to prepare descriptor sets: %s", decoded.file_path.c_str());
+        model = nullptr;
+    } else if ( !decoded.cache_path.empty() ) {
+        // 스테이징 메모리의 변환 결과를 그대로 캐시에 기록
+        const tinygltf::Model& gltf_model = decoded.gltf_model;
+        std::vector<std::string> dependencies;
+        for ( const tinygltf::Buffer& buffer : gltf_model.buffers ) {
+            if ( !buffer.uri.empty() && buffer.uri.rfind("data:", 0) != 0 ) {
+                dependencies.push_back((decoded.resource_path / buffer.uri).string());
+            }
+        }
+        for ( const tinygltf::Image& image : gltf_model.images ) {
+            if ( !image.uri.empty() && image.uri.rfind("data:", 0) != 0 ) {
+                dependencies.push_back((decoded.resource_path / image.uri).string());
+            }
+        }
+        const std::vector<uint32_t>& texture_images = decoded.texture_images;
+        std::vector<std::span<const uint8_t>> embedded_images(texture_images.size());
+        for ( size_t i = 0 ; i < texture_images.size() ; ++i ) {
+            if ( texture_images[i] < decoded.cached_images.embedded.size() ) {
+                embedded_images[i] = decoded.cached_images.embedded[texture_images[i]];
+            }
+        }
+        write_model_cache(model, decoded.cache_path, decoded.source_hash, dependencies, embedded_images,
+            decoded.vertices.data, decoded.vertices.size, decoded.indices.data, decoded.indices.size);
+    }
 
+    upload = PendingUpload();
+    recycle_staging(decoded);
     return model;
 }
 
+std::shared_ptr<ev::tools::StagingBuffer> GLTFModelManager::acquire_staging(VkDeviceSize capacity) {
+    std::shared_ptr<ev::tools::StagingBuffer> staging;
+    {
+        // spare_staging 은 큰 순서이므로 뒤에서부터 담을 수 있는 첫 버퍼가 가장 작음. 없으면 가장 큰 버퍼를 늘림
+        std::lock_guard<std::mutex> lock(staging_mutex);
+        if ( !spare_staging.empty() ) {
+            auto it = std::find_if(spare_staging.rbegin(), spare_staging.rend(), [&](const auto& spare) {
+                return spare->get_capacity() >= capacity;
+            });
+            auto selected = it != spare_staging.rend() ? std::prev(it.base()) : spare_staging.begin();
+            staging = std::move(*selected);
+            spare_staging.erase(selected);
+        }
+    }
+    if ( !staging ) {
+        // 생성자는 실패하면 종료하므로 최소 크기로 만든 뒤 reserve 로 확보
+        staging = std::make_shared<ev::tools::StagingBuffer>(device, 4);
+    }
+    staging->reset();
+    if ( staging->reserve(capacity) != VK_SUCCESS ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager::acquire_staging] Failed to reserve staging memory (%llu bytes).", static_cast<unsigned long long>(capacity));
+        return nullptr;
+    }
+    return staging;
+}
+
+void GLTFModelManager::recycle_staging(std::shared_ptr<ev::tools::StagingBuffer> staging) {
+    if ( !staging ) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(staging_mutex);
+    auto it = std::find_if(spare_staging.begin(), spare_staging.end(), [&](const auto& spare) {
+        return spare->get_capacity() < staging->get_capacity();
+    });
+    spare_staging.insert(it, std::move(staging));
+    if ( spare_staging.size() > MAX_SPARE_STAGING ) {
+        spare_staging.pop_back();
+    }
+}
+
+void GLTFModelManager::recycle_staging(DecodedModel& decoded) {
+    recycle_staging(std::move(decoded.staging));
+    for ( std::shared_ptr<ev::tools::StagingBuffer>& staging : decoded.image_staging ) {
+        recycle_staging(std::move(staging));
+    }
+    decoded.image_staging.clear();
+    decoded.images.clear();
+}
+
+bool GLTFModelManager::allocate_image_staging(
+    std::vector<std::shared_ptr<ev::tools::StagingBuffer>>& image_staging,
+    VkDeviceSize size,
+    StagedImage& staged
+) {
+    // 정렬 여유를 두고 남은 공간을 확인해 가득 찬 버퍼에서 할당 실패 로그가 남지 않게 함
+    const VkDeviceSize required = size + 16;
+    if ( image_staging.empty() || image_staging.back()->get_capacity() - image_staging.back()->get_used_size() < required ) {
+        std::shared_ptr<ev::tools::StagingBuffer> staging = acquire_staging(std::max(required, IMAGE_STAGING_SIZE));
+        if ( !staging ) {
+            return false;
+        }
+        image_staging.push_back(std::move(staging));
+    }
+    staged.staging = image_staging.back();
+    staged.pixels = staged.staging->allocate(size);
+    return static_cast<bool>(staged.pixels);
+}
+
+bool GLTFModelManager::decode_image(
+    const LoadSettings& settings,
+    const uint8_t* bytes,
+    size_t size,
+    tinygltf::Image& image,
+    StagedImage& staged,
+    std::vector<std::shared_ptr<ev::tools::StagingBuffer>>& image_staging
+) {
+    const int length = static_cast<int>(size);
+    int width = 0, height = 0, channels = 0;
+    if ( !stbi_info_from_memory(bytes, length, &width, &height, &channels) || width <= 0 || height <= 0 ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager::decode_image] Unsupported image: %s", stbi_failure_reason());
+        return false;
+    }
+    const bool is_16_bit = stbi_is_16_bit_from_memory(bytes, length) != 0;
+    image.width = width;
+    image.height = height;
+    image.image.clear();
+
+    if ( settings.pixel_unpacker && (channels != 4 || is_16_bit) ) {
+        // GPU 확장 경로는 원본 채널과 비트 깊이를 유지하고 stb 결과를 그대로 넘김
+        void* pixels = is_16_bit
+            ? static_cast<void*>(stbi_load_16_from_memory(bytes, length, &width, &height, &channels, 0))
+            : static_cast<void*>(stbi_load_from_memory(bytes, length, &width, &height, &channels, 0));
+        if ( !pixels ) {
+            ev_log_warn("[ev::tools::gltf::GLTFModelManager::decode_image] Failed to decode image: %s", stbi_failure_reason());
+            return false;
+        }
+        image.component = channels;
+        image.bits = is_16_bit ? 16 : 8;
+        image.pixel_type = is_16_bit ? TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT : TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE;
+        staged.packed = std::shared_ptr<void>(pixels, stbi_image_free);
+        return true;
+    }
+
+    // RGB 는 stb 가 패딩하지 않게 3 채널로 받아 스테이징에 기록하면서 확장
+    const int desired_channels = channels == 3 ? 3 : 4;
+    stbi_uc* pixels = stbi_load_from_memory(bytes, length, &width, &height, &channels, desired_channels);
+    if ( !pixels ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager::decode_image] Failed to decode image: %s", stbi_failure_reason());
+        return false;
+    }
+    const size_t pixel_count = static_cast<size_t>(width) * height;
+    if ( !allocate_image_staging(image_staging, static_cast<VkDeviceSize>(pixel_count) * 4, staged) ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager::decode_image] Failed to allocate staging memory for image (%dx%d).", width, height);
+        stbi_image_free(pixels);
+        return false;
+    }
+    uint8_t* dst = static_cast<uint8_t*>(staged.pixels.data);
+    if ( desired_channels == 3 ) {
+        ev::tools::pixel::rgb8_to_rgba8(pixels, dst, pixel_count);
+    } else {
+        memcpy(dst, pixels, pixel_count * 4);
+        if ( settings.premultiply_alpha && (channels == 2 || channels == 4) ) {
+            ev::tools::pixel::premultiply_rgba8(dst, pixel_count);
+        }
+    }
+    stbi_image_free(pixels);
+    image.component = 4;
+    image.bits = 8;
+    image.pixel_type = TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE;
+    return true;
+}
+
+void GLTFModelManager::set_model_asset_cache(std::shared_ptr<ModelAssetCache> cache) {
+    model_asset_cache = std::move(cache);
+    connect_model_eviction();
+}
+
+void GLTFModelManager::set_bindless_materials(std::shared_ptr<BindlessMaterials> materials) {
+    bindless_materials = std::move(materials);
+    connect_model_eviction();
+}
+
+void GLTFModelManager::connect_model_eviction() {
+    if ( !model_asset_cache || !bindless_materials ) {
+        return;
+    }
+    // 캐시가 관리자보다 오래 남을 수 있으므로 약한 참조로 연결
+    std::weak_ptr<BindlessMaterials> materials = bindless_materials;
+    model_asset_cache->set_evict_callback([materials](const std::shared_ptr<Model>& model) {
+        if ( std::shared_ptr<BindlessMaterials> owner = materials.lock() ) {
+            owner->remove_model(model);
+        }
+    });
+}
+
+void GLTFModelManager::set_geometry_heap(std::shared_ptr<GeometryHeap> heap) {
+    load_settings.geometry_heap = std::move(heap);
+    if ( load_settings.geometry_heap ) {
+        load_settings.vertex_layout = load_settings.geometry_heap->get_vertex_layout();
+    }
+}
+
+bool GLTFModelManager::make_model_key(const std::string& file_path, ev::tools::ResourceKey& key) const {
+    // load_model 결과를 바꾸는 설정. 지오메트리 힙은 버퍼가 힙에 속하므로 힙마다 다른 항목
+    uint32_t reduction_bits = 0;
+    std::memcpy(&reduction_bits, &load_settings.lod_reduction, sizeof(reduction_bits));
+    const uint64_t heap = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(load_settings.geometry_heap.get()));
+    const uint32_t params[] = {
+        load_settings.vertex_layout.get_key(),
+        load_settings.mesh_optimize_flags,
+        load_settings.lod_levels,
+        reduction_bits,
+        load_settings.meshlets_enabled ? 1u : 0u,
+        load_settings.pixel_unpacker != nullptr ? 1u : 0u,
+        load_settings.premultiply_alpha ? 1u : 0u,
+        static_cast<uint32_t>(heap),
+        static_cast<uint32_t>(heap >> 32)
+    };
+    return ev::tools::gltf::make_model_key(file_path, params, sizeof(params), key);
+}
+
+std::shared_ptr<ModelInstance> GLTFModelManager::load_model_instance(const std::string& file_path) {
+    ev::tools::ResourceKey key;
+    if ( !model_asset_cache || !make_model_key(file_path, key) ) {
+        return std::make_shared<ModelInstance>(device, load_model(file_path));
+    }
+    std::shared_ptr<Model> model = model_asset_cache->acquire(key, [&]() {
+        std::shared_ptr<Model> loaded = load_model(file_path);
+        return std::make_pair(loaded, loaded->get_resource_bytes());
+    });
+    return std::make_shared<ModelInstance>(device, std::move(model));
+}
+
 void GLTFModelManager::load_animations(
     tinygltf::Model& gltf_model, 
     std::shared_ptr<ev::tools::gltf::Model> model
@@ -296,18 +1937,14 @@ void GLTFModelManager::load_animations(
             }  
             // Input time values 
             {
-                const auto& accessor = gltf_model.accessors[samp.input];
-                const auto& buffer_view = gltf_model.bufferViews[accessor.bufferView];
-                const auto& buffer = gltf_model.buffers[buffer_view.buffer];
-
-                assert(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
-
-                std::vector<float> buf(accessor.count);
-                memcpy(buf.data(), buffer.data.data() + accessor.byteOffset + buffer_view.byteOffset, accessor.count * sizeof(float));
-                for ( size_t index = 0 ; index < accessor.count ; ++index ) {
-                    sampler.input_times.push_back(buf[index]);
+                ev::tools::accessor::View view;
+                // 채널이 sampler 번호로 참조하므로 읽지 못한 sampler 도 빈 채로 추가
+                if ( make_accessor_view(gltf_model, buffer_data, samp.input, view) && view.components == 1 ) {
+                    sampler.input_times.resize(view.count);
+                    ev::tools::accessor::read_floats(view, sampler.input_times.data(), sizeof(float), 1);
+                } else {
+                    ev_log_error("[ev::tools::gltf::GLTFModelManager::load_animations] Invalid sampler input accessor: %d", samp.input);
                 }
-                buf.clear();
 
                 for ( auto input : sampler.input_times ) {
                     animation->set_start_time(input);
@@ -315,68 +1952,57 @@ void GLTFModelManager::load_animations(
                 }
             }
 
-            // Sampler TRS 값 읽기 
+            // Sampler TRS 값 읽기. KHR_mesh_quantization 의 normalized 회전 값도 float 로 변환
             {
-                const auto& accessor = gltf_model.accessors[samp.output];
-                const auto& buffer_view = gltf_model.bufferViews[accessor.bufferView];
-                const auto& buffer = gltf_model.buffers[buffer_view.buffer];
-
-                assert(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
-
-                switch ( accessor.type ) {
-                    case TINYGLTF_TYPE_VEC3 : {
-                        std::vector<glm::vec3> buf(accessor.count);
-                        memcpy(buf.data(), buffer.data.data() + accessor.byteOffset + buffer_view.byteOffset, accessor.count * sizeof(glm::vec3));
-                        for ( size_t index = 0 ; index < accessor.count ; ++index ) {
-                            sampler.outputs.emplace_back(
-                                glm::vec4(buf[index], 1.0f) // Assuming vec3 is position, set w to 1.0f
-                            );
-                        }
-                        buf.clear();
+                ev::tools::accessor::View view;
+                if ( !make_accessor_view(gltf_model, buffer_data, samp.output, view) ) {
+                    ev_log_error("[ev::tools::gltf::GLTFModelManager::load_animations] Invalid sampler output accessor: %d", samp.output);
+                    view.count = 0;
+                }
+
+                switch ( view.count > 0 ? view.components : 0 ) {
+                    case 0 :
                         break;
-                    }
-                    case TINYGLTF_TYPE_VEC4 : {
-                        std::vector<glm::vec4> buf(accessor.count);
-                        memcpy(buf.data(), buffer.data.data() + accessor.byteOffset + buffer_view.byteOffset, accessor.count * sizeof(glm::vec4));
-                        for ( size_t index = 0 ; index < accessor.count ; ++index ) {
-                            sampler.outputs.emplace_back(buf[index]);
-                        }
-                        buf.clear();
+                    case 3 :
+                    case 4 : {
+                        // vec3 는 position 으로 가정하고 w 를 1.0f 로 설정
+                        static constexpr float defaults[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+                        sampler.outputs.resize(view.count);
+                        ev::tools::accessor::read_floats(view, &sampler.outputs[0].x, sizeof(glm::vec4), 4, defaults);
                         break;
                     }
                     default: 
-                        ev_log_error("[ev::tools::gltf::GLTFModelManager::load_animations] Unsupported accessor type: %d", accessor.type);
+                        ev_log_error("[ev::tools::gltf::GLTFModelManager::load_animations] Unsupported accessor type: %d", gltf_model.accessors[samp.output].type);
                         break;
                 }
                 animation->add_sampler(sampler);
             }
+        }
 
-            // channels
-            {
-                for (const auto& chan : anim.channels) {
-                    auto channel = Animation::AnimationChannel();
-
-                    if ( chan.target_path == "translation" ) {
-                        channel.path_type = Animation::AnimationChannel::PathType::TRANSLATION;
-                    } else if ( chan.target_path == "rotation" ) {
-                        channel.path_type = Animation::AnimationChannel::PathType::ROTATION;
-                    } else if ( chan.target_path == "scale" ) {
-                        channel.path_type = Animation::AnimationChannel::PathType::SCALE;
-                    } else if (chan.target_path == "weights") {
-                        ev_log_error("[ev::tools::gltf::GLTFModelManager::load_animations] Unsupported animation channel path: %s", chan.target_path.c_str());
-                        continue;
-                    }
+        // channels
+        {
+            for (const auto& chan : anim.channels) {
+                auto channel = Animation::AnimationChannel();
+
+                if ( chan.target_path == "translation" ) {
+                    channel.path_type = Animation::AnimationChannel::PathType::TRANSLATION;
+                } else if ( chan.target_path == "rotation" ) {
+                    channel.path_type = Animation::AnimationChannel::PathType::ROTATION;
+                } else if ( chan.target_path == "scale" ) {
+                    channel.path_type = Animation::AnimationChannel::PathType::SCALE;
+                } else if (chan.target_path == "weights") {
+                    ev_log_error("[ev::tools::gltf::GLTFModelManager::load_animations] Unsupported animation channel path: %s", chan.target_path.c_str());
+                    continue;
+                }
 
-                    channel.sampler_index = chan.sampler;
-                    channel.target_node = model->get_node_by_index(chan.target_node);
+                channel.sampler_index = chan.sampler;
+                channel.target_node = model->get_node_by_index(chan.target_node);
 
-                    if ( channel.target_node == nullptr ) {
-                        continue;
-                    }
-                    animation->add_channel(channel);
+                if ( channel.target_node == nullptr ) {
+                    continue;
                 }
+                animation->add_channel(channel);
             }
-            model->add_animation(animation);
         }
     }
 
@@ -407,54 +2033,41 @@ void GLTFModelManager::load_skins(
 
         // Load inverse bind matrices
         if (skin.inverseBindMatrices >= 0) {
-            const auto& accessor = gltf_model.accessors[skin.inverseBindMatrices];
-            const auto& buffer_view = gltf_model.bufferViews[accessor.bufferView];
-            const auto& buffer = gltf_model.buffers[buffer_view.buffer];
-
-            assert(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
-
-            std::vector<glm::mat4> ibm(accessor.count);
-            memcpy(ibm.data(), buffer.data.data() + accessor.byteOffset + buffer_view.byteOffset, accessor.count * sizeof(glm::mat4));
-            for (size_t i = 0; i < ibm.size(); ++i) {
-                new_skin->add_inverse_bind_matrix(ibm[i]);
+            ev::tools::accessor::View view;
+            if ( make_accessor_view(gltf_model, buffer_data, skin.inverseBindMatrices, view) && view.components == 16 ) {
+                std::vector<glm::mat4> ibm(view.count);
+                if ( !ibm.empty() ) {
+                    ev::tools::accessor::read_floats(view, glm::value_ptr(ibm[0]), sizeof(glm::mat4), 16);
+                }
+                for (size_t i = 0; i < ibm.size(); ++i) {
+                    new_skin->add_inverse_bind_matrix(ibm[i]);
+                }
+            } else {
+                ev_log_error("[ev::tools::gltf::GLTFModelManager::load_skins] Invalid inverse bind matrix accessor: %d", skin.inverseBindMatrices);
             }
         }
         model->add_skin(new_skin);
     }
 
-    ev_log_info("[ev::tools::gltf::GLTFModelManager::load_skins] Finished loading skins.");
-}
-
-std::shared_ptr<ev::Texture> GLTFModelManager::load_texture(tinygltf::Image &image, std::string& file_path) {
-    ev_log_info("[ev::tools::gltf::GLTFModelManager::load_texture] Loading image file: %s", file_path.c_str());
-    if (!std::filesystem::exists(file_path)) {
-        ev_log_error("[ev::tools::gltf::GLTFModelManager::load_texture] Image file does not exist: %s", file_path.c_str());
-        exit(EXIT_FAILURE);
+    // 메시 노드와 스킨 연결 (skin_index 는 glTF 스킨 인덱스, 스킨이 없으면 -1)
+    for ( const auto& node : model->get_linear_nodes() ) {
+        if ( node->get_skin_index() < model->get_skins().size() ) {
+            node->set_skin(model->get_skins()[node->get_skin_index()]);
+        }
     }
-    // Load the image data from the file using stb_image
 
-    uint8_t* buffer;
-    uint32_t buffer_size;
-    bool delete_buffer = false;
-
-    if ( image.component == 4 ) {
-        buffer_size = image.width * image.height * 4; // RGBA
-        buffer = new uint8_t[buffer_size];
-        uint8_t *rgba = buffer;
-        uint8_t *rgb = &image.image[0];
+    ev_log_info("[ev::tools::gltf::GLTFModelManager::load_skins] Finished loading skins.");
+}
 
-        for ( size_t i = 0 ; i < image.width * image.height ; ++i ) {
-            for ( uint32_t ch = 0 ; ch < 3 ; ++ch ) {
-                rgba[ch] = rgb[ch];
-            }
-            rgba+=4;
-            rgb+=3;
-        }
-        delete_buffer = true;
-    } else {
-        buffer_size = static_cast<uint32_t>(image.image.size());
-        buffer = &image.image[0];
-    }
+std::shared_ptr<ev::Texture> GLTFModelManager::record_texture(
+    const LoadSettings& settings,
+    const tinygltf::Image& image,
+    const std::string& file_path,
+    const StagedImage& staged,
+    std::shared_ptr<ev::CommandBuffer> command_buffer
+) {
+    // file_path 는 로그용이며 임베디드 이미지는 비어 있음
+    ev_log_info("[ev::tools::gltf::GLTFModelManager::record_texture] Loading image: %s", file_path.empty() ? "(embedded)" : file_path.c_str());
 
     uint32_t width = static_cast<uint32_t>(image.width);
     uint32_t height = static_cast<uint32_t>(image.height);
@@ -467,8 +2080,12 @@ std::shared_ptr<ev::Texture> GLTFModelManager::load_texture(tinygltf::Image &ima
 
     if ( !(props.optimalTilingFeatures & VK_FORMAT_FEATURE_BLIT_SRC_BIT) 
          || !(props.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) ) {
-        ev_log_error("[ev::tools::gltf::GLTFModelManager::load_texture] Format not supported for blit or sampled image: %d", format);
-        exit(EXIT_FAILURE);
+        ev_log_error("[ev::tools::gltf::GLTFModelManager::record_texture] Format not supported for blit or sampled image: %d", format);
+        return nullptr;
+    }
+    if ( staged.empty() || (!staged.pixels && !settings.pixel_unpacker) ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager::record_texture] Image has no staged pixels: %s", file_path.c_str());
+        return nullptr;
     }
 
     std::shared_ptr<ev::Image> texture_image = std::make_shared<ev::Image>(
@@ -480,98 +2097,86 @@ std::shared_ptr<ev::Texture> GLTFModelManager::load_texture(tinygltf::Image &ima
         1,
         mip_levels,
         1,
-        VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT
-    );
-    ev_log_debug("[ev::tools::gltf::GLTFModelManager::load_texture] Texture image created with size: %ux%u, mip levels: %u", width, height, mip_levels);
-
-    std::shared_ptr<ev::Buffer> staging_buffer = std::make_shared<ev::Buffer>(
-        device,
-        buffer_size,
-        ev::buffer_type::STAGING_BUFFER
+        VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT
     );
-    ev_log_debug("[ev::tools::gltf::GLTFModelManager::load_texture] Staging buffer created with size: %u", buffer_size);
+    ev_log_debug("[ev::tools::gltf::GLTFModelManager::record_texture] Texture image created with size: %ux%u, mip levels: %u", width, height, mip_levels);
 
     if ( memory_allocator->allocate_image(texture_image, ev::memory_type::GPU_ONLY ) != VK_SUCCESS ) {
-        ev_log_error("[ev::tools::gltf::GLTFModelManager::load_texture] Failed to allocate image memory for texture.");
-        exit(EXIT_FAILURE);
-    }
-    ev_log_debug("[ev::tools::gltf::GLTFModelManager::load_texture] Image memory allocated for texture.");
-
-    if ( memory_allocator->allocate_buffer(staging_buffer, ev::memory_type::HOST_READABLE) != VK_SUCCESS ) {
-        ev_log_error("[ev::tools::gltf::GLTFModelManager::load_texture] Failed to allocate buffer memory for staging buffer.");
-        exit(EXIT_FAILURE);
+        ev_log_error("[ev::tools::gltf::GLTFModelManager::record_texture] Failed to allocate image memory for texture.");
+        return nullptr;
     }
-    ev_log_debug("[ev::tools::gltf::GLTFModelManager::load_texture] Buffer memory allocated for staging buffer.");
+    ev_log_debug("[ev::tools::gltf::GLTFModelManager::record_texture] Image memory allocated for texture.");
 
-    staging_buffer->map(buffer_size);
-    staging_buffer->write(buffer, buffer_size);
-    staging_buffer->flush();
-    staging_buffer->unmap();
-    ev_log_debug("[ev::tools::gltf::GLTFModelManager::load_texture] Staging buffer created with size: %u", buffer_size);
-
-    std::shared_ptr<ev::CommandBuffer> command_buffer = command_pool->allocate();
-    command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
-    command_buffer->pipeline_barrier(
-        VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-        VK_PIPELINE_STAGE_TRANSFER_BIT,
-        {ev::ImageMemoryBarrier(
+    if ( !staged.pixels ) {
+        // PixelUnpacker 는 자체 큐에 제출하고 완료를 기다리므로 mip 생성 명령보다 먼저 끝남
+        if ( settings.pixel_unpacker->upload(
             texture_image,
-            VK_ACCESS_NONE_KHR,
-            VK_ACCESS_TRANSFER_WRITE_BIT,
-            VK_IMAGE_LAYOUT_UNDEFINED,
-            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-            VK_QUEUE_FAMILY_IGNORED,
-            VK_QUEUE_FAMILY_IGNORED,
-            {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1}
-        )},{},{}
-    );
-    texture_image->transient_layout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-
-    VkBufferImageCopy region = {};
-    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    region.imageSubresource.mipLevel = 0;
-    region.imageSubresource.baseArrayLayer = 0;
-    region.imageSubresource.layerCount = 1;
-    region.imageExtent.width = width;
-    region.imageExtent.height = height;
-    region.imageExtent.depth = 1;
-
-    command_buffer->copy_buffer_to_image(
-        texture_image,
-        staging_buffer,
-        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-        {region}
-    );
-    texture_image->transient_layout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+            staged.packed.get(),
+            width,
+            height,
+            static_cast<uint32_t>(image.component),
+            static_cast<uint32_t>(image.bits / 8),
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            image.component == 1,
+            settings.premultiply_alpha
+        ) != VK_SUCCESS ) {
+            ev_log_error("[ev::tools::gltf::GLTFModelManager::record_texture] Failed to unpack image on GPU: %s", file_path.c_str());
+            return nullptr;
+        }
+        ev_log_debug("[ev::tools::gltf::GLTFModelManager::record_texture] Packed image (%d components, %d bits) unpacked on GPU.", image.component, image.bits);
+    } else {
+        command_buffer->pipeline_barrier(
+            VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            {ev::ImageMemoryBarrier(
+                texture_image,
+                VK_ACCESS_NONE_KHR,
+                VK_ACCESS_TRANSFER_WRITE_BIT,
+                VK_IMAGE_LAYOUT_UNDEFINED,
+                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                VK_QUEUE_FAMILY_IGNORED,
+                VK_QUEUE_FAMILY_IGNORED,
+                {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1}
+            )},{},{}
+        );
+        texture_image->transient_layout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
-    command_buffer->pipeline_barrier(
-        VK_PIPELINE_STAGE_TRANSFER_BIT,
-        VK_PIPELINE_STAGE_TRANSFER_BIT,
-        {ev::ImageMemoryBarrier(
+        VkBufferImageCopy region = {};
+        region.bufferOffset = staged.pixels.offset;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel = 0;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = 1;
+        region.imageExtent.width = width;
+        region.imageExtent.height = height;
+        region.imageExtent.depth = 1;
+
+        command_buffer->copy_buffer_to_image(
             texture_image,
-            VK_ACCESS_TRANSFER_WRITE_BIT,
-            VK_ACCESS_TRANSFER_READ_BIT,
+            staged.staging->get_buffer(),
             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-            VK_QUEUE_FAMILY_IGNORED,
-            VK_QUEUE_FAMILY_IGNORED,
-            {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1}
-        )},{},{}
-    );
-    command_buffer->end();
-    this->transfer_queue->submit(
-        command_buffer,
-        {},
-        {},
-        VK_NULL_HANDLE
-    );
-    this->transfer_queue->wait_idle(UINT32_MAX);
-    ev_log_debug("[ev::tools::gltf::GLTFModelManager::load_texture] Image transfer completed.");
-    staging_buffer.reset();
+            {region}
+        );
+        texture_image->transient_layout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
-    std::shared_ptr<ev::CommandBuffer> blit_command = command_pool->allocate();
-    blit_command->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+        command_buffer->pipeline_barrier(
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            {ev::ImageMemoryBarrier(
+                texture_image,
+                VK_ACCESS_TRANSFER_WRITE_BIT,
+                VK_ACCESS_TRANSFER_READ_BIT,
+                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                VK_QUEUE_FAMILY_IGNORED,
+                VK_QUEUE_FAMILY_IGNORED,
+                {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1}
+            )},{},{}
+        );
+        ev_log_debug("[ev::tools::gltf::GLTFModelManager::record_texture] Image transfer recorded.");
+    }
 
+    // 업로드와 같은 커맨드 버퍼에 이어서 기록하므로 mip 0 복사 뒤의 barrier 로 순서가 보장됨
     for ( uint32_t i = 1 ;i < mip_levels ; ++i ) {
         VkImageBlit blit = {};
         blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
@@ -590,7 +2195,7 @@ std::shared_ptr<ev::Texture> GLTFModelManager::load_texture(tinygltf::Image &ima
         mip_range.levelCount = 1;
         mip_range.layerCount = 1;
         texture_image->transient_layout(VK_IMAGE_LAYOUT_UNDEFINED);
-        blit_command->pipeline_barrier(
+        command_buffer->pipeline_barrier(
             VK_PIPELINE_STAGE_TRANSFER_BIT,
             VK_PIPELINE_STAGE_TRANSFER_BIT,
             {ev::ImageMemoryBarrier(
@@ -605,7 +2210,7 @@ std::shared_ptr<ev::Texture> GLTFModelManager::load_texture(tinygltf::Image &ima
             )},{},{}
         );
 
-        blit_command->blit_image(
+        command_buffer->blit_image(
             texture_image,
             VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
             texture_image,
@@ -614,7 +2219,7 @@ std::shared_ptr<ev::Texture> GLTFModelManager::load_texture(tinygltf::Image &ima
             VK_FILTER_LINEAR
         );
         texture_image->transient_layout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-        blit_command->pipeline_barrier(
+        command_buffer->pipeline_barrier(
             VK_PIPELINE_STAGE_TRANSFER_BIT,
             VK_PIPELINE_STAGE_TRANSFER_BIT,
             {ev::ImageMemoryBarrier(
@@ -630,7 +2235,7 @@ std::shared_ptr<ev::Texture> GLTFModelManager::load_texture(tinygltf::Image &ima
         );
     }
 
-    blit_command->pipeline_barrier(
+    command_buffer->pipeline_barrier(
         VK_PIPELINE_STAGE_TRANSFER_BIT,
         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
         {ev::ImageMemoryBarrier(
@@ -644,21 +2249,9 @@ std::shared_ptr<ev::Texture> GLTFModelManager::load_texture(tinygltf::Image &ima
             {VK_IMAGE_ASPECT_COLOR_BIT, 0, mip_levels, 0, 1}
         )},{},{}
     );
-    blit_command->end();
     texture_image->transient_layout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-    this->transfer_queue->submit(
-        blit_command,
-        {},
-        {},
-        VK_NULL_HANDLE
-    );
-    this->transfer_queue->wait_idle(UINT32_MAX);
-
-    ev_log_debug("[ev::tools::gltf::GLTFModelManager::load_texture] Mipmaps generated for texture image.");
 
-    if ( delete_buffer ) {
-        delete[] buffer;
-    }
+    ev_log_debug("[ev::tools::gltf::GLTFModelManager::record_texture] Mipmap generation recorded for texture image.");
 
     VkBorderColor border_color = VK_BORDER_COLOR_FLOAT_OPAQUE_WHITE;
 
@@ -679,11 +2272,6 @@ std::shared_ptr<ev::Texture> GLTFModelManager::load_texture(tinygltf::Image &ima
         static_cast<float>(mip_levels)
     );
 
-    if (!sampler) {
-        ev_log_error("[ev::tools::gltf::GLTFModelManager] Failed to create sampler.");
-        exit(EXIT_FAILURE);
-    }
-
     VkImageSubresourceRange subresource_range = {};
     subresource_range.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
     subresource_range.baseMipLevel = 0;
@@ -705,42 +2293,73 @@ std::shared_ptr<ev::Texture> GLTFModelManager::load_texture(tinygltf::Image &ima
         subresource_range
     );
 
-    if (!image_view) {
-        ev_log_error("[ev::tools::gltf::GLTFModelManager] Failed to create image view.");
-        exit(EXIT_FAILURE);
-    }
-
-    std::shared_ptr<ev::Texture> texture = std::make_shared<ev::Texture>(
+    return std::make_shared<ev::Texture>(
         texture_image,
         image_view,
         sampler
     );
+}
 
-    if (!texture) {
-        ev_log_error("[ev::tools::gltf::GLTFModelManager] Failed to create texture.");
-        exit(EXIT_FAILURE);
-    }
-    return texture;
+ev::tools::ResourceKey GLTFModelManager::make_texture_key(const LoadSettings& settings, const void* source, size_t size) const {
+    // load_texture 가 사용하는 포맷, 채널 보존 여부, 알파 premultiply 여부, 샘플러 설정
+    const uint32_t params[] = {
+        static_cast<uint32_t>(VK_FORMAT_R8G8B8A8_UNORM),
+        settings.pixel_unpacker != nullptr ? 1u : 0u,
+        settings.premultiply_alpha ? 1u : 0u,
+        static_cast<uint32_t>(VK_FILTER_LINEAR),
+        static_cast<uint32_t>(VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT),
+        8u // max anisotropy
+    };
+    return ev::tools::make_resource_key(source, size, params, sizeof(params));
 }
 
-void GLTFModelManager::load_textures(tinygltf::Model& gltf_model, 
-    std::shared_ptr<Model> model
-) {
+bool GLTFModelManager::load_textures(DecodedModel& decoded, PendingUpload& upload, std::vector<uint32_t>& image_indices) {
     ev_log_info("[ev::tools::gltf::GLTFModelManager] Loading textures...");  
-    for (tinygltf::Image& gltf_image : gltf_model.images) {
-        if (gltf_image.uri.empty() && gltf_image.bufferView < 0) {
-            ev_log_warn("[ev::tools::gltf::GLTFModelManager] Image has no URI or buffer view, skipping.");
+    tinygltf::Model& gltf_model = decoded.gltf_model;
+    const CachedImages& cached_images = decoded.cached_images;
+    std::shared_ptr<Model> model = decoded.model;
+    image_indices.clear();
+    for ( size_t i = 0 ; i < gltf_model.images.size() ; ++i ) {
+        tinygltf::Image& gltf_image = gltf_model.images[i];
+        const bool cache_hit = i < cached_images.hits.size() && cached_images.hits[i];
+        const bool staged = i < decoded.images.size() && !decoded.images[i].empty();
+        if ( !staged && !cache_hit ) {
+            ev_log_warn("[ev::tools::gltf::GLTFModelManager] Image %zu has no decoded pixels, skipping.", i);
             continue;
         }
 
-        std::string file_path = (resource_path / gltf_image.uri).string();
-        std::shared_ptr<ev::Texture> texture = load_texture(gltf_image, file_path);
-        // model->get_textures().emplace_back(texture);
+        // uri 가 없는 이미지(.glb 의 bufferView, data URI)는 원본 파일이 없으므로 빈 경로로 기록
+        std::string file_path = gltf_image.uri.empty() ? std::string() : (decoded.resource_path / gltf_image.uri).string();
+        const bool keyed = decoded.settings.texture_cache && i < cached_images.hashed.size() && cached_images.hashed[i];
+        std::shared_ptr<ev::Texture> texture = nullptr;
+        if ( cache_hit ) {
+            ev_log_debug("[ev::tools::gltf::GLTFModelManager] Texture cache hit: %s", file_path.c_str());
+            texture = cached_images.hits[i];
+        } else if ( keyed ) {
+            // 업로드가 끝나기 전에는 캐시에 없으므로 같은 모델 안의 중복 이미지는 여기서 공유
+            for ( const auto& [key, created] : upload.new_textures ) {
+                if ( key == cached_images.keys[i] ) {
+                    texture = created;
+                    break;
+                }
+            }
+        }
+        if ( !texture ) {
+            texture = record_texture(decoded.settings, gltf_image, file_path, decoded.images[i], upload.command_buffer);
+            if ( !texture ) {
+                return false;
+            }
+            if ( keyed ) {
+                upload.new_textures.emplace_back(cached_images.keys[i], texture);
+            }
+        }
         texture->index = static_cast<uint32_t>(model->get_textures().size());
-        model->add_texture(texture);
+        model->add_texture(texture, file_path);
+        image_indices.push_back(static_cast<uint32_t>(i));
     }
 
     ev_log_debug("[ev::tools::gltf::GLTFModelManager] Number of textures: %u", static_cast<uint32_t>(gltf_model.textures.size()));
+    return true;
 }
 
 std::shared_ptr<ev::Texture> GLTFModelManager::get_texture(
@@ -764,20 +2383,6 @@ void GLTFModelManager::load_materials(
     for (tinygltf::Material& mat : gltf_model.materials) {
         std::shared_ptr<Material> material = std::make_shared<Material>(device);
 
-        if ( mat.values.find("baseColorTexture") != mat.values.end() ) {
-            ev_log_debug("[ev::tools::gltf::GLTFModelManager] Base color factor found in material: %s", mat.name.c_str());
-            uint32_t texture_idx = mat.values["baseColorTexture"].TextureIndex();
-            uint32_t idx = gltf_model.textures[texture_idx].source;
-            material->set_base_color_texture(get_texture(model, idx));
-        }
-
-        if ( mat.values.find("metallicRoughnessTexture") != mat.values.end() ) {
-            ev_log_debug("[ev::tools::gltf::GLTFModelManager] Metallic roughness texture found in material: %s", mat.name.c_str());
-            uint32_t texture_idx = mat.values["metallicRoughnessTexture"].TextureIndex();
-            uint32_t idx = gltf_model.textures[texture_idx].source;
-            material->set_metallic_roughness_texture(get_texture(model, idx));
-        }
-
         if ( mat.values.find("roughnessFactor") != mat.values.end() ) {
             ev_log_debug("[ev::tools::gltf::GLTFModelManager] Roughness factor found in material: %s", mat.name.c_str());
             material->set_roughness_factor(static_cast<float>(mat.values["roughnessFactor"].Factor()));
@@ -799,28 +2404,6 @@ void GLTFModelManager::load_materials(
             ));
         }
 
-        if ( mat.values.find("normalTexture") != mat.values.end() ) {
-            ev_log_debug("[ev::tools::gltf::GLTFModelManager] Normal texture found in material: %s", mat.name.c_str());
-            uint32_t texture_idx = mat.values["normalTexture"].TextureIndex();
-            uint32_t idx = gltf_model.textures[texture_idx].source;
-            material->set_normal_texture(get_texture(model, idx));
-        }
-        
-        if ( mat.values.find("emissiveTexture") != mat.values.end() ) {
-            ev_log_debug("[ev::tools::gltf::GLTFModelManager] Emissive texture found in material: %s", mat.name.c_str());
-            // Check if the material has an emissive texture
-            uint32_t texture_idx = mat.values["emissiveTexture"].TextureIndex();
-            uint32_t idx = gltf_model.textures[texture_idx].source;
-            material->set_emissive_texture(get_texture(model, idx));
-        }
-
-        if ( mat.values.find("occlusionTexture") != mat.values.end() ) {
-            ev_log_debug("[ev::tools::gltf::GLTFModelManager] Occlusion texture found in material: %s", mat.name.c_str());
-            uint32_t texture_idx = mat.values["occlusionTexture"].TextureIndex();
-            uint32_t idx = gltf_model.textures[texture_idx].source;
-            material->set_occlusion_texture(get_texture(model, idx));
-        }
-
         if ( mat.values.find("alphaMode") != mat.values.end() ) {
             ev_log_debug("[ev::tools::gltf::GLTFModelManager] Alpha mode found in material: %s", mat.name.c_str());
             tinygltf::Parameter param = mat.additionalValues["alphaMode"];
@@ -846,11 +2429,36 @@ void GLTFModelManager::load_materials(
     ev_log_debug("[ev::tools::gltf::GLTFModelManager] Number of materials: %zu", gltf_model.materials.size());
 }
 
+void GLTFModelManager::bind_material_textures(
+    tinygltf::Model& gltf_model,
+    std::shared_ptr<Model> model
+) {
+    // 텍스처는 glTF 이미지 순서로 load_textures 가 추가한 것
+    auto texture = [&](tinygltf::Material& mat, const char* name) -> std::shared_ptr<ev::Texture> {
+        auto it = mat.values.find(name);
+        if ( it == mat.values.end() ) {
+            return nullptr;
+        }
+        ev_log_debug("[ev::tools::gltf::GLTFModelManager] %s found in material: %s", name, mat.name.c_str());
+        return get_texture(model, gltf_model.textures[it->second.TextureIndex()].source);
+    };
+
+    const auto& materials = model->get_materials();
+    for ( size_t i = 0 ; i < gltf_model.materials.size() && i < materials.size() ; ++i ) {
+        tinygltf::Material& mat = gltf_model.materials[i];
+        const std::shared_ptr<Material>& material = materials[i];
+        material->set_base_color_texture(texture(mat, "baseColorTexture"));
+        material->set_metallic_roughness_texture(texture(mat, "metallicRoughnessTexture"));
+        material->set_normal_texture(texture(mat, "normalTexture"));
+        material->set_emissive_texture(texture(mat, "emissiveTexture"));
+        material->set_occlusion_texture(texture(mat, "occlusionTexture"));
+    }
+}
+
 void GLTFModelManager::load_nodes(
     tinygltf::Model& gltf_model, 
     std::shared_ptr<Model> model,
-    std::vector<Vertex> &h_vertices,
-    std::vector<uint32_t> &h_indices,
+    GeometryStream& geometry,
     float scale_factor
 ) {
     ev_log_info("[ev::tools::gltf::GLTFModelManager] Loading nodes...");
@@ -865,8 +2473,7 @@ void GLTFModelManager::load_nodes(
             model,
             node,
             node_idx,
-            h_vertices,
-            h_indices,
+            geometry,
             scale_factor
         );
     }
@@ -880,8 +2487,7 @@ void GLTFModelManager::load_node(
     std::shared_ptr<Model> model,
     tinygltf::Node& node,
     uint32_t node_idx,
-    std::vector<Vertex> &h_vertices,
-    std::vector<uint32_t> &h_indices,
+    GeometryStream& geometry,
     float scale_factor
 ) {
     ev_log_info("[ev::tools::gltf::GLTFModelManager] Loading node: %s", node.name.c_str());
@@ -891,6 +2497,8 @@ void GLTFModelManager::load_node(
     // new_node->set_index(node_idx);
     new_node->set_parent(parent_node);
     new_node->set_skin_index(node.skin);
+    // 메시가 없는 노드(관절 등)도 애니메이션/스킨에서 인덱스로 찾을 수 있도록 모든 노드를 등록
+    model->add_linear_node(new_node);
 
     if (parent_node) {
         parent_node->add_child(new_node);
@@ -931,14 +2539,13 @@ void GLTFModelManager::load_node(
                 model,
                 child_node,
                 child_idx,
-                h_vertices,
-                h_indices,
+                geometry,
                 scale_factor
             );
         }
     }
 
-    load_node_meshes(gltf_model, model, node, new_node, h_vertices, h_indices);
+    load_node_meshes(gltf_model, model, node, new_node, geometry);
 }
 
 void GLTFModelManager::load_node_meshes(
@@ -946,8 +2553,7 @@ void GLTFModelManager::load_node_meshes(
     std::shared_ptr<ev::tools::gltf::Model> model,
     tinygltf::Node& node,
     std::shared_ptr<ev::tools::gltf::Node> new_node,
-    std::vector<Vertex> &h_vertices,
-    std::vector<uint32_t> &h_indices
+    GeometryStream& geometry
 ) {
     if (node.mesh < 0) {
         return; // No mesh associated with this node
@@ -958,15 +2564,7 @@ void GLTFModelManager::load_node_meshes(
     std::shared_ptr<ev::tools::gltf::Mesh> new_mesh
         = std::make_shared<ev::tools::gltf::Mesh>();
     new_mesh->set_name(mesh.name);
-    new_mesh->set_uniform_buffer(
-        std::make_shared<ev::Buffer>(
-            device,
-            sizeof(ev::tools::gltf::Mesh::Uniform),
-            ev::buffer_type::UNIFORM_BUFFER
-        )
-    );
-    memory_allocator->allocate_buffer(new_mesh->get_uniform_buffer(), 
-        ev::memory_type::HOST_READABLE);
+    // uniform 버퍼는 공유 할당자를 사용하므로 prepare_node_descriptor_set 에서 만듦
     new_mesh->get_uniform_data().matrix = new_node->get_matrix();
 
     for (size_t i = 0; i < mesh.primitives.size(); ++i) {
@@ -976,28 +2574,59 @@ void GLTFModelManager::load_node_meshes(
             continue;
         }
 
-        glm::vec3 min_pos(0.0f);
-        glm::vec3 max_pos(0.0f);
-
-        uint32_t vertex_start = static_cast<uint32_t>(h_vertices.size());
-        uint32_t vertex_count = 0;
-        uint32_t index_start = static_cast<uint32_t>(h_indices.size());
-        uint32_t index_count = 0;
-
-        add_mesh_vertices(gltf_model, mesh, primitive, h_vertices, min_pos, max_pos, vertex_start, vertex_count);
-        add_mesh_indices(gltf_model, 
-            model, 
-            mesh, 
-            new_mesh, 
-            primitive, 
-            h_indices, 
-            vertex_start, 
-            vertex_count, 
-            index_start, 
-            index_count, 
-            min_pos, 
-            max_pos
-        );
+        auto position = primitive.attributes.find("POSITION");
+        if ( position == primitive.attributes.end() ) {
+            ev_log_warn("[ev::tools::gltf::GLTFModelManager] Primitive without POSITION attribute skipped: %s", mesh.name.c_str());
+            continue;
+        }
+        const tinygltf::Accessor& pos_accessor = gltf_model.accessors[position->second];
+        const tinygltf::Accessor& index_accessor = gltf_model.accessors[primitive.indices];
+
+        switch ( index_accessor.componentType ) {
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT: {
+                // 변환은 convert_geometry 에서 수행하고 여기서는 출력 위치만 할당
+                PrimitiveTask task;
+                task.primitive = &primitive;
+                task.mesh = new_mesh.get();
+                task.vertex_start = geometry.vertex_count;
+                task.index_start = geometry.index_count;
+                task.vertex_count = static_cast<uint32_t>(pos_accessor.count);
+                task.index_count = static_cast<uint32_t>(index_accessor.count);
+
+                const uint32_t vertex_count = task.vertex_count;
+                const uint32_t index_count = task.index_count;
+                geometry.vertex_count += vertex_count;
+                geometry.index_count += index_count;
+
+                std::shared_ptr<ev::tools::gltf::Primitive> new_primitive =
+                    std::make_shared<ev::tools::gltf::Primitive>(
+                        task.index_start,
+                        index_count,
+                        task.vertex_start,
+                        vertex_count,
+                        primitive.material > -1 ? model->get_materials()[primitive.material] : model->get_materials().back()
+                    );
+                // min/max 는 성분 타입 단위이므로 normalized 정수 위치(KHR_mesh_quantization)는 변환
+                const auto position_type = static_cast<ev::tools::accessor::ComponentType>(pos_accessor.componentType);
+                glm::vec3 min_pos(0.0f);
+                glm::vec3 max_pos(0.0f);
+                for ( int c = 0 ; c < 3 && c < static_cast<int>(pos_accessor.minValues.size()) && c < static_cast<int>(pos_accessor.maxValues.size()) ; ++c ) {
+                    min_pos[c] = ev::tools::accessor::dequantize(pos_accessor.minValues[c], position_type, pos_accessor.normalized);
+                    max_pos[c] = ev::tools::accessor::dequantize(pos_accessor.maxValues[c], position_type, pos_accessor.normalized);
+                }
+                new_primitive->set_dimensions(min_pos, max_pos);
+                new_mesh->add_primitive(new_primitive);
+                task.target = new_primitive.get();
+                geometry.tasks.push_back(std::move(task));
+                break;
+            }
+            default:
+                ev_log_error("[ev::tools::gltf::GLTFModelManager] Unsupported index component type.");
+                break;
+        }
+
         new_node->set_mesh(new_mesh);
         auto parent = new_node->get_parent();
         if ( !parent.expired() ) {
@@ -1005,284 +2634,715 @@ void GLTFModelManager::load_node_meshes(
         } else {
             model->add_node(new_node);
         }
-        model->add_linear_node(new_node);
+    }
+
+    // 양자화 위치의 기준이 되는 메시 bounds. 변환 전에 정해져 있어야 함
+    if ( !new_mesh->get_primitives().empty() ) {
+        glm::vec3 min_pos = new_mesh->get_primitives().front()->get_dimensions().min;
+        glm::vec3 max_pos = new_mesh->get_primitives().front()->get_dimensions().max;
+        for ( const auto& primitive : new_mesh->get_primitives() ) {
+            min_pos = glm::min(min_pos, primitive->get_dimensions().min);
+            max_pos = glm::max(max_pos, primitive->get_dimensions().max);
+        }
+        Mesh::Uniform& uniform = new_mesh->get_uniform_data();
+        uniform.position_offset = glm::vec4((min_pos + max_pos) * 0.5f, 0.0f);
+        uniform.position_scale = glm::vec4(glm::max((max_pos - min_pos) * 0.5f, glm::vec3(1e-6f)), 1.0f);
     }
 }
 
 void GLTFModelManager::add_mesh_indices(
-    tinygltf::Model& gltf_model,
-    std::shared_ptr<ev::tools::gltf::Model> model,
-    tinygltf::Mesh& mesh,
-    std::shared_ptr<ev::tools::gltf::Mesh> new_mesh,
+    const tinygltf::Model& gltf_model,
     const tinygltf::Primitive& primitive,
-    std::vector<uint32_t> &h_indices,
-    uint32_t& vertex_start,
-    uint32_t& vertex_count,
-    uint32_t& index_start,
-    uint32_t& index_count,
-    glm::vec3& min_pos,
-    glm::vec3& max_pos
+    uint32_t* dst
 ) {
-    const tinygltf::Accessor accessor = gltf_model.accessors[primitive.indices];
-    const tinygltf::BufferView& buffer_view = gltf_model.bufferViews[accessor.bufferView];
-    const tinygltf::Buffer& buffer = gltf_model.buffers[buffer_view.buffer];
+    const tinygltf::Accessor& accessor = gltf_model.accessors[primitive.indices];
+    ev::tools::accessor::View view;
+    if ( !make_accessor_view(gltf_model, buffer_data, primitive.indices, view) ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager] Invalid index accessor: %d", primitive.indices);
+        std::fill_n(dst, accessor.count, 0u);
+        return;
+    }
 
-    index_count = static_cast<uint32_t>(accessor.count);
+    // 인덱스 bufferView 는 byteStride 를 가질 수 없으므로 촘촘하게 배치됨
+    const unsigned char* src = view.data;
 
     switch(accessor.componentType) {
         case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
-            std::vector<uint16_t> buf = std::vector<uint16_t>(accessor.count);
-            memcpy(buf.data(), &buffer.data[accessor.byteOffset + buffer_view.byteOffset], index_count * sizeof(uint16_t));
+            const uint16_t* buf = reinterpret_cast<const uint16_t*>(src);
             for ( size_t index = 0 ; index < accessor.count ; ++index ) {
-                h_indices.emplace_back(buf[index] + vertex_start);
+                dst[index] = buf[index];
             }
-            buf.clear();
             break;
         }
         case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT: {
-            std::vector<uint32_t> buf = std::vector<uint32_t>(accessor.count);
-            memcpy(buf.data(), &buffer.data[accessor.byteOffset + buffer_view.byteOffset], index_count * sizeof(uint32_t));
+            const uint32_t* buf = reinterpret_cast<const uint32_t*>(src);
             for ( size_t index = 0 ; index < accessor.count ; ++index ) {
-                h_indices.emplace_back(buf[index] + vertex_start);
+                dst[index] = buf[index];
             }
-            buf.clear();
             break;
         }
         case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE: {
-            std::vector<uint8_t> buf = std::vector<uint8_t>(accessor.count);
-            memcpy(buf.data(), &buffer.data[accessor.byteOffset + buffer_view.byteOffset], index_count * sizeof(uint8_t));
+            const uint8_t* buf = reinterpret_cast<const uint8_t*>(src);
             for ( size_t index = 0 ; index < accessor.count ; ++index ) {
-                h_indices.emplace_back(static_cast<uint32_t>(buf[index]) + vertex_start);
+                dst[index] = static_cast<uint32_t>(buf[index]);
             }
-            buf.clear();
             break;
         }
         default:
             ev_log_error("[ev::tools::gltf::GLTFModelManager] Unsupported index component type.");
             return;
     }
-
-    std::shared_ptr<ev::tools::gltf::Primitive> new_primitive =
-        std::make_shared<ev::tools::gltf::Primitive>(
-            index_start,
-            index_count,
-            vertex_start,
-            vertex_count,
-            primitive.material > -1 ? model->get_materials()[primitive.material] : model->get_materials().back()
-        );
-    new_primitive->set_dimensions(min_pos, max_pos);
-    new_mesh->add_primitive(new_primitive);
 }
 
 void GLTFModelManager::add_mesh_vertices(
-    tinygltf::Model& gltf_model,
-    tinygltf::Mesh& mesh,
+    const tinygltf::Model& gltf_model,
     const tinygltf::Primitive& primitive,
-    std::vector<Vertex> &h_vertices,
-    glm::vec3 &min_pos,
-    glm::vec3 &max_pos,
-    uint32_t &vertex_start,
-    uint32_t &vertex_count
+    Vertex* dst,
+    uint32_t skip_mask
 ) {
-    bool has_skin = false;
-    vertex_start = static_cast<uint32_t>(h_vertices.size());
-    vertex_count = 0;
-
-    const float *buffer_pos = nullptr;
-    const float *buffer_normal = nullptr;
-    const float *buffer_uv = nullptr;
-    const float *buffer_color = nullptr;
-    const float *buffer_tangent = nullptr;
-    const uint16_t *buffer_joint = nullptr;
-    const float *buffer_weight = nullptr;
-    uint32_t num_color_components;
+    namespace accessor = ev::tools::accessor;
     assert(primitive.attributes.find("POSITION") != primitive.attributes.end());
+    const size_t count = gltf_model.accessors[primitive.attributes.find("POSITION")->second].count;
+
+    // 없는 속성은 defaults 로 채움. 읽었으면 true
+    auto read_attribute = [&](const char* name, VertexType type, float* first, uint32_t components, const float* defaults) {
+        if ( skip_mask & (1u << type) ) {
+            return false;
+        }
+        accessor::View view;
+        auto it = primitive.attributes.find(name);
+        if ( it != primitive.attributes.end() && make_accessor_view(gltf_model, buffer_data, it->second, view) && view.count >= count ) {
+            view.count = count;
+            accessor::read_floats(view, first, sizeof(Vertex), components, defaults);
+            return true;
+        }
+        for ( size_t i = 0 ; i < count ; ++i ) {
+            float* element = reinterpret_cast<float*>(reinterpret_cast<uint8_t*>(first) + i * sizeof(Vertex));
+            for ( uint32_t c = 0 ; c < components ; ++c ) {
+                element[c] = defaults[c];
+            }
+        }
+        return false;
+    };
+
+    static constexpr float ZERO[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    static constexpr float ONE[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    read_attribute("POSITION", Position, glm::value_ptr(dst->pos), 3, ZERO);
+    if ( read_attribute("NORMAL", Normal, glm::value_ptr(dst->normal), 3, ZERO) ) {
+        // 양자화된 법선은 길이가 1 이 아닐 수 있음
+        for ( size_t i = 0 ; i < count ; ++i ) {
+            const float length = glm::length(dst[i].normal);
+            dst[i].normal = length > 0.0f ? dst[i].normal / length : glm::vec3(0.0f);
+        }
+    }
+    read_attribute("TEXCOORD_0", UV, glm::value_ptr(dst->uv), 2, ZERO);
+    // VEC3 색상은 alpha 1
+    read_attribute("COLOR_0", Color, glm::value_ptr(dst->color), 4, ONE);
+    read_attribute("TANGENT", Tangent, glm::value_ptr(dst->tangent), 4, ZERO);
+
+    // 건너뛴 속성은 copy_mesh_attributes 가 이미 기록한 것
+    const bool has_joint = (skip_mask & (1u << Joint)) || read_attribute("JOINTS_0", Joint, glm::value_ptr(dst->joint), 4, ZERO);
+    const bool has_weight = (skip_mask & (1u << Weight)) || read_attribute("WEIGHTS_0", Weight, glm::value_ptr(dst->weight), 4, ZERO);
+    if ( has_joint != has_weight ) {
+        // 관절과 가중치가 모두 있어야 스킨 정점
+        for ( size_t i = 0 ; i < count ; ++i ) {
+            if ( !(skip_mask & (1u << Joint)) ) dst[i].joint = glm::vec4(0.0f);
+            if ( !(skip_mask & (1u << Weight)) ) dst[i].weight = glm::vec4(0.0f);
+        }
+    }
+}
 
-    const tinygltf::Accessor& pos_accessor = gltf_model.accessors[primitive.attributes.find("POSITION")->second];
-    const tinygltf::BufferView& pos_buffer_view = gltf_model.bufferViews[pos_accessor.bufferView];
-    buffer_pos = reinterpret_cast<const float*>(& (gltf_model.buffers[pos_buffer_view.buffer].data[pos_accessor.byteOffset + pos_buffer_view.byteOffset]));
-    min_pos = glm::vec3(pos_accessor.minValues[0], pos_accessor.minValues[1], pos_accessor.minValues[2]);
-    max_pos = glm::vec3(pos_accessor.maxValues[0], pos_accessor.maxValues[1], pos_accessor.maxValues[2]);
+uint32_t GLTFModelManager::copy_mesh_attributes(
+    const VertexLayout& vertex_layout,
+    const tinygltf::Model& gltf_model,
+    const tinygltf::Primitive& primitive,
+    uint8_t* const* dst
+) {
+    static const std::pair<const char*, VertexType> ATTRIBUTES[] = {
+        { "POSITION", Position }, { "NORMAL", Normal }, { "TEXCOORD_0", UV }, { "COLOR_0", Color },
+        { "JOINTS_0", Joint }, { "WEIGHTS_0", Weight }, { "TANGENT", Tangent }
+    };
+    const size_t count = gltf_model.accessors[primitive.attributes.find("POSITION")->second].count;
+    const bool quantized = vertex_layout.get_encoding() == VertexEncoding::Quantized;
+    uint32_t copied = 0;
+    for ( const auto& [name, type] : ATTRIBUTES ) {
+        // Quantized 위치는 메시 bounds 기준, 법선/탄젠트는 octahedral 로 변환하므로 포맷이 같아도 복사할 수 없음
+        if ( !vertex_layout.has(type) || (quantized && (type == Position || type == Normal || type == Tangent)) ) {
+            continue;
+        }
+        auto it = primitive.attributes.find(name);
+        ev::tools::accessor::View view;
+        if ( it == primitive.attributes.end() || !make_accessor_view(gltf_model, buffer_data, it->second, view) || view.count < count ) {
+            continue;
+        }
+        if ( accessor_format(view) != vertex_layout.get_format(type) ) {
+            continue;
+        }
+        // 관절과 가중치는 둘 다 있을 때만 유효하므로 add_mesh_vertices 의 처리에 맡김
+        if ( (type == Joint || type == Weight)
+            && (primitive.attributes.count("JOINTS_0") == 0 || primitive.attributes.count("WEIGHTS_0") == 0) ) {
+            continue;
+        }
+        view.count = count;
+        const uint32_t stream = vertex_layout.get_stream(type);
+        ev::tools::accessor::copy_elements(view, dst[stream] + vertex_layout.get_offset(type), vertex_layout.get_stream_stride(stream));
+        copied |= 1u << type;
+    }
+    return copied;
+}
+
+void GLTFModelManager::read_primitive(
+    const tinygltf::Model& gltf_model,
+    PrimitiveTask& task
+) {
+    task.vertices.resize(task.vertex_count);
+    task.indices.resize(task.index_count);
+    add_mesh_vertices(gltf_model, *task.primitive, task.vertices.data());
+    add_mesh_indices(gltf_model, *task.primitive, task.indices.data());
+}
+
+void GLTFModelManager::optimize_geometry(
+    const LoadSettings& settings,
+    ev::tools::WorkerPool& pool,
+    const tinygltf::Model& gltf_model,
+    GeometryStream& geometry
+) {
+    using namespace ev::tools::mesh_optimizer;
+
+    const uint32_t reorder_flags = MeshOptimizeFlags::DeduplicateVertices
+        | MeshOptimizeFlags::OptimizeVertexCache
+        | MeshOptimizeFlags::OptimizeVertexFetch;
+    if ( settings.mesh_optimize_flags & reorder_flags ) {
+        // 삼각형 수로 가중 평균하기 위해 프리미티브별 캐시 미스 수를 기록
+        std::vector<double> misses_before(geometry.tasks.size(), 0.0);
+        std::vector<double> misses_after(geometry.tasks.size(), 0.0);
+        pool.parallel_for(static_cast<uint32_t>(geometry.tasks.size()), [&](uint32_t begin, uint32_t end) {
+            std::vector<uint32_t> remap;
+            std::vector<Vertex> compacted;
+            for ( uint32_t i = begin ; i < end ; ++i ) {
+                PrimitiveTask& task = geometry.tasks[i];
+                read_primitive(gltf_model, task);
+
+                const bool valid = std::all_of(task.indices.begin(), task.indices.end(),
+                    [&](uint32_t index) { return index < task.vertex_count; });
+                if ( !valid ) {
+                    ev_log_warn("[ev::tools::gltf::GLTFModelManager] Primitive has out of range indices, optimization skipped.");
+                    continue;
+                }
+                const bool triangles = task.primitive->mode == TINYGLTF_MODE_TRIANGLES || task.primitive->mode == -1;
+                const double triangle_count = static_cast<double>(task.index_count / 3);
+                if ( triangles ) {
+                    misses_before[i] = compute_acmr(task.indices.data(), task.indices.size(), task.vertices.size()) * triangle_count;
+                }
 
-    auto& attr = primitive.attributes;
+                if ( settings.mesh_optimize_flags & MeshOptimizeFlags::DeduplicateVertices ) {
+                    remap.resize(task.vertices.size());
+                    const uint32_t unique_count = generate_vertex_remap(remap.data(), task.vertices.data(), task.vertices.size(), sizeof(Vertex));
+                    if ( unique_count < task.vertices.size() ) {
+                        compacted.resize(unique_count);
+                        remap_vertices(compacted.data(), task.vertices.data(), task.vertices.size(), sizeof(Vertex), remap.data());
+                        remap_indices(task.indices.data(), task.indices.data(), task.indices.size(), remap.data());
+                        task.vertices.swap(compacted);
+                    }
+                }
+                if ( triangles && (settings.mesh_optimize_flags & MeshOptimizeFlags::OptimizeVertexCache) ) {
+                    optimize_vertex_cache(task.indices.data(), task.indices.data(), task.indices.size(), task.vertices.size());
+                }
+                if ( settings.mesh_optimize_flags & MeshOptimizeFlags::OptimizeVertexFetch ) {
+                    remap.resize(task.vertices.size());
+                    const uint32_t used_count = optimize_vertex_fetch_remap(remap.data(), task.indices.data(), task.indices.size(), task.vertices.size());
+                    compacted.resize(used_count);
+                    remap_vertices(compacted.data(), task.vertices.data(), task.vertices.size(), sizeof(Vertex), remap.data());
+                    remap_indices(task.indices.data(), task.indices.data(), task.indices.size(), remap.data());
+                    task.vertices.swap(compacted);
+                }
 
-    if ( attr.find("NORMAL") != attr.end() ) {
-        const tinygltf::Accessor& normal_accessor = gltf_model.accessors[attr.find("NORMAL")->second];
-        const tinygltf::BufferView& normal_buffer_view = gltf_model.bufferViews[normal_accessor.bufferView];
-        buffer_normal = reinterpret_cast<const float*>(& (gltf_model.buffers[normal_buffer_view.buffer].data[normal_accessor.byteOffset + normal_buffer_view.byteOffset]));
+                if ( triangles ) {
+                    misses_after[i] = compute_acmr(task.indices.data(), task.indices.size(), task.vertices.size()) * triangle_count;
+                }
+                task.vertex_count = static_cast<uint32_t>(task.vertices.size());
+            }
+        });
+        geometry.optimized = true;
+
+        // 정점 수가 줄었으므로 출력 위치를 다시 계산. 인덱스 수는 변하지 않음
+        double triangles = 0.0, before = 0.0, after = 0.0;
+        geometry.vertex_count = 0;
+        for ( size_t i = 0 ; i < geometry.tasks.size() ; ++i ) {
+            PrimitiveTask& task = geometry.tasks[i];
+            task.vertex_start = geometry.vertex_count;
+            geometry.vertex_count += task.vertex_count;
+            task.target->set_range(task.index_start, task.index_count, task.vertex_start, task.vertex_count);
+            if ( misses_before[i] > 0.0 ) {
+                triangles += task.index_count / 3;
+                before += misses_before[i];
+                after += misses_after[i];
+            }
+        }
+        if ( triangles > 0.0 ) {
+            ev_log_info("[ev::tools::gltf::GLTFModelManager] ACMR (cache size %u): %.3f -> %.3f",
+                DEFAULT_CACHE_SIZE, before / triangles, after / triangles);
+        }
     }
-    
-    if ( attr.find("TEXCOORD_0") != attr.end() ) {
-        const tinygltf::Accessor& uv_accessor = gltf_model.accessors[attr.find("TEXCOORD_0")->second];
-        const tinygltf::BufferView& uv_buffer_view = gltf_model.bufferViews[uv_accessor.bufferView];
-        buffer_uv = reinterpret_cast<const float*>(& (gltf_model.buffers[uv_buffer_view.buffer].data[uv_accessor.byteOffset + uv_buffer_view.byteOffset]));
+
+    if ( settings.geometry_heap ) {
+        // 힙 인덱스 버퍼와 형식이 같아야 힙에 올릴 수 있으므로 CompactIndices 대신 힙 형식을 따름
+        const bool fits = std::all_of(geometry.tasks.begin(), geometry.tasks.end(),
+            [](const PrimitiveTask& task) { return task.vertex_count <= 0xFFFFu; });
+        geometry.index_type = settings.geometry_heap->get_index_type() == VK_INDEX_TYPE_UINT16 && fits ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+    } else if ( settings.mesh_optimize_flags & MeshOptimizeFlags::CompactIndices ) {
+        // 0xFFFF 는 primitive restart 값과 겹치므로 로컬 인덱스 0xFFFE 까지만 허용
+        const bool fits = std::all_of(geometry.tasks.begin(), geometry.tasks.end(),
+            [](const PrimitiveTask& task) { return task.vertex_count <= 0xFFFFu; });
+        geometry.index_type = fits ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
     }
+}
+
+void GLTFModelManager::generate_lods(
+    const LoadSettings& settings,
+    ev::tools::WorkerPool& pool,
+    const tinygltf::Model& gltf_model,
+    GeometryStream& geometry
+) {
+    using namespace ev::tools::mesh_optimizer;
 
-    if ( attr.find("COLOR_0") != attr.end() ) {
-        const tinygltf::Accessor& color_accessor = gltf_model.accessors[attr.find("COLOR_0")->second];
-        const tinygltf::BufferView& color_buffer_view = gltf_model.bufferViews[color_accessor.bufferView];
-        buffer_color = reinterpret_cast<const float*>(& (gltf_model.buffers[color_buffer_view.buffer].data[color_accessor.byteOffset + color_buffer_view.byteOffset]));
-        num_color_components = color_accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT ? 4 : 3;
+    if ( settings.lod_levels <= 1 ) {
+        return;
     }
+    pool.parallel_for(static_cast<uint32_t>(geometry.tasks.size()), [&](uint32_t begin, uint32_t end) {
+        std::vector<uint32_t> lod_indices;
+        for ( uint32_t i = begin ; i < end ; ++i ) {
+            PrimitiveTask& task = geometry.tasks[i];
+            if ( !geometry.optimized ) {
+                read_primitive(gltf_model, task);
+            }
+            const bool triangles = task.primitive->mode == TINYGLTF_MODE_TRIANGLES || task.primitive->mode == -1;
+            const bool valid = std::all_of(task.indices.begin(), task.indices.end(),
+                [&](uint32_t index) { return index < task.vertex_count; });
+            if ( !triangles || !valid || task.vertices.empty() ) {
+                continue;
+            }
 
-    if ( attr.find("TANGENT") != attr.end() ) {
-        const tinygltf::Accessor& tangent_accessor = gltf_model.accessors[attr.find("TANGENT")->second];
-        const tinygltf::BufferView& tangent_buffer_view = gltf_model.bufferViews[tangent_accessor.bufferView];
-        buffer_tangent = reinterpret_cast<const float*>(& (gltf_model.buffers[tangent_buffer_view.buffer].data[tangent_accessor.byteOffset + tangent_buffer_view.byteOffset]));
+            // LOD 마다 원본에서 다시 단순화하여 오차가 누적되지 않도록 함
+            lod_indices.resize(task.index_count);
+            size_t previous_count = task.index_count;
+            float target = static_cast<float>(task.index_count);
+            for ( uint32_t level = 1 ; level < settings.lod_levels ; ++level ) {
+                target *= settings.lod_reduction;
+                const size_t target_count = static_cast<size_t>(target) / 3 * 3;
+                float error = 0.0f;
+                const size_t count = simplify(lod_indices.data(), task.indices.data(), task.index_count,
+                    &task.vertices[0].pos.x, task.vertices.size(), sizeof(Vertex), target_count, &error);
+                // 고정된 정점 때문에 더 줄어들지 않으면 중단
+                if ( count == 0 || count > previous_count * 9 / 10 ) {
+                    break;
+                }
+                if ( settings.mesh_optimize_flags & MeshOptimizeFlags::OptimizeVertexCache ) {
+                    optimize_vertex_cache(lod_indices.data(), lod_indices.data(), count, task.vertices.size());
+                }
+                Primitive::Lod lod;
+                lod.first_index = static_cast<uint32_t>(task.indices.size());
+                lod.index_count = static_cast<uint32_t>(count);
+                lod.error = error;
+                task.lods.push_back(lod);
+                task.indices.insert(task.indices.end(), lod_indices.begin(), lod_indices.begin() + count);
+                previous_count = count;
+            }
+        }
+    });
+    geometry.optimized = true;
+
+    // LOD 구간이 붙었으므로 인덱스 출력 위치를 다시 계산
+    size_t lod_index_count = 0;
+    geometry.index_count = 0;
+    for ( PrimitiveTask& task : geometry.tasks ) {
+        task.index_start = geometry.index_count;
+        geometry.index_count += static_cast<uint32_t>(task.indices.size());
+        task.target->set_range(task.index_start, task.index_count, task.vertex_start, task.vertex_count);
+        for ( const Primitive::Lod& lod : task.lods ) {
+            task.target->add_lod({ task.index_start + lod.first_index, lod.index_count, lod.error });
+            lod_index_count += lod.index_count;
+        }
     }
+    ev_log_info("[ev::tools::gltf::GLTFModelManager] Generated LOD chains (%u levels, %zu additional indices).",
+        settings.lod_levels, lod_index_count);
+}
+
+void GLTFModelManager::generate_meshlets(
+    const LoadSettings& settings,
+    ev::tools::WorkerPool& pool,
+    const tinygltf::Model& gltf_model,
+    GeometryStream& geometry,
+    std::shared_ptr<Model> model
+) {
+    using namespace ev::tools::mesh_optimizer;
 
-    if ( attr.find("JOINTS_0") != attr.end() ) {
-        const tinygltf::Accessor& joint_accessor = gltf_model.accessors[attr.find("JOINTS_0")->second];
-        const tinygltf::BufferView& joint_buffer_view = gltf_model.bufferViews[joint_accessor.bufferView];
-        buffer_joint = reinterpret_cast<const uint16_t*>(& (gltf_model.buffers[joint_buffer_view.buffer].data[joint_accessor.byteOffset + joint_buffer_view.byteOffset]));
+    if ( !settings.meshlets_enabled ) {
+        return;
     }
+    pool.parallel_for(static_cast<uint32_t>(geometry.tasks.size()), [&](uint32_t begin, uint32_t end) {
+        std::vector<Meshlet> clusters;
+        for ( uint32_t i = begin ; i < end ; ++i ) {
+            PrimitiveTask& task = geometry.tasks[i];
+            if ( !geometry.optimized ) {
+                read_primitive(gltf_model, task);
+            }
+            const bool triangles = task.primitive->mode == TINYGLTF_MODE_TRIANGLES || task.primitive->mode == -1;
+            const bool valid = std::all_of(task.indices.begin(), task.indices.begin() + task.index_count,
+                [&](uint32_t index) { return index < task.vertices.size(); });
+            if ( !triangles || !valid || task.vertices.empty() ) {
+                continue;
+            }
 
-    if (  attr.find("WEIGHTS_0") != attr.end() ) {
-        const tinygltf::Accessor& weight_accessor = gltf_model.accessors[attr.find("WEIGHTS_0")->second];
-        const tinygltf::BufferView& weight_buffer_view = gltf_model.bufferViews[weight_accessor.bufferView];
-        buffer_weight = reinterpret_cast<const float*>(& (gltf_model.buffers[weight_buffer_view.buffer].data[weight_accessor.byteOffset + weight_buffer_view.byteOffset]));
+            // LOD 0 구간만 나눔. 인덱스 순서가 유지되므로 meshlet 은 인덱스 버퍼의 연속 구간이 됨
+            clusters.clear();
+            build_meshlets(clusters, task.meshlet_vertices, task.meshlet_triangles,
+                task.indices.data(), task.index_count, task.vertices.size());
+            task.meshlets.reserve(clusters.size());
+            for ( const Meshlet& cluster : clusters ) {
+                const MeshletBounds bounds = compute_meshlet_bounds(cluster,
+                    task.meshlet_vertices.data(), task.meshlet_triangles.data(),
+                    &task.vertices[0].pos.x, sizeof(Vertex));
+                MeshletData meshlet = {};
+                meshlet.bounds = glm::vec4(glm::make_vec3(bounds.center), bounds.radius);
+                meshlet.cone = glm::vec4(glm::make_vec3(bounds.cone_axis), bounds.cone_cutoff);
+                meshlet.vertex_offset = cluster.vertex_offset;
+                meshlet.triangle_offset = cluster.triangle_offset;
+                meshlet.vertex_count = cluster.vertex_count;
+                meshlet.triangle_count = cluster.triangle_count;
+                meshlet.first_index = cluster.triangle_offset * 3;
+                task.meshlets.push_back(meshlet);
+            }
+        }
+    });
+    geometry.optimized = true;
+
+    // 프리미티브 기준 오프셋을 모델 전체 배열 기준으로 바꿔 합침
+    std::vector<MeshletData> meshlets;
+    std::vector<uint32_t> meshlet_vertices;
+    std::vector<uint8_t> meshlet_triangles;
+    for ( PrimitiveTask& task : geometry.tasks ) {
+        const uint32_t first_meshlet = static_cast<uint32_t>(meshlets.size());
+        const uint32_t vertex_base = static_cast<uint32_t>(meshlet_vertices.size());
+        const uint32_t triangle_base = static_cast<uint32_t>(meshlet_triangles.size() / 3);
+        for ( MeshletData meshlet : task.meshlets ) {
+            meshlet.vertex_offset += vertex_base;
+            meshlet.triangle_offset += triangle_base;
+            meshlet.first_index += task.index_start;
+            meshlet.first_vertex = task.vertex_start;
+            meshlets.push_back(meshlet);
+        }
+        meshlet_vertices.insert(meshlet_vertices.end(), task.meshlet_vertices.begin(), task.meshlet_vertices.end());
+        meshlet_triangles.insert(meshlet_triangles.end(), task.meshlet_triangles.begin(), task.meshlet_triangles.end());
+        task.target->set_meshlets(first_meshlet, static_cast<uint32_t>(task.meshlets.size()));
     }
+    // 셰이더는 삼각형 배열을 uint 단위로 읽음
+    const size_t triangle_bytes = meshlet_triangles.size();
+    meshlet_triangles.resize((triangle_bytes + 3) & ~size_t(3), 0);
+
+    ev_log_info("[ev::tools::gltf::GLTFModelManager] Generated %zu meshlets (%.1f vertices, %.1f triangles per meshlet).",
+        meshlets.size(),
+        meshlets.empty() ? 0.0 : static_cast<double>(meshlet_vertices.size()) / meshlets.size(),
+        meshlets.empty() ? 0.0 : static_cast<double>(triangle_bytes / 3) / meshlets.size());
+    model->set_meshlets(std::move(meshlets), std::move(meshlet_vertices), std::move(meshlet_triangles));
+}
 
-    has_skin = (buffer_joint != nullptr && buffer_weight != nullptr);
-    vertex_count = static_cast<uint32_t>(pos_accessor.count);
+void GLTFModelManager::convert_geometry(
+    const LoadSettings& settings,
+    ev::tools::WorkerPool& pool,
+    const tinygltf::Model& gltf_model,
+    const GeometryStream& geometry,
+    uint8_t* vertices,
+    void* indices
+) {
+    ev_log_info("[ev::tools::gltf::GLTFModelManager] Converting %zu primitives (%u vertices, %u indices, stride: %u)...",
+        geometry.tasks.size(), geometry.vertex_count, geometry.index_count, settings.vertex_layout.get_stride());
+
+    // 스트림별 시작 위치. 프리미티브마다 출력 구간이 겹치지 않으므로 동기화 없이 병렬로 기록
+    const bool native = settings.vertex_layout.is_native();
+    const bool compact_indices = geometry.index_type == VK_INDEX_TYPE_UINT16;
+    uint8_t* streams[VERTEX_TYPE_COUNT] = {};
+    for ( uint32_t stream = 0 ; stream < settings.vertex_layout.get_stream_count() ; ++stream ) {
+        streams[stream] = vertices + settings.vertex_layout.get_stream_offset(stream, geometry.vertex_count);
+    }
+    pool.parallel_for(static_cast<uint32_t>(geometry.tasks.size()), [&](uint32_t begin, uint32_t end) {
+        std::vector<Vertex> scratch;
+        std::vector<uint32_t> scratch_indices;
+        for ( uint32_t i = begin ; i < end ; ++i ) {
+            const PrimitiveTask& task = geometry.tasks[i];
+            const Vertex* src = task.vertices.data();
+            if ( native ) {
+                Vertex* dst = reinterpret_cast<Vertex*>(vertices) + task.vertex_start;
+                if ( geometry.optimized ) {
+                    std::memcpy(dst, src, task.vertices.size() * sizeof(Vertex));
+                } else {
+                    add_mesh_vertices(gltf_model, *task.primitive, dst);
+                }
+            } else {
+                // Vertex 로 변환한 뒤 레이아웃에 맞게 인코딩
+                uint8_t* dst[VERTEX_TYPE_COUNT] = {};
+                for ( uint32_t stream = 0 ; stream < settings.vertex_layout.get_stream_count() ; ++stream ) {
+                    dst[stream] = streams[stream] + static_cast<size_t>(task.vertex_start) * settings.vertex_layout.get_stream_stride(stream);
+                }
+                uint32_t copied = 0;
+                if ( !geometry.optimized ) {
+                    // 포맷이 같은 속성은 float 로 펼치지 않고 바로 복사
+                    copied = copy_mesh_attributes(settings.vertex_layout, gltf_model, *task.primitive, dst);
+                    scratch.resize(task.vertex_count);
+                    add_mesh_vertices(gltf_model, *task.primitive, scratch.data(), copied);
+                    src = scratch.data();
+                }
+                const Mesh::Uniform& uniform = task.mesh->get_uniform_data();
+                settings.vertex_layout.encode(src,
+                    task.vertex_count,
+                    glm::vec3(uniform.position_offset),
+                    glm::vec3(uniform.position_scale),
+                    dst,
+                    ~copied
+                );
+            }
 
-    for ( size_t i = 0 ; i < pos_accessor.count ; ++i ) {
-        Vertex vtx {};
-        vtx.pos = glm::make_vec3(&buffer_pos[i*3]);
-        vtx.normal = glm::normalize( glm::vec3( buffer_normal ? glm::make_vec3(&buffer_normal[i*3]) : glm::vec3(0.0f) ) );
-        vtx.uv = buffer_uv ? glm::make_vec2(&buffer_uv[i*2]) : glm::vec2(0.0f);
-        if ( buffer_color ) {
-            switch(num_color_components) {
-                case 3:
-                    vtx.color = glm::vec4(glm::make_vec3(&buffer_color[i*3]), 1.0f);
-                    break;
-                case 4:
-                    vtx.color = glm::make_vec4(&buffer_color[i*4]);
-                    break;
+            // 최적화된 경우 LOD 구간까지 포함
+            const uint32_t* local_indices = task.indices.data();
+            const size_t index_count = geometry.optimized ? task.indices.size() : task.index_count;
+            if ( !compact_indices ) {
+                uint32_t* dst = static_cast<uint32_t*>(indices) + task.index_start;
+                if ( geometry.optimized ) {
+                    std::memcpy(dst, local_indices, task.indices.size() * sizeof(uint32_t));
+                } else {
+                    add_mesh_indices(gltf_model, *task.primitive, dst);
+                }
+                continue;
+            }
+            if ( !geometry.optimized ) {
+                scratch_indices.resize(task.index_count);
+                add_mesh_indices(gltf_model, *task.primitive, scratch_indices.data());
+                local_indices = scratch_indices.data();
+            }
+            uint16_t* dst = static_cast<uint16_t*>(indices) + task.index_start;
+            for ( size_t index = 0 ; index < index_count ; ++index ) {
+                dst[index] = static_cast<uint16_t>(local_indices[index]);
             }
-        } else {
-            vtx.color = glm::vec4(1.0f);
         }
-        vtx.tangent = buffer_tangent ? glm::make_vec4(&buffer_tangent[i*4]) : glm::vec4(0.0f);
+    });
+}
 
-        if ( has_skin ) {
-            vtx.joint = glm::make_vec4(&buffer_joint[i*4]);
-            vtx.weight = glm::make_vec4(&buffer_weight[i*4]);
-        } else {
-            vtx.joint = glm::vec4(0.0f);
-            vtx.weight = glm::vec4(0.0f);
-        }
-        h_vertices.push_back(vtx);
+bool GLTFModelManager::reset_staging(VkDeviceSize capacity) {
+    if ( !staging_buffer ) {
+        staging_buffer = std::make_shared<ev::tools::StagingBuffer>(device, capacity);
+        return true;
+    }
+    // 이전 업로드는 모두 완료를 기다린 뒤이므로 바로 재사용 가능
+    staging_buffer->reset();
+    if ( staging_buffer->reserve(capacity) != VK_SUCCESS ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager::reset_staging] Failed to reserve staging memory (%llu bytes).", static_cast<unsigned long long>(capacity));
+        return false;
     }
+    return true;
 }
 
-void GLTFModelManager::setup_vertex_buffer(
+bool GLTFModelManager::setup_geometry_buffers(
+    const LoadSettings& settings,
     std::shared_ptr<ev::tools::gltf::Model> model,
-    std::vector<Vertex> &h_vertices
+    const std::shared_ptr<ev::tools::StagingBuffer>& staging,
+    const ev::tools::StagingBuffer::Allocation& vertices,
+    const ev::tools::StagingBuffer::Allocation& indices,
+    std::shared_ptr<ev::CommandBuffer> command_buffer
 ) {
-    ev_log_info("[ev::tools::gltf::GLTFModelManager] Setting up vertex buffer...");
+    ev_log_info("[ev::tools::gltf::GLTFModelManager] Setting up vertex and index buffers...");
+
+    if ( vertices.size == 0 || indices.size == 0 ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager] Model has no indexed geometry, skipping buffer setup.");
+        return true;
+    }
+
+    if ( settings.geometry_heap && upload_to_heap(settings.geometry_heap, model, staging, vertices, indices, command_buffer) ) {
+        return true;
+    }
 
-    std::shared_ptr<ev::Buffer> staging_buffer = std::make_shared<ev::Buffer>(
+    // save_model 에서 readback 할 수 있도록 TRANSFER_SRC 포함, mesh shader 는 정점을 storage buffer 로 읽음
+    // 스킨이 있으면 SkinningSystem 의 compute 미리 스키닝도 정점을 storage buffer 로 읽음
+    const VkBufferUsageFlags vertex_usage = model->get_meshlets().empty() && model->get_skins().empty() ? 0 : VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    std::shared_ptr<ev::Buffer> vertex_buffer = std::make_shared<ev::Buffer>(
         device,
-        h_vertices.size() * sizeof(Vertex),
-        ev::buffer_type::STAGING_BUFFER
+        vertices.size,
+        ev::buffer_type::VERTEX_BUFFER | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | vertex_usage
     );
 
-    std::shared_ptr<ev::Buffer> vertex_buffer = std::make_shared<ev::Buffer>(
+    std::shared_ptr<ev::Buffer> index_buffer = std::make_shared<ev::Buffer>(
         device,
-        h_vertices.size() * sizeof(Vertex),
-        ev::buffer_type::VERTEX_BUFFER
+        indices.size,
+        ev::buffer_type::INDEX_BUFFER | VK_BUFFER_USAGE_TRANSFER_SRC_BIT
     );
 
-    memory_allocator->allocate_buffer(vertex_buffer, ev::memory_type::GPU_ONLY);
-    memory_allocator->allocate_buffer(staging_buffer, ev::memory_type::HOST_READABLE);
-    staging_buffer->map(h_vertices.size() * sizeof(Vertex));
-    staging_buffer->write(h_vertices.data(), h_vertices.size() * sizeof(Vertex));
-    staging_buffer->flush();
-    staging_buffer->unmap();
+    if ( memory_allocator->allocate_buffer(vertex_buffer, ev::memory_type::GPU_ONLY) != VK_SUCCESS
+        || memory_allocator->allocate_buffer(index_buffer, ev::memory_type::GPU_ONLY) != VK_SUCCESS ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager] Failed to allocate vertex or index buffer memory.");
+        return false;
+    }
 
-    std::shared_ptr<ev::CommandBuffer> command_buffer = command_pool->allocate();
-    command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+    // 정점/인덱스는 이미 스테이징 메모리에 기록되어 있으므로 GPU 복사만 기록
     command_buffer->copy_buffer(
         vertex_buffer,
-        staging_buffer,
-        h_vertices.size() * sizeof(Vertex)
+        staging->get_buffer(),
+        vertices.size,
+        0,
+        vertices.offset
     );
-    command_buffer->end();
-
-    std::shared_ptr<ev::Fence> fence = std::make_shared<ev::Fence>(device);
-    fence->reset();
-
-    transfer_queue->submit(
-        command_buffer,
-        {},
-        {},
-        nullptr,
-        fence
+    command_buffer->copy_buffer(
+        index_buffer,
+        staging->get_buffer(),
+        indices.size,
+        0,
+        indices.offset
     );
-    fence->wait(UINT32_MAX);
-    transfer_queue->wait_idle(UINT32_MAX);
 
     model->set_vertex_buffer(vertex_buffer);
+    model->set_index_buffer(index_buffer);
 
-    ev_log_debug("[ev::tools::gltf::GLTFModelManager] Vertex buffer setup complete.");
+    ev_log_debug("[ev::tools::gltf::GLTFModelManager] Vertex and index buffer copies recorded (%llu + %llu bytes).",
+        static_cast<unsigned long long>(vertices.size),
+        static_cast<unsigned long long>(indices.size));
+    return true;
 }
 
-void GLTFModelManager::setup_index_buffer(
+bool GLTFModelManager::upload_to_heap(
+    const std::shared_ptr<GeometryHeap>& geometry_heap,
     std::shared_ptr<ev::tools::gltf::Model> model,
-    std::vector<uint32_t> &h_indices
+    const std::shared_ptr<ev::tools::StagingBuffer>& staging,
+    const ev::tools::StagingBuffer::Allocation& vertices,
+    const ev::tools::StagingBuffer::Allocation& indices,
+    std::shared_ptr<ev::CommandBuffer> command_buffer
 ) {
-    ev_log_info("[ev::tools::gltf::GLTFModelManager] Setting up index buffer...");
+    // 스키닝과 mesh shader 는 정점 버퍼를 모델 기준 storage buffer 로 읽으므로 모델별 버퍼 사용
+    if ( !model->get_meshlets().empty() || !model->get_skins().empty() ) {
+        ev_log_info("[ev::tools::gltf::GLTFModelManager::upload_to_heap] Model has skins or meshlets, using dedicated buffers.");
+        return false;
+    }
+    if ( !(model->get_vertex_layout() == geometry_heap->get_vertex_layout()) || model->get_index_type() != geometry_heap->get_index_type() ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager::upload_to_heap] Vertex layout or index type differs from geometry heap, using dedicated buffers.");
+        return false;
+    }
 
-    std::shared_ptr<ev::Buffer> staging_buffer = std::make_shared<ev::Buffer>(
-        device,
-        h_indices.size() * sizeof(uint32_t),
-        ev::buffer_type::STAGING_BUFFER
+    const VertexLayout& layout = model->get_vertex_layout();
+    const uint32_t vertex_count = model->get_vertex_count();
+    const uint32_t index_count = static_cast<uint32_t>(indices.size / geometry_heap->get_index_size());
+    std::shared_ptr<GeometryAllocation> allocation = geometry_heap->allocate(vertex_count, index_count);
+    if ( !allocation ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager::upload_to_heap] Geometry heap is full, using dedicated buffers.");
+        return false;
+    }
+
+    // 스테이징의 스트림들은 vertex_count 기준으로 이어져 있으므로 스트림마다 힙 영역으로 복사
+    for ( uint32_t stream = 0 ; stream < layout.get_stream_count() ; ++stream ) {
+        command_buffer->copy_buffer(
+            geometry_heap->get_vertex_buffer(),
+            staging->get_buffer(),
+            static_cast<VkDeviceSize>(vertex_count) * layout.get_stream_stride(stream),
+            geometry_heap->get_vertex_offset(stream, allocation->get_first_vertex()),
+            vertices.offset + layout.get_stream_offset(stream, vertex_count)
+        );
+    }
+    command_buffer->copy_buffer(
+        geometry_heap->get_index_buffer(),
+        staging->get_buffer(),
+        indices.size,
+        geometry_heap->get_index_offset(allocation->get_first_index()),
+        indices.offset
     );
 
-    std::shared_ptr<ev::Buffer> index_buffer = std::make_shared<ev::Buffer>(
-        device,
-        h_indices.size() * sizeof(uint32_t),
-        ev::buffer_type::INDEX_BUFFER
+    model->set_geometry_allocation(
+        allocation,
+        geometry_heap->get_vertex_buffer(),
+        geometry_heap->get_index_buffer(),
+        geometry_heap->get_vertex_stream_offsets()
     );
 
-    memory_allocator->allocate_buffer(index_buffer, ev::memory_type::GPU_ONLY);
-    memory_allocator->allocate_buffer(staging_buffer, ev::memory_type::HOST_READABLE);
-    staging_buffer->map(h_indices.size() * sizeof(uint32_t));
-    staging_buffer->write(h_indices.data(), h_indices.size() * sizeof(uint32_t));
-    staging_buffer->flush();
-    staging_buffer->unmap();
+    ev_log_debug("[ev::tools::gltf::GLTFModelManager::upload_to_heap] Recorded geometry heap upload (vertices %u+%u, indices %u+%u).",
+        allocation->get_first_vertex(), vertex_count,
+        allocation->get_first_index(), index_count);
+    return true;
+}
 
-    std::shared_ptr<ev::CommandBuffer> command_buffer = command_pool->allocate();
-    command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
-    command_buffer->copy_buffer(
-        index_buffer,
-        staging_buffer,
-        h_indices.size() * sizeof(uint32_t)
-    );
-    command_buffer->end();
-
-    std::shared_ptr<ev::Fence> fence = std::make_shared<ev::Fence>(device);
-    fence->reset();
-    transfer_queue->submit(
-        command_buffer,
-        {},
-        {},
-        nullptr,
-        fence
-    );
-    fence->wait(UINT32_MAX);
-    transfer_queue->wait_idle(UINT32_MAX);
-    model->set_index_buffer(index_buffer);
+VkDeviceSize GLTFModelManager::get_meshlet_staging_size(const Model& model) {
+    if ( model.get_meshlets().empty() ) {
+        return 0;
+    }
+    // 배열마다 16 byte 정렬 여유
+    return model.get_meshlets().size() * sizeof(MeshletData)
+        + model.get_meshlet_vertices().size() * sizeof(uint32_t)
+        + model.get_meshlet_triangles().size()
+        + 48;
+}
+
+bool GLTFModelManager::setup_meshlet_buffers(
+    std::shared_ptr<ev::tools::gltf::Model> model,
+    const std::shared_ptr<ev::tools::StagingBuffer>& staging,
+    std::shared_ptr<ev::CommandBuffer> command_buffer
+) {
+    const std::vector<MeshletData>& meshlets = model->get_meshlets();
+    if ( meshlets.empty() ) {
+        return true;
+    }
+    ev_log_info("[ev::tools::gltf::GLTFModelManager] Setting up meshlet buffers...");
+
+    const VkDeviceSize meshlet_bytes = meshlets.size() * sizeof(MeshletData);
+    const VkDeviceSize vertex_bytes = model->get_meshlet_vertices().size() * sizeof(uint32_t);
+    const VkDeviceSize triangle_bytes = model->get_meshlet_triangles().size();
+
+    // 호출한 쪽이 get_meshlet_staging_size 만큼 확보해 둔 스테이징 버퍼에 이어서 할당
+    ev::tools::StagingBuffer::Allocation meshlet_staging = staging->allocate(meshlet_bytes);
+    ev::tools::StagingBuffer::Allocation vertex_staging = staging->allocate(vertex_bytes);
+    ev::tools::StagingBuffer::Allocation triangle_staging = staging->allocate(triangle_bytes);
+    if ( !meshlet_staging || !vertex_staging || !triangle_staging ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager] Failed to allocate staging memory for meshlets.");
+        return false;
+    }
+    std::memcpy(meshlet_staging.data, meshlets.data(), meshlet_bytes);
+    std::memcpy(vertex_staging.data, model->get_meshlet_vertices().data(), vertex_bytes);
+    std::memcpy(triangle_staging.data, model->get_meshlet_triangles().data(), triangle_bytes);
+
+    std::shared_ptr<ev::Buffer> buffers[3];
+    const ev::tools::StagingBuffer::Allocation* sources[3] = { &meshlet_staging, &vertex_staging, &triangle_staging };
+    for ( int i = 0 ; i < 3 ; ++i ) {
+        buffers[i] = std::make_shared<ev::Buffer>(
+            device,
+            sources[i]->size,
+            ev::buffer_type::READONLY_STORAGE_BUFFER
+        );
+        if ( memory_allocator->allocate_buffer(buffers[i], ev::memory_type::GPU_ONLY) != VK_SUCCESS ) {
+            ev_log_error("[ev::tools::gltf::GLTFModelManager] Failed to allocate meshlet buffer memory.");
+            return false;
+        }
+        command_buffer->copy_buffer(
+            buffers[i],
+            staging->get_buffer(),
+            sources[i]->size,
+            0,
+            sources[i]->offset
+        );
+    }
 
-    ev_log_debug("[ev::tools::gltf::GLTFModelManager] Index buffer setup complete.");
+    model->set_meshlet_buffers(buffers[0], buffers[1], buffers[2]);
+
+    ev_log_debug("[ev::tools::gltf::GLTFModelManager] Meshlet buffer copies recorded (%llu + %llu + %llu bytes).",
+        static_cast<unsigned long long>(meshlet_bytes),
+        static_cast<unsigned long long>(vertex_bytes),
+        static_cast<unsigned long long>(triangle_bytes));
+    return true;
 }
 
-void GLTFModelManager::prepare_material_descriptor_sets(
+bool GLTFModelManager::prepare_material_descriptor_sets(
     std::shared_ptr<ev::tools::gltf::Model> model
 ) {
     ev_log_info("[ev::tools::gltf::GLTFModelManager::prepare_material_descriptor_sets] Preparing material descriptor sets...");
 
+    if ( bindless_materials ) {
+        bindless_materials->add_model(model);
+        ev_log_info("[ev::tools::gltf::GLTFModelManager::prepare_material_descriptor_sets] Materials registered to bindless material set.");
+        return true;
+    }
+
     std::shared_ptr<ev::DescriptorSetLayout> texture_layout
         = std::make_shared<ev::DescriptorSetLayout>(device);
 
@@ -1306,7 +3366,10 @@ void GLTFModelManager::prepare_material_descriptor_sets(
         );
     }
 
-    CHECK_RESULT(texture_layout->create_layout());
+    if ( texture_layout->create_layout() != VK_SUCCESS ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager::prepare_material_descriptor_sets] Failed to create material descriptor set layout.");
+        return false;
+    }
     model->add_descriptor_set_layout(texture_layout);
 
     for ( auto& material : model->get_materials() ) {
@@ -1336,9 +3399,10 @@ void GLTFModelManager::prepare_material_descriptor_sets(
     }
 
     ev_log_info("[ev::tools::gltf::GLTFModelManager::prepare_material_descriptor_sets] Material descriptor sets prepared successfully.");
+    return true;
 }
 
-void GLTFModelManager::prepare_node_descriptor_sets(
+bool GLTFModelManager::prepare_node_descriptor_sets(
     std::shared_ptr<ev::tools::gltf::Model> model
 ) {
     ev_log_info("[ev::tools::gltf::GLTFModelManager::prepare_node_descriptor_sets] Preparing node descriptor sets...");
@@ -1352,38 +3416,61 @@ void GLTFModelManager::prepare_node_descriptor_sets(
         1
     );
 
-    node_layout->create_layout();
+    if ( node_layout->create_layout() != VK_SUCCESS ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager::prepare_node_descriptor_sets] Failed to create node descriptor set layout.");
+        return false;
+    }
     model->add_descriptor_set_layout(node_layout);
 
-    for ( auto node : model->get_nodes() ) {
-        prepare_node_descriptor_set(model, node, node_layout);
+    // 메시가 없는 루트 아래의 메시 노드는 get_nodes 에 없으므로 모든 노드를 순회
+    for ( const auto& node : model->get_linear_nodes() ) {
+        if ( !prepare_node_descriptor_set(model, node, node_layout) ) {
+            return false;
+        }
     }
+    // 양자화 위치 복원값(position_offset / scale)과 행렬을 셰이더가 읽을 수 있도록 기록
+    model->upload_mesh_uniforms();
 
     ev_log_info("[ev::tools::gltf::GLTFModelManager::prepare_node_descriptor_sets] Node descriptor sets prepared successfully.");
+    return true;
 }
 
-void GLTFModelManager::prepare_node_descriptor_set(
+bool GLTFModelManager::prepare_node_descriptor_set(
     std::shared_ptr<ev::tools::gltf::Model> model,
     std::shared_ptr<ev::tools::gltf::Node> node,
     std::shared_ptr<ev::DescriptorSetLayout> node_layout
 ) {
-    if( node -> get_mesh() ) return;
+    // 여러 노드가 공유하는 메시는 셋을 한 번만 만듦
+    const std::shared_ptr<Mesh>& mesh = node->get_mesh();
+    if ( !mesh || mesh->get_descriptor_set() ) {
+        return true;
+    }
+
+    if ( !mesh->get_uniform_buffer() ) {
+        std::shared_ptr<ev::Buffer> uniform_buffer = std::make_shared<ev::Buffer>(
+            device,
+            sizeof(ev::tools::gltf::Mesh::Uniform),
+            ev::buffer_type::UNIFORM_BUFFER
+        );
+        if ( memory_allocator->allocate_buffer(uniform_buffer, ev::memory_type::HOST_READABLE) != VK_SUCCESS ) {
+            ev_log_error("[ev::tools::gltf::GLTFModelManager::prepare_node_descriptor_set] Failed to allocate mesh uniform buffer.");
+            return false;
+        }
+        mesh->set_uniform_buffer(uniform_buffer);
+    }
 
-    node->get_mesh()->set_descriptor_set(
+    mesh->set_descriptor_set(
         descriptor_pool->allocate(node_layout)
     );
 
     std::shared_ptr<ev::DescriptorSet> descriptor_set 
-        = node->get_mesh()->get_descriptor_set();
+        = mesh->get_descriptor_set();
 
     descriptor_set->write_buffer(
         0,
-        node->get_mesh()->get_uniform_buffer(),
+        mesh->get_uniform_buffer(),
         VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER
     );
     descriptor_set->update();
-
-    for ( auto& child : node->get_children() ) {
-        prepare_node_descriptor_set(model, child, node_layout);
-    }
+    return true;
 }
@@ -0,0 +1,952 @@
+#include "tools/ev-gltf.h"
+#include "tools/ev-gltf_cache.h"
+#include "tools/ev-geometry_heap.h"
+#include "tools/ev-hash.h"
+#include "tools/ev-mapped_file.h"
+#include "ev-macro.h"
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <unordered_map>
+
+using namespace ev::tools::gltf;
+
+namespace {
+
+inline uint64_t align_up(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+inline bool in_range(uint64_t first, uint64_t count, uint64_t total) {
+    return first <= total && count <= total - first;
+}
+
+/**
+ * @brief 섹션별 바이트 배열을 모아 캐시 파일 레이아웃을 만듭니다.
+ */
+class CacheBuilder {
+
+public:
+
+    std::vector<uint8_t> sections[cache::SECTION_COUNT];
+
+    template<typename T>
+    uint32_t push(cache::Section section, const T& record) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        std::vector<uint8_t>& bytes = sections[section];
+        const uint32_t index = static_cast<uint32_t>(bytes.size() / sizeof(T));
+        const uint8_t* src = reinterpret_cast<const uint8_t*>(&record);
+        bytes.insert(bytes.end(), src, src + sizeof(T));
+        return index;
+    }
+
+    template<typename T>
+    uint32_t count(cache::Section section) const {
+        return static_cast<uint32_t>(sections[section].size() / sizeof(T));
+    }
+
+    template<typename T>
+    T& at(cache::Section section, uint32_t index) {
+        return reinterpret_cast<T*>(sections[section].data())[index];
+    }
+
+    cache::StringRef add_string(const std::string& value) {
+        std::vector<uint8_t>& bytes = sections[cache::STRINGS];
+        cache::StringRef ref = { static_cast<uint32_t>(bytes.size()), static_cast<uint32_t>(value.size()) };
+        bytes.insert(bytes.end(), value.begin(), value.end());
+        return ref;
+    }
+
+    cache::RefRange add_refs(const std::vector<uint32_t>& refs) {
+        cache::RefRange range = { count<uint32_t>(cache::REFS), static_cast<uint32_t>(refs.size()) };
+        for ( uint32_t ref : refs ) {
+            push(cache::REFS, ref);
+        }
+        return range;
+    }
+};
+
+/**
+ * @brief mmap 한 캐시 파일의 섹션을 레코드 배열로 참조합니다. 범위를 벗어나는 참조는 모두 실패로 처리합니다.
+ */
+class CacheReader {
+
+public:
+
+    const uint8_t* data = nullptr;
+
+    cache::Header header = {};
+
+    template<typename T>
+    const T* records(cache::Section section) const {
+        return reinterpret_cast<const T*>(data + header.sections[section].offset);
+    }
+
+    template<typename T>
+    uint32_t count(cache::Section section) const {
+        return static_cast<uint32_t>(header.sections[section].size / sizeof(T));
+    }
+
+    bool valid_string(const cache::StringRef& ref) const {
+        return in_range(ref.offset, ref.length, header.sections[cache::STRINGS].size);
+    }
+
+    std::string string(const cache::StringRef& ref) const {
+        return std::string(reinterpret_cast<const char*>(data + header.sections[cache::STRINGS].offset + ref.offset), ref.length);
+    }
+
+    bool valid_refs(const cache::RefRange& range, uint32_t target_count) const {
+        if ( !in_range(range.first, range.count, count<uint32_t>(cache::REFS)) ) {
+            return false;
+        }
+        const uint32_t* refs = records<uint32_t>(cache::REFS) + range.first;
+        for ( uint32_t i = 0 ; i < range.count ; ++i ) {
+            if ( refs[i] >= target_count ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const uint32_t* refs(const cache::RefRange& range) const {
+        return records<uint32_t>(cache::REFS) + range.first;
+    }
+};
+
+bool valid_optional_index(int32_t index, uint32_t count) {
+    return index == cache::NONE || (index >= 0 && static_cast<uint32_t>(index) < count);
+}
+
+/**
+ * @brief 복원 전에 모든 레코드 간 참조를 검사합니다. 손상된 캐시로 GPU 리소스를 만들지 않기 위함입니다.
+ */
+bool validate_records(const CacheReader& reader) {
+    const uint32_t texture_count = reader.count<cache::TextureRecord>(cache::TEXTURES);
+    const uint32_t material_count = reader.count<cache::MaterialRecord>(cache::MATERIALS);
+    const uint32_t mesh_count = reader.count<cache::MeshRecord>(cache::MESHES);
+    const uint32_t primitive_count = reader.count<cache::PrimitiveRecord>(cache::PRIMITIVES);
+    const uint32_t node_count = reader.count<cache::NodeRecord>(cache::NODES);
+    const uint32_t skin_count = reader.count<cache::SkinRecord>(cache::SKINS);
+    const uint32_t animation_count = reader.count<cache::AnimationRecord>(cache::ANIMATIONS);
+    const uint32_t sampler_count = reader.count<cache::SamplerRecord>(cache::SAMPLERS);
+    const uint32_t channel_count = reader.count<cache::ChannelRecord>(cache::CHANNELS);
+    const uint32_t lod_count = reader.count<cache::LodRecord>(cache::LODS);
+    const uint32_t meshlet_count = reader.count<cache::MeshletRecord>(cache::MESHLETS);
+    const uint32_t vertex_count = reader.header.vertex_count;
+    const uint32_t index_count = static_cast<uint32_t>(reader.header.sections[cache::INDICES].size
+        / (reader.header.index_type == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t)));
+
+    // 기본 머티리얼이 항상 마지막에 있어야 함
+    if ( material_count == 0 ) {
+        return false;
+    }
+
+    const cache::DependencyRecord* dependencies = reader.records<cache::DependencyRecord>(cache::DEPENDENCIES);
+    for ( uint32_t i = 0 ; i < reader.count<cache::DependencyRecord>(cache::DEPENDENCIES) ; ++i ) {
+        if ( !reader.valid_string(dependencies[i].path) ) return false;
+    }
+
+    const cache::TextureRecord* textures = reader.records<cache::TextureRecord>(cache::TEXTURES);
+    for ( uint32_t i = 0 ; i < texture_count ; ++i ) {
+        if ( !reader.valid_string(textures[i].source) ) return false;
+        if ( textures[i].source.length == 0 && (textures[i].image_size == 0
+            || !in_range(textures[i].image_offset, textures[i].image_size, reader.header.sections[cache::IMAGES].size)) ) return false;
+    }
+
+    const cache::MaterialRecord* materials = reader.records<cache::MaterialRecord>(cache::MATERIALS);
+    for ( uint32_t i = 0 ; i < material_count ; ++i ) {
+        if ( materials[i].alpha_mode > Material::BLEND ) return false;
+        for ( int32_t texture : materials[i].textures ) {
+            if ( !valid_optional_index(texture, texture_count) ) return false;
+        }
+    }
+
+    const cache::MeshRecord* meshes = reader.records<cache::MeshRecord>(cache::MESHES);
+    for ( uint32_t i = 0 ; i < mesh_count ; ++i ) {
+        if ( !reader.valid_string(meshes[i].name) ) return false;
+        if ( !in_range(meshes[i].first_primitive, meshes[i].primitive_count, primitive_count) ) return false;
+    }
+
+    const cache::PrimitiveRecord* primitives = reader.records<cache::PrimitiveRecord>(cache::PRIMITIVES);
+    for ( uint32_t i = 0 ; i < primitive_count ; ++i ) {
+        if ( !valid_optional_index(primitives[i].material, material_count) ) return false;
+        if ( !in_range(primitives[i].first_index, primitives[i].index_count, index_count) ) return false;
+        if ( !in_range(primitives[i].first_vertex, primitives[i].vertex_count, vertex_count) ) return false;
+        if ( !in_range(primitives[i].first_lod, primitives[i].lod_count, lod_count) ) return false;
+        if ( !in_range(primitives[i].first_meshlet, primitives[i].meshlet_count, meshlet_count) ) return false;
+    }
+
+    const cache::LodRecord* lods = reader.records<cache::LodRecord>(cache::LODS);
+    for ( uint32_t i = 0 ; i < lod_count ; ++i ) {
+        if ( !in_range(lods[i].first_index, lods[i].index_count, index_count) ) return false;
+    }
+
+    const uint32_t meshlet_vertex_count = reader.count<uint32_t>(cache::MESHLET_VERTICES);
+    const uint64_t meshlet_triangle_count = reader.header.sections[cache::MESHLET_TRIANGLES].size / 3;
+    const uint32_t* meshlet_vertices = reader.records<uint32_t>(cache::MESHLET_VERTICES);
+    const uint8_t* meshlet_triangles = reader.records<uint8_t>(cache::MESHLET_TRIANGLES);
+    const cache::MeshletRecord* meshlets = reader.records<cache::MeshletRecord>(cache::MESHLETS);
+    for ( uint32_t i = 0 ; i < meshlet_count ; ++i ) {
+        const cache::MeshletRecord& meshlet = meshlets[i];
+        if ( !in_range(meshlet.vertex_offset, meshlet.vertex_count, meshlet_vertex_count) ) return false;
+        if ( !in_range(meshlet.triangle_offset, meshlet.triangle_count, meshlet_triangle_count) ) return false;
+        if ( !in_range(meshlet.first_index, static_cast<uint64_t>(meshlet.triangle_count) * 3, index_count) ) return false;
+        for ( uint32_t v = 0 ; v < meshlet.vertex_count ; ++v ) {
+            if ( static_cast<uint64_t>(meshlet.first_vertex) + meshlet_vertices[meshlet.vertex_offset + v] >= vertex_count ) return false;
+        }
+        for ( uint64_t t = 0 ; t < static_cast<uint64_t>(meshlet.triangle_count) * 3 ; ++t ) {
+            if ( meshlet_triangles[static_cast<uint64_t>(meshlet.triangle_offset) * 3 + t] >= meshlet.vertex_count ) return false;
+        }
+    }
+
+    const cache::NodeRecord* nodes = reader.records<cache::NodeRecord>(cache::NODES);
+    for ( uint32_t i = 0 ; i < node_count ; ++i ) {
+        if ( !reader.valid_string(nodes[i].name) ) return false;
+        if ( !valid_optional_index(nodes[i].parent, node_count) ) return false;
+        if ( !valid_optional_index(nodes[i].mesh, mesh_count) ) return false;
+        if ( !valid_optional_index(nodes[i].skin, skin_count) ) return false;
+        if ( !reader.valid_refs(nodes[i].children, node_count) ) return false;
+    }
+
+    const uint32_t matrix_count = static_cast<uint32_t>(reader.header.sections[cache::MATRICES].size / (16 * sizeof(float)));
+    const cache::SkinRecord* skins = reader.records<cache::SkinRecord>(cache::SKINS);
+    for ( uint32_t i = 0 ; i < skin_count ; ++i ) {
+        if ( !reader.valid_string(skins[i].name) ) return false;
+        if ( !valid_optional_index(skins[i].skeleton_root, node_count) ) return false;
+        if ( !reader.valid_refs(skins[i].joints, node_count) ) return false;
+        if ( !in_range(skins[i].first_matrix, skins[i].matrix_count, matrix_count) ) return false;
+    }
+
+    const uint32_t float_count = reader.count<float>(cache::FLOATS);
+    const uint32_t vec4_count = static_cast<uint32_t>(reader.header.sections[cache::VEC4S].size / (4 * sizeof(float)));
+    const cache::SamplerRecord* samplers = reader.records<cache::SamplerRecord>(cache::SAMPLERS);
+    for ( uint32_t i = 0 ; i < sampler_count ; ++i ) {
+        if ( samplers[i].method > Animation::AnimationSampler::CUBICSPLINE ) return false;
+        if ( !in_range(samplers[i].first_time, samplers[i].time_count, float_count) ) return false;
+        if ( !in_range(samplers[i].first_output, samplers[i].output_count, vec4_count) ) return false;
+    }
+
+    const cache::ChannelRecord* channels = reader.records<cache::ChannelRecord>(cache::CHANNELS);
+    for ( uint32_t i = 0 ; i < channel_count ; ++i ) {
+        if ( channels[i].path_type > Animation::AnimationChannel::SCALE ) return false;
+        if ( !valid_optional_index(channels[i].target_node, node_count) ) return false;
+    }
+
+    const cache::AnimationRecord* animations = reader.records<cache::AnimationRecord>(cache::ANIMATIONS);
+    for ( uint32_t i = 0 ; i < animation_count ; ++i ) {
+        if ( !reader.valid_string(animations[i].name) ) return false;
+        if ( !in_range(animations[i].first_sampler, animations[i].sampler_count, sampler_count) ) return false;
+        if ( !in_range(animations[i].first_channel, animations[i].channel_count, channel_count) ) return false;
+    }
+
+    return reader.valid_refs(reader.header.roots, node_count)
+        && reader.valid_refs(reader.header.linear_nodes, node_count)
+        && reader.valid_refs(reader.header.animations, animation_count);
+}
+
+}
+
+bool GLTFModelManager::decode_cached_model(
+    const std::filesystem::path& cache_path,
+    std::optional<uint64_t> expected_hash,
+    DecodedModel& decoded
+) {
+    const LoadSettings& settings = decoded.settings;
+    ev_log_info("[ev::tools::gltf::GLTFModelManager::decode_cached_model] Loading model cache: %s", cache_path.string().c_str());
+
+    ev::tools::MappedFile file(cache_path);
+    if ( !file.is_open() || file.get_size() < sizeof(cache::Header) ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager::decode_cached_model] Cache file is missing or truncated: %s", cache_path.string().c_str());
+        return false;
+    }
+
+    CacheReader reader;
+    reader.data = file.get_data();
+    std::memcpy(&reader.header, file.get_data(), sizeof(cache::Header));
+    const cache::Header& header = reader.header;
+
+    if ( header.magic != cache::MAGIC || header.version != cache::VERSION ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager::decode_cached_model] Cache version mismatch (version: %u, expected: %u)", header.version, cache::VERSION);
+        return false;
+    }
+    const VertexLayout layout = VertexLayout::from_key(header.vertex_layout);
+    const bool valid_layout_key = (header.vertex_layout & 0xFF80u) == 0
+        && ((header.vertex_layout >> 16) & 0xFu) <= static_cast<uint32_t>(VertexEncoding::Quantized)
+        && (header.vertex_layout >> 20) <= static_cast<uint32_t>(VertexStreams::PerAttribute);
+    if ( !valid_layout_key
+        || layout.get_stride() == 0
+        || header.vertex_size != layout.get_stride()
+        || header.sections[cache::VERTICES].size != layout.get_buffer_size(header.vertex_count) ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager::decode_cached_model] Invalid vertex layout in cache.");
+        return false;
+    }
+    if ( header.index_type != VK_INDEX_TYPE_UINT16 && header.index_type != VK_INDEX_TYPE_UINT32 ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager::decode_cached_model] Invalid index type in cache: %u", header.index_type);
+        return false;
+    }
+    if ( expected_hash && !(layout == settings.vertex_layout) ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager::decode_cached_model] Cache vertex layout differs from the requested layout.");
+        return false;
+    }
+    if ( expected_hash && settings.meshlets_enabled && header.sections[cache::MESHLETS].size == 0 ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager::decode_cached_model] Cache has no meshlets but meshlets are enabled.");
+        return false;
+    }
+    if ( expected_hash && header.source_hash != *expected_hash ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager::decode_cached_model] Cache source hash mismatch.");
+        return false;
+    }
+    for ( const cache::SectionEntry& section : header.sections ) {
+        if ( section.offset % cache::SECTION_ALIGNMENT != 0 || !in_range(section.offset, section.size, file.get_size()) ) {
+            ev_log_warn("[ev::tools::gltf::GLTFModelManager::decode_cached_model] Cache section out of bounds.");
+            return false;
+        }
+    }
+    if ( !validate_records(reader) ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager::decode_cached_model] Cache records are corrupted.");
+        return false;
+    }
+
+    if ( expected_hash ) {
+        // .bin 버퍼나 이미지만 바뀐 경우도 캐시를 무효화
+        const cache::DependencyRecord* dependencies = reader.records<cache::DependencyRecord>(cache::DEPENDENCIES);
+        for ( uint32_t i = 0 ; i < reader.count<cache::DependencyRecord>(cache::DEPENDENCIES) ; ++i ) {
+            uint64_t hash = 0;
+            std::string path = reader.string(dependencies[i].path);
+            if ( !ev::tools::hash_file(path, hash) || hash != dependencies[i].hash ) {
+                ev_log_warn("[ev::tools::gltf::GLTFModelManager::decode_cached_model] Dependency changed: %s", path.c_str());
+                return false;
+            }
+        }
+    }
+
+    std::shared_ptr<Model> model = std::make_shared<Model>(device);
+    model->set_vertex_layout(layout);
+    model->set_vertex_count(header.vertex_count);
+    model->set_index_type(static_cast<VkIndexType>(header.index_type));
+    std::vector<VkDeviceSize> stream_offsets;
+    for ( uint32_t stream = 0 ; stream < layout.get_stream_count() ; ++stream ) {
+        stream_offsets.push_back(layout.get_stream_offset(stream, header.vertex_count));
+    }
+    model->set_vertex_stream_offsets(stream_offsets);
+
+    // Textures: 원본 glTF 경로와 같이 이미지를 스테이징 메모리에 디코딩하고 텍스처는 upload_model 이 만듦
+    const cache::TextureRecord* texture_records = reader.records<cache::TextureRecord>(cache::TEXTURES);
+    const uint8_t* images = reader.records<uint8_t>(cache::IMAGES);
+    const uint32_t texture_count = reader.count<cache::TextureRecord>(cache::TEXTURES);
+    CachedImages& cached_images = decoded.cached_images;
+    decoded.gltf_model.images.resize(texture_count);
+    decoded.images.resize(texture_count);
+    cached_images.keys.resize(texture_count);
+    cached_images.hashed.resize(texture_count);
+    cached_images.hits.resize(texture_count);
+    for ( uint32_t i = 0 ; i < texture_count ; ++i ) {
+        // 원본 파일이 없는 텍스처는 캐시에 담긴 인코딩 바이트를 디코딩
+        std::string source = reader.string(texture_records[i].source);
+        std::unique_ptr<ev::tools::MappedFile> image_file;
+        const uint8_t* image_data = images + texture_records[i].image_offset;
+        size_t image_size = static_cast<size_t>(texture_records[i].image_size);
+        if ( !source.empty() ) {
+            image_file = std::make_unique<ev::tools::MappedFile>(source);
+            if ( !image_file->is_open() ) {
+                ev_log_warn("[ev::tools::gltf::GLTFModelManager::decode_cached_model] Texture source is missing: %s", source.c_str());
+                return false;
+            }
+            image_data = image_file->get_data();
+            image_size = image_file->get_size();
+        }
+        tinygltf::Image& image = decoded.gltf_model.images[i];
+        image.uri = source;
+        if ( settings.texture_cache ) {
+            cached_images.keys[i] = make_texture_key(settings, image_data, image_size);
+            cached_images.hashed[i] = true;
+            cached_images.hits[i] = settings.texture_cache->find(cached_images.keys[i]);
+            if ( cached_images.hits[i] ) {
+                continue;
+            }
+        }
+        if ( !decode_image(settings, image_data, image_size, image, decoded.images[i], decoded.image_staging) ) {
+            ev_log_warn("[ev::tools::gltf::GLTFModelManager::decode_cached_model] Failed to decode image: %s",
+                source.empty() ? (cache_path.string() + "#" + std::to_string(i)).c_str() : source.c_str());
+            return false;
+        }
+    }
+
+    // Materials: 텍스처는 업로드 후 bind_cached_material_textures 가 연결
+    const cache::MaterialRecord* material_records = reader.records<cache::MaterialRecord>(cache::MATERIALS);
+    for ( uint32_t i = 0 ; i < reader.count<cache::MaterialRecord>(cache::MATERIALS) ; ++i ) {
+        const cache::MaterialRecord& record = material_records[i];
+        std::shared_ptr<Material> material = std::make_shared<Material>(device);
+        material->set_alpha_mode(static_cast<Material::AlphaMode>(record.alpha_mode));
+        material->set_alpha_cutoff(record.alpha_cutoff);
+        material->set_metallic_factor(record.metallic_factor);
+        material->set_roughness_factor(record.roughness_factor);
+        material->set_base_color_factor(glm::make_vec4(record.base_color_factor));
+        material->set_double_sided(record.double_sided != 0);
+        model->add_material(material);
+        decoded.cached_materials.push_back(record);
+    }
+
+    // Meshes, Primitives
+    const cache::MeshRecord* mesh_records = reader.records<cache::MeshRecord>(cache::MESHES);
+    const cache::PrimitiveRecord* primitive_records = reader.records<cache::PrimitiveRecord>(cache::PRIMITIVES);
+    const cache::LodRecord* lod_records = reader.records<cache::LodRecord>(cache::LODS);
+    std::vector<std::shared_ptr<Mesh>> meshes(reader.count<cache::MeshRecord>(cache::MESHES));
+    for ( uint32_t i = 0 ; i < meshes.size() ; ++i ) {
+        const cache::MeshRecord& record = mesh_records[i];
+        std::shared_ptr<Mesh> mesh = std::make_shared<Mesh>();
+        mesh->set_name(reader.string(record.name));
+        mesh->get_uniform_data().matrix = glm::make_mat4(record.matrix);
+        mesh->get_uniform_data().position_offset = glm::vec4(glm::make_vec3(record.position_offset), 0.0f);
+        mesh->get_uniform_data().position_scale = glm::vec4(glm::make_vec3(record.position_scale), 1.0f);
+
+        for ( uint32_t p = 0 ; p < record.primitive_count ; ++p ) {
+            const cache::PrimitiveRecord& primitive = primitive_records[record.first_primitive + p];
+            std::shared_ptr<Primitive> new_primitive = std::make_shared<Primitive>(
+                primitive.first_index,
+                primitive.index_count,
+                primitive.first_vertex,
+                primitive.vertex_count,
+                primitive.material != cache::NONE ? model->get_materials()[primitive.material] : model->get_materials().back()
+            );
+            new_primitive->set_dimensions(glm::make_vec3(primitive.min), glm::make_vec3(primitive.max));
+            for ( uint32_t l = 0 ; l < primitive.lod_count ; ++l ) {
+                const cache::LodRecord& lod = lod_records[primitive.first_lod + l];
+                new_primitive->add_lod({ lod.first_index, lod.index_count, lod.error });
+            }
+            new_primitive->set_meshlets(primitive.first_meshlet, primitive.meshlet_count);
+            mesh->add_primitive(new_primitive);
+        }
+        meshes[i] = mesh;
+    }
+
+    // Nodes: 모든 노드를 먼저 만든 뒤 계층을 연결
+    const cache::NodeRecord* node_records = reader.records<cache::NodeRecord>(cache::NODES);
+    std::vector<std::shared_ptr<Node>> nodes(reader.count<cache::NodeRecord>(cache::NODES));
+    for ( uint32_t i = 0 ; i < nodes.size() ; ++i ) {
+        const cache::NodeRecord& record = node_records[i];
+        std::shared_ptr<Node> node = std::make_shared<Node>(record.index);
+        node->set_name(reader.string(record.name));
+        node->set_skin_index(record.skin_index);
+        node->set_translation(glm::make_vec3(record.translation));
+        node->set_rotation(glm::quat(record.rotation[3], record.rotation[0], record.rotation[1], record.rotation[2]));
+        node->set_scale(glm::make_vec3(record.scale));
+        node->set_matrix(glm::make_mat4(record.matrix));
+        if ( record.mesh != cache::NONE ) {
+            node->set_mesh(meshes[record.mesh]);
+        }
+        nodes[i] = node;
+    }
+    for ( uint32_t i = 0 ; i < nodes.size() ; ++i ) {
+        const cache::NodeRecord& record = node_records[i];
+        const uint32_t* children = reader.refs(record.children);
+        for ( uint32_t c = 0 ; c < record.children.count ; ++c ) {
+            nodes[i]->add_child(nodes[children[c]]);
+        }
+    }
+    // add_child 가 덮어쓴 부모를 기록된 값으로 복원
+    for ( uint32_t i = 0 ; i < nodes.size() ; ++i ) {
+        const int32_t parent = node_records[i].parent;
+        nodes[i]->set_parent(parent != cache::NONE ? nodes[parent] : nullptr);
+    }
+
+    const uint32_t* roots = reader.refs(header.roots);
+    for ( uint32_t i = 0 ; i < header.roots.count ; ++i ) {
+        model->add_node(nodes[roots[i]]);
+    }
+    const uint32_t* linear_nodes = reader.refs(header.linear_nodes);
+    for ( uint32_t i = 0 ; i < header.linear_nodes.count ; ++i ) {
+        model->add_linear_node(nodes[linear_nodes[i]]);
+    }
+
+    // Skins
+    const cache::SkinRecord* skin_records = reader.records<cache::SkinRecord>(cache::SKINS);
+    const float* matrices = reader.records<float>(cache::MATRICES);
+    std::vector<std::shared_ptr<Skin>> skins(reader.count<cache::SkinRecord>(cache::SKINS));
+    for ( uint32_t i = 0 ; i < skins.size() ; ++i ) {
+        const cache::SkinRecord& record = skin_records[i];
+        std::shared_ptr<Skin> skin = std::make_shared<Skin>(reader.string(record.name));
+        if ( record.skeleton_root != cache::NONE ) {
+            skin->set_skeleton_root(nodes[record.skeleton_root]);
+        }
+        const uint32_t* joints = reader.refs(record.joints);
+        for ( uint32_t j = 0 ; j < record.joints.count ; ++j ) {
+            skin->add_joint(nodes[joints[j]]);
+        }
+        for ( uint32_t m = 0 ; m < record.matrix_count ; ++m ) {
+            skin->add_inverse_bind_matrix(glm::make_mat4(matrices + static_cast<size_t>(record.first_matrix + m) * 16));
+        }
+        skins[i] = skin;
+        model->add_skin(skin);
+    }
+    for ( uint32_t i = 0 ; i < nodes.size() ; ++i ) {
+        if ( node_records[i].skin != cache::NONE ) {
+            nodes[i]->set_skin(skins[node_records[i].skin]);
+        }
+    }
+
+    // Animations
+    const cache::AnimationRecord* animation_records = reader.records<cache::AnimationRecord>(cache::ANIMATIONS);
+    const cache::SamplerRecord* sampler_records = reader.records<cache::SamplerRecord>(cache::SAMPLERS);
+    const cache::ChannelRecord* channel_records = reader.records<cache::ChannelRecord>(cache::CHANNELS);
+    const float* floats = reader.records<float>(cache::FLOATS);
+    const float* vec4s = reader.records<float>(cache::VEC4S);
+    std::vector<std::shared_ptr<Animation>> animations(reader.count<cache::AnimationRecord>(cache::ANIMATIONS));
+    for ( uint32_t i = 0 ; i < animations.size() ; ++i ) {
+        const cache::AnimationRecord& record = animation_records[i];
+        std::shared_ptr<Animation> animation = std::make_shared<Animation>(reader.string(record.name));
+        animation->set_start_time(record.start);
+        animation->set_end_time(record.end);
+
+        for ( uint32_t s = 0 ; s < record.sampler_count ; ++s ) {
+            const cache::SamplerRecord& sampler_record = sampler_records[record.first_sampler + s];
+            Animation::AnimationSampler sampler;
+            sampler.method = static_cast<Animation::AnimationSampler::InterpolationMethod>(sampler_record.method);
+            sampler.input_times.assign(floats + sampler_record.first_time, floats + sampler_record.first_time + sampler_record.time_count);
+            sampler.outputs.resize(sampler_record.output_count);
+            std::memcpy(sampler.outputs.data(), vec4s + static_cast<size_t>(sampler_record.first_output) * 4, sampler_record.output_count * sizeof(glm::vec4));
+            animation->add_sampler(sampler);
+        }
+        for ( uint32_t c = 0 ; c < record.channel_count ; ++c ) {
+            const cache::ChannelRecord& channel_record = channel_records[record.first_channel + c];
+            Animation::AnimationChannel channel;
+            channel.path_type = static_cast<Animation::AnimationChannel::PathType>(channel_record.path_type);
+            channel.target_node = channel_record.target_node != cache::NONE ? nodes[channel_record.target_node] : nullptr;
+            channel.sampler_index = channel_record.sampler_index;
+            animation->add_channel(channel);
+        }
+        animations[i] = animation;
+    }
+    const uint32_t* animation_refs = reader.refs(header.animations);
+    for ( uint32_t i = 0 ; i < header.animations.count ; ++i ) {
+        model->add_animation(animations[animation_refs[i]]);
+    }
+    model->build_transform_hierarchy();
+
+    // Meshlets: 컬링용 CPU 사본을 만든 뒤 정점 버퍼 생성 시 storage 용도를 결정
+    static_assert(sizeof(cache::MeshletRecord) == sizeof(MeshletData));
+    std::vector<MeshletData> meshlets(reader.count<cache::MeshletRecord>(cache::MESHLETS));
+    std::memcpy(meshlets.data(), reader.records<cache::MeshletRecord>(cache::MESHLETS), meshlets.size() * sizeof(MeshletData));
+    const uint32_t* meshlet_vertices = reader.records<uint32_t>(cache::MESHLET_VERTICES);
+    const uint8_t* meshlet_triangles = reader.records<uint8_t>(cache::MESHLET_TRIANGLES);
+    model->set_meshlets(
+        std::move(meshlets),
+        std::vector<uint32_t>(meshlet_vertices, meshlet_vertices + reader.count<uint32_t>(cache::MESHLET_VERTICES)),
+        std::vector<uint8_t>(meshlet_triangles, meshlet_triangles + header.sections[cache::MESHLET_TRIANGLES].size)
+    );
+
+    // Geometry: mmap 된 캐시에서 스테이징 메모리로 한 번만 복사. meshlet 영역은 setup_meshlet_buffers 가 같은 버퍼에서 할당
+    const cache::SectionEntry& vertex_section = header.sections[cache::VERTICES];
+    const cache::SectionEntry& index_section = header.sections[cache::INDICES];
+    decoded.staging = acquire_staging(vertex_section.size + index_section.size + 32 + get_meshlet_staging_size(*model));
+    if ( !decoded.staging ) {
+        return false;
+    }
+    decoded.vertices = decoded.staging->allocate(vertex_section.size);
+    decoded.indices = decoded.staging->allocate(index_section.size);
+    if ( !decoded.vertices || !decoded.indices ) {
+        return false;
+    }
+    std::memcpy(decoded.vertices.data, file.get_data() + vertex_section.offset, vertex_section.size);
+    std::memcpy(decoded.indices.data, file.get_data() + index_section.offset, index_section.size);
+    file.close();
+
+    decoded.model = model;
+    decoded.cached_model_path = cache_path;
+
+    ev_log_info("[ev::tools::gltf::GLTFModelManager::decode_cached_model] Model cache loaded (%zu nodes, %llu vertex bytes, %llu index bytes).",
+        nodes.size(),
+        static_cast<unsigned long long>(vertex_section.size),
+        static_cast<unsigned long long>(index_section.size));
+    return true;
+}
+
+void GLTFModelManager::bind_cached_material_textures(DecodedModel& decoded) {
+    const std::vector<std::shared_ptr<ev::Texture>>& textures = decoded.model->get_textures();
+    const std::vector<std::shared_ptr<Material>>& materials = decoded.model->get_materials();
+    for ( size_t i = 0 ; i < decoded.cached_materials.size() ; ++i ) {
+        const cache::MaterialRecord& record = decoded.cached_materials[i];
+        auto texture = [&](cache::MaterialRecord::TextureSlot slot) -> std::shared_ptr<ev::Texture> {
+            return record.textures[slot] == cache::NONE ? nullptr : textures[record.textures[slot]];
+        };
+        const std::shared_ptr<Material>& material = materials[i];
+        material->set_base_color_texture(texture(cache::MaterialRecord::BASE_COLOR));
+        material->set_metallic_roughness_texture(texture(cache::MaterialRecord::METALLIC_ROUGHNESS));
+        material->set_normal_texture(texture(cache::MaterialRecord::NORMAL));
+        material->set_occlusion_texture(texture(cache::MaterialRecord::OCCLUSION));
+        material->set_emissive_texture(texture(cache::MaterialRecord::EMISSIVE));
+        material->set_diffuse_texture(texture(cache::MaterialRecord::DIFFUSE));
+        material->set_specular_texture(texture(cache::MaterialRecord::SPECULAR));
+    }
+}
+
+bool GLTFModelManager::write_model_cache(
+    std::shared_ptr<Model> model,
+    const std::filesystem::path& cache_path,
+    uint64_t source_hash,
+    const std::vector<std::string>& dependencies,
+    const std::vector<std::span<const uint8_t>>& texture_images,
+    const void* vertices,
+    VkDeviceSize vertex_bytes,
+    const void* indices,
+    VkDeviceSize index_bytes
+) {
+    ev_log_info("[ev::tools::gltf::GLTFModelManager::write_model_cache] Writing model cache: %s", cache_path.string().c_str());
+    CacheBuilder builder;
+
+    for ( const std::string& dependency : dependencies ) {
+        cache::DependencyRecord record = {};
+        if ( !ev::tools::hash_file(dependency, record.hash) ) {
+            ev_log_warn("[ev::tools::gltf::GLTFModelManager::write_model_cache] Failed to hash dependency, cache not written: %s", dependency.c_str());
+            return false;
+        }
+        record.path = builder.add_string(dependency);
+        builder.push(cache::DEPENDENCIES, record);
+    }
+
+    // Textures: 원본 파일이 있으면 경로를, 없으면 인코딩된 이미지 바이트를 IMAGES 섹션에 기록
+    std::unordered_map<const ev::Texture*, int32_t> texture_ids;
+    const auto& textures = model->get_textures();
+    const auto& texture_sources = model->get_texture_sources();
+    std::vector<uint8_t>& images = builder.sections[cache::IMAGES];
+    for ( size_t i = 0 ; i < textures.size() ; ++i ) {
+        cache::TextureRecord record = {};
+        if ( i < texture_sources.size() && !texture_sources[i].empty() ) {
+            record.source = builder.add_string(texture_sources[i]);
+        } else if ( i < texture_images.size() && !texture_images[i].empty() ) {
+            record.image_offset = images.size();
+            record.image_size = texture_images[i].size();
+            images.insert(images.end(), texture_images[i].begin(), texture_images[i].end());
+        } else {
+            ev_log_warn("[ev::tools::gltf::GLTFModelManager::write_model_cache] Texture %zu has no source file or image data, cache not written.", i);
+            return false;
+        }
+        texture_ids[textures[i].get()] = static_cast<int32_t>(builder.push(cache::TEXTURES, record));
+    }
+    auto texture_id = [&](const std::shared_ptr<ev::Texture>& texture) -> int32_t {
+        auto it = texture ? texture_ids.find(texture.get()) : texture_ids.end();
+        return it != texture_ids.end() ? it->second : cache::NONE;
+    };
+
+    // Materials
+    std::unordered_map<const Material*, int32_t> material_ids;
+    for ( const auto& material : model->get_materials() ) {
+        cache::MaterialRecord record = {};
+        record.alpha_mode = static_cast<uint32_t>(material->get_alpha_mode());
+        record.alpha_cutoff = material->get_alpha_cutoff();
+        record.metallic_factor = material->get_metallic_factor();
+        record.roughness_factor = material->get_roughness_factor();
+        std::memcpy(record.base_color_factor, glm::value_ptr(material->get_base_color_factor()), sizeof(record.base_color_factor));
+        record.double_sided = material->is_double_sided() ? 1u : 0u;
+        record.textures[cache::MaterialRecord::BASE_COLOR] = texture_id(material->get_base_color_texture());
+        record.textures[cache::MaterialRecord::METALLIC_ROUGHNESS] = texture_id(material->get_metallic_roughness_texture());
+        record.textures[cache::MaterialRecord::NORMAL] = texture_id(material->get_normal_texture());
+        record.textures[cache::MaterialRecord::OCCLUSION] = texture_id(material->get_occlusion_texture());
+        record.textures[cache::MaterialRecord::EMISSIVE] = texture_id(material->get_emissive_texture());
+        record.textures[cache::MaterialRecord::DIFFUSE] = texture_id(material->get_diffuse_texture());
+        record.textures[cache::MaterialRecord::SPECULAR] = texture_id(material->get_specular_texture());
+        material_ids[material.get()] = static_cast<int32_t>(builder.push(cache::MATERIALS, record));
+    }
+
+    // Nodes: 모델에서 도달 가능한 모든 노드에 레코드 인덱스를 부여
+    std::vector<std::shared_ptr<Node>> nodes;
+    std::unordered_map<const Node*, uint32_t> node_ids;
+    std::function<void(const std::shared_ptr<Node>&)> collect = [&](const std::shared_ptr<Node>& node) {
+        if ( !node || node_ids.count(node.get()) ) {
+            return;
+        }
+        node_ids[node.get()] = static_cast<uint32_t>(nodes.size());
+        nodes.push_back(node);
+        if ( std::shared_ptr<Node> parent = node->get_parent().lock() ) {
+            collect(parent);
+        }
+        for ( const auto& child : node->get_children() ) {
+            collect(child);
+        }
+    };
+    for ( const auto& node : model->get_nodes() ) collect(node);
+    for ( const auto& node : model->get_linear_nodes() ) collect(node);
+    for ( const auto& skin : model->get_skins() ) {
+        collect(skin->get_skeleton_root());
+        for ( const auto& joint : skin->get_joints() ) collect(joint);
+    }
+    for ( const auto& animation : model->get_animations() ) {
+        for ( const auto& channel : animation->get_channels() ) collect(channel.target_node);
+    }
+    auto node_id = [&](const std::shared_ptr<Node>& node) -> int32_t {
+        auto it = node ? node_ids.find(node.get()) : node_ids.end();
+        return it != node_ids.end() ? static_cast<int32_t>(it->second) : cache::NONE;
+    };
+
+    // Meshes, Primitives
+    // GeometryHeap 에 올라간 모델은 프리미티브 구간이 힙 기준이므로 모델 기준으로 되돌려 기록
+    const std::shared_ptr<GeometryAllocation>& allocation = model->get_geometry_allocation();
+    const uint32_t vertex_base = allocation ? allocation->get_first_vertex() : 0;
+    const uint32_t index_base = allocation ? allocation->get_first_index() : 0;
+    std::unordered_map<const Mesh*, int32_t> mesh_ids;
+    for ( const auto& node : nodes ) {
+        const std::shared_ptr<Mesh>& mesh = node->get_mesh();
+        if ( !mesh || mesh_ids.count(mesh.get()) ) {
+            continue;
+        }
+        cache::MeshRecord record = {};
+        record.name = builder.add_string(mesh->get_name());
+        record.first_primitive = builder.count<cache::PrimitiveRecord>(cache::PRIMITIVES);
+        record.primitive_count = static_cast<uint32_t>(mesh->get_primitives().size());
+        std::memcpy(record.matrix, glm::value_ptr(mesh->get_uniform_data().matrix), sizeof(record.matrix));
+        std::memcpy(record.position_offset, glm::value_ptr(mesh->get_uniform_data().position_offset), sizeof(record.position_offset));
+        std::memcpy(record.position_scale, glm::value_ptr(mesh->get_uniform_data().position_scale), sizeof(record.position_scale));
+        for ( const auto& primitive : mesh->get_primitives() ) {
+            cache::PrimitiveRecord primitive_record = {};
+            primitive_record.first_index = primitive->get_first_index() - index_base;
+            primitive_record.index_count = primitive->get_index_count();
+            primitive_record.first_vertex = primitive->get_first_vertex() - vertex_base;
+            primitive_record.vertex_count = primitive->get_vertex_count();
+            auto material = material_ids.find(primitive->get_material().get());
+            primitive_record.material = material != material_ids.end() ? material->second : cache::NONE;
+            std::memcpy(primitive_record.min, glm::value_ptr(primitive->get_dimensions().min), sizeof(primitive_record.min));
+            std::memcpy(primitive_record.max, glm::value_ptr(primitive->get_dimensions().max), sizeof(primitive_record.max));
+            primitive_record.first_lod = builder.count<cache::LodRecord>(cache::LODS);
+            primitive_record.lod_count = static_cast<uint32_t>(primitive->get_lods().size());
+            for ( const Primitive::Lod& lod : primitive->get_lods() ) {
+                builder.push(cache::LODS, cache::LodRecord{ lod.first_index - index_base, lod.index_count, lod.error });
+            }
+            primitive_record.first_meshlet = primitive->get_first_meshlet();
+            primitive_record.meshlet_count = primitive->get_meshlet_count();
+            builder.push(cache::PRIMITIVES, primitive_record);
+        }
+        mesh_ids[mesh.get()] = static_cast<int32_t>(builder.push(cache::MESHES, record));
+    }
+
+    // Skins
+    std::unordered_map<const Skin*, int32_t> skin_ids;
+    for ( const auto& skin : model->get_skins() ) {
+        cache::SkinRecord record = {};
+        record.name = builder.add_string(skin->get_name());
+        record.skeleton_root = node_id(skin->get_skeleton_root());
+        std::vector<uint32_t> joints;
+        for ( const auto& joint : skin->get_joints() ) {
+            joints.push_back(static_cast<uint32_t>(node_id(joint)));
+        }
+        record.joints = builder.add_refs(joints);
+        record.first_matrix = static_cast<uint32_t>(builder.sections[cache::MATRICES].size() / sizeof(glm::mat4));
+        record.matrix_count = static_cast<uint32_t>(skin->get_inverse_bind_matrices().size());
+        for ( const glm::mat4& matrix : skin->get_inverse_bind_matrices() ) {
+            builder.push(cache::MATRICES, matrix);
+        }
+        skin_ids[skin.get()] = static_cast<int32_t>(builder.push(cache::SKINS, record));
+    }
+
+    for ( const auto& node : nodes ) {
+        cache::NodeRecord record = {};
+        record.name = builder.add_string(node->get_name());
+        record.index = node->get_index();
+        record.skin_index = node->get_skin_index();
+        record.parent = node_id(node->get_parent().lock());
+        auto mesh = node->get_mesh() ? mesh_ids.find(node->get_mesh().get()) : mesh_ids.end();
+        record.mesh = mesh != mesh_ids.end() ? mesh->second : cache::NONE;
+        auto skin = node->get_skin() ? skin_ids.find(node->get_skin().get()) : skin_ids.end();
+        record.skin = skin != skin_ids.end() ? skin->second : cache::NONE;
+        std::vector<uint32_t> children;
+        for ( const auto& child : node->get_children() ) {
+            children.push_back(node_ids[child.get()]);
+        }
+        record.children = builder.add_refs(children);
+        std::memcpy(record.translation, glm::value_ptr(node->get_translation()), sizeof(record.translation));
+        const glm::quat& rotation = node->get_rotation();
+        record.rotation[0] = rotation.x;
+        record.rotation[1] = rotation.y;
+        record.rotation[2] = rotation.z;
+        record.rotation[3] = rotation.w;
+        std::memcpy(record.scale, glm::value_ptr(node->get_scale()), sizeof(record.scale));
+        std::memcpy(record.matrix, glm::value_ptr(node->get_matrix()), sizeof(record.matrix));
+        builder.push(cache::NODES, record);
+    }
+
+    // Animations: 모델의 애니메이션 목록은 같은 객체를 여러 번 가질 수 있으므로 레코드와 참조 목록을 분리
+    std::unordered_map<const Animation*, uint32_t> animation_ids;
+    std::vector<uint32_t> animation_refs;
+    for ( const auto& animation : model->get_animations() ) {
+        auto it = animation_ids.find(animation.get());
+        if ( it != animation_ids.end() ) {
+            animation_refs.push_back(it->second);
+            continue;
+        }
+        cache::AnimationRecord record = {};
+        record.name = builder.add_string(animation->get_name());
+        record.start = animation->get_start_time();
+        record.end = animation->get_end_time();
+        record.first_sampler = builder.count<cache::SamplerRecord>(cache::SAMPLERS);
+        record.sampler_count = static_cast<uint32_t>(animation->get_samplers().size());
+        for ( const auto& sampler : animation->get_samplers() ) {
+            cache::SamplerRecord sampler_record = {};
+            sampler_record.method = static_cast<uint32_t>(sampler.method);
+            sampler_record.first_time = builder.count<float>(cache::FLOATS);
+            sampler_record.time_count = static_cast<uint32_t>(sampler.input_times.size());
+            for ( float time : sampler.input_times ) {
+                builder.push(cache::FLOATS, time);
+            }
+            sampler_record.first_output = static_cast<uint32_t>(builder.sections[cache::VEC4S].size() / sizeof(glm::vec4));
+            sampler_record.output_count = static_cast<uint32_t>(sampler.outputs.size());
+            for ( const glm::vec4& output : sampler.outputs ) {
+                builder.push(cache::VEC4S, output);
+            }
+            builder.push(cache::SAMPLERS, sampler_record);
+        }
+        record.first_channel = builder.count<cache::ChannelRecord>(cache::CHANNELS);
+        record.channel_count = static_cast<uint32_t>(animation->get_channels().size());
+        for ( const auto& channel : animation->get_channels() ) {
+            cache::ChannelRecord channel_record = {};
+            channel_record.path_type = static_cast<uint32_t>(channel.path_type);
+            channel_record.target_node = node_id(channel.target_node);
+            channel_record.sampler_index = channel.sampler_index;
+            builder.push(cache::CHANNELS, channel_record);
+        }
+        const uint32_t id = builder.push(cache::ANIMATIONS, record);
+        animation_ids[animation.get()] = id;
+        animation_refs.push_back(id);
+    }
+
+    cache::Header header = {};
+    header.magic = cache::MAGIC;
+    header.version = cache::VERSION;
+    header.source_hash = source_hash;
+    header.vertex_size = model->get_vertex_layout().get_stride();
+    header.vertex_layout = model->get_vertex_layout().get_key();
+    header.vertex_count = model->get_vertex_count();
+    header.index_type = model->get_index_type();
+
+    std::vector<uint32_t> roots, linear_nodes;
+    for ( const auto& node : model->get_nodes() ) roots.push_back(node_ids[node.get()]);
+    for ( const auto& node : model->get_linear_nodes() ) linear_nodes.push_back(node_ids[node.get()]);
+    header.roots = builder.add_refs(roots);
+    header.linear_nodes = builder.add_refs(linear_nodes);
+    header.animations = builder.add_refs(animation_refs);
+
+    // Meshlets: 모델 전체 배열을 그대로 기록하므로 프리미티브의 meshlet 구간을 바꾸지 않음
+    auto append_bytes = [&](cache::Section section, const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        builder.sections[section].insert(builder.sections[section].end(), bytes, bytes + size);
+    };
+    append_bytes(cache::MESHLETS, model->get_meshlets().data(), model->get_meshlets().size() * sizeof(MeshletData));
+    append_bytes(cache::MESHLET_VERTICES, model->get_meshlet_vertices().data(), model->get_meshlet_vertices().size() * sizeof(uint32_t));
+    append_bytes(cache::MESHLET_TRIANGLES, model->get_meshlet_triangles().data(), model->get_meshlet_triangles().size());
+
+    // 정점/인덱스는 호출자의 메모리에서 바로 기록
+    const uint8_t* section_data[cache::SECTION_COUNT] = {};
+    uint64_t offset = align_up(sizeof(cache::Header), cache::SECTION_ALIGNMENT);
+    for ( uint32_t i = 0 ; i < cache::SECTION_COUNT ; ++i ) {
+        uint64_t size = builder.sections[i].size();
+        section_data[i] = builder.sections[i].data();
+        if ( i == cache::VERTICES ) {
+            size = vertex_bytes;
+            section_data[i] = static_cast<const uint8_t*>(vertices);
+        } else if ( i == cache::INDICES ) {
+            size = index_bytes;
+            section_data[i] = static_cast<const uint8_t*>(indices);
+        }
+        header.sections[i] = { offset, size };
+        offset = align_up(offset + size, cache::SECTION_ALIGNMENT);
+    }
+
+    // 다른 프로세스가 쓰다 만 파일을 읽지 않도록 임시 파일에 쓴 뒤 교체
+    std::error_code error;
+    if ( cache_path.has_parent_path() ) {
+        std::filesystem::create_directories(cache_path.parent_path(), error);
+    }
+    std::filesystem::path temp_path = cache_path;
+    temp_path += ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if ( !out ) {
+            ev_log_warn("[ev::tools::gltf::GLTFModelManager::write_model_cache] Failed to open cache file: %s", temp_path.string().c_str());
+            return false;
+        }
+        static const char padding[cache::SECTION_ALIGNMENT] = {};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        uint64_t position = sizeof(header);
+        for ( uint32_t i = 0 ; i < cache::SECTION_COUNT ; ++i ) {
+            out.write(padding, static_cast<std::streamsize>(header.sections[i].offset - position));
+            if ( header.sections[i].size > 0 ) {
+                out.write(reinterpret_cast<const char*>(section_data[i]), static_cast<std::streamsize>(header.sections[i].size));
+            }
+            position = header.sections[i].offset + header.sections[i].size;
+        }
+        if ( !out ) {
+            ev_log_warn("[ev::tools::gltf::GLTFModelManager::write_model_cache] Failed to write cache file: %s", temp_path.string().c_str());
+            out.close();
+            std::filesystem::remove(temp_path, error);
+            return false;
+        }
+    }
+    std::filesystem::rename(temp_path, cache_path, error);
+    if ( error ) {
+        ev_log_warn("[ev::tools::gltf::GLTFModelManager::write_model_cache] Failed to move cache file into place: %s", error.message().c_str());
+        std::filesystem::remove(temp_path, error);
+        return false;
+    }
+
+    ev_log_info("[ev::tools::gltf::GLTFModelManager::write_model_cache] Model cache written (%llu bytes).", static_cast<unsigned long long>(offset));
+    return true;
+}
+
+bool GLTFModelManager::save_model(std::shared_ptr<Model> model, const std::string save_path) {
+    std::lock_guard<std::mutex> lock(load_mutex);
+    ev_log_info("[ev::tools::gltf::GLTFModelManager::save_model] Saving model to %s", save_path.c_str());
+
+    if ( !model ) {
+        ev_log_error("[ev::tools::gltf::GLTFModelManager::save_model] Model is null.");
+        return false;
+    }
+
+    std::shared_ptr<ev::Buffer> vertex_buffer = model->get_vertex_buffer();
+    std::shared_ptr<ev::Buffer> index_buffer = model->get_index_buffer();
+    const std::shared_ptr<GeometryAllocation>& allocation = model->get_geometry_allocation();
+    const VertexLayout& layout = model->get_vertex_layout();
+    const VkDeviceSize index_size = model->get_index_type() == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t);
+    // GeometryHeap 버퍼는 다른 모델과 공유하므로 이 모델의 구간만 읽음
+    const VkDeviceSize vertex_bytes = allocation ? layout.get_buffer_size(model->get_vertex_count()) : vertex_buffer ? vertex_buffer->get_size() : 0;
+    const VkDeviceSize index_bytes = allocation ? allocation->get_index_count() * index_size : index_buffer ? index_buffer->get_size() : 0;
+
+    // GPU_ONLY 버퍼이므로 스테이징 메모리로 읽어온 뒤 기록
+    if ( !reset_staging(vertex_bytes + index_bytes + 16) ) {
+        return false;
+    }
+    ev::tools::StagingBuffer::Allocation vertex_staging = staging_buffer->allocate(vertex_bytes);
+    ev::tools::StagingBuffer::Allocation index_staging = staging_buffer->allocate(index_bytes);
+
+    if ( vertex_bytes > 0 && index_bytes > 0 ) {
+        std::shared_ptr<ev::CommandBuffer> command_buffer = command_pool->allocate();
+        command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+        if ( allocation ) {
+            const std::vector<VkDeviceSize>& stream_offsets = model->get_vertex_stream_offsets();
+            for ( uint32_t stream = 0 ; stream < layout.get_stream_count() ; ++stream ) {
+                command_buffer->copy_buffer(staging_buffer->get_buffer(), vertex_buffer,
+                    static_cast<VkDeviceSize>(model->get_vertex_count()) * layout.get_stream_stride(stream),
+                    vertex_staging.offset + layout.get_stream_offset(stream, model->get_vertex_count()),
+                    stream_offsets[stream] + static_cast<VkDeviceSize>(allocation->get_first_vertex()) * layout.get_stream_stride(stream));
+            }
+            command_buffer->copy_buffer(staging_buffer->get_buffer(), index_buffer, index_bytes, index_staging.offset, allocation->get_first_index() * index_size);
+        } else {
+            command_buffer->copy_buffer(staging_buffer->get_buffer(), vertex_buffer, vertex_bytes, vertex_staging.offset, 0);
+            command_buffer->copy_buffer(staging_buffer->get_buffer(), index_buffer, index_bytes, index_staging.offset, 0);
+        }
+        command_buffer->end();
+
+        std::shared_ptr<ev::Fence> fence = std::make_shared<ev::Fence>(device, 0);
+        CHECK_RESULT(transfer_queue->submit(command_buffer, {}, {}, nullptr, fence));
+        CHECK_RESULT(fence->wait(UINT64_MAX));
+    }
+
+    return write_model_cache(
+        model,
+        save_path,
+        0,
+        {},
+        {},
+        vertex_staging.data,
+        vertex_bytes,
+        index_staging.data,
+        index_bytes
+    );
+}
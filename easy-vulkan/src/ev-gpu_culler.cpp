@@ -0,0 +1,271 @@
+#include "tools/ev-gpu_culler.h"
+#include "ev-macro.h"
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+
+using namespace ev::tools::gltf;
+
+GPUCuller::GPUCuller(
+    std::shared_ptr<ev::Device> device,
+    std::shared_ptr<ev::MemoryAllocator> memory_allocator,
+    std::shared_ptr<ev::Shader> shader,
+    uint32_t frame_count
+) : device(std::move(device)),
+    memory_allocator(std::move(memory_allocator)) {
+    ev_log_info("[ev::tools::gltf::GPUCuller::GPUCuller] Creating GPUCuller.");
+
+    if ( !this->device || !this->memory_allocator || !shader || frame_count == 0 ) {
+        ev_log_error("[ev::tools::gltf::GPUCuller::GPUCuller] Invalid parameters provided for GPUCuller creation.");
+        exit(EXIT_FAILURE);
+    }
+
+    compact = this->device->is_draw_indirect_count_enabled();
+    if ( !compact ) {
+        ev_log_warn("[ev::tools::gltf::GPUCuller::GPUCuller] drawIndirectCount is not enabled, culled draws are kept with zero instances.");
+    }
+    multi_draw = this->device->get_features().multiDrawIndirect == VK_TRUE;
+    if ( !compact && !multi_draw ) {
+        ev_log_warn("[ev::tools::gltf::GPUCuller::GPUCuller] multiDrawIndirect is not supported, indirect draws are recorded one by one.");
+    }
+    setup_pipeline(std::move(shader), frame_count);
+    ev_log_info("[ev::tools::gltf::GPUCuller::GPUCuller] GPUCuller created successfully.");
+}
+
+void GPUCuller::setup_pipeline(std::shared_ptr<ev::Shader> shader, uint32_t frame_count) {
+    descriptor_set_layout = std::make_shared<ev::DescriptorSetLayout>(device);
+    descriptor_set_layout->add_binding(VK_SHADER_STAGE_COMPUTE_BIT, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 0);
+    descriptor_set_layout->add_binding(VK_SHADER_STAGE_COMPUTE_BIT, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1);
+    descriptor_set_layout->add_binding(VK_SHADER_STAGE_COMPUTE_BIT, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2);
+    CHECK_RESULT(descriptor_set_layout->create_layout());
+
+    descriptor_pool = std::make_shared<ev::DescriptorPool>(device);
+    descriptor_pool->add(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 3 * frame_count);
+    CHECK_RESULT(descriptor_pool->create_pool(frame_count));
+
+    VkPushConstantRange push_constant_range = {};
+    push_constant_range.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    push_constant_range.offset = 0;
+    push_constant_range.size = sizeof(PushConstants);
+
+    pipeline_layout = std::make_shared<ev::PipelineLayout>(
+        device,
+        std::vector<std::shared_ptr<ev::DescriptorSetLayout>>{ descriptor_set_layout },
+        std::vector<VkPushConstantRange>{ push_constant_range }
+    );
+    pipeline = std::make_shared<ev::ComputePipeline>(device, pipeline_layout, shader);
+    CHECK_RESULT(pipeline->create_pipeline());
+
+    frames.resize(frame_count);
+    for ( Frame& frame : frames ) {
+        frame.descriptor_set = descriptor_pool->allocate(descriptor_set_layout);
+    }
+}
+
+uint32_t GPUCuller::add_instance(const Instance& instance) {
+    const uint32_t index = static_cast<uint32_t>(instances.size());
+    instances.push_back(instance);
+    mark_dirty(index, index + 1);
+    return index;
+}
+
+uint32_t GPUCuller::add_model(const Model& model, const glm::mat4& model_matrix, uint32_t render_flags) {
+    const uint32_t first = static_cast<uint32_t>(instances.size());
+    std::unordered_set<const Node*> visited;
+    std::vector<std::shared_ptr<Node>> stack(model.get_nodes().rbegin(), model.get_nodes().rend());
+    while ( !stack.empty() ) {
+        std::shared_ptr<Node> node = std::move(stack.back());
+        stack.pop_back();
+        if ( !visited.insert(node.get()).second ) {
+            continue;
+        }
+        const auto& children = node->get_children();
+        stack.insert(stack.end(), children.rbegin(), children.rend());
+        if ( !node->get_mesh() ) {
+            continue;
+        }
+
+        const glm::mat4 matrix = model_matrix * node->get_world_matrix();
+        for ( const auto& primitive : node->get_mesh()->get_primitives() ) {
+            if ( skip_material(*primitive->get_material(), render_flags) || primitive->get_index_count() == 0 ) {
+                continue;
+            }
+            const Primitive::Dimensions& dimensions = primitive->get_dimensions();
+            Instance instance = {};
+            instance.matrix = matrix;
+            instance.bounds = glm::vec4(dimensions.center, dimensions.radius);
+            instance.first_index = primitive->get_first_index();
+            instance.index_count = primitive->get_index_count();
+            instance.vertex_offset = static_cast<int32_t>(primitive->get_first_vertex());
+            instances.push_back(instance);
+        }
+    }
+    mark_dirty(first, static_cast<uint32_t>(instances.size()));
+    ev_log_debug("[ev::tools::gltf::GPUCuller::add_model] Added %zu instances.", instances.size() - first);
+    return first;
+}
+
+void GPUCuller::set_matrix(uint32_t index, const glm::mat4& matrix) {
+    if ( index >= instances.size() ) {
+        ev_log_error("[ev::tools::gltf::GPUCuller::set_matrix] Instance index %u is out of range.", index);
+        return;
+    }
+    instances[index].matrix = matrix;
+    mark_dirty(index, index + 1);
+}
+
+void GPUCuller::clear() {
+    instances.clear();
+    for ( Frame& frame : frames ) {
+        frame.dirty_begin = frame.dirty_end = 0;
+    }
+}
+
+void GPUCuller::mark_dirty(uint32_t begin, uint32_t end) {
+    if ( begin >= end ) {
+        return;
+    }
+    for ( Frame& frame : frames ) {
+        if ( frame.dirty_begin >= frame.dirty_end ) {
+            frame.dirty_begin = begin;
+            frame.dirty_end = end;
+        } else {
+            frame.dirty_begin = std::min(frame.dirty_begin, begin);
+            frame.dirty_end = std::max(frame.dirty_end, end);
+        }
+    }
+}
+
+void GPUCuller::reserve(Frame& frame) {
+    const uint32_t count = static_cast<uint32_t>(instances.size());
+    if ( frame.instance_buffer && frame.capacity >= count ) {
+        return;
+    }
+    // 이 프레임 번호의 이전 제출은 끝났으므로 바로 교체 가능
+    const uint32_t capacity = std::max(count + count / 2, 64u);
+    frame.instance_buffer.reset();
+    frame.command_buffer.reset();
+    frame.count_buffer.reset();
+
+    const VkDeviceSize instance_size = static_cast<VkDeviceSize>(capacity) * sizeof(Instance);
+    frame.instance_buffer = std::make_shared<ev::Buffer>(device, instance_size, ev::buffer_type::READONLY_STORAGE_BUFFER);
+    CHECK_RESULT(memory_allocator->allocate_buffer(frame.instance_buffer, ev::memory_type::HOST_READABLE));
+    CHECK_RESULT(frame.instance_buffer->map(instance_size));
+
+    const VkDeviceSize command_size = static_cast<VkDeviceSize>(capacity) * sizeof(VkDrawIndexedIndirectCommand);
+    frame.command_buffer = std::make_shared<ev::Buffer>(
+        device,
+        command_size,
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+    );
+    CHECK_RESULT(memory_allocator->allocate_buffer(frame.command_buffer, ev::memory_type::GPU_ONLY));
+
+    frame.count_buffer = std::make_shared<ev::Buffer>(
+        device,
+        sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT
+    );
+    CHECK_RESULT(memory_allocator->allocate_buffer(frame.count_buffer, ev::memory_type::GPU_ONLY));
+
+    frame.descriptor_set->write_buffer(0, frame.instance_buffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    frame.descriptor_set->write_buffer(1, frame.command_buffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    frame.descriptor_set->write_buffer(2, frame.count_buffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    CHECK_RESULT(frame.descriptor_set->update());
+
+    frame.capacity = capacity;
+    ++frame.generation;
+    frame.dirty_begin = 0;
+    frame.dirty_end = count;
+}
+
+void GPUCuller::cull(std::shared_ptr<ev::CommandBuffer> command_buffer, uint32_t frame_index, const glm::mat4& view_projection) {
+    Frame& frame = frames[frame_index];
+    const uint32_t count = static_cast<uint32_t>(instances.size());
+    frame.draw_count = count;
+    if ( count == 0 ) {
+        return;
+    }
+    reserve(frame);
+    if ( frame.dirty_begin < frame.dirty_end ) {
+        Instance* mapped = static_cast<Instance*>(frame.instance_buffer->get_mapped_ptr());
+        const uint32_t end = std::min(frame.dirty_end, count);
+        memcpy(mapped + frame.dirty_begin, instances.data() + frame.dirty_begin, static_cast<size_t>(end - frame.dirty_begin) * sizeof(Instance));
+        frame.dirty_begin = frame.dirty_end = 0;
+    }
+
+    // 이전 프레임의 indirect 읽기가 끝난 뒤 개수를 초기화하고 다시 기록
+    command_buffer->pipeline_barrier(
+        VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        {},
+        {ev::BufferMemoryBarrier(frame.count_buffer, VK_ACCESS_INDIRECT_COMMAND_READ_BIT, VK_ACCESS_TRANSFER_WRITE_BIT),
+         ev::BufferMemoryBarrier(frame.command_buffer, VK_ACCESS_INDIRECT_COMMAND_READ_BIT, VK_ACCESS_SHADER_WRITE_BIT)},
+        {}
+    );
+    command_buffer->fill_buffer(frame.count_buffer, 0, sizeof(uint32_t), 0);
+    command_buffer->pipeline_barrier(
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        {},
+        {ev::BufferMemoryBarrier(frame.count_buffer, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT)},
+        {}
+    );
+
+    PushConstants push_constants = {};
+    extract_frustum_planes(view_projection, push_constants.planes);
+    push_constants.instance_count = count;
+    push_constants.compact = compact ? 1u : 0u;
+
+    command_buffer->bind_compute_pipeline(pipeline);
+    command_buffer->bind_descriptor_sets(VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, { frame.descriptor_set });
+    command_buffer->bind_push_constants(pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, &push_constants, sizeof(PushConstants));
+    command_buffer->dispatch((count + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE);
+
+    command_buffer->pipeline_barrier(
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+        {},
+        {ev::BufferMemoryBarrier(frame.command_buffer, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT),
+         ev::BufferMemoryBarrier(frame.count_buffer, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT)},
+        {}
+    );
+}
+
+void GPUCuller::draw(std::shared_ptr<ev::CommandBuffer> command_buffer, uint32_t frame_index) {
+    const Frame& frame = frames[frame_index];
+    if ( frame.draw_count == 0 ) {
+        return;
+    }
+    if ( compact ) {
+        command_buffer->draw_indexed_indirect_count(frame.command_buffer, 0, frame.count_buffer, 0, frame.draw_count);
+    } else if ( multi_draw ) {
+        command_buffer->draw_indexed_indirect(frame.command_buffer, 0, frame.draw_count);
+    } else {
+        for ( uint32_t i = 0 ; i < frame.draw_count ; ++i ) {
+            command_buffer->draw_indexed_indirect(frame.command_buffer, static_cast<VkDeviceSize>(i) * sizeof(VkDrawIndexedIndirectCommand), 1);
+        }
+    }
+}
+
+void GPUCuller::destroy() {
+    for ( Frame& frame : frames ) {
+        frame.descriptor_set.reset();
+        if ( frame.instance_buffer ) {
+            frame.instance_buffer->unmap();
+        }
+        frame.instance_buffer.reset();
+        frame.command_buffer.reset();
+        frame.count_buffer.reset();
+    }
+    frames.clear();
+    instances.clear();
+    pipeline.reset();
+    pipeline_layout.reset();
+    descriptor_pool.reset();
+    descriptor_set_layout.reset();
+    ev_log_debug("[ev::tools::gltf::GPUCuller::destroy] GPUCuller destroyed.");
+}
+
+GPUCuller::~GPUCuller() {
+    destroy();
+}
@@ -0,0 +1,104 @@
+#include "tools/ev-mapped_file.h"
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+using namespace ev::tools;
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+    ev_log_debug("[ev::tools::MappedFile::MappedFile] Mapping file: %s", path.string().c_str());
+#if defined(_WIN32)
+    HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if ( file == INVALID_HANDLE_VALUE ) {
+        ev_log_error("[ev::tools::MappedFile::MappedFile] Failed to open file: %s", path.string().c_str());
+        return;
+    }
+    file_handle = file;
+
+    LARGE_INTEGER file_size = {};
+    GetFileSizeEx(file, &file_size);
+    size = static_cast<size_t>(file_size.QuadPart);
+    if ( size == 0 ) {
+        return;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if ( mapping == nullptr ) {
+        ev_log_error("[ev::tools::MappedFile::MappedFile] Failed to create file mapping: %s", path.string().c_str());
+        close();
+        return;
+    }
+    mapping_handle = mapping;
+    data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+    fd = ::open(path.c_str(), O_RDONLY);
+    if ( fd < 0 ) {
+        ev_log_error("[ev::tools::MappedFile::MappedFile] Failed to open file: %s", path.string().c_str());
+        return;
+    }
+
+    struct stat st = {};
+    if ( fstat(fd, &st) != 0 ) {
+        ev_log_error("[ev::tools::MappedFile::MappedFile] Failed to stat file: %s", path.string().c_str());
+        close();
+        return;
+    }
+    size = static_cast<size_t>(st.st_size);
+    if ( size == 0 ) {
+        return;
+    }
+
+    void* ptr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if ( ptr == MAP_FAILED ) {
+        ptr = nullptr;
+    } else {
+        // 스테이징 복사는 처음부터 끝까지 한 번만 읽으므로 read-ahead 를 요청
+        madvise(ptr, size, MADV_SEQUENTIAL);
+    }
+    data = static_cast<const uint8_t*>(ptr);
+#endif
+
+    if ( data == nullptr ) {
+        ev_log_error("[ev::tools::MappedFile::MappedFile] Failed to map file: %s", path.string().c_str());
+        close();
+    }
+}
+
+void MappedFile::close() {
+#if defined(_WIN32)
+    if ( data ) {
+        UnmapViewOfFile(data);
+    }
+    if ( mapping_handle ) {
+        CloseHandle(static_cast<HANDLE>(mapping_handle));
+        mapping_handle = nullptr;
+    }
+    if ( file_handle ) {
+        CloseHandle(static_cast<HANDLE>(file_handle));
+        file_handle = nullptr;
+    }
+#else
+    if ( data ) {
+        munmap(const_cast<uint8_t*>(data), size);
+    }
+    if ( fd >= 0 ) {
+        ::close(fd);
+        fd = -1;
+    }
+#endif
+    data = nullptr;
+    size = 0;
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
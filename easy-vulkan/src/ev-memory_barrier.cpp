@@ -0,0 +1,14 @@
+#include "ev-sync.h"
+
+using namespace ev;
+
+MemoryBarrier::MemoryBarrier(
+    VkAccessFlags src_access_mask,
+    VkAccessFlags dst_access_mask,
+    void* next
+) {
+    memory_barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memory_barrier.pNext = next;
+    memory_barrier.srcAccessMask = src_access_mask;
+    memory_barrier.dstAccessMask = dst_access_mask;
+}
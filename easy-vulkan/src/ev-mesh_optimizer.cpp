@@ -0,0 +1,554 @@
+#include "tools/ev-mesh_optimizer.h"
+#include "tools/ev-hash.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <unordered_set>
+#include <vector>
+
+using namespace ev::tools::mesh_optimizer;
+
+namespace {
+
+/**
+ * @brief 평면까지 거리 제곱의 합을 나타내는 대칭 4x4 행렬 (Garland & Heckbert 1997)
+ * @details weight 는 누적된 삼각형 면적으로, 오차를 면적 가중 평균 거리로 정규화하는 데 사용합니다.
+ */
+struct Quadric {
+    double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+    double b0 = 0, b1 = 0, b2 = 0;
+    double c = 0;
+    double weight = 0;
+
+    void add_plane(const double n[3], double d, double w) {
+        a00 += w * n[0] * n[0]; a01 += w * n[0] * n[1]; a02 += w * n[0] * n[2];
+        a11 += w * n[1] * n[1]; a12 += w * n[1] * n[2]; a22 += w * n[2] * n[2];
+        b0 += w * n[0] * d; b1 += w * n[1] * d; b2 += w * n[2] * d;
+        c += w * d * d;
+        weight += w;
+    }
+
+    Quadric& operator+=(const Quadric& other) {
+        a00 += other.a00; a01 += other.a01; a02 += other.a02;
+        a11 += other.a11; a12 += other.a12; a22 += other.a22;
+        b0 += other.b0; b1 += other.b1; b2 += other.b2;
+        c += other.c;
+        weight += other.weight;
+        return *this;
+    }
+
+    double evaluate(const float p[3]) const {
+        const double x = p[0], y = p[1], z = p[2];
+        return a00 * x * x + a11 * y * y + a22 * z * z
+            + 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z)
+            + 2.0 * (b0 * x + b1 * y + b2 * z)
+            + c;
+    }
+};
+
+void triangle_normal(const float* p0, const float* p1, const float* p2, double n[3]) {
+    const double e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+    const double e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+    n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+    n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+    n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+}
+
+}
+
+uint32_t ev::tools::mesh_optimizer::generate_vertex_remap(uint32_t* remap, const void* vertices, size_t vertex_count, size_t vertex_size) {
+    const uint8_t* data = static_cast<const uint8_t*>(vertices);
+
+    // open addressing 해시 테이블. 슬롯에는 처음 등장한 정점의 원본 인덱스를 저장
+    size_t table_size = 1;
+    while ( table_size < vertex_count * 2 ) {
+        table_size <<= 1;
+    }
+    std::vector<uint32_t> table(table_size, INVALID_INDEX);
+
+    uint32_t unique_count = 0;
+    for ( size_t i = 0 ; i < vertex_count ; ++i ) {
+        const uint8_t* vertex = data + i * vertex_size;
+        size_t slot = ev::tools::hash64(vertex, vertex_size) & (table_size - 1);
+        while ( table[slot] != INVALID_INDEX && std::memcmp(data + static_cast<size_t>(table[slot]) * vertex_size, vertex, vertex_size) != 0 ) {
+            slot = (slot + 1) & (table_size - 1);
+        }
+        if ( table[slot] == INVALID_INDEX ) {
+            table[slot] = static_cast<uint32_t>(i);
+            remap[i] = unique_count++;
+        } else {
+            remap[i] = remap[table[slot]];
+        }
+    }
+    return unique_count;
+}
+
+void ev::tools::mesh_optimizer::remap_vertices(void* dst, const void* src, size_t vertex_count, size_t vertex_size, const uint32_t* remap) {
+    uint8_t* out = static_cast<uint8_t*>(dst);
+    const uint8_t* in = static_cast<const uint8_t*>(src);
+    for ( size_t i = 0 ; i < vertex_count ; ++i ) {
+        if ( remap[i] != INVALID_INDEX ) {
+            std::memcpy(out + static_cast<size_t>(remap[i]) * vertex_size, in + i * vertex_size, vertex_size);
+        }
+    }
+}
+
+void ev::tools::mesh_optimizer::remap_indices(uint32_t* dst, const uint32_t* indices, size_t index_count, const uint32_t* remap) {
+    for ( size_t i = 0 ; i < index_count ; ++i ) {
+        dst[i] = remap[indices[i]];
+    }
+}
+
+void ev::tools::mesh_optimizer::optimize_vertex_cache(uint32_t* dst, const uint32_t* indices, size_t index_count, size_t vertex_count, uint32_t cache_size) {
+    const size_t triangle_count = index_count / 3;
+    if ( triangle_count == 0 || index_count % 3 != 0 ) {
+        if ( dst != indices ) {
+            std::memmove(dst, indices, index_count * sizeof(uint32_t));
+        }
+        return;
+    }
+    // 제자리 실행을 위해 입력을 복사
+    const std::vector<uint32_t> source(indices, indices + index_count);
+
+    // 정점 -> 인접 삼각형 목록 (CSR)
+    std::vector<uint32_t> live(vertex_count, 0);
+    for ( uint32_t index : source ) {
+        live[index]++;
+    }
+    std::vector<uint32_t> adjacency_offsets(vertex_count + 1, 0);
+    for ( size_t v = 0 ; v < vertex_count ; ++v ) {
+        adjacency_offsets[v + 1] = adjacency_offsets[v] + live[v];
+    }
+    std::vector<uint32_t> adjacency(index_count);
+    {
+        std::vector<uint32_t> fill(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+        for ( size_t i = 0 ; i < index_count ; ++i ) {
+            adjacency[fill[source[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+    }
+
+    // time - cache_time[v] < cache_size 이면 캐시에 남아 있는 정점
+    std::vector<uint32_t> cache_time(vertex_count, 0);
+    uint32_t time = cache_size + 1;
+    std::vector<bool> emitted(triangle_count, false);
+    std::vector<uint32_t> dead_end;
+    dead_end.reserve(index_count);
+    std::vector<uint32_t> candidates;
+
+    size_t output = 0;
+    size_t cursor = 0;
+    int64_t fan = source[0];
+    while ( fan >= 0 ) {
+        candidates.clear();
+        for ( uint32_t a = adjacency_offsets[fan] ; a < adjacency_offsets[fan + 1] ; ++a ) {
+            const uint32_t triangle = adjacency[a];
+            if ( emitted[triangle] ) {
+                continue;
+            }
+            for ( int k = 0 ; k < 3 ; ++k ) {
+                const uint32_t v = source[triangle * 3 + k];
+                dst[output++] = v;
+                dead_end.push_back(v);
+                candidates.push_back(v);
+                live[v]--;
+                if ( time - cache_time[v] > cache_size ) {
+                    cache_time[v] = time++;
+                }
+            }
+            emitted[triangle] = true;
+        }
+
+        // 캐시에 남아 있을 정점 중 가장 오래된 것을 다음 fan 으로 선택
+        fan = -1;
+        int64_t best_priority = -1;
+        for ( uint32_t v : candidates ) {
+            if ( live[v] == 0 ) {
+                continue;
+            }
+            int64_t priority = 0;
+            if ( time - cache_time[v] + 2 * live[v] <= cache_size ) {
+                priority = time - cache_time[v];
+            }
+            if ( priority > best_priority ) {
+                best_priority = priority;
+                fan = v;
+            }
+        }
+        if ( fan >= 0 ) {
+            continue;
+        }
+        // 막다른 곳: 최근 출력한 정점, 그다음 아직 남은 정점 순서로 탐색
+        while ( !dead_end.empty() ) {
+            const uint32_t v = dead_end.back();
+            dead_end.pop_back();
+            if ( live[v] > 0 ) {
+                fan = v;
+                break;
+            }
+        }
+        while ( fan < 0 && cursor < vertex_count ) {
+            if ( live[cursor] > 0 ) {
+                fan = static_cast<int64_t>(cursor);
+            }
+            ++cursor;
+        }
+    }
+}
+
+uint32_t ev::tools::mesh_optimizer::optimize_vertex_fetch_remap(uint32_t* remap, const uint32_t* indices, size_t index_count, size_t vertex_count) {
+    for ( size_t v = 0 ; v < vertex_count ; ++v ) {
+        remap[v] = INVALID_INDEX;
+    }
+    uint32_t next = 0;
+    for ( size_t i = 0 ; i < index_count ; ++i ) {
+        if ( remap[indices[i]] == INVALID_INDEX ) {
+            remap[indices[i]] = next++;
+        }
+    }
+    return next;
+}
+
+float ev::tools::mesh_optimizer::compute_acmr(const uint32_t* indices, size_t index_count, size_t vertex_count, uint32_t cache_size) {
+    const size_t triangle_count = index_count / 3;
+    if ( triangle_count == 0 ) {
+        return 0.0f;
+    }
+    // 미스가 날 때만 시간이 흐르는 FIFO 캐시
+    std::vector<uint32_t> cache_time(vertex_count, 0);
+    uint32_t time = cache_size + 1;
+    uint32_t misses = 0;
+    for ( size_t i = 0 ; i < triangle_count * 3 ; ++i ) {
+        const uint32_t v = indices[i];
+        if ( time - cache_time[v] > cache_size ) {
+            cache_time[v] = time++;
+            misses++;
+        }
+    }
+    return static_cast<float>(misses) / static_cast<float>(triangle_count);
+}
+
+size_t ev::tools::mesh_optimizer::simplify(uint32_t* dst, const uint32_t* indices, size_t index_count,
+    const float* positions, size_t vertex_count, size_t position_stride,
+    size_t target_index_count, float* result_error) {
+    std::vector<uint32_t> result(indices, indices + index_count);
+    if ( result_error ) {
+        *result_error = 0.0f;
+    }
+    if ( index_count % 3 != 0 ) {
+        std::memcpy(dst, result.data(), index_count * sizeof(uint32_t));
+        return index_count;
+    }
+    auto position = [&](uint32_t v) {
+        return reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(positions) + static_cast<size_t>(v) * position_stride);
+    };
+
+    // 같은 위치의 정점을 하나의 그룹으로 묶음. 그룹에 정점이 둘 이상이면 속성 seam
+    std::vector<float> packed(vertex_count * 3);
+    for ( size_t v = 0 ; v < vertex_count ; ++v ) {
+        std::memcpy(&packed[v * 3], position(static_cast<uint32_t>(v)), sizeof(float) * 3);
+    }
+    std::vector<uint32_t> group(vertex_count);
+    const uint32_t group_count = generate_vertex_remap(group.data(), packed.data(), vertex_count, sizeof(float) * 3);
+    std::vector<uint32_t> group_size(group_count, 0);
+    for ( uint32_t g : group ) {
+        group_size[g]++;
+    }
+    std::vector<uint8_t> locked(vertex_count, 0);
+    for ( size_t v = 0 ; v < vertex_count ; ++v ) {
+        locked[v] = group_size[group[v]] > 1;
+    }
+
+    // 반대 방향 edge 가 없는 edge 는 경계. seam 을 경계로 오인하지 않도록 위치 그룹 기준으로 판단
+    std::unordered_set<uint64_t> edges;
+    edges.reserve(index_count * 2);
+    auto edge_key = [](uint32_t a, uint32_t b) { return (static_cast<uint64_t>(a) << 32) | b; };
+    for ( size_t i = 0 ; i < index_count ; i += 3 ) {
+        for ( int k = 0 ; k < 3 ; ++k ) {
+            edges.insert(edge_key(group[result[i + k]], group[result[i + (k + 1) % 3]]));
+        }
+    }
+    for ( size_t i = 0 ; i < index_count ; i += 3 ) {
+        for ( int k = 0 ; k < 3 ; ++k ) {
+            const uint32_t a = result[i + k];
+            const uint32_t b = result[i + (k + 1) % 3];
+            if ( !edges.count(edge_key(group[b], group[a])) ) {
+                locked[a] = 1;
+                locked[b] = 1;
+            }
+        }
+    }
+
+    // 면적 가중 평면 quadric
+    std::vector<Quadric> quadrics(vertex_count);
+    for ( size_t i = 0 ; i < index_count ; i += 3 ) {
+        double n[3];
+        triangle_normal(position(result[i]), position(result[i + 1]), position(result[i + 2]), n);
+        const double length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if ( length == 0.0 ) {
+            continue;
+        }
+        for ( double& c : n ) c /= length;
+        const float* p0 = position(result[i]);
+        const double d = -(n[0] * p0[0] + n[1] * p0[1] + n[2] * p0[2]);
+        for ( int k = 0 ; k < 3 ; ++k ) {
+            quadrics[result[i + k]].add_plane(n, d, length * 0.5);
+        }
+    }
+
+    struct Collapse {
+        uint32_t source;
+        uint32_t target;
+        double error;
+    };
+    auto collapse_error = [&](uint32_t source, uint32_t target) {
+        Quadric q = quadrics[source];
+        q += quadrics[target];
+        return q.weight > 0.0 ? std::sqrt(std::max(q.evaluate(position(target)) / q.weight, 0.0)) : 0.0;
+    };
+
+    double max_error = 0.0;
+    std::vector<uint32_t> remap(vertex_count);
+    std::vector<uint8_t> touched(vertex_count);
+    std::vector<uint32_t> adjacency_offsets(vertex_count + 1);
+    std::vector<uint32_t> adjacency;
+    std::vector<Collapse> collapses;
+    while ( result.size() > target_index_count ) {
+        // 정점 -> 인접 삼각형 (CSR)
+        std::fill(adjacency_offsets.begin(), adjacency_offsets.end(), 0);
+        for ( uint32_t v : result ) {
+            adjacency_offsets[v + 1]++;
+        }
+        for ( size_t v = 0 ; v < vertex_count ; ++v ) {
+            adjacency_offsets[v + 1] += adjacency_offsets[v];
+        }
+        adjacency.resize(result.size());
+        {
+            std::vector<uint32_t> fill(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+            for ( size_t i = 0 ; i < result.size() ; ++i ) {
+                adjacency[fill[result[i]]++] = static_cast<uint32_t>(i / 3);
+            }
+        }
+
+        collapses.clear();
+        for ( size_t i = 0 ; i < result.size() ; i += 3 ) {
+            for ( int k = 0 ; k < 3 ; ++k ) {
+                const uint32_t a = result[i + k];
+                const uint32_t b = result[i + (k + 1) % 3];
+                if ( !locked[a] ) collapses.push_back({ a, b, collapse_error(a, b) });
+                if ( !locked[b] ) collapses.push_back({ b, a, collapse_error(b, a) });
+            }
+        }
+        if ( collapses.empty() ) {
+            break;
+        }
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& l, const Collapse& r) { return l.error < r.error; });
+
+        // 한 패스에서는 서로 영향을 주지 않는 collapse 만 수행 (source 의 1-ring 을 잠금)
+        for ( size_t v = 0 ; v < vertex_count ; ++v ) {
+            remap[v] = static_cast<uint32_t>(v);
+        }
+        std::fill(touched.begin(), touched.end(), 0);
+        const size_t triangle_goal = (result.size() - target_index_count + 2) / 3;
+        size_t removed = 0;
+        for ( const Collapse& collapse : collapses ) {
+            if ( removed >= triangle_goal ) {
+                break;
+            }
+            if ( touched[collapse.source] || touched[collapse.target] ) {
+                continue;
+            }
+
+            // source 를 target 위치로 옮겼을 때 뒤집히는 삼각형이 있으면 건너뜀
+            bool flipped = false;
+            size_t collapsed_triangles = 0;
+            for ( uint32_t a = adjacency_offsets[collapse.source] ; a < adjacency_offsets[collapse.source + 1] && !flipped ; ++a ) {
+                const uint32_t* triangle = &result[adjacency[a] * 3];
+                if ( triangle[0] == collapse.target || triangle[1] == collapse.target || triangle[2] == collapse.target ) {
+                    collapsed_triangles++;
+                    continue;
+                }
+                const float* before[3];
+                const float* after[3];
+                for ( int k = 0 ; k < 3 ; ++k ) {
+                    before[k] = position(triangle[k]);
+                    after[k] = triangle[k] == collapse.source ? position(collapse.target) : before[k];
+                }
+                double n0[3], n1[3];
+                triangle_normal(before[0], before[1], before[2], n0);
+                triangle_normal(after[0], after[1], after[2], n1);
+                flipped = n0[0] * n1[0] + n0[1] * n1[1] + n0[2] * n1[2] <= 0.0;
+            }
+            if ( flipped ) {
+                continue;
+            }
+
+            remap[collapse.source] = collapse.target;
+            quadrics[collapse.target] += quadrics[collapse.source];
+            max_error = std::max(max_error, collapse.error);
+            removed += collapsed_triangles;
+            for ( uint32_t a = adjacency_offsets[collapse.source] ; a < adjacency_offsets[collapse.source + 1] ; ++a ) {
+                const uint32_t* triangle = &result[adjacency[a] * 3];
+                touched[triangle[0]] = touched[triangle[1]] = touched[triangle[2]] = 1;
+            }
+        }
+        if ( removed == 0 ) {
+            break;
+        }
+
+        // remap 적용 후 퇴화 삼각형 제거
+        size_t write = 0;
+        for ( size_t i = 0 ; i < result.size() ; i += 3 ) {
+            const uint32_t a = remap[result[i]];
+            const uint32_t b = remap[result[i + 1]];
+            const uint32_t c = remap[result[i + 2]];
+            if ( a == b || b == c || c == a ) {
+                continue;
+            }
+            result[write++] = a;
+            result[write++] = b;
+            result[write++] = c;
+        }
+        result.resize(write);
+    }
+
+    std::memcpy(dst, result.data(), result.size() * sizeof(uint32_t));
+    if ( result_error ) {
+        *result_error = static_cast<float>(max_error);
+    }
+    return result.size();
+}
+
+size_t ev::tools::mesh_optimizer::build_meshlets(std::vector<Meshlet>& meshlets,
+    std::vector<uint32_t>& meshlet_vertices,
+    std::vector<uint8_t>& meshlet_triangles,
+    const uint32_t* indices, size_t index_count, size_t vertex_count,
+    uint32_t max_vertices, uint32_t max_triangles) {
+    const size_t first_meshlet = meshlets.size();
+    const uint32_t base_triangle = static_cast<uint32_t>(meshlet_triangles.size() / 3);
+
+    // 현재 meshlet 에서의 정점 번호. 다른 meshlet 의 값은 generation 으로 구분
+    std::vector<uint8_t> local(vertex_count, 0);
+    std::vector<uint32_t> generation(vertex_count, 0);
+    uint32_t current = 1;
+
+    Meshlet meshlet = { static_cast<uint32_t>(meshlet_vertices.size()), base_triangle, 0, 0 };
+    for ( size_t i = 0 ; i + 2 < index_count ; i += 3 ) {
+        uint32_t new_vertices = 0;
+        for ( int k = 0 ; k < 3 ; ++k ) {
+            const uint32_t v = indices[i + k];
+            // 같은 삼각형 안에서 반복되는 정점은 한 번만 셈
+            bool repeated = false;
+            for ( int j = 0 ; j < k ; ++j ) {
+                repeated |= indices[i + j] == v;
+            }
+            new_vertices += (generation[v] != current && !repeated) ? 1 : 0;
+        }
+        if ( meshlet.vertex_count + new_vertices > max_vertices || meshlet.triangle_count + 1 > max_triangles ) {
+            meshlets.push_back(meshlet);
+            meshlet = { static_cast<uint32_t>(meshlet_vertices.size()), meshlet.triangle_offset + meshlet.triangle_count, 0, 0 };
+            current++;
+        }
+        for ( int k = 0 ; k < 3 ; ++k ) {
+            const uint32_t v = indices[i + k];
+            if ( generation[v] != current ) {
+                generation[v] = current;
+                local[v] = static_cast<uint8_t>(meshlet.vertex_count++);
+                meshlet_vertices.push_back(v);
+            }
+            meshlet_triangles.push_back(local[v]);
+        }
+        meshlet.triangle_count++;
+    }
+    if ( meshlet.triangle_count > 0 ) {
+        meshlets.push_back(meshlet);
+    }
+    return meshlets.size() - first_meshlet;
+}
+
+ev::tools::mesh_optimizer::MeshletBounds ev::tools::mesh_optimizer::compute_meshlet_bounds(const Meshlet& meshlet,
+    const uint32_t* meshlet_vertices,
+    const uint8_t* meshlet_triangles,
+    const float* positions, size_t position_stride) {
+    auto position = [&](uint32_t local) {
+        const uint32_t v = meshlet_vertices[meshlet.vertex_offset + local];
+        return reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(positions) + static_cast<size_t>(v) * position_stride);
+    };
+
+    MeshletBounds bounds = {};
+    if ( meshlet.vertex_count == 0 ) {
+        bounds.cone_cutoff = 1.0f;
+        return bounds;
+    }
+
+    // AABB 중심 기준 bounding sphere
+    float min[3] = { position(0)[0], position(0)[1], position(0)[2] };
+    float max[3] = { min[0], min[1], min[2] };
+    for ( uint32_t i = 1 ; i < meshlet.vertex_count ; ++i ) {
+        const float* p = position(i);
+        for ( int c = 0 ; c < 3 ; ++c ) {
+            min[c] = std::min(min[c], p[c]);
+            max[c] = std::max(max[c], p[c]);
+        }
+    }
+    for ( int c = 0 ; c < 3 ; ++c ) {
+        bounds.center[c] = (min[c] + max[c]) * 0.5f;
+    }
+    float radius_sq = 0.0f;
+    for ( uint32_t i = 0 ; i < meshlet.vertex_count ; ++i ) {
+        const float* p = position(i);
+        const float dx = p[0] - bounds.center[0], dy = p[1] - bounds.center[1], dz = p[2] - bounds.center[2];
+        radius_sq = std::max(radius_sq, dx * dx + dy * dy + dz * dz);
+    }
+    bounds.radius = std::sqrt(radius_sq);
+
+    // 법선 cone: 단위 법선 평균을 축으로, 축과 가장 많이 벌어진 법선으로 반각을 정함
+    std::vector<std::array<double, 3>> normals;
+    normals.reserve(meshlet.triangle_count);
+    double axis[3] = { 0.0, 0.0, 0.0 };
+    const uint8_t* triangles = meshlet_triangles + static_cast<size_t>(meshlet.triangle_offset) * 3;
+    for ( uint32_t t = 0 ; t < meshlet.triangle_count ; ++t ) {
+        double n[3];
+        triangle_normal(position(triangles[t * 3]), position(triangles[t * 3 + 1]), position(triangles[t * 3 + 2]), n);
+        const double length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if ( length == 0.0 ) {
+            continue;
+        }
+        normals.push_back({ n[0] / length, n[1] / length, n[2] / length });
+        for ( int c = 0 ; c < 3 ; ++c ) {
+            axis[c] += normals.back()[c];
+        }
+    }
+    const double axis_length = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+    bounds.cone_cutoff = 1.0f;
+    if ( normals.empty() || axis_length == 0.0 ) {
+        return bounds;
+    }
+    double min_dot = 1.0;
+    for ( int c = 0 ; c < 3 ; ++c ) {
+        axis[c] /= axis_length;
+        bounds.cone_axis[c] = static_cast<float>(axis[c]);
+    }
+    for ( const auto& n : normals ) {
+        min_dot = std::min(min_dot, n[0] * axis[0] + n[1] * axis[1] + n[2] * axis[2]);
+    }
+    if ( min_dot > 0.0 ) {
+        bounds.cone_cutoff = static_cast<float>(std::sqrt(1.0 - min_dot * min_dot));
+    }
+    return bounds;
+}
+
+bool ev::tools::mesh_optimizer::is_cone_backfacing(const MeshletBounds& bounds, const float camera_position[3]) {
+    if ( bounds.cone_cutoff >= 1.0f ) {
+        return false;
+    }
+    // 카메라에서 sphere 의 어느 점을 보더라도 cone 안의 법선과 같은 방향이면 뒷면
+    const float d[3] = {
+        bounds.center[0] - camera_position[0],
+        bounds.center[1] - camera_position[1],
+        bounds.center[2] - camera_position[2]
+    };
+    const float distance = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+    const float projection = d[0] * bounds.cone_axis[0] + d[1] * bounds.cone_axis[1] + d[2] * bounds.cone_axis[2];
+    return projection >= bounds.cone_cutoff * distance + bounds.radius;
+}
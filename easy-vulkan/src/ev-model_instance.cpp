@@ -0,0 +1,147 @@
+#include "tools/ev-model_instance.h"
+#include "ev-macro.h"
+#include <system_error>
+
+using namespace ev::tools::gltf;
+
+ModelInstance::ModelInstance(std::shared_ptr<ev::Device> device, std::shared_ptr<Model> model)
+    : device(std::move(device)), model(std::move(model)) {
+    if ( !this->device || !this->model ) {
+        ev_log_error("[ev::tools::gltf::ModelInstance::ModelInstance] Invalid parameters provided for ModelInstance creation.");
+        exit(EXIT_FAILURE);
+    }
+    if ( !this->model->get_transform_hierarchy() ) {
+        ev_log_error("[ev::tools::gltf::ModelInstance::ModelInstance] Model has no transform hierarchy. Call build_transform_hierarchy first.");
+        exit(EXIT_FAILURE);
+    }
+    transforms = std::make_shared<ev::tools::TransformHierarchy>(*this->model->get_transform_hierarchy());
+    mixer = std::make_shared<ev::tools::AnimationMixer>(transforms);
+}
+
+bool ModelInstance::enable_skinning(std::shared_ptr<ev::MemoryAllocator> memory_allocator,
+    uint32_t frame_count,
+    std::shared_ptr<ev::Shader> shader,
+    uint32_t skinned_binding
+) {
+    if ( model->get_skins().empty() ) {
+        ev_log_warn("[ev::tools::gltf::ModelInstance::enable_skinning] Model has no skins.");
+        return false;
+    }
+    skinning = std::make_shared<SkinningSystem>(device, std::move(memory_allocator), model, frame_count, std::move(shader), transforms);
+    this->skinned_binding = skinned_binding;
+    return true;
+}
+
+uint32_t ModelInstance::play(const std::string& clip_name, float weight, bool loop) {
+    std::shared_ptr<ev::tools::AnimationClip> clip = model->get_animation_clip(clip_name);
+    if ( !clip ) {
+        ev_log_warn("[ev::tools::gltf::ModelInstance::play] Animation clip not found: %s", clip_name.c_str());
+        return UINT32_MAX;
+    }
+    if ( !skinning && !model->get_skins().empty() ) {
+        // 모델 palette 는 공유 hierarchy 로 계산되므로 이 인스턴스의 자세가 스킨 메시에 반영되지 않음
+        ev_log_warn("[ev::tools::gltf::ModelInstance::play] Skinned meshes do not follow this instance until enable_skinning is called.");
+    }
+    return mixer->add_layer(std::move(clip), weight, loop);
+}
+
+void ModelInstance::update(float delta_time, bool parallel) {
+    if ( mixer->get_layer_count() > 0 ) {
+        mixer->advance(delta_time);
+        mixer->apply();
+    }
+    transforms->update(parallel);
+}
+
+void ModelInstance::update_instances(uint32_t frame_index) {
+    if ( skinning ) {
+        if ( frame_index < skinning->get_frame_count() ) {
+            skinning->update(frame_index);
+        } else {
+            ev_log_error("[ev::tools::gltf::ModelInstance::update_instances] Frame index %u exceeds the skinning frame count %u.", frame_index, skinning->get_frame_count());
+        }
+    }
+    const uint32_t instance_count = model->get_instance_count();
+    if ( instance_count == 0 ) {
+        return;
+    }
+    if ( frame_index >= frames.size() ) {
+        frames.resize(frame_index + 1);
+    }
+    Frame& frame = frames[frame_index];
+    if ( !frame.buffer ) {
+        // 인스턴스 수는 모델 구성에 따라 고정
+        const VkDeviceSize size = static_cast<VkDeviceSize>(instance_count) * sizeof(glm::mat4);
+        frame.buffer = std::make_shared<ev::Buffer>(device, size, ev::buffer_type::VERTEX_BUFFER);
+        frame.memory = std::make_shared<ev::Memory>(
+            device,
+            size,
+            ev::memory_type::HOST_ONLY,
+            frame.buffer->get_memory_requirements()
+        );
+        CHECK_RESULT(frame.buffer->bind_memory(frame.memory, 0, size));
+        CHECK_RESULT(frame.buffer->map(size));
+    }
+    model->write_instances(*transforms, model_matrix, static_cast<glm::mat4*>(frame.buffer->get_mapped_ptr()));
+}
+
+void ModelInstance::draw(std::shared_ptr<ev::CommandBuffer> command_buffer,
+    uint32_t frame_index,
+    uint32_t render_flags,
+    std::shared_ptr<ev::PipelineLayout> pipeline_layout,
+    uint32_t bind_image_set,
+    uint32_t vertex_pass
+) {
+    if ( model->get_instance_count() == 0 ) {
+        return;
+    }
+    if ( frame_index >= frames.size() || !frames[frame_index].buffer ) {
+        ev_log_error("[ev::tools::gltf::ModelInstance::draw] Instance buffer for frame %u is not written. Call update_instances first.", frame_index);
+        return;
+    }
+    if ( skinning && skinning->is_pre_skinning_enabled() && frame_index < skinning->get_frame_count() ) {
+        skinning->bind_skinned_vertices(command_buffer, frame_index, skinned_binding);
+    }
+    const std::shared_ptr<ev::Buffer>& buffer = frames[frame_index].buffer;
+    model->draw_instanced(command_buffer,
+        buffer,
+        static_cast<const glm::mat4*>(buffer->get_mapped_ptr()),
+        render_flags,
+        pipeline_layout,
+        bind_image_set,
+        vertex_pass
+    );
+}
+
+void ModelInstance::destroy() {
+    for ( Frame& frame : frames ) {
+        frame.buffer.reset();
+        frame.memory.reset();
+    }
+    frames.clear();
+    skinning.reset();
+    mixer.reset();
+    transforms.reset();
+}
+
+ModelInstance::~ModelInstance() {
+    destroy();
+}
+
+bool ev::tools::gltf::make_model_key(const std::filesystem::path& path, const void* params, size_t params_size, ev::tools::ResourceKey& key) {
+    std::error_code error;
+    const std::filesystem::path canonical_path = std::filesystem::canonical(path, error);
+    if ( error ) {
+        return false;
+    }
+    const std::filesystem::file_time_type modified = std::filesystem::last_write_time(canonical_path, error);
+    if ( error ) {
+        return false;
+    }
+    // 경로와 수정 시간이 원본, 로드 설정이 파라미터
+    std::string source = canonical_path.generic_string();
+    const int64_t ticks = static_cast<int64_t>(modified.time_since_epoch().count());
+    source.append(reinterpret_cast<const char*>(&ticks), sizeof(ticks));
+    key = ev::tools::make_resource_key(source.data(), source.size(), params, params_size);
+    return true;
+}
@@ -0,0 +1,124 @@
+#include "tools/ev-parallel.h"
+#include <algorithm>
+
+using namespace ev::tools;
+
+namespace {
+
+// 작업 스레드이거나 parallel_for 실행 중인 스레드. 중첩 호출은 풀을 다시 잡지 않고 바로 실행
+thread_local bool inside_job = false;
+
+}
+
+uint32_t ev::tools::get_worker_count() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+WorkerPool::WorkerPool(uint32_t thread_count) {
+    threads.reserve(thread_count);
+    for ( uint32_t i = 0 ; i < thread_count ; ++i ) {
+        threads.emplace_back(&WorkerPool::run_worker, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    work_condition.notify_all();
+    for ( std::thread& thread : threads ) {
+        thread.join();
+    }
+}
+
+void WorkerPool::run_job(Job& job) {
+    for ( uint32_t chunk = job.next_chunk++ ; chunk < job.chunk_count ; chunk = job.next_chunk++ ) {
+        const uint32_t begin = chunk * job.grain;
+        (*job.func)(begin, std::min(begin + job.grain, job.count));
+    }
+}
+
+void WorkerPool::run_worker() {
+    inside_job = true;
+    uint64_t seen_generation = 0;
+    while ( true ) {
+        Job* current = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            work_condition.wait(lock, [&]() { return stopping || generation != seen_generation; });
+            if ( stopping ) {
+                return;
+            }
+            seen_generation = generation;
+            // 늦게 깨어 이미 끝난 작업이면 다음 작업까지 대기
+            if ( job == nullptr ) {
+                continue;
+            }
+            current = job;
+            ++active_workers;
+        }
+        run_job(*current);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if ( --active_workers == 0 ) {
+                done_condition.notify_all();
+            }
+        }
+    }
+}
+
+void WorkerPool::parallel_for(uint32_t count, const std::function<void(uint32_t begin, uint32_t end)>& func, uint32_t grain) {
+    if ( count == 0 ) {
+        return;
+    }
+    grain = std::max(1u, grain);
+    const uint32_t chunk_count = (count + grain - 1) / grain;
+    if ( threads.empty() || chunk_count <= 1 || inside_job ) {
+        func(0, count);
+        return;
+    }
+    // 다른 스레드가 풀을 사용 중이면 기다리지 않고 직접 실행
+    std::unique_lock<std::mutex> dispatch(dispatch_mutex, std::try_to_lock);
+    if ( !dispatch.owns_lock() ) {
+        func(0, count);
+        return;
+    }
+
+    Job current;
+    current.func = &func;
+    current.count = count;
+    current.grain = grain;
+    current.chunk_count = chunk_count;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &current;
+        ++generation;
+    }
+    if ( chunk_count - 1 >= threads.size() ) {
+        work_condition.notify_all();
+    } else {
+        for ( uint32_t i = 0 ; i < chunk_count - 1 ; ++i ) {
+            work_condition.notify_one();
+        }
+    }
+
+    // 호출한 스레드도 작업에 참여
+    inside_job = true;
+    run_job(current);
+    inside_job = false;
+
+    // 작업을 가져간 스레드가 끝난 뒤 작업을 내려야 current 가 스택에서 사라져도 안전
+    std::unique_lock<std::mutex> lock(mutex);
+    done_condition.wait(lock, [&]() { return active_workers == 0; });
+    job = nullptr;
+}
+
+WorkerPool& WorkerPool::get_default() {
+    static WorkerPool pool(get_worker_count() - 1);
+    return pool;
+}
+
+void ev::tools::parallel_for(uint32_t count, const std::function<void(uint32_t begin, uint32_t end)>& func, uint32_t grain) {
+    WorkerPool::get_default().parallel_for(count, func, grain);
+}
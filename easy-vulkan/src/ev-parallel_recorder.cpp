@@ -0,0 +1,76 @@
+#include "tools/ev-parallel_recorder.h"
+#include "tools/ev-parallel.h"
+#include <algorithm>
+
+using namespace ev::tools;
+
+ParallelRecorder::ParallelRecorder(std::shared_ptr<ev::Device> device,
+    VkQueueFlags queue_flags,
+    uint32_t frame_count,
+    uint32_t thread_count
+) : device(std::move(device)),
+    frame_count(frame_count),
+    thread_count(thread_count ? thread_count : get_worker_count()) {
+    if ( !this->device || frame_count == 0 ) {
+        ev_log_error("[ev::tools::ParallelRecorder::ParallelRecorder] Invalid parameters provided for ParallelRecorder creation.");
+        exit(EXIT_FAILURE);
+    }
+
+    // 풀 단위로 reset 하므로 버퍼별 reset 플래그 없이 짧게 쓰는 풀로 생성
+    pools.resize(frame_count);
+    command_buffers.resize(frame_count);
+    for ( uint32_t frame = 0 ; frame < frame_count ; ++frame ) {
+        for ( uint32_t slice = 0 ; slice < this->thread_count ; ++slice ) {
+            std::shared_ptr<ev::CommandPool> pool = std::make_shared<ev::CommandPool>(this->device, queue_flags, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
+            command_buffers[frame].push_back(pool->allocate(VK_COMMAND_BUFFER_LEVEL_SECONDARY));
+            pools[frame].push_back(std::move(pool));
+        }
+    }
+    ev_log_info("[ev::tools::ParallelRecorder] Created %u command pools (%u frames x %u threads).",
+        frame_count * this->thread_count, frame_count, this->thread_count);
+}
+
+std::vector<std::shared_ptr<ev::CommandBuffer>> ParallelRecorder::record(uint32_t frame,
+    std::shared_ptr<ev::RenderPass> render_pass,
+    uint32_t subpass,
+    std::shared_ptr<ev::Framebuffer> framebuffer,
+    uint32_t item_count,
+    const RecordFunction& func,
+    uint32_t min_items_per_slice
+) {
+    if ( frame >= frame_count ) {
+        ev_log_error("[ev::tools::ParallelRecorder::record] Frame index %u is out of range (%u frames).", frame, frame_count);
+        exit(EXIT_FAILURE);
+    }
+    if ( item_count == 0 ) {
+        return {};
+    }
+
+    min_items_per_slice = std::max(1u, min_items_per_slice);
+    const uint32_t slice_count = std::min(thread_count, (item_count + min_items_per_slice - 1) / min_items_per_slice);
+
+    // 슬라이스마다 자기 풀만 사용하므로 풀 reset 과 기록을 같은 작업 안에서 수행
+    parallel_for(slice_count, [&](uint32_t begin, uint32_t end) {
+        for ( uint32_t slice = begin ; slice < end ; ++slice ) {
+            const uint32_t first = static_cast<uint32_t>(static_cast<uint64_t>(item_count) * slice / slice_count);
+            const uint32_t last = static_cast<uint32_t>(static_cast<uint64_t>(item_count) * (slice + 1) / slice_count);
+            pools[frame][slice]->reset();
+            const std::shared_ptr<ev::CommandBuffer>& command_buffer = command_buffers[frame][slice];
+            command_buffer->begin_secondary(render_pass, subpass, framebuffer);
+            func(command_buffer, first, last);
+            command_buffer->end();
+        }
+    });
+
+    return std::vector<std::shared_ptr<ev::CommandBuffer>>(command_buffers[frame].begin(), command_buffers[frame].begin() + slice_count);
+}
+
+void ParallelRecorder::destroy() {
+    // 커맨드 버퍼를 풀보다 먼저 해제
+    command_buffers.clear();
+    pools.clear();
+}
+
+ParallelRecorder::~ParallelRecorder() {
+    destroy();
+}
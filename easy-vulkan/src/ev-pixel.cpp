@@ -0,0 +1,387 @@
+#include "tools/ev-pixel.h"
+
+#include <cstring>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define EV_PIXEL_AVX2 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define EV_PIXEL_SSE2 1
+#endif
+
+#if defined(__SSSE3__) || defined(__AVX2__)
+    #include <tmmintrin.h>
+    #define EV_PIXEL_SSSE3 1
+#endif
+
+#if defined(__F16C__)
+    #include <immintrin.h>
+    #define EV_PIXEL_F16C 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define EV_PIXEL_NEON 1
+#endif
+
+namespace ev::tools::pixel {
+
+/* ---------------------------------------------------------------------------------------------
+ * scalar
+ * ------------------------------------------------------------------------------------------- */
+
+namespace scalar {
+
+void rgb8_to_rgba8(const uint8_t* src, uint8_t* dst, size_t pixel_count, uint8_t alpha) {
+    for ( size_t i = 0 ; i < pixel_count ; ++i ) {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+        dst[3] = alpha;
+        src += 3;
+        dst += 4;
+    }
+}
+
+void premultiply_rgba8(uint8_t* pixels, size_t pixel_count) {
+    for ( size_t i = 0 ; i < pixel_count ; ++i ) {
+        uint32_t a = pixels[3];
+        for ( uint32_t ch = 0 ; ch < 3 ; ++ch ) {
+            uint32_t t = pixels[ch] * a + 128;
+            pixels[ch] = static_cast<uint8_t>((t + (t >> 8)) >> 8);
+        }
+        pixels += 4;
+    }
+}
+
+static inline uint16_t float_to_half(float value) {
+    const uint32_t f32_infty = 255u << 23;
+    const uint32_t f16_max = (127u + 16u) << 23;
+    const uint32_t denorm_magic_bits = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+    uint32_t x;
+    std::memcpy(&x, &value, sizeof(x));
+    uint32_t sign = x & 0x80000000u;
+    x ^= sign;
+
+    uint16_t out;
+    if ( x >= f16_max ) {
+        // overflow 는 inf, NaN 은 quiet NaN 으로
+        out = (x > f32_infty) ? 0x7E00 : 0x7C00;
+    } else if ( x < (113u << 23) ) {
+        // subnormal 과 0 은 float 덧셈의 반올림을 이용
+        float f, magic;
+        std::memcpy(&f, &x, sizeof(f));
+        std::memcpy(&magic, &denorm_magic_bits, sizeof(magic));
+        f += magic;
+        uint32_t bits;
+        std::memcpy(&bits, &f, sizeof(bits));
+        out = static_cast<uint16_t>(bits - denorm_magic_bits);
+    } else {
+        uint32_t mant_odd = (x >> 13) & 1u;
+        x += (static_cast<uint32_t>(15 - 127) << 23) + 0xFFFu;
+        x += mant_odd;
+        out = static_cast<uint16_t>(x >> 13);
+    }
+    return static_cast<uint16_t>(out | (sign >> 16));
+}
+
+void r32f_to_r16f(const float* src, uint16_t* dst, size_t count) {
+    for ( size_t i = 0 ; i < count ; ++i ) {
+        dst[i] = float_to_half(src[i]);
+    }
+}
+
+void rgba8_to_luminance8(const uint8_t* src, uint8_t* dst, size_t pixel_count) {
+    for ( size_t i = 0 ; i < pixel_count ; ++i ) {
+        uint32_t y = 54u * src[0] + 183u * src[1] + 19u * src[2] + 128u;
+        dst[i] = static_cast<uint8_t>(y >> 8);
+        src += 4;
+    }
+}
+
+}
+
+/* ---------------------------------------------------------------------------------------------
+ * SIMD helpers
+ * ------------------------------------------------------------------------------------------- */
+
+#if defined(EV_PIXEL_SSE2) && !defined(EV_PIXEL_F16C)
+/**
+ * @brief scalar::float_to_half 와 동일한 결과를 내는 4-wide 구현, 결과는 32bit lane 의 하위 16bit 에 위치
+ */
+static inline __m128i float_to_half_sse2(__m128 value) {
+    const __m128i sign_mask = _mm_set1_epi32(static_cast<int>(0x80000000u));
+    const __m128i f32_infty = _mm_set1_epi32(255 << 23);
+    const __m128i f16_max = _mm_set1_epi32((127 + 16) << 23);
+    const __m128i subnormal_limit = _mm_set1_epi32(113 << 23);
+    const __m128i denorm_magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+    const __m128i rebias = _mm_set1_epi32(((15 - 127) << 23) + 0xFFF);
+    const __m128i one = _mm_set1_epi32(1);
+
+    __m128i x = _mm_castps_si128(value);
+    __m128i sign = _mm_and_si128(x, sign_mask);
+    x = _mm_xor_si128(x, sign);
+
+    __m128i is_overflow = _mm_cmpgt_epi32(x, _mm_sub_epi32(f16_max, one));
+    __m128i is_nan = _mm_cmpgt_epi32(x, f32_infty);
+    __m128i is_subnormal = _mm_cmplt_epi32(x, subnormal_limit);
+
+    __m128i inf_nan = _mm_or_si128(_mm_set1_epi32(0x7C00), _mm_and_si128(is_nan, _mm_set1_epi32(0x0200)));
+
+    __m128 sub_f = _mm_add_ps(_mm_castsi128_ps(x), _mm_castsi128_ps(denorm_magic));
+    __m128i sub = _mm_sub_epi32(_mm_castps_si128(sub_f), denorm_magic);
+
+    __m128i mant_odd = _mm_and_si128(_mm_srli_epi32(x, 13), one);
+    __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(x, rebias), mant_odd), 13);
+
+    __m128i finite = _mm_or_si128(_mm_and_si128(is_subnormal, sub), _mm_andnot_si128(is_subnormal, normal));
+    __m128i out = _mm_or_si128(_mm_and_si128(is_overflow, inf_nan), _mm_andnot_si128(is_overflow, finite));
+    return _mm_or_si128(out, _mm_srli_epi32(sign, 16));
+}
+
+/**
+ * @brief 32bit lane 의 하위 16bit 값 8개를 16bit 로 패킹합니다.
+ */
+static inline __m128i pack_u32_low16_sse2(__m128i a, __m128i b) {
+    a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+    b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+    return _mm_packs_epi32(a, b);
+}
+#endif
+
+#if defined(EV_PIXEL_SSE2)
+/**
+ * @brief 4 픽셀(RGBA8 32bit lane)의 휘도를 32bit lane 으로 계산합니다.
+ */
+static inline __m128i luminance_sse2(__m128i px) {
+    const __m128i byte_mask = _mm_set1_epi32(0xFF);
+    __m128i r = _mm_and_si128(px, byte_mask);
+    __m128i g = _mm_and_si128(_mm_srli_epi32(px, 8), byte_mask);
+    __m128i b = _mm_and_si128(_mm_srli_epi32(px, 16), byte_mask);
+    // 최대값 65408 로 16bit 곱셈 범위 내에 들어옴
+    __m128i y = _mm_mullo_epi16(r, _mm_set1_epi32(54));
+    y = _mm_add_epi16(y, _mm_mullo_epi16(g, _mm_set1_epi32(183)));
+    y = _mm_add_epi16(y, _mm_mullo_epi16(b, _mm_set1_epi32(19)));
+    y = _mm_add_epi16(y, _mm_set1_epi32(128));
+    return _mm_srli_epi32(y, 8);
+}
+
+/**
+ * @brief 16bit lane 2 픽셀(RGBA)에 알파를 곱하고 255 로 나눕니다.
+ */
+static inline __m128i premultiply_u16_sse2(__m128i px) {
+    const __m128i alpha_lane = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(px, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_or_si128(_mm_andnot_si128(alpha_lane, alpha), _mm_and_si128(alpha_lane, _mm_set1_epi16(255)));
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(px, alpha), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+#endif
+
+#if defined(EV_PIXEL_AVX2)
+static inline __m256i luminance_avx2(__m256i px) {
+    const __m256i byte_mask = _mm256_set1_epi32(0xFF);
+    __m256i r = _mm256_and_si256(px, byte_mask);
+    __m256i g = _mm256_and_si256(_mm256_srli_epi32(px, 8), byte_mask);
+    __m256i b = _mm256_and_si256(_mm256_srli_epi32(px, 16), byte_mask);
+    __m256i y = _mm256_mullo_epi16(r, _mm256_set1_epi32(54));
+    y = _mm256_add_epi16(y, _mm256_mullo_epi16(g, _mm256_set1_epi32(183)));
+    y = _mm256_add_epi16(y, _mm256_mullo_epi16(b, _mm256_set1_epi32(19)));
+    y = _mm256_add_epi16(y, _mm256_set1_epi32(128));
+    return _mm256_srli_epi32(y, 8);
+}
+
+static inline __m256i premultiply_u16_avx2(__m256i px) {
+    const __m256i alpha_lane = _mm256_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0);
+    __m256i alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(px, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm256_or_si256(_mm256_andnot_si256(alpha_lane, alpha), _mm256_and_si256(alpha_lane, _mm256_set1_epi16(255)));
+    __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(px, alpha), _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+#endif
+
+/* ---------------------------------------------------------------------------------------------
+ * dispatch
+ * ------------------------------------------------------------------------------------------- */
+
+const char* simd_backend() {
+#if defined(EV_PIXEL_AVX2)
+    return "avx2";
+#elif defined(EV_PIXEL_SSSE3)
+    return "ssse3";
+#elif defined(EV_PIXEL_SSE2)
+    return "sse2";
+#elif defined(EV_PIXEL_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+void rgb8_to_rgba8(const uint8_t* src, uint8_t* dst, size_t pixel_count, uint8_t alpha) {
+    size_t i = 0;
+#if defined(EV_PIXEL_AVX2)
+    {
+        const __m256i shuffle = _mm256_setr_epi8(
+            0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+            0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1
+        );
+        const __m256i alpha_mask = _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(alpha) << 24));
+        // 16 byte 로드가 입력 범위를 넘지 않도록 여유 픽셀을 남겨둠
+        for ( ; i + 18 <= pixel_count ; i += 16 ) {
+            const uint8_t* s = src + i * 3;
+            __m256i a = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 12)), 1);
+            __m256i b = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 24))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 36)), 1);
+            a = _mm256_or_si256(_mm256_shuffle_epi8(a, shuffle), alpha_mask);
+            b = _mm256_or_si256(_mm256_shuffle_epi8(b, shuffle), alpha_mask);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), a);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4 + 32), b);
+        }
+    }
+#elif defined(EV_PIXEL_SSSE3)
+    {
+        const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+        const __m128i alpha_mask = _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(alpha) << 24));
+        for ( ; i + 6 <= pixel_count ; i += 4 ) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3));
+            v = _mm_or_si128(_mm_shuffle_epi8(v, shuffle), alpha_mask);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), v);
+        }
+    }
+#elif defined(EV_PIXEL_NEON)
+    {
+        const uint8x16_t a = vdupq_n_u8(alpha);
+        for ( ; i + 16 <= pixel_count ; i += 16 ) {
+            uint8x16x3_t rgb = vld3q_u8(src + i * 3);
+            uint8x16x4_t rgba = { { rgb.val[0], rgb.val[1], rgb.val[2], a } };
+            vst4q_u8(dst + i * 4, rgba);
+        }
+    }
+#endif
+    scalar::rgb8_to_rgba8(src + i * 3, dst + i * 4, pixel_count - i, alpha);
+}
+
+void premultiply_rgba8(uint8_t* pixels, size_t pixel_count) {
+    size_t i = 0;
+#if defined(EV_PIXEL_AVX2)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        for ( ; i + 8 <= pixel_count ; i += 8 ) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pixels + i * 4));
+            __m256i lo = premultiply_u16_avx2(_mm256_unpacklo_epi8(v, zero));
+            __m256i hi = premultiply_u16_avx2(_mm256_unpackhi_epi8(v, zero));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(pixels + i * 4), _mm256_packus_epi16(lo, hi));
+        }
+    }
+#elif defined(EV_PIXEL_SSE2)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        for ( ; i + 4 <= pixel_count ; i += 4 ) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i * 4));
+            __m128i lo = premultiply_u16_sse2(_mm_unpacklo_epi8(v, zero));
+            __m128i hi = premultiply_u16_sse2(_mm_unpackhi_epi8(v, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i * 4), _mm_packus_epi16(lo, hi));
+        }
+    }
+#elif defined(EV_PIXEL_NEON)
+    {
+        for ( ; i + 16 <= pixel_count ; i += 16 ) {
+            uint8x16x4_t px = vld4q_u8(pixels + i * 4);
+            for ( int ch = 0 ; ch < 3 ; ++ch ) {
+                uint16x8_t lo = vmull_u8(vget_low_u8(px.val[ch]), vget_low_u8(px.val[3]));
+                uint16x8_t hi = vmull_u8(vget_high_u8(px.val[ch]), vget_high_u8(px.val[3]));
+                // (t + 128 + ((t + 128) >> 8)) >> 8
+                px.val[ch] = vcombine_u8(
+                    vraddhn_u16(lo, vrshrq_n_u16(lo, 8)),
+                    vraddhn_u16(hi, vrshrq_n_u16(hi, 8))
+                );
+            }
+            vst4q_u8(pixels + i * 4, px);
+        }
+    }
+#endif
+    scalar::premultiply_rgba8(pixels + i * 4, pixel_count - i);
+}
+
+void r32f_to_r16f(const float* src, uint16_t* dst, size_t count) {
+    size_t i = 0;
+#if defined(EV_PIXEL_F16C) && defined(EV_PIXEL_AVX2)
+    for ( ; i + 8 <= count ; i += 8 ) {
+        __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);
+    }
+#elif defined(EV_PIXEL_F16C)
+    for ( ; i + 4 <= count ; i += 4 ) {
+        __m128i h = _mm_cvtps_ph(_mm_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), h);
+    }
+#elif defined(EV_PIXEL_SSE2)
+    for ( ; i + 8 <= count ; i += 8 ) {
+        __m128i a = float_to_half_sse2(_mm_loadu_ps(src + i));
+        __m128i b = float_to_half_sse2(_mm_loadu_ps(src + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), pack_u32_low16_sse2(a, b));
+    }
+#elif defined(EV_PIXEL_NEON) && defined(__aarch64__)
+    for ( ; i + 4 <= count ; i += 4 ) {
+        float16x4_t h = vcvt_f16_f32(vld1q_f32(src + i));
+        vst1_u16(dst + i, vreinterpret_u16_f16(h));
+    }
+#endif
+    scalar::r32f_to_r16f(src + i, dst + i, count - i);
+}
+
+void rgba8_to_luminance8(const uint8_t* src, uint8_t* dst, size_t pixel_count) {
+    size_t i = 0;
+#if defined(EV_PIXEL_AVX2)
+    {
+        const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        for ( ; i + 32 <= pixel_count ; i += 32 ) {
+            const __m256i* s = reinterpret_cast<const __m256i*>(src + i * 4);
+            __m256i y0 = luminance_avx2(_mm256_loadu_si256(s + 0));
+            __m256i y1 = luminance_avx2(_mm256_loadu_si256(s + 1));
+            __m256i y2 = luminance_avx2(_mm256_loadu_si256(s + 2));
+            __m256i y3 = luminance_avx2(_mm256_loadu_si256(s + 3));
+            // pack 은 128bit lane 단위로 동작하므로 마지막에 dword 순서를 복원
+            __m256i y = _mm256_packus_epi16(_mm256_packs_epi32(y0, y1), _mm256_packs_epi32(y2, y3));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_permutevar8x32_epi32(y, order));
+        }
+    }
+#elif defined(EV_PIXEL_SSE2)
+    for ( ; i + 16 <= pixel_count ; i += 16 ) {
+        const __m128i* s = reinterpret_cast<const __m128i*>(src + i * 4);
+        __m128i y0 = luminance_sse2(_mm_loadu_si128(s + 0));
+        __m128i y1 = luminance_sse2(_mm_loadu_si128(s + 1));
+        __m128i y2 = luminance_sse2(_mm_loadu_si128(s + 2));
+        __m128i y3 = luminance_sse2(_mm_loadu_si128(s + 3));
+        __m128i y = _mm_packus_epi16(_mm_packs_epi32(y0, y1), _mm_packs_epi32(y2, y3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), y);
+    }
+#elif defined(EV_PIXEL_NEON)
+    {
+        const uint8x8_t wr = vdup_n_u8(54);
+        const uint8x8_t wg = vdup_n_u8(183);
+        const uint8x8_t wb = vdup_n_u8(19);
+        for ( ; i + 16 <= pixel_count ; i += 16 ) {
+            uint8x16x4_t px = vld4q_u8(src + i * 4);
+            uint16x8_t lo = vmull_u8(vget_low_u8(px.val[0]), wr);
+            lo = vmlal_u8(lo, vget_low_u8(px.val[1]), wg);
+            lo = vmlal_u8(lo, vget_low_u8(px.val[2]), wb);
+            uint16x8_t hi = vmull_u8(vget_high_u8(px.val[0]), wr);
+            hi = vmlal_u8(hi, vget_high_u8(px.val[1]), wg);
+            hi = vmlal_u8(hi, vget_high_u8(px.val[2]), wb);
+            vst1q_u8(dst + i, vcombine_u8(vrshrn_n_u16(lo, 8), vrshrn_n_u16(hi, 8)));
+        }
+    }
+#endif
+    scalar::rgba8_to_luminance8(src + i * 4, dst + i, pixel_count - i);
+}
+
+}
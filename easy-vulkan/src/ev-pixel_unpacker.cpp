@@ -0,0 +1,230 @@
+#include "tools/ev-pixel_unpacker.h"
+#include "ev-macro.h"
+#include <algorithm>
+
+using namespace ev::tools;
+
+PixelUnpacker::PixelUnpacker(
+    std::shared_ptr<ev::Device> device,
+    std::shared_ptr<ev::MemoryAllocator> memory_allocator,
+    std::shared_ptr<ev::CommandPool> command_pool,
+    std::shared_ptr<ev::Queue> queue,
+    std::shared_ptr<ev::Shader> shader
+) : device(std::move(device)),
+    memory_allocator(std::move(memory_allocator)),
+    command_pool(std::move(command_pool)),
+    queue(std::move(queue)) {
+    ev_log_info("[ev::tools::PixelUnpacker::PixelUnpacker] Creating PixelUnpacker.");
+
+    if ( !this->device || !this->memory_allocator || !this->command_pool || !this->queue || !shader ) {
+        ev_log_error("[ev::tools::PixelUnpacker::PixelUnpacker] Invalid parameters provided for PixelUnpacker creation.");
+        exit(EXIT_FAILURE);
+    }
+
+    descriptor_set_layout = std::make_shared<ev::DescriptorSetLayout>(this->device);
+    descriptor_set_layout->add_binding(VK_SHADER_STAGE_COMPUTE_BIT, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 0);
+    descriptor_set_layout->add_binding(VK_SHADER_STAGE_COMPUTE_BIT, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1);
+    CHECK_RESULT(descriptor_set_layout->create_layout());
+
+    descriptor_pool = std::make_shared<ev::DescriptorPool>(this->device);
+    descriptor_pool->add(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2);
+    CHECK_RESULT(descriptor_pool->create_pool(1));
+    descriptor_set = descriptor_pool->allocate(descriptor_set_layout);
+
+    VkPushConstantRange push_constant_range = {};
+    push_constant_range.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    push_constant_range.offset = 0;
+    push_constant_range.size = sizeof(PushConstants);
+
+    pipeline_layout = std::make_shared<ev::PipelineLayout>(
+        this->device,
+        std::vector<std::shared_ptr<ev::DescriptorSetLayout>>{ descriptor_set_layout },
+        std::vector<VkPushConstantRange>{ push_constant_range }
+    );
+    pipeline = std::make_shared<ev::ComputePipeline>(this->device, pipeline_layout, shader);
+    CHECK_RESULT(pipeline->create_pipeline());
+
+    ev_log_info("[ev::tools::PixelUnpacker::PixelUnpacker] PixelUnpacker created.");
+}
+
+PixelUnpacker::FormatLayout PixelUnpacker::get_format_layout(VkFormat format) {
+    switch ( format ) {
+        case VK_FORMAT_R8_UNORM:
+        case VK_FORMAT_R8_SRGB:
+            return { 1, 1 };
+        case VK_FORMAT_R8G8_UNORM:
+        case VK_FORMAT_R8G8_SRGB:
+            return { 2, 1 };
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+            return { 4, 1 };
+        case VK_FORMAT_R16_UNORM:
+            return { 1, 2 };
+        case VK_FORMAT_R16G16_UNORM:
+            return { 2, 2 };
+        case VK_FORMAT_R16G16B16A16_UNORM:
+            return { 4, 2 };
+        case VK_FORMAT_R32_SFLOAT:
+            return { 1, 4 };
+        case VK_FORMAT_R32G32_SFLOAT:
+            return { 2, 4 };
+        case VK_FORMAT_R32G32B32A32_SFLOAT:
+            return { 4, 4 };
+        default:
+            return {};
+    }
+}
+
+VkResult PixelUnpacker::upload(
+    std::shared_ptr<ev::Image> image,
+    const void* data,
+    uint32_t width,
+    uint32_t height,
+    uint32_t src_channels,
+    uint32_t src_bytes_per_channel,
+    VkImageLayout final_layout,
+    bool replicate_gray,
+    bool premultiply_alpha
+) {
+    FormatLayout dst = get_format_layout(image->get_format());
+    if ( dst.channels == 0 ) {
+        ev_log_error("[ev::tools::PixelUnpacker::upload] Unsupported destination format: %d", image->get_format());
+        return VK_ERROR_FORMAT_NOT_SUPPORTED;
+    }
+    if ( src_channels == 0 || src_channels > 4 || (src_bytes_per_channel != 1 && src_bytes_per_channel != 2) ) {
+        ev_log_error("[ev::tools::PixelUnpacker::upload] Unsupported source layout: %u channels, %u bytes per channel", src_channels, src_bytes_per_channel);
+        return VK_ERROR_FORMAT_NOT_SUPPORTED;
+    }
+
+    const VkDeviceSize pixel_count = static_cast<VkDeviceSize>(width) * height;
+    const VkDeviceSize packed_size = pixel_count * src_channels * src_bytes_per_channel;
+    const VkDeviceSize unpacked_size = pixel_count * dst.channels * dst.bytes_per_channel;
+    const uint32_t dst_word_count = static_cast<uint32_t>((unpacked_size + 3) / 4);
+
+    // shader 가 word 단위로 읽으므로 4 byte 단위로 올림
+    std::shared_ptr<ev::Buffer> packed_buffer = std::make_shared<ev::Buffer>(
+        device,
+        (packed_size + 3) & ~VkDeviceSize(3),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+    );
+    std::shared_ptr<ev::Buffer> unpacked_buffer = std::make_shared<ev::Buffer>(
+        device,
+        static_cast<VkDeviceSize>(dst_word_count) * 4,
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+    );
+
+    VkResult result = memory_allocator->allocate_buffer(packed_buffer, ev::memory_type::HOST_ONLY);
+    if ( result != VK_SUCCESS ) {
+        ev_log_error("[ev::tools::PixelUnpacker::upload] Failed to allocate packed staging buffer.");
+        return result;
+    }
+    result = memory_allocator->allocate_buffer(unpacked_buffer, ev::memory_type::GPU_ONLY);
+    if ( result != VK_SUCCESS ) {
+        ev_log_error("[ev::tools::PixelUnpacker::upload] Failed to allocate unpacked buffer.");
+        return result;
+    }
+
+    CHECK_RESULT(packed_buffer->map());
+    packed_buffer->write(const_cast<void*>(data), packed_size);
+    packed_buffer->flush();
+    packed_buffer->unmap();
+    ev_log_debug("[ev::tools::PixelUnpacker::upload] Staged %llu packed bytes (unpacked: %llu bytes).",
+        static_cast<unsigned long long>(packed_size),
+        static_cast<unsigned long long>(unpacked_size));
+
+    descriptor_set->write_buffer(0, packed_buffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set->write_buffer(1, unpacked_buffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    CHECK_RESULT(descriptor_set->update());
+
+    PushConstants push_constants = {};
+    push_constants.dst_word_count = dst_word_count;
+    push_constants.pixel_count = static_cast<uint32_t>(pixel_count);
+    push_constants.src_channels = src_channels;
+    push_constants.src_bytes = src_bytes_per_channel;
+    push_constants.dst_channels = dst.channels;
+    push_constants.dst_bytes = dst.bytes_per_channel;
+    push_constants.replicate_gray = replicate_gray ? 1u : 0u;
+    push_constants.alpha = 0xFFFF;
+    push_constants.premultiply_alpha = premultiply_alpha ? 1u : 0u;
+
+    uint32_t group_count = (dst_word_count + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE;
+    uint32_t group_count_x = std::min(group_count, device->get_physical_device()->get_properties().limits.maxComputeWorkGroupCount[0]);
+    uint32_t group_count_y = (group_count + group_count_x - 1) / group_count_x;
+
+    const uint32_t mip_levels = image->get_mip_levels();
+
+    std::shared_ptr<ev::CommandBuffer> command_buffer = command_pool->allocate();
+    command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+    command_buffer->bind_compute_pipeline(pipeline);
+    command_buffer->bind_descriptor_sets(VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, { descriptor_set });
+    command_buffer->bind_push_constants(pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, &push_constants, sizeof(PushConstants));
+    command_buffer->dispatch(group_count_x, group_count_y, 1);
+
+    command_buffer->pipeline_barrier(
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        {ev::ImageMemoryBarrier(
+            image,
+            0,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_IMAGE_LAYOUT_UNDEFINED,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            {VK_IMAGE_ASPECT_COLOR_BIT, 0, mip_levels, 0, 1}
+        )},
+        {ev::BufferMemoryBarrier(
+            unpacked_buffer,
+            VK_ACCESS_SHADER_WRITE_BIT,
+            VK_ACCESS_TRANSFER_READ_BIT
+        )},
+        {}
+    );
+
+    VkBufferImageCopy region = {};
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.mipLevel = 0;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = 1;
+    region.imageExtent = { width, height, 1 };
+    command_buffer->copy_buffer_to_image(image, unpacked_buffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, { region });
+
+    command_buffer->pipeline_barrier(
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        {ev::ImageMemoryBarrier(
+            image,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            final_layout,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            {VK_IMAGE_ASPECT_COLOR_BIT, 0, mip_levels, 0, 1}
+        )},
+        {},
+        {}
+    );
+    CHECK_RESULT(command_buffer->end());
+
+    std::shared_ptr<ev::Fence> fence = std::make_shared<ev::Fence>(device, 0);
+    CHECK_RESULT(queue->submit(command_buffer, {}, {}, nullptr, fence));
+    CHECK_RESULT(fence->wait());
+    image->transient_layout(final_layout);
+
+    ev_log_debug("[ev::tools::PixelUnpacker::upload] Uploaded %ux%u image (%u -> %u channels).", width, height, src_channels, dst.channels);
+    return VK_SUCCESS;
+}
+
+void PixelUnpacker::destroy() {
+    pipeline.reset();
+    pipeline_layout.reset();
+    descriptor_set.reset();
+    descriptor_pool.reset();
+    descriptor_set_layout.reset();
+    ev_log_debug("[ev::tools::PixelUnpacker::destroy] PixelUnpacker destroyed.");
+}
+
+PixelUnpacker::~PixelUnpacker() {
+    destroy();
+}
@@ -0,0 +1,92 @@
+#include "tools/ev-range_allocator.h"
+#include "ev-logger.h"
+#include <algorithm>
+#include <iterator>
+
+using namespace ev::tools;
+
+RangeAllocator::RangeAllocator(uint64_t capacity) {
+    reset(capacity);
+}
+
+uint64_t RangeAllocator::allocate(uint64_t size) {
+    if ( size == 0 ) {
+        return INVALID_OFFSET;
+    }
+    auto best = free_ranges.end();
+    for ( auto it = free_ranges.begin() ; it != free_ranges.end() ; ++it ) {
+        if ( it->second >= size && (best == free_ranges.end() || it->second < best->second) ) {
+            best = it;
+            if ( it->second == size ) {
+                break;
+            }
+        }
+    }
+    if ( best == free_ranges.end() ) {
+        return INVALID_OFFSET;
+    }
+
+    const uint64_t offset = best->first;
+    const uint64_t remain = best->second - size;
+    free_ranges.erase(best);
+    if ( remain > 0 ) {
+        free_ranges.emplace(offset + size, remain);
+    }
+    free_size -= size;
+    return offset;
+}
+
+bool RangeAllocator::free(uint64_t offset, uint64_t size) {
+    if ( size == 0 ) {
+        return true;
+    }
+    if ( offset > capacity || size > capacity - offset ) {
+        ev_log_error("[ev::tools::RangeAllocator::free] Range [%llu, +%llu) is out of capacity %llu.",
+            static_cast<unsigned long long>(offset),
+            static_cast<unsigned long long>(size),
+            static_cast<unsigned long long>(capacity));
+        return false;
+    }
+
+    auto next = free_ranges.lower_bound(offset);
+    auto prev = next != free_ranges.begin() ? std::prev(next) : free_ranges.end();
+    const bool overlaps_next = next != free_ranges.end() && next->first < offset + size;
+    const bool overlaps_prev = prev != free_ranges.end() && prev->first + prev->second > offset;
+    if ( overlaps_next || overlaps_prev ) {
+        ev_log_error("[ev::tools::RangeAllocator::free] Range [%llu, +%llu) is already free.",
+            static_cast<unsigned long long>(offset),
+            static_cast<unsigned long long>(size));
+        return false;
+    }
+
+    free_size += size;
+    if ( prev != free_ranges.end() && prev->first + prev->second == offset ) {
+        // 앞 구간에 이어 붙임
+        offset = prev->first;
+        size += prev->second;
+        free_ranges.erase(prev);
+    }
+    if ( next != free_ranges.end() && next->first == offset + size ) {
+        size += next->second;
+        free_ranges.erase(next);
+    }
+    free_ranges.emplace(offset, size);
+    return true;
+}
+
+void RangeAllocator::reset(uint64_t capacity) {
+    this->capacity = capacity;
+    free_size = capacity;
+    free_ranges.clear();
+    if ( capacity > 0 ) {
+        free_ranges.emplace(0, capacity);
+    }
+}
+
+uint64_t RangeAllocator::get_largest_free_range() const {
+    uint64_t largest = 0;
+    for ( const auto& [offset, size] : free_ranges ) {
+        largest = std::max(largest, size);
+    }
+    return largest;
+}
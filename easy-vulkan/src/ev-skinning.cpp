@@ -0,0 +1,282 @@
+#include "tools/ev-skinning.h"
+#include "tools/ev-parallel.h"
+#include "ev-macro.h"
+#include <algorithm>
+#include <cstddef>
+#include <unordered_set>
+
+using namespace ev::tools::gltf;
+
+namespace {
+
+/** 한 스레드가 한 번에 처리할 스킨 메시 노드 수 */
+constexpr uint32_t NODE_GRAIN = 16;
+
+}
+
+SkinningSystem::SkinningSystem(
+    std::shared_ptr<ev::Device> device,
+    std::shared_ptr<ev::MemoryAllocator> memory_allocator,
+    std::shared_ptr<Model> model,
+    uint32_t frame_count,
+    std::shared_ptr<ev::Shader> shader,
+    std::shared_ptr<ev::tools::TransformHierarchy> transforms
+) : device(std::move(device)),
+    memory_allocator(std::move(memory_allocator)),
+    model(std::move(model)),
+    transforms(std::move(transforms)) {
+    ev_log_info("[ev::tools::gltf::SkinningSystem::SkinningSystem] Creating SkinningSystem.");
+
+    if ( !this->device || !this->memory_allocator || !this->model || frame_count == 0 ) {
+        ev_log_error("[ev::tools::gltf::SkinningSystem::SkinningSystem] Invalid parameters provided for SkinningSystem creation.");
+        exit(EXIT_FAILURE);
+    }
+    const std::shared_ptr<ev::tools::TransformHierarchy>& model_transforms = this->model->get_transform_hierarchy();
+    if ( !this->transforms ) {
+        this->transforms = model_transforms;
+    } else if ( !model_transforms || this->transforms->size() != model_transforms->size() ) {
+        ev_log_error("[ev::tools::gltf::SkinningSystem::SkinningSystem] Transform hierarchy is not a copy of the model hierarchy.");
+        exit(EXIT_FAILURE);
+    }
+
+    collect_skinned_nodes();
+    if ( shader ) {
+        if ( !this->model->get_vertex_layout().is_native() || !this->model->get_vertex_buffer() ) {
+            ev_log_warn("[ev::tools::gltf::SkinningSystem::SkinningSystem] Pre-skinning needs the native Vertex layout, only palettes are updated.");
+        } else {
+            setup_pipeline(std::move(shader));
+        }
+    }
+    setup_frames(frame_count);
+
+    ev_log_info("[ev::tools::gltf::SkinningSystem::SkinningSystem] %zu skinned nodes, %u joints.", skinned_nodes.size(), joint_count);
+}
+
+void SkinningSystem::collect_skinned_nodes() {
+    std::unordered_set<const Node*> visited;
+    for ( const auto& node : model->get_linear_nodes() ) {
+        if ( !visited.insert(node.get()).second || !node->get_mesh() ) {
+            continue;
+        }
+        const std::shared_ptr<Skin>& skin = node->get_skin();
+        const bool skinned = skin && !skin->get_joints().empty();
+        if ( skinned ) {
+            skinned_nodes.push_back({ node, joint_count });
+        }
+
+        Mesh::Uniform& uniform = node->get_mesh()->get_uniform_data();
+        uniform.joint_offset = skinned ? joint_count : NO_JOINTS;
+        uniform.joint_count = skinned ? static_cast<uint32_t>(skin->get_joints().size()) : 0;
+        node->get_mesh()->upload_uniform();
+
+        for ( const auto& primitive : node->get_mesh()->get_primitives() ) {
+            PushConstants dispatch = {};
+            dispatch.first_vertex = primitive->get_first_vertex();
+            dispatch.vertex_count = primitive->get_vertex_count();
+            dispatch.joint_offset = uniform.joint_offset;
+            dispatch.joint_count = uniform.joint_count;
+            if ( dispatch.vertex_count == 0 ) {
+                continue;
+            }
+            (skinned ? skinned_dispatches : static_dispatches).push_back(dispatch);
+        }
+        joint_count += uniform.joint_count;
+    }
+}
+
+void SkinningSystem::setup_pipeline(std::shared_ptr<ev::Shader> shader) {
+    descriptor_set_layout = std::make_shared<ev::DescriptorSetLayout>(device);
+    descriptor_set_layout->add_binding(VK_SHADER_STAGE_COMPUTE_BIT, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 0);
+    descriptor_set_layout->add_binding(VK_SHADER_STAGE_COMPUTE_BIT, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1);
+    descriptor_set_layout->add_binding(VK_SHADER_STAGE_COMPUTE_BIT, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2);
+    CHECK_RESULT(descriptor_set_layout->create_layout());
+
+    VkPushConstantRange push_constant_range = {};
+    push_constant_range.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    push_constant_range.offset = 0;
+    push_constant_range.size = sizeof(PushConstants);
+
+    pipeline_layout = std::make_shared<ev::PipelineLayout>(
+        device,
+        std::vector<std::shared_ptr<ev::DescriptorSetLayout>>{ descriptor_set_layout },
+        std::vector<VkPushConstantRange>{ push_constant_range }
+    );
+    pipeline = std::make_shared<ev::ComputePipeline>(device, pipeline_layout, shader);
+    CHECK_RESULT(pipeline->create_pipeline());
+}
+
+void SkinningSystem::setup_frames(uint32_t frame_count) {
+    frames.resize(frame_count);
+    if ( pipeline ) {
+        descriptor_pool = std::make_shared<ev::DescriptorPool>(device);
+        descriptor_pool->add(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 3 * frame_count);
+        CHECK_RESULT(descriptor_pool->create_pool(frame_count));
+    }
+
+    // 관절이 없어도 바인딩할 수 있도록 최소 한 개
+    const VkDeviceSize palette_size = static_cast<VkDeviceSize>(std::max(joint_count, 1u)) * sizeof(glm::mat4);
+    for ( Frame& frame : frames ) {
+        frame.palette_buffer = std::make_shared<ev::Buffer>(device, palette_size, ev::buffer_type::READONLY_STORAGE_BUFFER);
+        CHECK_RESULT(memory_allocator->allocate_buffer(frame.palette_buffer, ev::memory_type::HOST_READABLE));
+        CHECK_RESULT(frame.palette_buffer->map(palette_size));
+
+        if ( !pipeline ) {
+            continue;
+        }
+        const VkDeviceSize skinned_size = static_cast<VkDeviceSize>(model->get_vertex_count()) * sizeof(SkinnedVertex);
+        frame.skinned_buffer = std::make_shared<ev::Buffer>(
+            device,
+            skinned_size,
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+        );
+        CHECK_RESULT(memory_allocator->allocate_buffer(frame.skinned_buffer, ev::memory_type::GPU_ONLY));
+
+        frame.descriptor_set = descriptor_pool->allocate(descriptor_set_layout);
+        frame.descriptor_set->write_buffer(0, frame.palette_buffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        frame.descriptor_set->write_buffer(1, model->get_vertex_buffer(), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        frame.descriptor_set->write_buffer(2, frame.skinned_buffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        CHECK_RESULT(frame.descriptor_set->update());
+    }
+}
+
+glm::mat4 SkinningSystem::get_world_matrix(const Node& node) const {
+    // 노드는 모델의 hierarchy 를 가리키므로 같은 번호의 항목을 transforms 에서 읽음
+    if ( transforms && node.get_transform_hierarchy() ) {
+        return glm::make_mat4(transforms->get_world_matrix(node.get_transform_index()));
+    }
+    return node.get_world_matrix();
+}
+
+void SkinningSystem::update(uint32_t frame_index, bool parallel) {
+    if ( skinned_nodes.empty() ) {
+        return;
+    }
+    glm::mat4* palette = static_cast<glm::mat4*>(frames[frame_index].palette_buffer->get_mapped_ptr());
+
+    auto update_range = [&](uint32_t begin, uint32_t end) {
+        for ( uint32_t i = begin ; i < end ; ++i ) {
+            const SkinnedNode& entry = skinned_nodes[i];
+            const Skin& skin = *entry.node->get_skin();
+            const auto& joints = skin.get_joints();
+            const auto& inverse_bind_matrices = skin.get_inverse_bind_matrices();
+            const glm::mat4 inverse_node = glm::inverse(get_world_matrix(*entry.node));
+            glm::mat4* dst = palette + entry.joint_offset;
+            for ( size_t j = 0 ; j < joints.size() ; ++j ) {
+                glm::mat4 joint = inverse_node * get_world_matrix(*joints[j]);
+                if ( j < inverse_bind_matrices.size() ) {
+                    joint *= inverse_bind_matrices[j];
+                }
+                // 매핑된 메모리에는 순서대로 한 번씩만 기록
+                dst[j] = joint;
+            }
+        }
+    };
+    if ( parallel ) {
+        ev::tools::parallel_for(static_cast<uint32_t>(skinned_nodes.size()), update_range, NODE_GRAIN);
+    } else {
+        update_range(0, static_cast<uint32_t>(skinned_nodes.size()));
+    }
+}
+
+void SkinningSystem::record_dispatches(std::shared_ptr<ev::CommandBuffer> command_buffer, const std::vector<PushConstants>& dispatches) {
+    for ( const PushConstants& push_constants : dispatches ) {
+        command_buffer->bind_push_constants(pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, &push_constants, sizeof(PushConstants));
+        command_buffer->dispatch((push_constants.vertex_count + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE);
+    }
+}
+
+void SkinningSystem::dispatch(std::shared_ptr<ev::CommandBuffer> command_buffer, uint32_t frame_index) {
+    if ( !pipeline ) {
+        return;
+    }
+    Frame& frame = frames[frame_index];
+    if ( frame.initialized && skinned_dispatches.empty() ) {
+        return;
+    }
+
+    // 이전 프레임의 vertex input 읽기가 끝난 뒤 덮어씀
+    command_buffer->pipeline_barrier(
+        VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        {},
+        {ev::BufferMemoryBarrier(
+            frame.skinned_buffer,
+            VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT,
+            VK_ACCESS_SHADER_WRITE_BIT
+        )},
+        {}
+    );
+    command_buffer->bind_compute_pipeline(pipeline);
+    command_buffer->bind_descriptor_sets(VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, { frame.descriptor_set });
+    if ( !frame.initialized ) {
+        record_dispatches(command_buffer, static_dispatches);
+        frame.initialized = true;
+    }
+    record_dispatches(command_buffer, skinned_dispatches);
+    command_buffer->pipeline_barrier(
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+        {},
+        {ev::BufferMemoryBarrier(
+            frame.skinned_buffer,
+            VK_ACCESS_SHADER_WRITE_BIT,
+            VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT
+        )},
+        {}
+    );
+}
+
+void SkinningSystem::bind_skinned_vertices(std::shared_ptr<ev::CommandBuffer> command_buffer, uint32_t frame_index, uint32_t binding) {
+    if ( !frames[frame_index].skinned_buffer ) {
+        ev_log_error("[ev::tools::gltf::SkinningSystem::bind_skinned_vertices] Pre-skinning is not enabled.");
+        return;
+    }
+    command_buffer->bind_vertex_buffers(binding, { frames[frame_index].skinned_buffer }, { 0 });
+}
+
+VkVertexInputBindingDescription SkinningSystem::input_binding_description(uint32_t binding) {
+    VkVertexInputBindingDescription description = {};
+    description.binding = binding;
+    description.stride = sizeof(SkinnedVertex);
+    description.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+    return description;
+}
+
+std::vector<VkVertexInputAttributeDescription> SkinningSystem::input_attribute_descriptions(
+    uint32_t binding,
+    uint32_t position_location,
+    uint32_t normal_location
+) {
+    VkVertexInputAttributeDescription position = {};
+    position.binding = binding;
+    position.location = position_location;
+    position.format = VK_FORMAT_R32G32B32A32_SFLOAT;
+    position.offset = offsetof(SkinnedVertex, position);
+
+    VkVertexInputAttributeDescription normal = position;
+    normal.location = normal_location;
+    normal.offset = offsetof(SkinnedVertex, normal);
+    return { position, normal };
+}
+
+void SkinningSystem::destroy() {
+    for ( Frame& frame : frames ) {
+        frame.descriptor_set.reset();
+        if ( frame.palette_buffer ) {
+            frame.palette_buffer->unmap();
+        }
+        frame.palette_buffer.reset();
+        frame.skinned_buffer.reset();
+    }
+    frames.clear();
+    transforms.reset();
+    pipeline.reset();
+    pipeline_layout.reset();
+    descriptor_pool.reset();
+    descriptor_set_layout.reset();
+    ev_log_debug("[ev::tools::gltf::SkinningSystem::destroy] SkinningSystem destroyed.");
+}
+
+SkinningSystem::~SkinningSystem() {
+    destroy();
+}
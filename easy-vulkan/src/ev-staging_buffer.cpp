@@ -0,0 +1,91 @@
+#include "tools/ev-staging_buffer.h"
+#include "ev-macro.h"
+
+using namespace ev::tools;
+
+StagingBuffer::StagingBuffer(
+    std::shared_ptr<ev::Device> device,
+    VkDeviceSize capacity
+) : device(std::move(device)) {
+    ev_log_debug("[ev::tools::StagingBuffer::StagingBuffer] Creating staging buffer with capacity: %llu", static_cast<unsigned long long>(capacity));
+    if ( !this->device ) {
+        ev_log_error("[ev::tools::StagingBuffer::StagingBuffer] Invalid device provided for StagingBuffer creation.");
+        exit(EXIT_FAILURE);
+    }
+    CHECK_RESULT(create(capacity));
+}
+
+VkResult StagingBuffer::create(VkDeviceSize capacity) {
+    destroy();
+    capacity = std::max<VkDeviceSize>(capacity, 4);
+
+    buffer = std::make_shared<ev::Buffer>(
+        device,
+        capacity,
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+    );
+    memory = std::make_shared<ev::Memory>(
+        device,
+        capacity,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        buffer->get_memory_requirements()
+    );
+
+    VkResult result = buffer->bind_memory(memory, 0, capacity);
+    if ( result != VK_SUCCESS ) {
+        ev_log_error("[ev::tools::StagingBuffer::create] Failed to bind staging memory.");
+        return result;
+    }
+    result = buffer->map(capacity);
+    if ( result != VK_SUCCESS ) {
+        ev_log_error("[ev::tools::StagingBuffer::create] Failed to map staging memory.");
+        return result;
+    }
+
+    mapped = static_cast<uint8_t*>(buffer->get_mapped_ptr());
+    this->capacity = capacity;
+    head = 0;
+    return VK_SUCCESS;
+}
+
+StagingBuffer::Allocation StagingBuffer::allocate(VkDeviceSize size, VkDeviceSize alignment) {
+    Allocation allocation = {};
+    if ( alignment == 0 ) {
+        alignment = 1;
+    }
+    VkDeviceSize offset = (head + alignment - 1) & ~(alignment - 1);
+    if ( offset + size > capacity ) {
+        ev_log_error("[ev::tools::StagingBuffer::allocate] Out of staging memory (requested: %llu, used: %llu, capacity: %llu)",
+            static_cast<unsigned long long>(size),
+            static_cast<unsigned long long>(head),
+            static_cast<unsigned long long>(capacity));
+        return allocation;
+    }
+    head = offset + size;
+    allocation.offset = offset;
+    allocation.size = size;
+    allocation.data = mapped + offset;
+    return allocation;
+}
+
+VkResult StagingBuffer::reserve(VkDeviceSize capacity) {
+    if ( capacity <= this->capacity ) {
+        return VK_SUCCESS;
+    }
+    // 반복적인 재할당을 피하기 위해 최소 두 배로 늘림
+    return create(std::max(capacity, this->capacity * 2));
+}
+
+void StagingBuffer::destroy() {
+    // Buffer 가 VkDeviceMemory 를 참조하므로 unmap 을 위해 메모리보다 먼저 해제
+    buffer.reset();
+    memory.reset();
+    mapped = nullptr;
+    capacity = 0;
+    head = 0;
+}
+
+StagingBuffer::~StagingBuffer() {
+    destroy();
+    ev_log_debug("[ev::tools::StagingBuffer::~StagingBuffer] StagingBuffer destroyed.");
+}
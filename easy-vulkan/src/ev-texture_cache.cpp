@@ -0,0 +1,10 @@
+#include "tools/ev-texture_cache.h"
+#include "tools/ev-hash.h"
+
+ev::tools::ResourceKey ev::tools::make_resource_key(const void* source, size_t source_size, const void* params, size_t params_size) {
+    ResourceKey key;
+    key.content_hash = hash64(source, source_size);
+    // 파라미터가 없어도 content_hash 와 구분되도록 다른 seed 사용
+    key.params_hash = hash64(params, params_size, 1);
+    return key;
+}
@@ -1,190 +1,353 @@
 #include "tools/ev-texture_loader.h"
+#include <algorithm>
+#include <cstring>
 
 using namespace ev::tools;
 
-std::vector<uint8_t> TextureLoader::load_data(std::filesystem::path file_path, int& width, int& height, int& channels) {
-    ev_log_info("[TextureLoader::load_data] Loading texture data from file: %s", file_path.string().c_str());
-    
-    // Use stb_image to load the image data
-    std::vector<uint8_t> data;
-    unsigned char* img_data = stbi_load(file_path.string().c_str(), &width, &height, &channels, 0);
-    
-    if (!img_data) {
-        ev_log_error("[TextureLoader::load_data] Failed to load image: %s", file_path.string().c_str());
-        return data;
+static int format_channel_count(VkFormat format) {
+    switch ( format ) {
+        case VK_FORMAT_R8_UNORM:
+        case VK_FORMAT_R8_SRGB:
+        case VK_FORMAT_R16_SFLOAT:
+            return 1;
+        case VK_FORMAT_R8G8_UNORM:
+        case VK_FORMAT_R8G8_SRGB:
+        case VK_FORMAT_R16G16_SFLOAT:
+            return 2;
+        case VK_FORMAT_R8G8B8_UNORM:
+        case VK_FORMAT_R8G8B8_SRGB:
+            return 3;
+        default:
+            return 4;
     }
-
-    data.assign(img_data, img_data + (width * height * channels));
-    stbi_image_free(img_data);
-    
-    ev_log_info("[TextureLoader::load_data] Texture data loaded successfully from file: %s", file_path.string().c_str());
-    return data;
 }
 
-Texture2DLoader::Texture2DLoader(
-    std::shared_ptr<ev::Device> device,
-    std::shared_ptr<ev::CommandPool> command_pool,
-    std::shared_ptr<ev::Queue> transfer_queue,
-    std::shared_ptr<ev::MemoryAllocator> memory_allocator
-) : TextureLoader(std::move(device), std::move(command_pool), std::move(transfer_queue), std::move(memory_allocator)) {
-    ev_log_info("[Texture2DLoader::Texture2DLoader] Created Texture2DLoader.");
+static bool is_half_float_format(VkFormat format) {
+    return format == VK_FORMAT_R16_SFLOAT
+        || format == VK_FORMAT_R16G16_SFLOAT
+        || format == VK_FORMAT_R16G16B16A16_SFLOAT;
+}
 
-    if (!m_device || !m_command_pool || !m_transfer_queue || !m_memory_allocator) {
-        ev_log_error("[Texture2DLoader::Texture2DLoader] Invalid parameters provided for Texture2DLoader creation.");
-        exit(EXIT_FAILURE);
+static VkDeviceSize format_texel_size(VkFormat format) {
+    switch ( format ) {
+        case VK_FORMAT_R8_UNORM:
+        case VK_FORMAT_R8_SRGB:
+            return 1;
+        case VK_FORMAT_R8G8_UNORM:
+        case VK_FORMAT_R8G8_SRGB:
+        case VK_FORMAT_R16_UNORM:
+        case VK_FORMAT_R16_SFLOAT:
+            return 2;
+        case VK_FORMAT_R8G8B8_UNORM:
+        case VK_FORMAT_R8G8B8_SRGB:
+            return 3;
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+        case VK_FORMAT_B8G8R8A8_UNORM:
+        case VK_FORMAT_B8G8R8A8_SRGB:
+        case VK_FORMAT_R16G16_UNORM:
+        case VK_FORMAT_R16G16_SFLOAT:
+        case VK_FORMAT_R32_SFLOAT:
+        case VK_FORMAT_R32_UINT:
+            return 4;
+        case VK_FORMAT_R16G16B16A16_UNORM:
+        case VK_FORMAT_R16G16B16A16_SFLOAT:
+        case VK_FORMAT_R32G32_SFLOAT:
+            return 8;
+        case VK_FORMAT_R32G32B32A32_SFLOAT:
+            return 16;
+        default:
+            return 0;
     }
-
-    ev_log_info("[Texture2DLoader::Texture2DLoader] Created Texture2DLoader completed");
 }
 
-std::shared_ptr<ev::Texture> Texture2DLoader::__load_from_file(
-    std::filesystem::path file_path,
-    VkFormat format,
-    VkImageUsageFlags usage_flags,
-    VkImageLayout final_layout,
-    uint32_t mip_levels
-) {
-    ev_log_info("[Texture2DLoader::load_from_file] Loading texture from file: %s", file_path.string().c_str());
-
-    int width, height, channels;
-    std::vector<uint8_t> data = load_data(file_path, width, height, channels);
-    
-    if (data.empty()) {
-        ev_log_error("[Texture2DLoader::load_from_file] Failed to load texture data from file: %s", file_path.string().c_str());
-        return nullptr;
+TextureLoader::DecodedImage TextureLoader::decode(const std::filesystem::path& file_path, VkFormat format, bool keep_packed) {
+    DecodedImage image;
+    MappedFile file(file_path);
+    if ( !file.is_open() || file.get_size() == 0 || file.get_size() > static_cast<size_t>(INT32_MAX) ) {
+        ev_log_error("[TextureLoader::decode] Failed to read image file: %s", file_path.string().c_str());
+        return image;
     }
 
-    if ( mip_levels == 0 ) {
-        mip_levels = static_cast<uint32_t>(std::floor(std::log2(std::max(width, height)))) + 1;
+    const stbi_uc* bytes = file.get_data();
+    const int length = static_cast<int>(file.get_size());
+    void* pixels = nullptr;
+
+    if ( is_half_float_format(format) ) {
+        // HDR 이미지는 그대로, LDR 이미지는 [0, 1] 로 정규화된 float 로 읽어 half float 로 변환
+        const int format_channels = format_channel_count(format);
+        pixels = stbi_loadf_from_memory(bytes, length, &image.width, &image.height, &image.channels, format_channels);
+        image.channels = format_channels;
+        image.is_float = true;
+    } else if ( keep_packed && stbi_is_16_bit_from_memory(bytes, length) ) {
+        pixels = stbi_load_16_from_memory(bytes, length, &image.width, &image.height, &image.channels, 0);
+        image.bytes_per_channel = 2;
+    } else {
+        pixels = stbi_load_from_memory(bytes, length, &image.width, &image.height, &image.channels, 0);
     }
 
-    std::shared_ptr<ev::Image> image = std::make_shared<ev::Image>(
-        m_device,
-        VK_IMAGE_TYPE_2D,
-        format,
-        static_cast<uint32_t>(width),
-        static_cast<uint32_t>(height),
-        1, // depth
-        mip_levels,
-        1, // array layers
-        usage_flags,
-        VK_IMAGE_LAYOUT_UNDEFINED,
-        VK_SAMPLE_COUNT_1_BIT,
-        VK_IMAGE_TILING_OPTIMAL,
-        0, // flags
-        VK_SHARING_MODE_EXCLUSIVE,
-        0, // queue family count
-        nullptr, // queue family indices
-        nullptr // pNext
-    );
-
-    std::vector<VkBufferImageCopy> copy_regions;
-    VkDeviceSize offset = 0;
-    for ( uint32_t i = 0 ; i < mip_levels ; ++i ) {
-        VkBufferImageCopy region = {};
-        region.bufferOffset = offset; // Offset in the buffer
-        region.bufferRowLength = 0; // Row length in pixels
-        region.bufferImageHeight = 0; // Image height in pixels
-        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        region.imageSubresource.mipLevel = i;
-        region.imageSubresource.baseArrayLayer = 0;
-        region.imageSubresource.layerCount = 1;
-        region.imageOffset = {0, 0, 0};
-        region.imageExtent = {
-            static_cast<uint32_t>(width >> i),
-            static_cast<uint32_t>(height >> i),
-            1 // depth
-        };
-        copy_regions.push_back(region);
-        offset += region.imageExtent.width * region.imageExtent.height * channels;
+    if ( !pixels ) {
+        ev_log_error("[TextureLoader::decode] Failed to decode image: %s (%s)", file_path.string().c_str(), stbi_failure_reason());
+        return image;
     }
+    image.pixels.reset(pixels);
+    return image;
+}
 
+VkDeviceSize TextureLoader::converted_size(const DecodedImage& image, VkFormat format) {
+    const VkDeviceSize pixel_count = static_cast<VkDeviceSize>(image.width) * image.height;
+    const int format_channels = format_channel_count(format);
+    if ( image.is_float ) {
+        return pixel_count * image.channels * sizeof(uint16_t);
+    }
+    if ( image.bytes_per_channel == 1 && ((image.channels == 3 && format_channels == 4) || (image.channels == 4 && format_channels == 1)) ) {
+        return pixel_count * format_channels;
+    }
+    return image.size();
+}
 
-    VkResult result = m_memory_allocator->allocate_image(image, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+void TextureLoader::convert_pixels(const DecodedImage& image, VkFormat format, void* dst, bool premultiply_alpha) {
+    const size_t pixel_count = static_cast<size_t>(image.width) * image.height;
+    const int format_channels = format_channel_count(format);
+    const void* src = image.pixels.get();
 
-    if (result != VK_SUCCESS) {
-        ev_log_error("[Texture2DLoader::load_from_file] Failed to allocate memory for image: %s", file_path.string().c_str());
-        exit(EXIT_FAILURE);
+    if ( image.is_float ) {
+        ev::tools::pixel::r32f_to_r16f(static_cast<const float*>(src), static_cast<uint16_t*>(dst), pixel_count * image.channels);
+        return;
     }
+    if ( image.bytes_per_channel == 1 && image.channels == 3 && format_channels == 4 ) {
+        ev::tools::pixel::rgb8_to_rgba8(static_cast<const uint8_t*>(src), static_cast<uint8_t*>(dst), pixel_count);
+        return;
+    }
+    if ( image.bytes_per_channel == 1 && image.channels == 4 && format_channels == 1 ) {
+        ev::tools::pixel::rgba8_to_luminance8(static_cast<const uint8_t*>(src), static_cast<uint8_t*>(dst), pixel_count);
+        return;
+    }
+    if ( image.channels != format_channels ) {
+        ev_log_warn("[TextureLoader::convert_pixels] Channel count mismatch (image: %d, format: %d)", image.channels, format_channels);
+    }
+    std::memcpy(dst, src, image.size());
+    // RGB 에서 확장한 경우는 알파가 255 이므로 원본에 알파가 있을 때만 곱함
+    if ( premultiply_alpha && image.bytes_per_channel == 1 && image.channels == 4 && format_channels == 4 ) {
+        ev::tools::pixel::premultiply_rgba8(static_cast<uint8_t*>(dst), pixel_count);
+    }
+}
 
-    std::shared_ptr<ev::Buffer> staging_buffer = std::make_shared<ev::Buffer>(
-        m_device,
-        data.size(),
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT
-    );
-
-    result = m_memory_allocator->allocate_buffer(staging_buffer, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-    if (result != VK_SUCCESS) {
-        ev_log_error("[Texture2DLoader::load_from_file] Failed to allocate staging buffer for image: %s", file_path.string().c_str());
-        exit(EXIT_FAILURE);
+StagingBuffer::Allocation TextureLoader::acquire_staging(VkDeviceSize size) {
+    if ( !m_staging_buffer ) {
+        m_staging_buffer = std::make_shared<StagingBuffer>(m_device, size);
+    } else {
+        // upload_staging 은 완료될 때까지 대기하므로 이전 영역을 바로 재사용할 수 있음
+        m_staging_buffer->reset();
+        CHECK_RESULT(m_staging_buffer->reserve(size));
     }
-    staging_buffer->map();
-    staging_buffer->write(data.data(), data.size());
-    staging_buffer->flush();
-    staging_buffer->unmap();
-    ev_log_debug("[Texture2DLoader::load_from_file] Staging buffer created and data written successfully.");
+    return m_staging_buffer->allocate(size);
+}
+
+void TextureLoader::upload_staging(std::shared_ptr<ev::Image> image, const StagingBuffer::Allocation& allocation, VkImageLayout final_layout) {
+    const uint32_t mip_levels = image->get_mip_levels();
+    const VkExtent3D extent = image->get_extent();
 
     std::shared_ptr<ev::CommandBuffer> command_buffer = m_command_pool->allocate(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
     if (!command_buffer) {
-        ev_log_error("[Texture2DLoader::load_from_file] Failed to allocate command buffer for image: %s", file_path.string().c_str());
+        ev_log_error("[TextureLoader::upload_staging] Failed to allocate command buffer.");
         exit(EXIT_FAILURE);
     }
     command_buffer->begin();
 
-    ImageMemoryBarrier barrier = ImageMemoryBarrier(
-        image,
-        0, // src access mask
-        VK_ACCESS_TRANSFER_WRITE_BIT, // dst access mask
-        VK_IMAGE_LAYOUT_UNDEFINED, // old layout
-        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, // new layout
-        VK_QUEUE_FAMILY_IGNORED, // src queue family index
-        VK_QUEUE_FAMILY_IGNORED, // dst queue family index
-        {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1} // subresource range
-    );
     command_buffer->pipeline_barrier(
         VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
         VK_PIPELINE_STAGE_TRANSFER_BIT,
-        {barrier},
+        {ImageMemoryBarrier(
+            image,
+            0, // src access mask
+            VK_ACCESS_TRANSFER_WRITE_BIT, // dst access mask
+            VK_IMAGE_LAYOUT_UNDEFINED, // old layout
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, // new layout
+            VK_QUEUE_FAMILY_IGNORED, // src queue family index
+            VK_QUEUE_FAMILY_IGNORED, // dst queue family index
+            {VK_IMAGE_ASPECT_COLOR_BIT, 0, mip_levels, 0, 1} // subresource range
+        )},
         {}, // no buffer barriers
         {} // no memory barriers
     );
+
+    VkBufferImageCopy region = {};
+    region.bufferOffset = allocation.offset;
+    region.bufferRowLength = 0; // tightly packed
+    region.bufferImageHeight = 0;
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.mipLevel = 0;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = 1;
+    region.imageOffset = {0, 0, 0};
+    region.imageExtent = extent;
     command_buffer->copy_buffer_to_image(
         image,
-        staging_buffer,
+        m_staging_buffer->get_buffer(),
         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-        copy_regions
+        { region }
     );
 
-    barrier = ImageMemoryBarrier(
-        image,
-        VK_ACCESS_TRANSFER_WRITE_BIT, // src access mask
-        VK_ACCESS_SHADER_READ_BIT, // dst access mask
-        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, // old layout
-        final_layout, // new layout
-        VK_QUEUE_FAMILY_IGNORED, // src queue family index
-        VK_QUEUE_FAMILY_IGNORED, // dst queue family index
-        {VK_IMAGE_ASPECT_COLOR_BIT, 0, mip_levels, 0, 1} // subresource range
-    );
     command_buffer->pipeline_barrier(
         VK_PIPELINE_STAGE_TRANSFER_BIT,
         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-        {barrier},
+        {ImageMemoryBarrier(
+            image,
+            VK_ACCESS_TRANSFER_WRITE_BIT, // src access mask
+            VK_ACCESS_SHADER_READ_BIT, // dst access mask
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, // old layout
+            final_layout, // new layout
+            VK_QUEUE_FAMILY_IGNORED, // src queue family index
+            VK_QUEUE_FAMILY_IGNORED, // dst queue family index
+            {VK_IMAGE_ASPECT_COLOR_BIT, 0, mip_levels, 0, 1} // subresource range
+        )},
         {}, // no buffer barriers
         {} // no memory barriers
     );
     command_buffer->end();
-    std::shared_ptr<ev::Fence> fence = std::make_shared<ev::Fence>(m_device);
-    if (!fence) {
-        ev_log_error("[Texture2DLoader::load_from_file] Failed to create fence for command buffer execution: %s", file_path.string().c_str());
+
+    std::shared_ptr<ev::Fence> fence = std::make_shared<ev::Fence>(m_device, 0);
+    VkPipelineStageFlags wait_stages = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    CHECK_RESULT(m_transfer_queue->submit(command_buffer, {}, {}, &wait_stages, fence));
+    CHECK_RESULT(fence->wait());
+    image->transient_layout(final_layout);
+}
+
+bool TextureLoader::supports_mip_generation(VkFormat format) const {
+    const VkFormatFeatureFlags required = VK_FORMAT_FEATURE_BLIT_SRC_BIT
+        | VK_FORMAT_FEATURE_BLIT_DST_BIT
+        | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+    VkFormatProperties props = m_device->get_physical_device()->get_format_properties(format);
+    return (props.optimalTilingFeatures & required) == required;
+}
+
+void TextureLoader::generate_mipmaps(std::shared_ptr<ev::Image> image, VkImageLayout final_layout) {
+    const uint32_t mip_levels = image->get_mip_levels();
+    const VkExtent3D extent = image->get_extent();
+
+    std::shared_ptr<ev::CommandBuffer> command_buffer = m_command_pool->allocate(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+    if (!command_buffer) {
+        ev_log_error("[TextureLoader::generate_mipmaps] Failed to allocate command buffer.");
         exit(EXIT_FAILURE);
     }
-    VkPipelineStageFlags wait_stages = VK_PIPELINE_STAGE_TRANSFER_BIT;
-    m_transfer_queue->submit(command_buffer, {}, {}, &wait_stages, fence);
-    fence->wait();
-    fence->destroy();
+    command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
 
-    ev_log_info("[Texture2DLoader::load_from_file] Texture loaded successfully from file: %s", file_path.string().c_str());
+    // 업로드(복사 또는 GPU 확장)에서 쓴 level 0 을 blit 원본으로 읽을 수 있게 함
+    command_buffer->pipeline_barrier(
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        {ImageMemoryBarrier(
+            image,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_ACCESS_TRANSFER_READ_BIT,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1}
+        )},
+        {},
+        {}
+    );
+
+    for ( uint32_t i = 1 ; i < mip_levels ; ++i ) {
+        const VkImageSubresourceRange mip_range = {VK_IMAGE_ASPECT_COLOR_BIT, i, 1, 0, 1};
+        command_buffer->pipeline_barrier(
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            {ImageMemoryBarrier(
+                image,
+                0,
+                VK_ACCESS_TRANSFER_WRITE_BIT,
+                VK_IMAGE_LAYOUT_UNDEFINED,
+                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                VK_QUEUE_FAMILY_IGNORED,
+                VK_QUEUE_FAMILY_IGNORED,
+                mip_range
+            )},
+            {},
+            {}
+        );
+
+        VkImageBlit blit = {};
+        blit.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, i - 1, 0, 1};
+        blit.srcOffsets[1] = { std::max(1, int32_t(extent.width >> (i - 1))), std::max(1, int32_t(extent.height >> (i - 1))), 1 };
+        blit.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, i, 0, 1};
+        blit.dstOffsets[1] = { std::max(1, int32_t(extent.width >> i)), std::max(1, int32_t(extent.height >> i)), 1 };
+        command_buffer->blit_image(
+            image,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            image,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            {blit},
+            VK_FILTER_LINEAR
+        );
+
+        // 다음 level 의 원본이 되도록 전환
+        command_buffer->pipeline_barrier(
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            {ImageMemoryBarrier(
+                image,
+                VK_ACCESS_TRANSFER_WRITE_BIT,
+                VK_ACCESS_TRANSFER_READ_BIT,
+                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                VK_QUEUE_FAMILY_IGNORED,
+                VK_QUEUE_FAMILY_IGNORED,
+                mip_range
+            )},
+            {},
+            {}
+        );
+    }
+
+    command_buffer->pipeline_barrier(
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+        {ImageMemoryBarrier(
+            image,
+            VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_ACCESS_SHADER_READ_BIT,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            final_layout,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            {VK_IMAGE_ASPECT_COLOR_BIT, 0, mip_levels, 0, 1}
+        )},
+        {},
+        {}
+    );
+    command_buffer->end();
+
+    std::shared_ptr<ev::Fence> fence = std::make_shared<ev::Fence>(m_device, 0);
+    CHECK_RESULT(m_transfer_queue->submit(command_buffer, {}, {}, nullptr, fence));
+    CHECK_RESULT(fence->wait());
+    image->transient_layout(final_layout);
+}
+
+Texture2DLoader::Texture2DLoader(
+    std::shared_ptr<ev::Device> device,
+    std::shared_ptr<ev::CommandPool> command_pool,
+    std::shared_ptr<ev::Queue> transfer_queue,
+    std::shared_ptr<ev::MemoryAllocator> memory_allocator
+) : TextureLoader(std::move(device), std::move(command_pool), std::move(transfer_queue), std::move(memory_allocator)) {
+    ev_log_info("[Texture2DLoader::Texture2DLoader] Created Texture2DLoader.");
+
+    if (!m_device || !m_command_pool || !m_transfer_queue || !m_memory_allocator) {
+        ev_log_error("[Texture2DLoader::Texture2DLoader] Invalid parameters provided for Texture2DLoader creation.");
+        exit(EXIT_FAILURE);
+    }
 
+    ev_log_info("[Texture2DLoader::Texture2DLoader] Created Texture2DLoader completed");
+}
+
+std::shared_ptr<ev::Texture> Texture2DLoader::make_texture(
+    std::shared_ptr<ev::Image> image,
+    VkFormat format,
+    uint32_t mip_levels
+) {
     VkComponentMapping components = {
         VK_COMPONENT_SWIZZLE_IDENTITY, // r
         VK_COMPONENT_SWIZZLE_IDENTITY, // g
@@ -236,6 +399,95 @@ std::shared_ptr<ev::Texture> Texture2DLoader::__load_from_file(
     );
 }
 
+std::shared_ptr<ev::Texture> Texture2DLoader::__load_from_file(
+    std::filesystem::path file_path,
+    VkFormat format,
+    VkImageUsageFlags usage_flags,
+    VkImageLayout final_layout,
+    uint32_t mip_levels
+) {
+    ev_log_info("[Texture2DLoader::load_from_file] Loading texture from file: %s", file_path.string().c_str());
+
+    const bool try_gpu_unpack = m_pixel_unpacker && PixelUnpacker::supports(format);
+    DecodedImage decoded = decode(file_path, format, try_gpu_unpack);
+    if (!decoded.pixels) {
+        ev_log_error("[Texture2DLoader::load_from_file] Failed to load texture data from file: %s", file_path.string().c_str());
+        return nullptr;
+    }
+
+    bool gpu_unpack = false;
+    if ( try_gpu_unpack ) {
+        PixelUnpacker::FormatLayout layout = PixelUnpacker::get_format_layout(format);
+        gpu_unpack = layout.channels != static_cast<uint32_t>(decoded.channels)
+            || layout.bytes_per_channel != static_cast<uint32_t>(decoded.bytes_per_channel);
+    }
+
+    const int width = decoded.width;
+    const int height = decoded.height;
+    if ( mip_levels == 0 ) {
+        // blit 할 수 없는 포맷은 정의되지 않은 level 을 샘플링하지 않도록 level 0 만 생성
+        mip_levels = supports_mip_generation(format)
+            ? static_cast<uint32_t>(std::floor(std::log2(std::max(width, height)))) + 1
+            : 1;
+    }
+    const bool generate_mips = mip_levels > 1;
+    // mip 생성 중에는 level 0 을 blit 원본으로 사용
+    const VkImageLayout upload_layout = generate_mips ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : final_layout;
+    if ( generate_mips ) {
+        usage_flags |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    }
+
+    std::shared_ptr<ev::Image> image = std::make_shared<ev::Image>(
+        m_device,
+        VK_IMAGE_TYPE_2D,
+        format,
+        static_cast<uint32_t>(width),
+        static_cast<uint32_t>(height),
+        1, // depth
+        mip_levels,
+        1, // array layers
+        usage_flags,
+        VK_IMAGE_LAYOUT_UNDEFINED,
+        VK_SAMPLE_COUNT_1_BIT,
+        VK_IMAGE_TILING_OPTIMAL,
+        0, // flags
+        VK_SHARING_MODE_EXCLUSIVE,
+        0, // queue family count
+        nullptr, // queue family indices
+        nullptr // pNext
+    );
+
+    VkResult result = m_memory_allocator->allocate_image(image, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    if (result != VK_SUCCESS) {
+        ev_log_error("[Texture2DLoader::load_from_file] Failed to allocate memory for image: %s", file_path.string().c_str());
+        exit(EXIT_FAILURE);
+    }
+
+    if ( gpu_unpack ) {
+        // 패킹된 원본을 그대로 스테이징하고 GPU 에서 포맷에 맞게 확장
+        CHECK_RESULT(m_pixel_unpacker->upload(image, decoded.pixels.get(), width, height, decoded.channels, decoded.bytes_per_channel, upload_layout, decoded.channels == 1, m_premultiply_alpha));
+    } else {
+        // 디코더 출력에서 영구 매핑된 스테이징 메모리로 바로 변환 (중간 버퍼 없음)
+        StagingBuffer::Allocation staging = acquire_staging(converted_size(decoded, format));
+        if (!staging) {
+            ev_log_error("[Texture2DLoader::load_from_file] Failed to allocate staging memory for image: %s", file_path.string().c_str());
+            exit(EXIT_FAILURE);
+        }
+        convert_pixels(decoded, format, staging.data, m_premultiply_alpha);
+        decoded.pixels.reset();
+        ev_log_debug("[Texture2DLoader::load_from_file] Pixels written to staging buffer (%llu bytes).", static_cast<unsigned long long>(staging.size));
+        upload_staging(image, staging, upload_layout);
+    }
+    if ( generate_mips ) {
+        generate_mipmaps(image, final_layout);
+    }
+
+    ev_log_info("[Texture2DLoader::load_from_file] Texture loaded successfully from file: %s", file_path.string().c_str());
+
+    return make_texture(image, format, mip_levels);
+}
+
 std::shared_ptr<ev::Texture> Texture2DLoader::load_from_file(
     std::filesystem::path file_path,
     VkFormat format,
@@ -254,6 +506,70 @@ std::shared_ptr<ev::Texture> Texture2DLoader::load_from_raw_image(
     return __load_from_file(file_path, format, usage_flags, final_layout, 1);
 }
 
+std::shared_ptr<ev::Texture> Texture2DLoader::load_from_raw_data(
+    std::filesystem::path file_path,
+    uint32_t width,
+    uint32_t height,
+    VkFormat format,
+    VkImageUsageFlags usage_flags,
+    VkImageLayout final_layout
+) {
+    ev_log_info("[Texture2DLoader::load_from_raw_data] Loading raw texels from file: %s", file_path.string().c_str());
+
+    MappedFile file(file_path);
+    if ( !file.is_open() ) {
+        ev_log_error("[Texture2DLoader::load_from_raw_data] Failed to map file: %s", file_path.string().c_str());
+        return nullptr;
+    }
+
+    const VkDeviceSize texel_size = format_texel_size(format);
+    const VkDeviceSize size = static_cast<VkDeviceSize>(width) * height * texel_size;
+    if ( texel_size == 0 || size == 0 || file.get_size() < size ) {
+        ev_log_error("[Texture2DLoader::load_from_raw_data] File size %zu is smaller than %ux%u texels of format %d: %s",
+            file.get_size(), width, height, format, file_path.string().c_str());
+        return nullptr;
+    }
+
+    std::shared_ptr<ev::Image> image = std::make_shared<ev::Image>(
+        m_device,
+        VK_IMAGE_TYPE_2D,
+        format,
+        width,
+        height,
+        1, // depth
+        1, // mip levels
+        1, // array layers
+        usage_flags,
+        VK_IMAGE_LAYOUT_UNDEFINED,
+        VK_SAMPLE_COUNT_1_BIT,
+        VK_IMAGE_TILING_OPTIMAL,
+        0, // flags
+        VK_SHARING_MODE_EXCLUSIVE,
+        0, // queue family count
+        nullptr, // queue family indices
+        nullptr // pNext
+    );
+
+    VkResult result = m_memory_allocator->allocate_image(image, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    if (result != VK_SUCCESS) {
+        ev_log_error("[Texture2DLoader::load_from_raw_data] Failed to allocate memory for image: %s", file_path.string().c_str());
+        exit(EXIT_FAILURE);
+    }
+
+    // 페이지 캐시 -> 스테이징 메모리, 유일한 CPU 복사
+    StagingBuffer::Allocation staging = acquire_staging(size);
+    if (!staging) {
+        ev_log_error("[Texture2DLoader::load_from_raw_data] Failed to allocate staging memory for image: %s", file_path.string().c_str());
+        exit(EXIT_FAILURE);
+    }
+    std::memcpy(staging.data, file.get_data(), static_cast<size_t>(size));
+    file.close();
+    upload_staging(image, staging, final_layout);
+
+    ev_log_info("[Texture2DLoader::load_from_raw_data] Texture loaded successfully from file: %s", file_path.string().c_str());
+    return make_texture(image, format, 1);
+}
+
 std::shared_ptr<ev::Texture> Texture2DLoader::load_from_file_as_uniform(
     std::filesystem::path file_path,
     VkFormat format,
@@ -263,10 +579,11 @@ std::shared_ptr<ev::Texture> Texture2DLoader::load_from_file_as_uniform(
     ev_log_info("[Texture2DLoader::load_from_file_as_uniform] Loading texture as uniform from file: %s", file_path.string().c_str());
 ev_log_info("[Texture2DLoader::load_from_file] Loading texture from file: %s", file_path.string().c_str());
 
-    int width, height, channels;
-    std::vector<uint8_t> data = load_data(file_path, width, height, channels);
-    
-    if (data.empty()) {
+    DecodedImage decoded = decode(file_path, format, false);
+    const int width = decoded.width;
+    const int height = decoded.height;
+
+    if (!decoded.pixels) {
         ev_log_error("[Texture2DLoader::load_from_file] Failed to load texture data from file: %s", file_path.string().c_str());
         return nullptr;
     }
@@ -298,8 +615,9 @@ ev_log_info("[Texture2DLoader::load_from_file] Loading texture from file: %s", f
         exit(EXIT_FAILURE);
     }
 
+    // linear 이미지의 매핑 영역에 바로 변환
     CHECK_RESULT(image->map(0));
-    image->write(data.data(), data.size());
+    convert_pixels(decoded, format, image->get_mapped_ptr(), m_premultiply_alpha);
     image->flush();
     image->unmap();
 
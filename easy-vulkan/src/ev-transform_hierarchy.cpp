@@ -0,0 +1,281 @@
+#include "tools/ev-transform_hierarchy.h"
+#include "tools/ev-parallel.h"
+#include "ev-logger.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+using namespace ev::tools;
+
+namespace {
+
+/** 로컬 행렬을 한 번에 다시 계산할 노드 수 단위 */
+constexpr uint32_t LOCAL_GRAIN = 1024;
+
+constexpr float IDENTITY[16] = {
+    1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f
+};
+
+/**
+ * @brief dst = a * b (열 우선)
+ */
+inline void multiply(float* __restrict dst, const float* __restrict a, const float* __restrict b) {
+    for ( int c = 0 ; c < 4 ; ++c ) {
+        const float b0 = b[c * 4 + 0], b1 = b[c * 4 + 1], b2 = b[c * 4 + 2], b3 = b[c * 4 + 3];
+        for ( int r = 0 ; r < 4 ; ++r ) {
+            dst[c * 4 + r] = a[r] * b0 + a[4 + r] * b1 + a[8 + r] * b2 + a[12 + r] * b3;
+        }
+    }
+}
+
+}
+
+TransformHierarchy::TransformHierarchy(const std::vector<uint32_t>& parents)
+    : parents(parents) {
+    const uint32_t count = static_cast<uint32_t>(parents.size());
+
+    // 부모가 현재 조상 경로 위에 있어야 전위 순회 순서
+    std::vector<uint32_t> ancestors;
+    for ( uint32_t i = 0 ; i < count ; ++i ) {
+        const uint32_t parent = parents[i];
+        while ( !ancestors.empty() && ancestors.back() != parent ) {
+            ancestors.pop_back();
+        }
+        if ( parent != NO_PARENT && ancestors.empty() ) {
+            ev_log_error("[ev::tools::TransformHierarchy::TransformHierarchy] Node %u is not in pre-order (parent %u).", i, parent);
+            exit(EXIT_FAILURE);
+        }
+        ancestors.push_back(i);
+    }
+
+    subtree_sizes.assign(count, 1);
+    for ( uint32_t i = count ; i-- > 0 ; ) {
+        if ( parents[i] != NO_PARENT ) {
+            subtree_sizes[parents[i]] += subtree_sizes[i];
+        }
+    }
+
+    for ( auto& axis : translations ) {
+        axis.assign(count, 0.0f);
+    }
+    for ( uint32_t axis = 0 ; axis < 3 ; ++axis ) {
+        rotations[axis].assign(count, 0.0f);
+    }
+    rotations[W].assign(count, 1.0f);
+    for ( auto& axis : scales ) {
+        axis.assign(count, 1.0f);
+    }
+
+    local_matrices.resize(static_cast<size_t>(count) * 16);
+    world_matrices.resize(static_cast<size_t>(count) * 16);
+    for ( uint32_t i = 0 ; i < count ; ++i ) {
+        std::memcpy(&local_matrices[static_cast<size_t>(i) * 16], IDENTITY, sizeof(IDENTITY));
+        std::memcpy(&world_matrices[static_cast<size_t>(i) * 16], IDENTITY, sizeof(IDENTITY));
+    }
+
+    dirty.assign(count, 0);
+    matrix_overrides.assign(count, 0);
+    world_updated.assign(count, 0);
+
+    plan_tasks();
+}
+
+void TransformHierarchy::plan_tasks() {
+    const uint32_t count = static_cast<uint32_t>(parents.size());
+    std::vector<uint32_t> depths(count, 0);
+    std::vector<uint32_t> depth_counts;
+    for ( uint32_t i = 0 ; i < count ; ++i ) {
+        depths[i] = parents[i] == NO_PARENT ? 0 : depths[parents[i]] + 1;
+        if ( depths[i] >= depth_counts.size() ) {
+            depth_counts.resize(depths[i] + 1, 0);
+        }
+        ++depth_counts[depths[i]];
+    }
+    if ( depth_counts.empty() ) {
+        return;
+    }
+
+    // 스레드마다 두 개 이상 돌아갈 만큼 서브트리가 생기는 가장 얕은 깊이에서 나눔. 없으면 노드가 가장 많은 깊이
+    const uint32_t wanted = get_worker_count() * 2;
+    uint32_t split_depth = static_cast<uint32_t>(
+        std::max_element(depth_counts.begin(), depth_counts.end()) - depth_counts.begin());
+    for ( uint32_t depth = 0 ; depth < depth_counts.size() ; ++depth ) {
+        if ( depth_counts[depth] >= wanted ) {
+            split_depth = depth;
+            break;
+        }
+    }
+
+    serial_nodes.clear();
+    task_roots.clear();
+    for ( uint32_t i = 0 ; i < count ; ++i ) {
+        if ( depths[i] < split_depth ) {
+            serial_nodes.push_back(i);
+        } else if ( depths[i] == split_depth ) {
+            task_roots.push_back(i);
+        }
+    }
+}
+
+void TransformHierarchy::set_translation(uint32_t node, const float translation[3]) {
+    for ( uint32_t axis = 0 ; axis < 3 ; ++axis ) {
+        translations[axis][node] = translation[axis];
+    }
+    mark_dirty(node);
+}
+
+void TransformHierarchy::set_rotation(uint32_t node, const float rotation[4]) {
+    for ( uint32_t axis = 0 ; axis < 4 ; ++axis ) {
+        rotations[axis][node] = rotation[axis];
+    }
+    mark_dirty(node);
+}
+
+void TransformHierarchy::set_scale(uint32_t node, const float scale[3]) {
+    for ( uint32_t axis = 0 ; axis < 3 ; ++axis ) {
+        scales[axis][node] = scale[axis];
+    }
+    mark_dirty(node);
+}
+
+void TransformHierarchy::set_local_matrix(uint32_t node, const float matrix[16]) {
+    std::memcpy(&local_matrices[static_cast<size_t>(node) * 16], matrix, sizeof(float) * 16);
+    dirty[node] = 1;
+    matrix_overrides[node] = 1;
+    any_dirty = true;
+}
+
+void TransformHierarchy::get_translation(uint32_t node, float translation[3]) const {
+    for ( uint32_t axis = 0 ; axis < 3 ; ++axis ) {
+        translation[axis] = translations[axis][node];
+    }
+}
+
+void TransformHierarchy::get_rotation(uint32_t node, float rotation[4]) const {
+    for ( uint32_t axis = 0 ; axis < 4 ; ++axis ) {
+        rotation[axis] = rotations[axis][node];
+    }
+}
+
+void TransformHierarchy::get_scale(uint32_t node, float scale[3]) const {
+    for ( uint32_t axis = 0 ; axis < 3 ; ++axis ) {
+        scale[axis] = scales[axis][node];
+    }
+}
+
+void TransformHierarchy::update_local(uint32_t begin, uint32_t end) {
+    const float* __restrict tx = translations[X].data();
+    const float* __restrict ty = translations[Y].data();
+    const float* __restrict tz = translations[Z].data();
+    const float* __restrict qx = rotations[X].data();
+    const float* __restrict qy = rotations[Y].data();
+    const float* __restrict qz = rotations[Z].data();
+    const float* __restrict qw = rotations[W].data();
+    const float* __restrict sx = scales[X].data();
+    const float* __restrict sy = scales[Y].data();
+    const float* __restrict sz = scales[Z].data();
+    const uint8_t* __restrict overrides = matrix_overrides.data();
+    float* __restrict out = local_matrices.data();
+
+    // T * R * S. 성분 배열을 순서대로 읽으므로 컴파일러가 여러 노드를 한 번에 계산할 수 있음
+    for ( uint32_t i = begin ; i < end ; ++i ) {
+        if ( overrides[i] ) {
+            continue;
+        }
+        const float xx = qx[i] * qx[i], yy = qy[i] * qy[i], zz = qz[i] * qz[i];
+        const float xy = qx[i] * qy[i], xz = qx[i] * qz[i], yz = qy[i] * qz[i];
+        const float wx = qw[i] * qx[i], wy = qw[i] * qy[i], wz = qw[i] * qz[i];
+        float* m = out + static_cast<size_t>(i) * 16;
+        m[0] = (1.0f - 2.0f * (yy + zz)) * sx[i];
+        m[1] = 2.0f * (xy + wz) * sx[i];
+        m[2] = 2.0f * (xz - wy) * sx[i];
+        m[3] = 0.0f;
+        m[4] = 2.0f * (xy - wz) * sy[i];
+        m[5] = (1.0f - 2.0f * (xx + zz)) * sy[i];
+        m[6] = 2.0f * (yz + wx) * sy[i];
+        m[7] = 0.0f;
+        m[8] = 2.0f * (xz + wy) * sz[i];
+        m[9] = 2.0f * (yz - wx) * sz[i];
+        m[10] = (1.0f - 2.0f * (xx + yy)) * sz[i];
+        m[11] = 0.0f;
+        m[12] = tx[i];
+        m[13] = ty[i];
+        m[14] = tz[i];
+        m[15] = 1.0f;
+    }
+}
+
+void TransformHierarchy::update_world(uint32_t node) {
+    const uint32_t parent = parents[node];
+    const bool parent_updated = parent != NO_PARENT && world_updated[parent];
+    world_updated[node] = dirty[node] || parent_updated;
+    if ( !world_updated[node] ) {
+        return;
+    }
+    float* world = &world_matrices[static_cast<size_t>(node) * 16];
+    const float* local = &local_matrices[static_cast<size_t>(node) * 16];
+    if ( parent == NO_PARENT ) {
+        std::memcpy(world, local, sizeof(float) * 16);
+    } else {
+        multiply(world, &world_matrices[static_cast<size_t>(parent) * 16], local);
+    }
+}
+
+uint32_t TransformHierarchy::update(bool parallel) {
+    if ( !any_dirty ) {
+        return 0;
+    }
+    const uint32_t count = static_cast<uint32_t>(parents.size());
+
+    // 변경된 노드가 많으면 전체를 연속으로 다시 계산하고, 적으면 변경된 노드만 계산
+    std::vector<uint32_t> dirty_nodes;
+    for ( uint32_t i = 0 ; i < count ; ++i ) {
+        if ( dirty[i] ) {
+            dirty_nodes.push_back(i);
+        }
+    }
+    if ( dirty_nodes.size() * 4 >= count ) {
+        if ( parallel ) {
+            parallel_for(count, [this](uint32_t begin, uint32_t end) {
+                update_local(begin, end);
+            }, LOCAL_GRAIN);
+        } else {
+            update_local(0, count);
+        }
+    } else {
+        for ( uint32_t node : dirty_nodes ) {
+            update_local(node, node + 1);
+        }
+    }
+
+    // 부모가 먼저 처리되도록 얕은 노드는 순서대로, 그 아래 서브트리는 구간별로 나누어 처리
+    for ( uint32_t node : serial_nodes ) {
+        update_world(node);
+    }
+    auto update_subtrees = [this](uint32_t begin, uint32_t end) {
+        for ( uint32_t task = begin ; task < end ; ++task ) {
+            const uint32_t root = task_roots[task];
+            const uint32_t last = root + subtree_sizes[root];
+            for ( uint32_t node = root ; node < last ; ++node ) {
+                update_world(node);
+            }
+        }
+    };
+    if ( parallel ) {
+        parallel_for(static_cast<uint32_t>(task_roots.size()), update_subtrees);
+    } else {
+        update_subtrees(0, static_cast<uint32_t>(task_roots.size()));
+    }
+
+    uint32_t updated_count = 0;
+    for ( uint32_t i = 0 ; i < count ; ++i ) {
+        updated_count += world_updated[i];
+        world_updated[i] = 0;
+        dirty[i] = 0;
+    }
+    any_dirty = false;
+    return updated_count;
+}
@@ -0,0 +1,74 @@
+#include "tools/ev-vertex_quantize.h"
+#include <algorithm>
+#include <cmath>
+
+int16_t ev::tools::quantize::float_to_snorm16(float value) {
+    return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+}
+
+int8_t ev::tools::quantize::float_to_snorm8(float value) {
+    return static_cast<int8_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 127.0f));
+}
+
+uint8_t ev::tools::quantize::float_to_unorm8(float value) {
+    return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+}
+
+void ev::tools::quantize::octahedral_encode(const float normal[3], float encoded[2]) {
+    const float l1 = std::fabs(normal[0]) + std::fabs(normal[1]) + std::fabs(normal[2]);
+    if ( l1 == 0.0f ) {
+        encoded[0] = 0.0f;
+        encoded[1] = 0.0f;
+        return;
+    }
+    float x = normal[0] / l1;
+    float y = normal[1] / l1;
+    if ( normal[2] < 0.0f ) {
+        // 아래쪽 반구는 대각선 기준으로 접어서 바깥 삼각형에 배치
+        const float fx = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        const float fy = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = fx;
+        y = fy;
+    }
+    encoded[0] = x;
+    encoded[1] = y;
+}
+
+void ev::tools::quantize::octahedral_decode(const float encoded[2], float normal[3]) {
+    float x = encoded[0];
+    float y = encoded[1];
+    const float z = 1.0f - std::fabs(x) - std::fabs(y);
+    if ( z < 0.0f ) {
+        const float fx = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        const float fy = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = fx;
+        y = fy;
+    }
+    const float length = std::sqrt(x * x + y * y + z * z);
+    normal[0] = x / length;
+    normal[1] = y / length;
+    normal[2] = z / length;
+}
+
+void ev::tools::quantize::weights_to_unorm8(const float weights[4], uint8_t quantized[4]) {
+    float sum = 0.0f;
+    for ( int i = 0 ; i < 4 ; ++i ) {
+        sum += std::max(weights[i], 0.0f);
+    }
+    if ( sum <= 0.0f ) {
+        quantized[0] = quantized[1] = quantized[2] = quantized[3] = 0;
+        return;
+    }
+
+    int total = 0;
+    int largest = 0;
+    for ( int i = 0 ; i < 4 ; ++i ) {
+        quantized[i] = float_to_unorm8(std::max(weights[i], 0.0f) / sum);
+        total += quantized[i];
+        if ( quantized[i] > quantized[largest] ) {
+            largest = i;
+        }
+    }
+    // 가장 큰 가중치는 최소 64 이므로 ±2 보정으로 범위를 벗어나지 않음
+    quantized[largest] = static_cast<uint8_t>(quantized[largest] + (255 - total));
+}
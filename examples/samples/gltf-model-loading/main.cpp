@@ -199,7 +199,9 @@ public:
             &model_matrix,
             sizeof(glm::mat4)
         );
-        gltf_model->draw(command_buffers[current_buffer_index],
+        gltf_model->update_instances(current_buffer_index);
+        gltf_model->draw_instanced(command_buffers[current_buffer_index],
+            current_buffer_index,
             ev::tools::gltf::RenderFlag::OPAQUE | ev::tools::gltf::RenderFlag::BIND_IMAGE,
             pipeline_layouts[0],
             1
@@ -283,7 +285,8 @@ public:
     void setup_graphics_pipeline() {
         pipeline_cache = std::make_shared<ev::PipelineCache>(device);
         VkPipelineVertexInputStateCreateInfo* info = 
-            ev::tools::gltf::Vertex::get_pipeline_vertex_input_state(
+            ev::tools::gltf::Vertex::get_instanced_pipeline_vertex_input_state(
+                gltf_model->get_vertex_layout(),
                 { 
                     ev::tools::gltf::VertexType::Position,
                     ev::tools::gltf::VertexType::Normal,
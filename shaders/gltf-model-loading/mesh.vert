@@ -3,6 +3,8 @@
 layout(location = 0) in vec3 in_pos;
 layout(location = 1) in vec3 in_normal;
 layout(location = 2) in vec2 in_uv;
+// 노드 월드 행렬 (Model::draw_instanced 인스턴스 버퍼)
+layout(location = 3) in mat4 in_instance_model;
 
 layout(push_constant) uniform Push{
     mat4 model;
@@ -18,6 +20,6 @@ layout(location = 0) out vec2 out_uv;
 void main() {
     out_uv = in_uv;
     // gl_Position = camera.proj * camera.view * mat4(1.0f) * vec4(in_pos, 1.0);
-    gl_Position = camera.proj * camera.view * push_constants.model * vec4(in_pos, 1.0);
+    gl_Position = camera.proj * camera.view * push_constants.model * in_instance_model * vec4(in_pos, 1.0);
     // gl_Position = mat4(1.0k) * vec4(in_pos, 1.0);
 }
\ No newline at end of file
@@ -0,0 +1,49 @@
+// Bindless 머티리얼 Fragment Shader (ev::tools::gltf::BindlessMaterials)
+// 텍스처 배열과 머티리얼 버퍼는 set 1 에 한 번만 바인딩하고, draw 마다 머티리얼 번호만 push constant 로 받습니다.
+// push constant 는 정점 셰이더의 모델 행렬(mat4) 바로 뒤 offset 64 를 사용합니다. (Model::set_material_index_push_constant)
+#version 450
+#extension GL_EXT_nonuniform_qualifier : require
+
+const uint NO_TEXTURE = 0xFFFFFFFFu;
+const uint ALPHA_MASK = 1u;
+
+struct MaterialData {
+    vec4 base_color_factor;
+    float metallic_factor;
+    float roughness_factor;
+    float alpha_cutoff;
+    uint alpha_mode;
+    uint base_color_texture;
+    uint metallic_roughness_texture;
+    uint normal_texture;
+    uint occlusion_texture;
+    uint emissive_texture;
+    uint double_sided;
+    uint padding[2];
+};
+
+layout(set = 1, binding = 0) uniform sampler2D textures[];
+
+layout(std430, set = 1, binding = 1) readonly buffer Materials {
+    MaterialData materials[];
+};
+
+layout(push_constant) uniform Push {
+    layout(offset = 64) uint material_index;
+} push_constants;
+
+layout(location = 0) in vec2 in_uv;
+
+layout(location = 0) out vec4 out_color;
+
+void main() {
+    MaterialData material = materials[push_constants.material_index];
+    vec4 color = material.base_color_factor;
+    if ( material.base_color_texture != NO_TEXTURE ) {
+        color *= texture(textures[nonuniformEXT(material.base_color_texture)], in_uv);
+    }
+    if ( material.alpha_mode == ALPHA_MASK && color.a < material.alpha_cutoff ) {
+        discard;
+    }
+    out_color = color;
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+#include "tools/ev-accessor.h"
+
+using namespace ev::tools::accessor;
+
+TEST(AccessorTest, DequantizesNormalizedIntegers) {
+    EXPECT_FLOAT_EQ(dequantize(127, ComponentType::Byte, true), 1.0f);
+    EXPECT_FLOAT_EQ(dequantize(-128, ComponentType::Byte, true), -1.0f);
+    EXPECT_FLOAT_EQ(dequantize(255, ComponentType::UnsignedByte, true), 1.0f);
+    EXPECT_FLOAT_EQ(dequantize(-32767, ComponentType::Short, true), -1.0f);
+    EXPECT_FLOAT_EQ(dequantize(32767, ComponentType::UnsignedShort, true), 32767.0f / 65535.0f);
+    // normalized 가 아니면 정수 값 그대로
+    EXPECT_FLOAT_EQ(dequantize(-300, ComponentType::Short, false), -300.0f);
+    EXPECT_FLOAT_EQ(dequantize(200, ComponentType::UnsignedByte, false), 200.0f);
+}
+
+TEST(AccessorTest, ReadsInterleavedQuantizedElements) {
+    // 12 bytes stride: short3 위치(normalized) + pad + ubyte4 관절
+    struct Packed {
+        int16_t position[3];
+        uint16_t pad;
+        uint8_t joints[4];
+    };
+    static_assert(sizeof(Packed) == 12);
+    std::vector<Packed> packed = {
+        { { 32767, -32767, 0 }, 0, { 1, 2, 3, 4 } },
+        { { 16384, 0, -16384 }, 0, { 250, 0, 7, 9 } },
+    };
+    const uint8_t* base = reinterpret_cast<const uint8_t*>(packed.data());
+
+    View positions;
+    positions.data = base;
+    positions.count = packed.size();
+    positions.stride = sizeof(Packed);
+    positions.component_type = ComponentType::Short;
+    positions.components = 3;
+    positions.normalized = true;
+    ASSERT_TRUE(positions.is_valid(0, packed.size() * sizeof(Packed)));
+
+    View joints = positions;
+    joints.data = base + offsetof(Packed, joints);
+    joints.component_type = ComponentType::UnsignedByte;
+    joints.components = 4;
+    joints.normalized = false;
+    ASSERT_TRUE(joints.is_valid(offsetof(Packed, joints), packed.size() * sizeof(Packed)));
+    // 마지막 요소가 버퍼를 넘으면 거부
+    EXPECT_FALSE(joints.is_valid(offsetof(Packed, joints), packed.size() * sizeof(Packed) - 1));
+
+    // 4 성분으로 읽으면 w 는 기본값
+    float out[2][4];
+    const float defaults[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    read_floats(positions, &out[0][0], sizeof(out[0]), 4, defaults);
+    EXPECT_FLOAT_EQ(out[0][0], 1.0f);
+    EXPECT_FLOAT_EQ(out[0][1], -1.0f);
+    EXPECT_FLOAT_EQ(out[0][3], 1.0f);
+    EXPECT_FLOAT_EQ(out[1][0], 16384.0f / 32767.0f);
+    EXPECT_FLOAT_EQ(out[1][2], -16384.0f / 32767.0f);
+
+    EXPECT_EQ(read_uint(joints, 1, 0), 250u);
+    EXPECT_EQ(read_uint(joints, 1, 3), 9u);
+    EXPECT_FLOAT_EQ(read_float(joints, 0, 2), 3.0f);
+
+    // 빠른 경로: stride 가 다른 촘촘한 배열로 바이트 그대로 복사
+    uint8_t copied[2][4];
+    copy_elements(joints, &copied[0][0], 4);
+    EXPECT_EQ(std::memcmp(copied[0], packed[0].joints, 4), 0);
+    EXPECT_EQ(std::memcmp(copied[1], packed[1].joints, 4), 0);
+}
+
+TEST(AccessorTest, ReadsUnalignedFloats) {
+    std::vector<uint8_t> buffer(1 + 2 * 2 * sizeof(float));
+    const float values[4] = { 0.5f, -2.0f, 3.25f, 8.0f };
+    std::memcpy(buffer.data() + 1, values, sizeof(values));
+
+    View uv;
+    uv.data = buffer.data() + 1;
+    uv.count = 2;
+    uv.components = 2;
+    ASSERT_TRUE(uv.is_valid(1, buffer.size()));
+    EXPECT_EQ(uv.get_stride(), 8u);
+
+    float out[2][3];
+    read_floats(uv, &out[0][0], sizeof(out[0]), 3);
+    EXPECT_FLOAT_EQ(out[0][0], 0.5f);
+    EXPECT_FLOAT_EQ(out[0][1], -2.0f);
+    EXPECT_FLOAT_EQ(out[0][2], 0.0f);
+    EXPECT_FLOAT_EQ(out[1][0], 3.25f);
+    EXPECT_FLOAT_EQ(out[1][1], 8.0f);
+}
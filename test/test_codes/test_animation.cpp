@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "tools/ev-animation.h"
+
+using namespace ev::tools;
+
+namespace {
+
+constexpr uint32_t NONE = TransformHierarchy::NO_PARENT;
+
+std::shared_ptr<TransformHierarchy> make_chain(uint32_t count) {
+    std::vector<uint32_t> parents;
+    for ( uint32_t i = 0 ; i < count ; ++i ) {
+        parents.push_back(i == 0 ? NONE : i - 1);
+    }
+    return std::make_shared<TransformHierarchy>(parents);
+}
+
+float translation_x(const std::shared_ptr<TransformHierarchy>& hierarchy, uint32_t node) {
+    return hierarchy->get_translations(TransformHierarchy::X)[node];
+}
+
+void slerp(float dst[4], const float a[4], const float b[4], float t) {
+    float dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+    float sign = 1.0f;
+    if ( dot < 0.0f ) {
+        dot = -dot;
+        sign = -1.0f;
+    }
+    const float angle = std::acos(std::min(dot, 1.0f));
+    const float s = std::sin(angle);
+    const float wa = s > 1e-6f ? std::sin((1.0f - t) * angle) / s : 1.0f - t;
+    const float wb = s > 1e-6f ? std::sin(t * angle) / s : t;
+    for ( int c = 0 ; c < 4 ; ++c ) {
+        dst[c] = a[c] * wa + b[c] * wb * sign;
+    }
+}
+
+}
+
+TEST(AnimationTest, LinearTranslationWithCursorRewind) {
+    auto hierarchy = make_chain(1);
+    auto clip = std::make_shared<AnimationClip>("move");
+    const float times[] = { 0.0f, 1.0f, 2.0f, 3.0f };
+    const float values[] = {
+        0.0f, 0.0f, 0.0f, 1.0f,
+        10.0f, 0.0f, 0.0f, 1.0f,
+        20.0f, 0.0f, 0.0f, 1.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+    clip->add_track(0, AnimationClip::TRANSLATION, AnimationClip::LINEAR, times, 4, values);
+    EXPECT_FLOAT_EQ(clip->get_duration(), 3.0f);
+
+    AnimationMixer mixer(hierarchy);
+    const uint32_t layer = mixer.add_layer(clip, 1.0f, false);
+    // 앞으로 진행, 크게 건너뛰기, 되감기, 범위 밖
+    const float sample_times[] = { 0.5f, 1.5f, 2.5f, 0.25f, 2.0f, 5.0f, -1.0f };
+    const float expected[] = { 5.0f, 15.0f, 10.0f, 2.5f, 20.0f, 0.0f, 0.0f };
+    for ( size_t i = 0 ; i < std::size(sample_times) ; ++i ) {
+        mixer.get_layer(layer).time = sample_times[i];
+        mixer.apply();
+        EXPECT_NEAR(translation_x(hierarchy, 0), expected[i], 1e-5f) << "time " << sample_times[i];
+    }
+    EXPECT_TRUE(hierarchy->is_dirty());
+    hierarchy->update(false);
+    EXPECT_NEAR(hierarchy->get_world_matrix(0)[12], 0.0f, 1e-5f);
+}
+
+TEST(AnimationTest, StepAndCubicSpline) {
+    auto hierarchy = make_chain(2);
+    auto clip = std::make_shared<AnimationClip>();
+    const float times[] = { 0.0f, 1.0f };
+    const float step_values[] = {
+        1.0f, 1.0f, 1.0f, 1.0f,
+        2.0f, 2.0f, 2.0f, 1.0f
+    };
+    // 접선이 0 이면 smoothstep
+    const float cubic_values[] = {
+        0.0f, 0.0f, 0.0f, 0.0f,   0.0f, 0.0f, 0.0f, 0.0f,   0.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.0f,   4.0f, 0.0f, 0.0f, 0.0f,   0.0f, 0.0f, 0.0f, 0.0f
+    };
+    clip->add_track(0, AnimationClip::SCALE, AnimationClip::STEP, times, 2, step_values);
+    clip->add_track(1, AnimationClip::TRANSLATION, AnimationClip::CUBICSPLINE, times, 2, cubic_values);
+
+    AnimationMixer mixer(hierarchy);
+    mixer.add_layer(clip, 1.0f, false);
+    mixer.get_layer(0).time = 0.25f;
+    mixer.apply();
+    EXPECT_FLOAT_EQ(hierarchy->get_scales(TransformHierarchy::Y)[0], 1.0f);
+    EXPECT_NEAR(translation_x(hierarchy, 1), 4.0f * (3.0f * 0.0625f - 2.0f * 0.015625f), 1e-5f);
+
+    mixer.get_layer(0).time = 1.0f;
+    mixer.apply();
+    EXPECT_FLOAT_EQ(hierarchy->get_scales(TransformHierarchy::Y)[0], 2.0f);
+    EXPECT_NEAR(translation_x(hierarchy, 1), 4.0f, 1e-5f);
+}
+
+TEST(AnimationTest, QuaternionInterpolationMatchesSlerp) {
+    constexpr size_t COUNT = 37;
+    std::vector<float> from[4], to[4], simd[4], reference[4], t(COUNT);
+    for ( int c = 0 ; c < 4 ; ++c ) {
+        from[c].resize(COUNT);
+        to[c].resize(COUNT);
+        simd[c].resize(COUNT);
+        reference[c].resize(COUNT);
+    }
+    for ( size_t i = 0 ; i < COUNT ; ++i ) {
+        // 축과 각도가 다른 쌍, 일부는 반대 반구
+        const float angle0 = 0.1f * static_cast<float>(i);
+        const float angle1 = angle0 + 0.05f + 0.08f * static_cast<float>(i);
+        const float axis[3] = { std::sqrt(1.0f / 3.0f), std::sqrt(1.0f / 3.0f), std::sqrt(1.0f / 3.0f) };
+        const float q0[4] = { 0.0f, std::sin(angle0), 0.0f, std::cos(angle0) };
+        const float sign = i % 3 == 0 ? -1.0f : 1.0f;
+        const float q1[4] = { axis[0] * std::sin(angle1) * sign, axis[1] * std::sin(angle1) * sign,
+            axis[2] * std::sin(angle1) * sign, std::cos(angle1) * sign };
+        for ( int c = 0 ; c < 4 ; ++c ) {
+            from[c][i] = q0[c];
+            to[c][i] = q1[c];
+        }
+        t[i] = static_cast<float>(i % 11) / 10.0f;
+    }
+
+    float* const simd_ptr[4] = { simd[0].data(), simd[1].data(), simd[2].data(), simd[3].data() };
+    float* const reference_ptr[4] = { reference[0].data(), reference[1].data(), reference[2].data(), reference[3].data() };
+    const float* const from_ptr[4] = { from[0].data(), from[1].data(), from[2].data(), from[3].data() };
+    const float* const to_ptr[4] = { to[0].data(), to[1].data(), to[2].data(), to[3].data() };
+    animation::interpolate_quaternions(simd_ptr, from_ptr, to_ptr, t.data(), COUNT);
+    animation::scalar::interpolate_quaternions(reference_ptr, from_ptr, to_ptr, t.data(), COUNT);
+
+    for ( size_t i = 0 ; i < COUNT ; ++i ) {
+        const float a[4] = { from[0][i], from[1][i], from[2][i], from[3][i] };
+        const float b[4] = { to[0][i], to[1][i], to[2][i], to[3][i] };
+        float expected[4];
+        slerp(expected, a, b, t[i]);
+        float dot = 0.0f;
+        for ( int c = 0 ; c < 4 ; ++c ) {
+            dot += expected[c] * simd[c][i];
+            EXPECT_NEAR(simd[c][i], reference[c][i], 1e-4f) << "index " << i << " (" << animation::simd_backend() << ")";
+        }
+        // 두 회전 사이 각도. acos 는 1 근처에서 부정확하므로 차이 벡터 길이로 계산
+        const float sign = dot < 0.0f ? -1.0f : 1.0f;
+        float distance2 = 0.0f;
+        for ( int c = 0 ; c < 4 ; ++c ) {
+            const float diff = simd[c][i] * sign - expected[c];
+            distance2 += diff * diff;
+        }
+        EXPECT_LT(4.0f * std::asin(std::sqrt(distance2) * 0.5f), 1e-3f) << "index " << i;
+    }
+}
+
+TEST(AnimationTest, BlendsLayersByWeight) {
+    auto hierarchy = make_chain(1);
+    const float times[] = { 0.0f };
+    const float left[] = { -4.0f, 0.0f, 0.0f, 1.0f };
+    const float right[] = { 4.0f, 0.0f, 0.0f, 1.0f };
+    const float identity[] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    const float half_turn[] = { 0.0f, 0.0f, 1.0f, 0.0f };
+    auto clip_a = std::make_shared<AnimationClip>("a");
+    auto clip_b = std::make_shared<AnimationClip>("b");
+    clip_a->add_track(0, AnimationClip::TRANSLATION, AnimationClip::LINEAR, times, 1, left);
+    clip_a->add_track(0, AnimationClip::ROTATION, AnimationClip::LINEAR, times, 1, identity);
+    clip_b->add_track(0, AnimationClip::TRANSLATION, AnimationClip::LINEAR, times, 1, right);
+    clip_b->add_track(0, AnimationClip::ROTATION, AnimationClip::LINEAR, times, 1, identity);
+
+    AnimationMixer mixer(hierarchy);
+    mixer.add_layer(clip_a, 0.25f);
+    mixer.add_layer(clip_b, 0.75f);
+    mixer.apply();
+    EXPECT_NEAR(translation_x(hierarchy, 0), 2.0f, 1e-5f);
+    EXPECT_NEAR(hierarchy->get_rotations(TransformHierarchy::W)[0], 1.0f, 1e-5f);
+
+    // 가중치가 0 인 레이어는 무시
+    mixer.get_layer(1).weight = 0.0f;
+    mixer.apply();
+    EXPECT_NEAR(translation_x(hierarchy, 0), -4.0f, 1e-5f);
+
+    // 회전만 기록하는 클립은 이동을 바꾸지 않음
+    auto clip_c = std::make_shared<AnimationClip>("c");
+    clip_c->add_track(0, AnimationClip::ROTATION, AnimationClip::STEP, times, 1, half_turn);
+    mixer.clear_layers();
+    mixer.add_layer(clip_c);
+    mixer.apply();
+    EXPECT_NEAR(translation_x(hierarchy, 0), -4.0f, 1e-5f);
+    EXPECT_NEAR(hierarchy->get_rotations(TransformHierarchy::Z)[0], 1.0f, 1e-5f);
+}
+
+TEST(AnimationTest, UpdateAnimationsLoopsAndUpdatesWorld) {
+    const float times[] = { 1.0f, 3.0f };
+    const float values[] = {
+        0.0f, 0.0f, 0.0f, 1.0f,
+        2.0f, 0.0f, 0.0f, 1.0f
+    };
+    auto clip = std::make_shared<AnimationClip>("loop");
+    clip->add_track(0, AnimationClip::TRANSLATION, AnimationClip::LINEAR, times, 2, values);
+
+    std::vector<std::shared_ptr<AnimationMixer>> mixers;
+    for ( uint32_t i = 0 ; i < 32 ; ++i ) {
+        mixers.push_back(std::make_shared<AnimationMixer>(make_chain(3)));
+        mixers.back()->add_layer(clip);
+    }
+    update_animations(mixers, 2.5f);
+    for ( const auto& mixer : mixers ) {
+        // 1 + 2.5 = 3.5 -> 구간 [1, 3) 에서 1.5
+        EXPECT_NEAR(mixer->get_layer(0).time, 1.5f, 1e-5f);
+        EXPECT_FALSE(mixer->get_target()->is_dirty());
+        EXPECT_NEAR(mixer->get_target()->get_world_matrix(2)[12], 0.5f, 1e-5f);
+    }
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <easy-vulkan.h>
+#include <filesystem>
+#include <memory>
+#include "test_common.h"
+#include "tools/ev-gltf.h"
+#include "tools/ev-bindless_materials.h"
+#include "tools/ev-model_instance.h"
+#include "tools/ev-texture_cache.h"
+
+using namespace std;
+using ev::tools::gltf::BindlessMaterials;
+
+class BindlessMaterialsTest : public ::testing::Test {
+protected:
+    shared_ptr<ev::Instance> instance;
+    shared_ptr<ev::PhysicalDevice> physical_device;
+    shared_ptr<ev::Device> device;
+    shared_ptr<ev::MemoryAllocator> memory_allocator;
+    shared_ptr<ev::DescriptorPool> descriptor_pool;
+    shared_ptr<ev::CommandPool> command_pool;
+    shared_ptr<ev::Queue> queue;
+    shared_ptr<ev::tools::gltf::GLTFModelManager> manager;
+    shared_ptr<BindlessMaterials> bindless;
+    filesystem::path directory;
+
+    void SetUp() override {
+        create_default_test_context(instance, physical_device, device);
+        if ( !device->is_descriptor_indexing_enabled() ) {
+            GTEST_SKIP() << "descriptor indexing is not enabled";
+        }
+        memory_allocator = make_shared<ev::BitmapBuddyMemoryAllocator>(device);
+        memory_allocator->add_pool(ev::memory_type::GPU_ONLY, 16 * 1024 * 1024);
+        memory_allocator->add_pool(ev::memory_type::HOST_ONLY, 16 * 1024 * 1024);
+        memory_allocator->add_pool(ev::memory_type::HOST_READABLE, 4 * 1024 * 1024);
+        ASSERT_EQ(memory_allocator->build(), VK_SUCCESS);
+        descriptor_pool = make_shared<ev::DescriptorPool>(device);
+        descriptor_pool->add(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 64);
+        descriptor_pool->add(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 64);
+        ASSERT_EQ(descriptor_pool->create_pool(), VK_SUCCESS);
+        command_pool = make_shared<ev::CommandPool>(device, VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT);
+        queue = make_shared<ev::Queue>(device, device->get_queue_index(VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
+        manager = make_shared<ev::tools::gltf::GLTFModelManager>(device, memory_allocator, descriptor_pool, command_pool, queue);
+        bindless = make_shared<BindlessMaterials>(device, memory_allocator, 16, 16);
+        manager->set_bindless_materials(bindless);
+
+        directory = filesystem::temp_directory_path() / "ev-bindless-materials-test";
+        filesystem::remove_all(directory);
+        filesystem::create_directories(directory);
+    }
+
+    void TearDown() override {
+        if ( !directory.empty() ) {
+            filesystem::remove_all(directory);
+        }
+    }
+
+    // 텍스처 하나를 쓰는 머티리얼 하나짜리 모델
+    shared_ptr<ev::tools::gltf::Model> load_triangle(const string& name) {
+        const filesystem::path path = directory / name;
+        write_triangle_glb(path, 1);
+        return manager->load_model(path.string());
+    }
+
+    static uint32_t material_index(const shared_ptr<ev::tools::gltf::Model>& model) {
+        return model->get_materials().front()->get_material_index();
+    }
+};
+
+TEST_F(BindlessMaterialsTest, RemovedSlotsReusedAfterRetire) {
+    auto first = load_triangle("first.glb");
+    ASSERT_NE(first, nullptr);
+    const uint32_t first_index = material_index(first);
+    EXPECT_NE(first_index, 0u);
+    EXPECT_EQ(bindless->get_material_count(), 2u);
+    EXPECT_EQ(bindless->get_texture_count(), 1u);
+
+    // 프레임 1 에서 제거하면 모델은 기본 머티리얼을 가리키지만 번호는 아직 GPU 가 읽을 수 있어 유지
+    bindless->set_current_frame(1);
+    bindless->remove_model(first);
+    EXPECT_EQ(material_index(first), 0u);
+    EXPECT_EQ(bindless->get_material_count(), 2u);
+    EXPECT_EQ(bindless->get_texture_count(), 1u);
+
+    // 해제를 기다리는 번호는 새 모델에 주지 않음
+    auto second = load_triangle("second.glb");
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(material_index(second), first_index);
+    EXPECT_EQ(bindless->get_material_count(), 3u);
+    EXPECT_EQ(bindless->get_texture_count(), 2u);
+
+    // 이전 프레임이 끝난 것만으로는 해제하지 않음
+    bindless->retire_frames(0);
+    EXPECT_EQ(bindless->get_material_count(), 3u);
+
+    bindless->retire_frames(1);
+    EXPECT_EQ(bindless->get_material_count(), 2u);
+    EXPECT_EQ(bindless->get_texture_count(), 1u);
+
+    auto third = load_triangle("third.glb");
+    ASSERT_NE(third, nullptr);
+    EXPECT_EQ(material_index(third), first_index);
+    EXPECT_EQ(bindless->get_material_count(), 3u);
+    EXPECT_EQ(bindless->get_texture_count(), 2u);
+    EXPECT_EQ(bindless->update(), VK_SUCCESS);
+}
+
+TEST_F(BindlessMaterialsTest, EvictedModelReleasesMaterials) {
+    auto cache = make_shared<ev::tools::gltf::ModelAssetCache>(0);
+    manager->set_model_asset_cache(cache);
+    write_triangle_glb(directory / "cached.glb", 1);
+
+    shared_ptr<ev::tools::gltf::ModelInstance> model_instance = manager->load_model_instance((directory / "cached.glb").string());
+    ASSERT_NE(model_instance, nullptr);
+    EXPECT_EQ(cache->size(), 1u);
+    EXPECT_EQ(bindless->get_material_count(), 2u);
+
+    // 인스턴스가 사라지면 budget 0 을 넘으므로 trim 이 모델을 버리고 머티리얼 해제를 예약
+    bindless->set_current_frame(3);
+    model_instance.reset();
+    EXPECT_EQ(cache->trim(), 1u);
+    EXPECT_EQ(cache->size(), 0u);
+    EXPECT_EQ(bindless->get_material_count(), 2u);
+
+    bindless->retire_frames(3);
+    EXPECT_EQ(bindless->get_material_count(), 1u);
+    EXPECT_EQ(bindless->get_texture_count(), 0u);
+}
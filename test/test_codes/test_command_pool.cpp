@@ -46,4 +46,35 @@ TEST_F(CommandPoolTest, AllocateMultipleCommandBuffers) {
     for (const auto& cmd_buffer : command_buffers) {
         EXPECT_NE(VkCommandBuffer(*cmd_buffer), VK_NULL_HANDLE);
     }
-}
\ No newline at end of file
+}
+
+TEST_F(CommandPoolTest, AllocateSecondaryCommandBuffers) {
+    ev::CommandPool command_pool(device, VK_QUEUE_GRAPHICS_BIT);
+    vector<shared_ptr<ev::CommandBuffer>> command_buffers = command_pool.allocate(3, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    EXPECT_EQ(command_buffers.size(), 3);
+    for (const auto& cmd_buffer : command_buffers) {
+        EXPECT_EQ(cmd_buffer->get_level(), VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    }
+}
+
+TEST_F(CommandPoolTest, ExecuteSecondaryAfterPoolReset) {
+    ev::CommandPool command_pool(device, VK_QUEUE_GRAPHICS_BIT, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
+    shared_ptr<ev::CommandBuffer> primary = command_pool.allocate(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+    shared_ptr<ev::CommandBuffer> secondary = command_pool.allocate(VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+
+    EXPECT_EQ(secondary->begin_secondary(nullptr), VK_SUCCESS);
+    EXPECT_EQ(secondary->end(), VK_SUCCESS);
+    EXPECT_EQ(primary->begin(), VK_SUCCESS);
+    primary->execute_commands({secondary});
+    EXPECT_EQ(primary->end(), VK_SUCCESS);
+
+    EXPECT_EQ(command_pool.reset(), VK_SUCCESS);
+    EXPECT_EQ(secondary->begin_secondary(nullptr), VK_SUCCESS);
+    EXPECT_EQ(secondary->end(), VK_SUCCESS);
+}
+
+TEST_F(CommandPoolTest, ResetAfterDestroyFails) {
+    ev::CommandPool command_pool(device, VK_QUEUE_GRAPHICS_BIT);
+    command_pool.destroy();
+    EXPECT_EQ(command_pool.reset(), VK_ERROR_INITIALIZATION_FAILED);
+}
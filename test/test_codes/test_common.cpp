@@ -1,5 +1,9 @@
 #include "test_common.h"
 #include "easy-vulkan.h"
+#include "tools/ev-glb.h"
+#include "stb_image_write.h"
+#include <cstring>
+#include <fstream>
 
 // 이 소스 파일 내에서만 접근 가능한 static 전역 변수
 static std::filesystem::path g_executable_dir;
@@ -41,4 +45,163 @@ void create_default_test_context(
         VK_KHR_SWAPCHAIN_EXTENSION_NAME,
     };
     device = std::make_shared<ev::Device>(instance, physical_device, device_extensions);
-}
\ No newline at end of file
+}
+
+std::shared_ptr<ev::Shader> load_tool_shader(
+    std::shared_ptr<ev::Device> device,
+    VkShaderStageFlagBits stage,
+    const std::string& file_name
+) {
+    // 셰이더는 최상위 빌드 디렉터리의 shaders/tools 로 컴파일됨 (테스트 실행 파일은 build/test)
+    const std::filesystem::path build_dir = std::filesystem::weakly_canonical(std::filesystem::absolute(get_executable_dir())).parent_path();
+    const std::filesystem::path path = build_dir / "shaders" / "tools" / (file_name + ".spv");
+    if ( !std::filesystem::exists(path) ) {
+        return nullptr;
+    }
+    vector<uint32_t> code;
+    ev::utility::read_spirv_shader_file(path.string().c_str(), code);
+    if ( code.empty() ) {
+        return nullptr;
+    }
+    return std::make_shared<ev::Shader>(device, stage, code);
+}
+
+namespace {
+
+void put_u32(std::vector<uint8_t>& out, uint32_t value) {
+    for ( int i = 0 ; i < 4 ; ++i ) {
+        out.push_back(static_cast<uint8_t>(value >> (i * 8)));
+    }
+}
+
+void put_chunk(std::vector<uint8_t>& out, uint32_t type, std::vector<uint8_t> data, uint8_t padding) {
+    while ( data.size() % 4 ) {
+        data.push_back(padding);
+    }
+    put_u32(out, static_cast<uint32_t>(data.size()));
+    put_u32(out, type);
+    out.insert(out.end(), data.begin(), data.end());
+}
+
+template <typename T>
+void append(std::vector<uint8_t>& out, const T* values, size_t count) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(values);
+    out.insert(out.end(), bytes, bytes + sizeof(T) * count);
+}
+
+}
+
+void write_glb_file(const std::filesystem::path& path, const std::string& json, const std::vector<uint8_t>& bin) {
+    std::vector<uint8_t> chunks;
+    put_chunk(chunks, ev::tools::glb::CHUNK_JSON, std::vector<uint8_t>(json.begin(), json.end()), ' ');
+    if ( !bin.empty() ) {
+        put_chunk(chunks, ev::tools::glb::CHUNK_BIN, bin, 0);
+    }
+    std::vector<uint8_t> file;
+    put_u32(file, ev::tools::glb::MAGIC);
+    put_u32(file, ev::tools::glb::VERSION);
+    put_u32(file, static_cast<uint32_t>(12 + chunks.size()));
+    file.insert(file.end(), chunks.begin(), chunks.end());
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+}
+
+void write_triangle_glb(const std::filesystem::path& path, uint32_t node_count) {
+    const float positions[] = { 0.0f, 0.0f, 0.0f,   1.0f, 0.0f, 0.0f,   0.0f, 1.0f, 0.0f };
+    const float normals[] = { 0.0f, 0.0f, 1.0f,   0.0f, 0.0f, 1.0f,   0.0f, 0.0f, 1.0f };
+    const float uvs[] = { 0.0f, 0.0f,   1.0f, 0.0f,   0.0f, 1.0f };
+    const uint16_t indices[] = { 0, 1, 2, 0 };  // 마지막 값은 4 바이트 정렬용
+    const uint8_t pixels[] = {
+        255, 0, 0, 255,     0, 255, 0, 255,
+        0, 0, 255, 255,     255, 255, 255, 255
+    };
+
+    std::vector<uint8_t> png;
+    stbi_write_png_to_func([](void* context, void* data, int size) {
+        std::vector<uint8_t>* out = static_cast<std::vector<uint8_t>*>(context);
+        out->insert(out->end(), static_cast<uint8_t*>(data), static_cast<uint8_t*>(data) + size);
+    }, &png, 2, 2, 4, pixels, 2 * 4);
+
+    std::vector<uint8_t> bin;
+    append(bin, positions, 9);
+    append(bin, normals, 9);
+    append(bin, uvs, 6);
+    append(bin, indices, 4);
+    const size_t image_offset = bin.size();
+    bin.insert(bin.end(), png.begin(), png.end());
+
+    std::string nodes;
+    std::string roots;
+    for ( uint32_t i = 0 ; i < node_count ; ++i ) {
+        nodes += (i ? "," : "") + std::string("{\"mesh\":0,\"translation\":[") + std::to_string(i * 2) + ",0,0]}";
+        roots += (i ? "," : "") + std::to_string(i);
+    }
+    const std::string json = "{"
+        "\"asset\":{\"version\":\"2.0\"},"
+        "\"scene\":0,"
+        "\"scenes\":[{\"nodes\":[" + roots + "]}],"
+        "\"nodes\":[" + nodes + "],"
+        "\"meshes\":[{\"name\":\"triangle\",\"primitives\":[{\"attributes\":{\"POSITION\":0,\"NORMAL\":1,\"TEXCOORD_0\":2},\"indices\":3,\"material\":0}]}],"
+        "\"materials\":[{\"pbrMetallicRoughness\":{\"baseColorTexture\":{\"index\":0}}}],"
+        "\"textures\":[{\"source\":0}],"
+        "\"images\":[{\"bufferView\":4,\"mimeType\":\"image/png\"}],"
+        "\"accessors\":["
+            "{\"bufferView\":0,\"componentType\":5126,\"count\":3,\"type\":\"VEC3\",\"min\":[0,0,0],\"max\":[1,1,0]},"
+            "{\"bufferView\":1,\"componentType\":5126,\"count\":3,\"type\":\"VEC3\"},"
+            "{\"bufferView\":2,\"componentType\":5126,\"count\":3,\"type\":\"VEC2\"},"
+            "{\"bufferView\":3,\"componentType\":5123,\"count\":3,\"type\":\"SCALAR\"}"
+        "],"
+        "\"bufferViews\":["
+            "{\"buffer\":0,\"byteOffset\":0,\"byteLength\":36},"
+            "{\"buffer\":0,\"byteOffset\":36,\"byteLength\":36},"
+            "{\"buffer\":0,\"byteOffset\":72,\"byteLength\":24},"
+            "{\"buffer\":0,\"byteOffset\":96,\"byteLength\":6},"
+            "{\"buffer\":0,\"byteOffset\":" + std::to_string(image_offset) + ",\"byteLength\":" + std::to_string(png.size()) + "}"
+        "],"
+        "\"buffers\":[{\"byteLength\":" + std::to_string(bin.size()) + "}]"
+    "}";
+    write_glb_file(path, json, bin);
+}
+
+void write_skinned_triangle_glb(const std::filesystem::path& path, const float (&joint_translation)[3]) {
+    const float positions[] = { 0.0f, 0.0f, 0.0f,   1.0f, 0.0f, 0.0f,   0.0f, 1.0f, 0.0f };
+    const float normals[] = { 0.0f, 0.0f, 1.0f,   0.0f, 0.0f, 1.0f,   0.0f, 0.0f, 1.0f };
+    // 0, 1 번 정점은 관절을 따라가고 2 번 정점은 관절 영향이 없음
+    const float weights[] = { 1.0f, 0.0f, 0.0f, 0.0f,   1.0f, 0.0f, 0.0f, 0.0f,   0.0f, 0.0f, 0.0f, 0.0f };
+    const uint8_t joints[] = { 0, 0, 0, 0,   0, 0, 0, 0,   0, 0, 0, 0 };
+    const uint16_t indices[] = { 0, 1, 2, 0 };
+
+    std::vector<uint8_t> bin;
+    append(bin, positions, 9);
+    append(bin, normals, 9);
+    append(bin, weights, 12);
+    append(bin, joints, 12);
+    append(bin, indices, 4);
+
+    const std::string translation = std::to_string(joint_translation[0]) + "," + std::to_string(joint_translation[1]) + "," + std::to_string(joint_translation[2]);
+    const std::string json = "{"
+        "\"asset\":{\"version\":\"2.0\"},"
+        "\"scene\":0,"
+        "\"scenes\":[{\"nodes\":[0,1]}],"
+        "\"nodes\":[{\"mesh\":0,\"skin\":0},{\"name\":\"joint\",\"translation\":[" + translation + "]}],"
+        "\"skins\":[{\"joints\":[1]}],"
+        "\"meshes\":[{\"name\":\"skinned\",\"primitives\":[{\"attributes\":{\"POSITION\":0,\"NORMAL\":1,\"WEIGHTS_0\":2,\"JOINTS_0\":3},\"indices\":4}]}],"
+        "\"accessors\":["
+            "{\"bufferView\":0,\"componentType\":5126,\"count\":3,\"type\":\"VEC3\",\"min\":[0,0,0],\"max\":[1,1,0]},"
+            "{\"bufferView\":1,\"componentType\":5126,\"count\":3,\"type\":\"VEC3\"},"
+            "{\"bufferView\":2,\"componentType\":5126,\"count\":3,\"type\":\"VEC4\"},"
+            "{\"bufferView\":3,\"componentType\":5121,\"count\":3,\"type\":\"VEC4\"},"
+            "{\"bufferView\":4,\"componentType\":5123,\"count\":3,\"type\":\"SCALAR\"}"
+        "],"
+        "\"bufferViews\":["
+            "{\"buffer\":0,\"byteOffset\":0,\"byteLength\":36},"
+            "{\"buffer\":0,\"byteOffset\":36,\"byteLength\":36},"
+            "{\"buffer\":0,\"byteOffset\":72,\"byteLength\":48},"
+            "{\"buffer\":0,\"byteOffset\":120,\"byteLength\":12},"
+            "{\"buffer\":0,\"byteOffset\":132,\"byteLength\":6}"
+        "],"
+        "\"buffers\":[{\"byteLength\":" + std::to_string(bin.size()) + "}]"
+    "}";
+    write_glb_file(path, json, bin);
+}
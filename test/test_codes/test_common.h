@@ -2,6 +2,8 @@
 
 #include <filesystem>
 #include <memory>
+#include <string>
+#include <vector>
 #include "easy-vulkan.h"
 
 // 실행 파일이 위치한 디렉터리 경로를 반환하는 함수의 '선언'
@@ -15,4 +17,22 @@ void create_default_test_context(
     std::shared_ptr<ev::PhysicalDevice>& physical_device,
     std::shared_ptr<ev::Device>& device,
     bool debug = false
-);
\ No newline at end of file
+);
+
+// shaders/tools 의 compute/graphics 셰이더를 빌드 디렉터리에서 읽습니다. 컴파일된 파일이 없으면 nullptr
+std::shared_ptr<ev::Shader> load_tool_shader(
+    std::shared_ptr<ev::Device> device,
+    VkShaderStageFlagBits stage,
+    const std::string& file_name
+);
+
+// JSON 청크와 BIN 청크로 .glb 파일을 기록합니다.
+void write_glb_file(const std::filesystem::path& path, const std::string& json, const std::vector<uint8_t>& bin);
+
+// 삼각형 메시 하나를 node_count 개 노드가 x 축으로 2 씩 떨어져 참조하고,
+// 2x2 PNG 베이스 컬러 텍스처를 BIN 청크(bufferView)에 담은 .glb 파일을 기록합니다.
+void write_triangle_glb(const std::filesystem::path& path, uint32_t node_count = 1);
+
+// 관절 하나(joint_translation 위치)를 가진 스킨 삼각형 .glb 파일을 기록합니다.
+// 0, 1 번 정점은 가중치 1 로 관절을 따라가고 2 번 정점은 가중치가 없어 그대로 남습니다. inverse bind matrix 는 생략(단위 행렬)합니다.
+void write_skinned_triangle_glb(const std::filesystem::path& path, const float (&joint_translation)[3]);
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include <easy-vulkan.h>
+#include <filesystem>
+#include <memory>
+#include <unordered_set>
+#include "test_common.h"
+#include "tools/ev-gltf.h"
+#include "tools/ev-draw_list.h"
+
+using namespace std;
+using ev::tools::gltf::DrawList;
+
+class DrawListTest : public ::testing::Test {
+protected:
+    shared_ptr<ev::Instance> instance;
+    shared_ptr<ev::PhysicalDevice> physical_device;
+    shared_ptr<ev::Device> device;
+    shared_ptr<ev::MemoryAllocator> memory_allocator;
+    shared_ptr<ev::DescriptorPool> descriptor_pool;
+    shared_ptr<ev::CommandPool> command_pool;
+    shared_ptr<ev::Queue> queue;
+    shared_ptr<ev::tools::gltf::GLTFModelManager> manager;
+    shared_ptr<ev::DescriptorSetLayout> mesh_layout;
+    shared_ptr<ev::PipelineLayout> pipeline_layout;
+    filesystem::path directory;
+
+    void SetUp() override {
+        create_default_test_context(instance, physical_device, device);
+        memory_allocator = make_shared<ev::BitmapBuddyMemoryAllocator>(device);
+        memory_allocator->add_pool(ev::memory_type::GPU_ONLY, 16 * 1024 * 1024);
+        memory_allocator->add_pool(ev::memory_type::HOST_ONLY, 16 * 1024 * 1024);
+        memory_allocator->add_pool(ev::memory_type::HOST_READABLE, 4 * 1024 * 1024);
+        ASSERT_EQ(memory_allocator->build(), VK_SUCCESS);
+        descriptor_pool = make_shared<ev::DescriptorPool>(device);
+        descriptor_pool->add(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 64);
+        descriptor_pool->add(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 64);
+        ASSERT_EQ(descriptor_pool->create_pool(), VK_SUCCESS);
+        command_pool = make_shared<ev::CommandPool>(device, VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT);
+        queue = make_shared<ev::Queue>(device, device->get_queue_index(VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
+        manager = make_shared<ev::tools::gltf::GLTFModelManager>(device, memory_allocator, descriptor_pool, command_pool, queue);
+
+        // GLTFModelManager 의 메시 uniform 레이아웃과 같은 정의 (set 0)
+        mesh_layout = make_shared<ev::DescriptorSetLayout>(device);
+        mesh_layout->add_binding(VK_SHADER_STAGE_VERTEX_BIT, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 0, 1);
+        ASSERT_EQ(mesh_layout->create_layout(), VK_SUCCESS);
+        pipeline_layout = make_shared<ev::PipelineLayout>(device, vector<shared_ptr<ev::DescriptorSetLayout>>{ mesh_layout });
+
+        directory = filesystem::temp_directory_path() / "ev-draw-list-test";
+        filesystem::remove_all(directory);
+        filesystem::create_directories(directory);
+    }
+
+    void TearDown() override {
+        if ( !directory.empty() ) {
+            filesystem::remove_all(directory);
+        }
+    }
+
+    shared_ptr<ev::tools::gltf::Model> load_triangles(const string& name, uint32_t node_count) {
+        const filesystem::path path = directory / name;
+        write_triangle_glb(path, node_count);
+        return manager->load_model(path.string());
+    }
+
+    // 제출하지 않고 바인딩 수만 세므로 render pass 없이 기록
+    void record(DrawList& draw_list) {
+        shared_ptr<ev::CommandBuffer> command_buffer = command_pool->allocate(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+        command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+        draw_list.record(command_buffer, pipeline_layout, 1, 0);
+        command_buffer->end();
+    }
+
+    static size_t count_instance_sets(const DrawList& draw_list) {
+        unordered_set<const ev::DescriptorSet*> sets;
+        for ( const auto& item : draw_list.get_items() ) {
+            sets.insert(item.instance_set.get());
+        }
+        return sets.size();
+    }
+};
+
+TEST_F(DrawListTest, RecordSkipsRedundantBinds) {
+    auto first = load_triangles("first.glb", 3);
+    auto second = load_triangles("second.glb", 2);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+
+    DrawList draw_list;
+    // 추가 순서와 관계없이 모델별로 정렬되어 버퍼는 모델마다 한 번만 바인딩
+    draw_list.add_model(first, nullptr, ev::tools::gltf::RenderFlag::OPAQUE);
+    draw_list.add_model(second, nullptr, ev::tools::gltf::RenderFlag::OPAQUE);
+    ASSERT_EQ(draw_list.get_draw_count(), 5u);
+
+    record(draw_list);
+    const DrawList::Stats& stats = draw_list.get_stats();
+    EXPECT_EQ(stats.draws, 5u);
+    EXPECT_EQ(stats.pipeline_binds, 0u);
+    EXPECT_EQ(stats.buffer_binds, 2u);
+    EXPECT_EQ(stats.material_binds, 0u);
+    EXPECT_EQ(stats.instance_binds, count_instance_sets(draw_list));
+
+    // 같은 모델을 다시 기록해도 상태는 기록마다 새로 시작
+    record(draw_list);
+    EXPECT_EQ(draw_list.get_stats().buffer_binds, 2u);
+    EXPECT_EQ(draw_list.get_stats().draws, 5u);
+
+    // 메시 셋 번호를 주지 않으면 인스턴스 셋은 바인딩하지 않음
+    shared_ptr<ev::CommandBuffer> command_buffer = command_pool->allocate(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+    command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+    draw_list.record(command_buffer, pipeline_layout);
+    command_buffer->end();
+    EXPECT_EQ(draw_list.get_stats().instance_binds, 0u);
+}
+
+TEST_F(DrawListTest, CullFeedsVisibleItemsToRecord) {
+    // 노드는 x = 0, 2, 4 에 놓인 삼각형 (bounding sphere 중심 x + 0.5, 반지름 약 0.7)
+    auto model = load_triangles("row.glb", 3);
+    ASSERT_NE(model, nullptr);
+
+    DrawList draw_list;
+    draw_list.add_model(model, nullptr, ev::tools::gltf::RenderFlag::OPAQUE);
+    ASSERT_EQ(draw_list.get_draw_count(), 3u);
+
+    // 단위 행렬의 절두체는 x 가 [-1, 1] 이므로 첫 노드만 보임
+    EXPECT_EQ(draw_list.cull(glm::mat4(1.0f)), 1u);
+    EXPECT_EQ(draw_list.get_draw_count(), 1u);
+    record(draw_list);
+    EXPECT_EQ(draw_list.get_stats().draws, 1u);
+    EXPECT_EQ(draw_list.get_stats().buffer_binds, 1u);
+
+    // 병렬 컬링도 같은 결과
+    EXPECT_EQ(draw_list.cull(glm::mat4(1.0f), true), draw_list.cull(glm::mat4(1.0f), false));
+
+    // 축소하면 모두 보임
+    EXPECT_EQ(draw_list.cull(glm::scale(glm::mat4(1.0f), glm::vec3(0.1f))), 3u);
+    record(draw_list);
+    EXPECT_EQ(draw_list.get_stats().draws, 3u);
+
+    // 노드를 옮기면 다음 cull 에서 새 월드 행렬을 읽음
+    model->get_linear_nodes()[0]->set_translation(glm::vec3(10.0f, 0.0f, 0.0f));
+    model->update_transforms();
+    EXPECT_EQ(draw_list.cull(glm::mat4(1.0f)), 0u);
+    record(draw_list);
+    EXPECT_EQ(draw_list.get_stats().draws, 0u);
+
+    // 컬링 결과를 버리면 다시 모든 항목을 기록
+    draw_list.reset_culling();
+    EXPECT_EQ(draw_list.get_draw_count(), 3u);
+    record(draw_list);
+    EXPECT_EQ(draw_list.get_stats().draws, 3u);
+}
@@ -23,3 +23,13 @@ TEST_F(FenceTest, CreateAndDestroy) {
     fence.destroy();
 }
 
+
+TEST_F(FenceTest, GetStatusDoesNotWait) {
+    Fence signaled(device);
+    EXPECT_EQ(signaled.get_status(), VK_SUCCESS);
+
+    Fence unsignaled(device, 0);
+    EXPECT_EQ(unsignaled.get_status(), VK_NOT_READY);
+    EXPECT_EQ(signaled.reset(), VK_SUCCESS);
+    EXPECT_EQ(signaled.get_status(), VK_NOT_READY);
+}
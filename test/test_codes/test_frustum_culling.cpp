@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "tools/ev-frustum_culling.h"
+
+using namespace ev::tools;
+
+namespace {
+
+/** 원점에서 -z 를 보는 90 도 원근 투영 (열 우선, z 범위 [0, 1], near 1, far 100) */
+void perspective(float matrix[16]) {
+    const float near_plane = 1.0f;
+    const float far_plane = 100.0f;
+    for ( int i = 0 ; i < 16 ; ++i ) {
+        matrix[i] = 0.0f;
+    }
+    matrix[0] = 1.0f;
+    matrix[5] = 1.0f;
+    matrix[10] = far_plane / (near_plane - far_plane);
+    matrix[11] = -1.0f;
+    matrix[14] = near_plane * far_plane / (near_plane - far_plane);
+}
+
+void translation(float matrix[16], float x, float y, float z, float scale = 1.0f) {
+    for ( int i = 0 ; i < 16 ; ++i ) {
+        matrix[i] = 0.0f;
+    }
+    matrix[0] = matrix[5] = matrix[10] = scale;
+    matrix[15] = 1.0f;
+    matrix[12] = x;
+    matrix[13] = y;
+    matrix[14] = z;
+}
+
+}
+
+TEST(FrustumCullingTest, ClassifiesSpheresAgainstPerspectiveFrustum) {
+    float view_projection[16];
+    perspective(view_projection);
+    float planes[24];
+    FrustumCuller::extract_planes(view_projection, planes);
+
+    FrustumCuller culler;
+    const float origin[3] = { 0.0f, 0.0f, 0.0f };
+    float matrix[16];
+    // 0: 정면, 1: 카메라 뒤, 2: 오른쪽 밖, 3: 오른쪽 경계에 걸침, 4: far 밖, 5: 스케일로 커져 near 에 걸침
+    const float positions[6][3] = {
+        { 0.0f, 0.0f, -10.0f }, { 0.0f, 0.0f, 10.0f }, { 20.0f, 0.0f, -10.0f },
+        { 10.5f, 0.0f, -10.0f }, { 0.0f, 0.0f, -150.0f }, { 0.0f, 0.0f, 2.0f }
+    };
+    for ( int i = 0 ; i < 6 ; ++i ) {
+        translation(matrix, positions[i][0], positions[i][1], positions[i][2], i == 5 ? 4.0f : 1.0f);
+        culler.add(origin, 1.0f, matrix);
+    }
+
+    std::vector<uint32_t> visible;
+    EXPECT_EQ(culler.cull(planes, visible), 3u);
+    EXPECT_EQ(visible, (std::vector<uint32_t>{ 0, 3, 5 })) << culling::simd_backend();
+
+    // 행렬만 바꿔도 결과 갱신
+    translation(matrix, 0.0f, 0.0f, -5.0f);
+    culler.set_matrix(1, matrix);
+    const float offset[3] = { -20.0f, 0.0f, 0.0f };
+    culler.set_sphere(0, offset, 1.0f);
+    culler.cull(planes, visible);
+    EXPECT_EQ(visible, (std::vector<uint32_t>{ 1, 3, 5 }));
+}
+
+TEST(FrustumCullingTest, SimdAndParallelMatchScalar) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+    std::uniform_real_distribution<float> unit(0.1f, 3.0f);
+
+    float view_projection[16];
+    perspective(view_projection);
+    float planes[24];
+    FrustumCuller::extract_planes(view_projection, planes);
+
+    constexpr uint32_t COUNT = 70001;
+    FrustumCuller culler;
+    culler.reserve(COUNT);
+    for ( uint32_t i = 0 ; i < COUNT ; ++i ) {
+        const float center[3] = { unit(rng), -unit(rng), unit(rng) };
+        float matrix[16];
+        translation(matrix, position(rng), position(rng), position(rng) - 40.0f, unit(rng));
+        // 비균등 스케일
+        matrix[5] *= unit(rng);
+        culler.add(center, unit(rng), matrix);
+    }
+
+    std::vector<uint32_t> parallel_visible;
+    std::vector<uint32_t> serial_visible;
+    culler.cull(planes, parallel_visible, true);
+    culler.cull(planes, serial_visible, false);
+    EXPECT_EQ(parallel_visible, serial_visible);
+    EXPECT_GT(serial_visible.size(), 0u);
+    EXPECT_LT(serial_visible.size(), COUNT);
+
+    // SoA 를 직접 만들어 scalar 구현과 비교
+    std::vector<uint32_t> expected(COUNT);
+    std::vector<uint32_t> simd(COUNT);
+    std::mt19937 replay(7);
+    std::vector<float> m[12], c[3], r;
+    for ( uint32_t i = 0 ; i < COUNT ; ++i ) {
+        const float center[3] = { unit(replay), -unit(replay), unit(replay) };
+        float matrix[16];
+        translation(matrix, position(replay), position(replay), position(replay) - 40.0f, unit(replay));
+        matrix[5] *= unit(replay);
+        r.push_back(unit(replay));
+        for ( int axis = 0 ; axis < 3 ; ++axis ) {
+            c[axis].push_back(center[axis]);
+        }
+        for ( int column = 0 ; column < 4 ; ++column ) {
+            for ( int row = 0 ; row < 3 ; ++row ) {
+                m[column * 3 + row].push_back(matrix[column * 4 + row]);
+            }
+        }
+    }
+    const float* m_ptr[12];
+    for ( int k = 0 ; k < 12 ; ++k ) {
+        m_ptr[k] = m[k].data();
+    }
+    const float* c_ptr[3] = { c[0].data(), c[1].data(), c[2].data() };
+    // 정렬되지 않은 시작 위치
+    const size_t scalar_count = culling::scalar::cull_spheres(m_ptr, c_ptr, r.data(), planes, 3, COUNT, expected.data());
+    const size_t simd_count = culling::cull_spheres(m_ptr, c_ptr, r.data(), planes, 3, COUNT, simd.data());
+    ASSERT_EQ(simd_count, scalar_count) << culling::simd_backend();
+    expected.resize(scalar_count);
+    simd.resize(simd_count);
+    EXPECT_EQ(simd, expected);
+
+    std::vector<uint32_t> tail(serial_visible.begin(), serial_visible.end());
+    tail.erase(std::remove_if(tail.begin(), tail.end(), [](uint32_t index) { return index < 3; }), tail.end());
+    EXPECT_EQ(tail, expected);
+}
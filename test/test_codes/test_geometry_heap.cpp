@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <easy-vulkan.h>
+#include <filesystem>
+#include <memory>
+#include "test_common.h"
+#include "tools/ev-gltf.h"
+#include "tools/ev-geometry_heap.h"
+
+using namespace std;
+using ev::tools::gltf::GeometryAllocation;
+using ev::tools::gltf::GeometryHeap;
+
+class GeometryHeapTest : public ::testing::Test {
+protected:
+    shared_ptr<ev::Instance> instance;
+    shared_ptr<ev::PhysicalDevice> physical_device;
+    shared_ptr<ev::Device> device;
+    shared_ptr<ev::MemoryAllocator> memory_allocator;
+    shared_ptr<GeometryHeap> heap;
+
+    static constexpr uint32_t VERTEX_CAPACITY = 64;
+    static constexpr uint32_t INDEX_CAPACITY = 192;
+
+    void SetUp() override {
+        create_default_test_context(instance, physical_device, device);
+        memory_allocator = make_shared<ev::BitmapBuddyMemoryAllocator>(device);
+        memory_allocator->add_pool(ev::memory_type::GPU_ONLY, 16 * 1024 * 1024);
+        memory_allocator->add_pool(ev::memory_type::HOST_ONLY, 16 * 1024 * 1024);
+        memory_allocator->add_pool(ev::memory_type::HOST_READABLE, 4 * 1024 * 1024);
+        ASSERT_EQ(memory_allocator->build(), VK_SUCCESS);
+        heap = make_shared<GeometryHeap>(device, memory_allocator, ev::tools::gltf::VertexLayout(), VERTEX_CAPACITY, INDEX_CAPACITY);
+    }
+};
+
+TEST_F(GeometryHeapTest, ReleasedRangesWaitForRetire) {
+    shared_ptr<GeometryAllocation> first = heap->allocate(VERTEX_CAPACITY / 2, INDEX_CAPACITY / 2);
+    shared_ptr<GeometryAllocation> second = heap->allocate(VERTEX_CAPACITY / 2, INDEX_CAPACITY / 2);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(heap->get_free_vertex_count(), 0u);
+    const uint32_t first_vertex = first->get_first_vertex();
+    const uint32_t first_index = first->get_first_index();
+
+    // 프레임 5 에서 해제한 구간은 그 프레임이 끝날 때까지 다른 할당에 주지 않음
+    heap->set_current_frame(5);
+    first.reset();
+    EXPECT_EQ(heap->get_pending_release_count(), 1u);
+    EXPECT_EQ(heap->get_free_vertex_count(), 0u);
+    EXPECT_EQ(heap->get_free_index_count(), 0u);
+    EXPECT_EQ(heap->allocate(1, 1), nullptr);
+
+    EXPECT_EQ(heap->retire_frames(4), 0u);
+    EXPECT_EQ(heap->get_pending_release_count(), 1u);
+
+    EXPECT_EQ(heap->retire_frames(5), 1u);
+    EXPECT_EQ(heap->get_pending_release_count(), 0u);
+    EXPECT_EQ(heap->get_free_vertex_count(), VERTEX_CAPACITY / 2);
+    EXPECT_EQ(heap->get_free_index_count(), INDEX_CAPACITY / 2);
+
+    shared_ptr<GeometryAllocation> third = heap->allocate(VERTEX_CAPACITY / 2, INDEX_CAPACITY / 2);
+    ASSERT_NE(third, nullptr);
+    EXPECT_EQ(third->get_first_vertex(), first_vertex);
+    EXPECT_EQ(third->get_first_index(), first_index);
+}
+
+TEST_F(GeometryHeapTest, ModelGeometryReleasedAfterRetire) {
+    const filesystem::path directory = filesystem::temp_directory_path() / "ev-geometry-heap-test";
+    filesystem::remove_all(directory);
+    filesystem::create_directories(directory);
+    write_triangle_glb(directory / "triangle.glb", 2);
+
+    auto descriptor_pool = make_shared<ev::DescriptorPool>(device);
+    descriptor_pool->add(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 16);
+    descriptor_pool->add(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 16);
+    ASSERT_EQ(descriptor_pool->create_pool(), VK_SUCCESS);
+    auto command_pool = make_shared<ev::CommandPool>(device, VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT);
+    auto queue = make_shared<ev::Queue>(device, device->get_queue_index(VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
+    auto manager = make_shared<ev::tools::gltf::GLTFModelManager>(device, memory_allocator, descriptor_pool, command_pool, queue);
+    manager->set_geometry_heap(heap);
+
+    shared_ptr<ev::tools::gltf::Model> model = manager->load_model((directory / "triangle.glb").string());
+    filesystem::remove_all(directory);
+    ASSERT_NE(model, nullptr);
+    ASSERT_NE(model->get_geometry_allocation(), nullptr);
+    EXPECT_EQ(model->get_vertex_buffer(), heap->get_vertex_buffer());
+    const uint32_t used_vertices = VERTEX_CAPACITY - heap->get_free_vertex_count();
+    EXPECT_GT(used_vertices, 0u);
+
+    // 모델을 버려도 기록된 커맨드 버퍼가 읽을 수 있으므로 구간은 retire_frames 까지 유지
+    heap->set_current_frame(1);
+    model.reset();
+    EXPECT_EQ(heap->get_pending_release_count(), 1u);
+    EXPECT_EQ(VERTEX_CAPACITY - heap->get_free_vertex_count(), used_vertices);
+
+    EXPECT_EQ(heap->retire_frames(1), 1u);
+    EXPECT_EQ(heap->get_free_vertex_count(), VERTEX_CAPACITY);
+    EXPECT_EQ(heap->get_free_index_count(), INDEX_CAPACITY);
+}
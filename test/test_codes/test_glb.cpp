@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "tools/ev-glb.h"
+
+using namespace ev::tools;
+
+namespace {
+
+void put_u32(std::vector<uint8_t>& out, uint32_t value) {
+    for ( int i = 0 ; i < 4 ; ++i ) {
+        out.push_back(static_cast<uint8_t>(value >> (i * 8)));
+    }
+}
+
+void put_chunk(std::vector<uint8_t>& out, uint32_t type, const std::vector<uint8_t>& data, uint8_t padding) {
+    std::vector<uint8_t> padded = data;
+    while ( padded.size() % 4 ) {
+        padded.push_back(padding);
+    }
+    put_u32(out, static_cast<uint32_t>(padded.size()));
+    put_u32(out, type);
+    out.insert(out.end(), padded.begin(), padded.end());
+}
+
+std::vector<uint8_t> make_glb(const std::string& json, const std::vector<uint8_t>& bin, bool with_extra_chunk = false) {
+    std::vector<uint8_t> chunks;
+    put_chunk(chunks, glb::CHUNK_JSON, std::vector<uint8_t>(json.begin(), json.end()), ' ');
+    if ( with_extra_chunk ) {
+        put_chunk(chunks, 0x54534554, { 1, 2, 3, 4 }, 0);
+    }
+    if ( !bin.empty() ) {
+        put_chunk(chunks, glb::CHUNK_BIN, bin, 0);
+    }
+    std::vector<uint8_t> out;
+    put_u32(out, glb::MAGIC);
+    put_u32(out, glb::VERSION);
+    put_u32(out, static_cast<uint32_t>(12 + chunks.size()));
+    out.insert(out.end(), chunks.begin(), chunks.end());
+    return out;
+}
+
+}
+
+TEST(GLBTest, FindsJsonAndBinChunks) {
+    const std::string json = "{\"asset\":{\"version\":\"2.0\"}}";
+    const std::vector<uint8_t> bin = { 10, 20, 30, 40, 50, 60, 70, 80 };
+    const std::vector<uint8_t> file = make_glb(json, bin, true);
+
+    ASSERT_TRUE(glb::is_glb(file.data(), file.size()));
+    glb::Container container;
+    ASSERT_TRUE(glb::parse(file.data(), file.size(), container));
+    // JSON 청크는 공백으로 패딩됨
+    EXPECT_EQ(container.json.substr(0, json.size()), json);
+    EXPECT_EQ(container.json.size() % 4, 0u);
+    // 알 수 없는 청크를 건너뛰고 BIN 청크를 복사 없이 가리킴
+    ASSERT_NE(container.bin, nullptr);
+    EXPECT_EQ(container.bin_size, bin.size());
+    EXPECT_GE(container.bin, file.data());
+    EXPECT_EQ(std::vector<uint8_t>(container.bin, container.bin + container.bin_size), bin);
+}
+
+TEST(GLBTest, AcceptsMissingBinChunk) {
+    const std::vector<uint8_t> file = make_glb("{}", {});
+    glb::Container container;
+    ASSERT_TRUE(glb::parse(file.data(), file.size(), container));
+    EXPECT_EQ(container.bin, nullptr);
+    EXPECT_EQ(container.bin_size, 0u);
+}
+
+TEST(GLBTest, RejectsMalformedFiles) {
+    glb::Container container;
+    std::vector<uint8_t> file = make_glb("{}", { 1, 2, 3, 4 });
+
+    // 잘린 파일
+    EXPECT_FALSE(glb::parse(file.data(), file.size() - 4, container));
+
+    // 청크 길이가 파일 길이를 넘음
+    std::vector<uint8_t> overflow = file;
+    overflow[12] = 0xFF;
+    EXPECT_FALSE(glb::parse(overflow.data(), overflow.size(), container));
+
+    // 잘못된 매직과 버전
+    std::vector<uint8_t> magic = file;
+    magic[0] = 'x';
+    EXPECT_FALSE(glb::is_glb(magic.data(), magic.size()));
+    EXPECT_FALSE(glb::parse(magic.data(), magic.size(), container));
+    std::vector<uint8_t> version = file;
+    version[4] = 1;
+    EXPECT_FALSE(glb::parse(version.data(), version.size(), container));
+
+    // 첫 청크가 JSON 이 아님
+    std::vector<uint8_t> order = file;
+    order[16] = 'B';
+    EXPECT_FALSE(glb::parse(order.data(), order.size(), container));
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <easy-vulkan.h>
+#include <chrono>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <thread>
+#include "test_common.h"
+#include "tools/ev-gltf.h"
+
+using namespace std;
+
+class GLTFCacheTest : public ::testing::Test {
+protected:
+    shared_ptr<ev::Instance> instance;
+    shared_ptr<ev::PhysicalDevice> physical_device;
+    shared_ptr<ev::Device> device;
+    shared_ptr<ev::MemoryAllocator> memory_allocator;
+    shared_ptr<ev::DescriptorPool> descriptor_pool;
+    shared_ptr<ev::CommandPool> command_pool;
+    shared_ptr<ev::Queue> queue;
+    filesystem::path directory;
+
+    void SetUp() override {
+        create_default_test_context(instance, physical_device, device);
+        memory_allocator = make_shared<ev::BitmapBuddyMemoryAllocator>(device);
+        memory_allocator->add_pool(ev::memory_type::GPU_ONLY, 16 * 1024 * 1024);
+        memory_allocator->add_pool(ev::memory_type::HOST_ONLY, 16 * 1024 * 1024);
+        memory_allocator->add_pool(ev::memory_type::HOST_READABLE, 4 * 1024 * 1024);
+        ASSERT_EQ(memory_allocator->build(), VK_SUCCESS);
+        descriptor_pool = make_shared<ev::DescriptorPool>(device);
+        descriptor_pool->add(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 16);
+        descriptor_pool->add(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 16);
+        ASSERT_EQ(descriptor_pool->create_pool(), VK_SUCCESS);
+        command_pool = make_shared<ev::CommandPool>(device, VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT);
+        queue = make_shared<ev::Queue>(device, device->get_queue_index(VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
+
+        directory = filesystem::temp_directory_path() / "ev-gltf-cache-test";
+        filesystem::remove_all(directory);
+        filesystem::create_directories(directory);
+    }
+
+    void TearDown() override {
+        if ( !directory.empty() ) {
+            filesystem::remove_all(directory);
+        }
+    }
+
+    shared_ptr<ev::tools::gltf::GLTFModelManager> create_manager() {
+        auto manager = make_shared<ev::tools::gltf::GLTFModelManager>(device, memory_allocator, descriptor_pool, command_pool, queue);
+        manager->set_cache_directory(directory / "cache");
+        return manager;
+    }
+
+    size_t cache_file_count() const {
+        size_t count = 0;
+        for ( const auto& entry : filesystem::directory_iterator(directory / "cache") ) {
+            count += entry.path().extension() == ".evmc" ? 1 : 0;
+        }
+        return count;
+    }
+};
+
+TEST_F(GLTFCacheTest, EmbeddedTextureRoundTrip) {
+    const filesystem::path model_path = directory / "triangle.glb";
+    write_triangle_glb(model_path, 2);
+
+    // 첫 로드는 원본을 파싱하고 BIN 청크의 PNG 를 캐시 파일에 함께 기록
+    shared_ptr<ev::tools::gltf::Model> source = create_manager()->load_model(model_path.string());
+    ASSERT_NE(source, nullptr);
+    ASSERT_EQ(cache_file_count(), 1u);
+
+    // 새 관리자로 다시 로드하면 캐시에서 복원
+    shared_ptr<ev::tools::gltf::Model> cached = create_manager()->load_model(model_path.string());
+    ASSERT_NE(cached, nullptr);
+    EXPECT_EQ(cache_file_count(), 1u);
+
+    ASSERT_EQ(source->get_textures().size(), 1u);
+    ASSERT_EQ(cached->get_textures().size(), source->get_textures().size());
+    // 원본 파일이 없는 텍스처는 빈 경로로 기록됨
+    EXPECT_TRUE(source->get_texture_sources()[0].empty());
+    EXPECT_TRUE(cached->get_texture_sources()[0].empty());
+    const VkExtent3D source_extent = source->get_textures()[0]->image->get_extent();
+    const VkExtent3D cached_extent = cached->get_textures()[0]->image->get_extent();
+    EXPECT_EQ(cached_extent.width, source_extent.width);
+    EXPECT_EQ(cached_extent.height, source_extent.height);
+    EXPECT_EQ(cached->get_textures()[0]->image->get_mip_levels(), source->get_textures()[0]->image->get_mip_levels());
+
+    EXPECT_EQ(cached->get_vertex_count(), source->get_vertex_count());
+    EXPECT_EQ(cached->get_index_type(), source->get_index_type());
+    ASSERT_EQ(cached->get_linear_nodes().size(), source->get_linear_nodes().size());
+    ASSERT_EQ(cached->get_materials().size(), source->get_materials().size());
+    EXPECT_EQ(cached->get_materials()[0]->get_base_color_texture(), cached->get_textures()[0]);
+    for ( size_t i = 0 ; i < source->get_linear_nodes().size() ; ++i ) {
+        const auto& source_node = source->get_linear_nodes()[i];
+        const auto& cached_node = cached->get_linear_nodes()[i];
+        EXPECT_EQ(cached_node->get_matrix(), source_node->get_matrix());
+        ASSERT_EQ(cached_node->get_mesh() != nullptr, source_node->get_mesh() != nullptr);
+        if ( !source_node->get_mesh() ) {
+            continue;
+        }
+        const auto& source_primitives = source_node->get_mesh()->get_primitives();
+        const auto& cached_primitives = cached_node->get_mesh()->get_primitives();
+        ASSERT_EQ(cached_primitives.size(), source_primitives.size());
+        for ( size_t p = 0 ; p < source_primitives.size() ; ++p ) {
+            EXPECT_EQ(cached_primitives[p]->get_index_count(), source_primitives[p]->get_index_count());
+            EXPECT_EQ(cached_primitives[p]->get_vertex_count(), source_primitives[p]->get_vertex_count());
+        }
+    }
+}
+
+TEST_F(GLTFCacheTest, AsyncLoadRestoresCache) {
+    const filesystem::path model_path = directory / "async.glb";
+    write_triangle_glb(model_path, 2);
+    auto manager = create_manager();
+    auto load = [&]() -> shared_ptr<ev::tools::gltf::Model> {
+        shared_future<shared_ptr<ev::tools::gltf::Model>> future = manager->load_model_async(model_path.string());
+        for ( int frame = 0 ; frame < 10000 ; ++frame ) {
+            manager->update_async_loads();
+            if ( future.wait_for(chrono::seconds(0)) == future_status::ready ) {
+                return future.get();
+            }
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+        ADD_FAILURE() << "async load did not finish";
+        return nullptr;
+    };
+
+    shared_ptr<ev::tools::gltf::Model> source = load();
+    ASSERT_NE(source, nullptr);
+    ASSERT_EQ(cache_file_count(), 1u);
+
+    // 두 번째 로드는 로더 스레드가 캐시를 복원하고 update_async_loads 가 한 번에 업로드
+    shared_ptr<ev::tools::gltf::Model> cached = load();
+    ASSERT_NE(cached, nullptr);
+    EXPECT_NE(cached, source);
+    EXPECT_EQ(cache_file_count(), 1u);
+    EXPECT_EQ(cached->get_vertex_count(), source->get_vertex_count());
+    ASSERT_EQ(cached->get_textures().size(), source->get_textures().size());
+    ASSERT_EQ(cached->get_materials().size(), source->get_materials().size());
+    EXPECT_EQ(cached->get_materials()[0]->get_base_color_texture(), cached->get_textures()[0]);
+    ASSERT_NE(cached->get_vertex_buffer(), nullptr);
+    ASSERT_NE(cached->get_index_buffer(), nullptr);
+    for ( const auto& node : cached->get_linear_nodes() ) {
+        if ( node->get_mesh() ) {
+            EXPECT_NE(node->get_mesh()->get_descriptor_set(), nullptr);
+        }
+    }
+    EXPECT_EQ(manager->update_async_loads(), 0u);
+}
@@ -0,0 +1,262 @@
+#include <gtest/gtest.h>
+#include <easy-vulkan.h>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <thread>
+#include "test_common.h"
+#include "tools/ev-gltf.h"
+#include "tools/ev-draw_list.h"
+#include "tools/ev-model_instance.h"
+#include "tools/ev-texture_cache.h"
+
+using namespace std;
+
+class GLTFModelTest : public ::testing::Test {
+protected:
+    shared_ptr<ev::Instance> instance;
+    shared_ptr<ev::PhysicalDevice> physical_device;
+    shared_ptr<ev::Device> device;
+    shared_ptr<ev::MemoryAllocator> memory_allocator;
+    shared_ptr<ev::DescriptorPool> descriptor_pool;
+    shared_ptr<ev::CommandPool> command_pool;
+    shared_ptr<ev::Queue> queue;
+    filesystem::path directory;
+
+    void SetUp() override {
+        create_default_test_context(instance, physical_device, device);
+        memory_allocator = make_shared<ev::BitmapBuddyMemoryAllocator>(device);
+        memory_allocator->add_pool(ev::memory_type::GPU_ONLY, 16 * 1024 * 1024);
+        memory_allocator->add_pool(ev::memory_type::HOST_ONLY, 16 * 1024 * 1024);
+        memory_allocator->add_pool(ev::memory_type::HOST_READABLE, 4 * 1024 * 1024);
+        ASSERT_EQ(memory_allocator->build(), VK_SUCCESS);
+        descriptor_pool = make_shared<ev::DescriptorPool>(device);
+        descriptor_pool->add(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 16);
+        descriptor_pool->add(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 16);
+        ASSERT_EQ(descriptor_pool->create_pool(), VK_SUCCESS);
+        command_pool = make_shared<ev::CommandPool>(device, VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT);
+        queue = make_shared<ev::Queue>(device, device->get_queue_index(VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
+
+        directory = filesystem::temp_directory_path() / "ev-gltf-model-test";
+        filesystem::remove_all(directory);
+        filesystem::create_directories(directory);
+    }
+
+    void TearDown() override {
+        if ( !directory.empty() ) {
+            filesystem::remove_all(directory);
+        }
+    }
+
+    shared_ptr<ev::tools::gltf::GLTFModelManager> create_manager() {
+        return make_shared<ev::tools::gltf::GLTFModelManager>(device, memory_allocator, descriptor_pool, command_pool, queue);
+    }
+
+    // 렌더 루프처럼 매 프레임 update_async_loads 를 호출하며 future 를 확인
+    static shared_ptr<ev::tools::gltf::Model> wait_async(
+        ev::tools::gltf::GLTFModelManager& manager,
+        const shared_future<shared_ptr<ev::tools::gltf::Model>>& future
+    ) {
+        for ( int frame = 0 ; frame < 10000 ; ++frame ) {
+            manager.update_async_loads();
+            if ( future.wait_for(chrono::seconds(0)) == future_status::ready ) {
+                return future.get();
+            }
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+        ADD_FAILURE() << "async load did not finish";
+        return nullptr;
+    }
+};
+
+TEST_F(GLTFModelTest, QuantizedMeshUniformUploaded) {
+    using namespace ev::tools::gltf;
+    const filesystem::path model_path = directory / "triangle.glb";
+    write_triangle_glb(model_path, 2);
+
+    auto manager = create_manager();
+    manager->set_vertex_layout(VertexLayout({ VertexType::Position, VertexType::Normal, VertexType::UV }, VertexEncoding::Quantized));
+    shared_ptr<Model> model = manager->load_model(model_path.string());
+    ASSERT_NE(model, nullptr);
+
+    size_t mesh_count = 0;
+    for ( const auto& node : model->get_linear_nodes() ) {
+        const shared_ptr<Mesh>& mesh = node->get_mesh();
+        if ( !mesh ) {
+            continue;
+        }
+        ++mesh_count;
+        // 메시마다 uniform 디스크립터 셋이 만들어지고 버퍼에 위치 복원 값이 올라가 있어야 함
+        ASSERT_NE(mesh->get_descriptor_set(), nullptr);
+        ASSERT_NE(mesh->get_uniform_buffer(), nullptr);
+        ASSERT_NE(mesh->get_uniform_buffer()->get_mapped_ptr(), nullptr);
+        Mesh::Uniform uploaded;
+        memcpy(&uploaded, mesh->get_uniform_buffer()->get_mapped_ptr(), sizeof(uploaded));
+        EXPECT_EQ(uploaded.position_offset, mesh->get_uniform_data().position_offset);
+        EXPECT_EQ(uploaded.position_scale, mesh->get_uniform_data().position_scale);
+        EXPECT_NE(uploaded.position_scale, glm::vec4(1.0f));
+        EXPECT_EQ(uploaded.matrix, mesh->get_uniform_data().matrix);
+    }
+    EXPECT_GT(mesh_count, 0u);
+
+    // 노드 이동 후 update_transforms 가 행렬을 다시 올림
+    const shared_ptr<Node>& node = model->get_linear_nodes()[0];
+    node->set_translation(glm::vec3(0.0f, 5.0f, 0.0f));
+    model->update_transforms();
+    Mesh::Uniform uploaded;
+    memcpy(&uploaded, node->get_mesh()->get_uniform_buffer()->get_mapped_ptr(), sizeof(uploaded));
+    EXPECT_EQ(uploaded.matrix, node->get_mesh()->get_uniform_data().matrix);
+
+    // DrawList 항목도 메시 uniform 셋을 가져감
+    ev::tools::gltf::DrawList draw_list;
+    draw_list.add_model(model, nullptr);
+    draw_list.build();
+    ASSERT_FALSE(draw_list.get_items().empty());
+    for ( const auto& item : draw_list.get_items() ) {
+        EXPECT_NE(item.instance_set, nullptr);
+    }
+}
+
+TEST_F(GLTFModelTest, ModelAssetCacheSharesAndEvicts) {
+    using namespace ev::tools::gltf;
+    const filesystem::path first_path = directory / "first.glb";
+    const filesystem::path second_path = directory / "second.glb";
+    write_triangle_glb(first_path, 1);
+    write_triangle_glb(second_path, 2);
+
+    auto cache = make_shared<ModelAssetCache>();
+    auto manager = create_manager();
+    manager->set_model_asset_cache(cache);
+
+    // 같은 파일과 설정이면 두 번째 로드는 같은 Model 을 공유
+    shared_ptr<ModelInstance> first = manager->load_model_instance(first_path.string());
+    shared_ptr<ModelInstance> again = manager->load_model_instance(first_path.string());
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(again, nullptr);
+    EXPECT_NE(first, again);
+    EXPECT_EQ(first->get_model(), again->get_model());
+    EXPECT_EQ(cache->size(), 1u);
+    EXPECT_EQ(cache->get_stats().hits, 1u);
+
+    // 로드 결과를 바꾸는 설정이 다르면 같은 파일이라도 따로 로드
+    auto lod_manager = create_manager();
+    lod_manager->set_model_asset_cache(cache);
+    lod_manager->set_lod_levels(2);
+    shared_ptr<ModelInstance> lod = lod_manager->load_model_instance(first_path.string());
+    ASSERT_NE(lod, nullptr);
+    EXPECT_NE(lod->get_model(), first->get_model());
+    EXPECT_EQ(cache->size(), 2u);
+
+    auto quantized_manager = create_manager();
+    quantized_manager->set_model_asset_cache(cache);
+    quantized_manager->set_vertex_layout(VertexLayout({ VertexType::Position, VertexType::Normal, VertexType::UV }, VertexEncoding::Quantized));
+    shared_ptr<ModelInstance> quantized = quantized_manager->load_model_instance(first_path.string());
+    ASSERT_NE(quantized, nullptr);
+    EXPECT_NE(quantized->get_model(), first->get_model());
+    EXPECT_EQ(cache->size(), 3u);
+
+    // budget 을 0 으로 줄여도 인스턴스가 참조하는 모델은 유지
+    cache->set_budget(0);
+    EXPECT_EQ(cache->size(), 3u);
+
+    // 참조가 사라진 모델만 해제되고 다시 로드하면 새 Model
+    const weak_ptr<Model> released = lod->get_model();
+    lod.reset();
+    quantized.reset();
+    EXPECT_EQ(cache->trim(), 2u);
+    EXPECT_EQ(cache->size(), 1u);
+    EXPECT_TRUE(released.expired());
+
+    // budget 안에서는 참조가 없어도 남아 있다가 오래된 것부터 해제
+    cache->set_budget(first->get_model()->get_resource_bytes() * 4);
+    shared_ptr<ModelInstance> second = manager->load_model_instance(second_path.string());
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(cache->size(), 2u);
+    second.reset();
+    EXPECT_EQ(cache->trim(), 0u);
+    EXPECT_EQ(cache->size(), 2u);
+    first.reset();
+    again.reset();
+    cache->set_budget(cache->get_resident_bytes() - 1);
+    EXPECT_EQ(cache->size(), 1u);
+    EXPECT_EQ(cache->get_stats().evictions, 3u);
+}
+
+TEST_F(GLTFModelTest, AsyncLoadFinishesInUpdate) {
+    using namespace ev::tools::gltf;
+    write_triangle_glb(directory / "async.glb", 2);
+    write_triangle_glb(directory / "sync.glb", 1);
+    auto texture_cache = make_shared<ev::tools::TextureCache>();
+    auto manager = create_manager();
+    manager->set_texture_cache(texture_cache);
+
+    // 디코딩은 로더 스레드에서 끝나도 GPU 업로드는 update_async_loads 를 호출해야 진행
+    shared_future<shared_ptr<Model>> future = manager->load_model_async((directory / "async.glb").string());
+    this_thread::sleep_for(chrono::milliseconds(50));
+    EXPECT_EQ(future.wait_for(chrono::seconds(0)), future_status::timeout);
+
+    shared_ptr<Model> model = wait_async(*manager, future);
+    ASSERT_NE(model, nullptr);
+    ASSERT_NE(model->get_vertex_buffer(), nullptr);
+    ASSERT_NE(model->get_index_buffer(), nullptr);
+    ASSERT_EQ(model->get_textures().size(), 1u);
+    for ( const auto& node : model->get_linear_nodes() ) {
+        if ( node->get_mesh() ) {
+            EXPECT_NE(node->get_mesh()->get_descriptor_set(), nullptr);
+            EXPECT_NE(node->get_mesh()->get_uniform_buffer(), nullptr);
+        }
+    }
+
+    // 텍스처는 업로드가 끝난 뒤 캐시에 등록되어 다음 로드가 공유
+    EXPECT_EQ(texture_cache->size(), 1u);
+    shared_ptr<Model> sync_model = manager->load_model((directory / "sync.glb").string());
+    ASSERT_NE(sync_model, nullptr);
+    ASSERT_EQ(sync_model->get_textures().size(), 1u);
+    EXPECT_EQ(sync_model->get_textures()[0], model->get_textures()[0]);
+    EXPECT_EQ(manager->update_async_loads(), 0u);
+}
+
+TEST_F(GLTFModelTest, FailedLoadReturnsNull) {
+    using namespace ev::tools::gltf;
+    const filesystem::path broken = directory / "broken.glb";
+    {
+        ofstream file(broken, ios::binary);
+        file << "not a glb file";
+    }
+    const filesystem::path missing = directory / "missing.gltf";
+    auto manager = create_manager();
+
+    // 프로그램을 종료하지 않고 nullptr 로 실패를 알림
+    EXPECT_EQ(manager->try_load_model(missing.string()), nullptr);
+    EXPECT_EQ(manager->try_load_model(broken.string()), nullptr);
+
+    shared_future<shared_ptr<Model>> missing_future = manager->load_model_async(missing.string());
+    shared_future<shared_ptr<Model>> broken_future = manager->load_model_async(broken.string());
+    EXPECT_EQ(wait_async(*manager, missing_future), nullptr);
+    EXPECT_EQ(wait_async(*manager, broken_future), nullptr);
+
+    // 실패 뒤에도 같은 관리자로 계속 로드할 수 있음
+    write_triangle_glb(directory / "valid.glb", 1);
+    EXPECT_NE(wait_async(*manager, manager->load_model_async((directory / "valid.glb").string())), nullptr);
+}
+
+TEST_F(GLTFModelTest, AsyncLoadKeepsRequestSettings) {
+    using namespace ev::tools::gltf;
+    write_triangle_glb(directory / "settings.glb", 1);
+    const VertexLayout quantized({ VertexType::Position, VertexType::Normal, VertexType::UV }, VertexEncoding::Quantized);
+    auto manager = create_manager();
+    manager->set_vertex_layout(quantized);
+
+    // 요청 뒤에 설정을 바꿔도 이미 요청한 로드는 요청 시점의 설정으로 디코딩
+    shared_future<shared_ptr<Model>> future = manager->load_model_async((directory / "settings.glb").string());
+    manager->set_vertex_layout(VertexLayout());
+    manager->set_meshlets_enabled(true);
+
+    shared_ptr<Model> model = wait_async(*manager, future);
+    ASSERT_NE(model, nullptr);
+    EXPECT_TRUE(model->get_vertex_layout() == quantized);
+    EXPECT_TRUE(model->get_meshlets().empty());
+}
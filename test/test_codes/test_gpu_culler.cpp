@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include <easy-vulkan.h>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include "test_common.h"
+#include "tools/ev-gpu_culler.h"
+
+using namespace std;
+using ev::tools::gltf::GPUCuller;
+
+class GPUCullerTest : public ::testing::Test {
+protected:
+    shared_ptr<ev::Instance> instance;
+    shared_ptr<ev::PhysicalDevice> physical_device;
+    shared_ptr<ev::Device> device;
+    shared_ptr<ev::MemoryAllocator> memory_allocator;
+    shared_ptr<ev::CommandPool> command_pool;
+    shared_ptr<ev::Queue> queue;
+    shared_ptr<GPUCuller> culler;
+
+    void SetUp() override {
+        create_default_test_context(instance, physical_device, device);
+        shared_ptr<ev::Shader> shader = load_tool_shader(device, VK_SHADER_STAGE_COMPUTE_BIT, "gpu_cull.comp");
+        if ( !shader ) {
+            GTEST_SKIP() << "gpu_cull.comp.spv is not built";
+        }
+        memory_allocator = make_shared<ev::BitmapBuddyMemoryAllocator>(device);
+        memory_allocator->add_pool(ev::memory_type::GPU_ONLY, 16 * 1024 * 1024);
+        memory_allocator->add_pool(ev::memory_type::HOST_ONLY, 16 * 1024 * 1024);
+        memory_allocator->add_pool(ev::memory_type::HOST_READABLE, 16 * 1024 * 1024);
+        ASSERT_EQ(memory_allocator->build(), VK_SUCCESS);
+        command_pool = make_shared<ev::CommandPool>(device, VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT);
+        queue = make_shared<ev::Queue>(device, device->get_queue_index(VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
+        culler = make_shared<GPUCuller>(device, memory_allocator, shader, 2);
+    }
+
+    // x 위치에 반지름 0.1 구 하나짜리 인스턴스. 단위 view_projection 에서는 |x| < 1 이면 보임
+    static GPUCuller::Instance make_instance(float x, uint32_t first_index) {
+        GPUCuller::Instance instance = {};
+        instance.matrix = glm::translate(glm::mat4(1.0f), glm::vec3(x, 0.0f, 0.5f));
+        instance.bounds = glm::vec4(0.0f, 0.0f, 0.0f, 0.1f);
+        instance.first_index = first_index;
+        instance.index_count = 3;
+        return instance;
+    }
+
+    // 컬링을 실행하고 기록된 명령 중 그려지는 것(instanceCount > 0)의 firstInstance 를 정렬해 반환
+    vector<uint32_t> cull_visible(uint32_t frame_index) {
+        const uint32_t count = culler->get_instance_count();
+        const VkDeviceSize command_size = static_cast<VkDeviceSize>(count) * sizeof(VkDrawIndexedIndirectCommand);
+        shared_ptr<ev::Buffer> readback = make_shared<ev::Buffer>(device, command_size + sizeof(uint32_t), VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+        EXPECT_EQ(memory_allocator->allocate_buffer(readback, ev::memory_type::HOST_ONLY), VK_SUCCESS);
+
+        shared_ptr<ev::CommandBuffer> command_buffer = command_pool->allocate(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+        command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+        culler->cull(command_buffer, frame_index, glm::mat4(1.0f));
+        command_buffer->pipeline_barrier(
+            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            {},
+            {ev::BufferMemoryBarrier(culler->get_command_buffer(frame_index), VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT),
+             ev::BufferMemoryBarrier(culler->get_draw_count_buffer(frame_index), VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT)},
+            {}
+        );
+        command_buffer->copy_buffer(readback, culler->get_command_buffer(frame_index), command_size);
+        command_buffer->copy_buffer(readback, culler->get_draw_count_buffer(frame_index), sizeof(uint32_t), command_size);
+        command_buffer->end();
+        shared_ptr<ev::Fence> fence = make_shared<ev::Fence>(device, 0);
+        EXPECT_EQ(queue->submit(command_buffer, {}, {}, nullptr, fence), VK_SUCCESS);
+        EXPECT_EQ(fence->wait(), VK_SUCCESS);
+
+        vector<VkDrawIndexedIndirectCommand> commands(count);
+        uint32_t draw_count = 0;
+        EXPECT_EQ(readback->map(), VK_SUCCESS);
+        const uint8_t* mapped = static_cast<const uint8_t*>(readback->get_mapped_ptr());
+        memcpy(commands.data(), mapped, command_size);
+        memcpy(&draw_count, mapped + command_size, sizeof(uint32_t));
+        readback->unmap();
+
+        // 압축하면 보이는 명령만 앞쪽에, 아니면 인스턴스 번호 위치에 기록
+        const uint32_t valid = culler->is_compacting() ? draw_count : count;
+        vector<uint32_t> visible;
+        for ( uint32_t i = 0 ; i < valid ; ++i ) {
+            if ( commands[i].instanceCount == 0 ) {
+                continue;
+            }
+            const GPUCuller::Instance expected = make_instance(0.0f, commands[i].firstInstance);
+            EXPECT_EQ(commands[i].firstIndex, expected.first_index);
+            EXPECT_EQ(commands[i].indexCount, expected.index_count);
+            visible.push_back(commands[i].firstInstance);
+        }
+        sort(visible.begin(), visible.end());
+        return visible;
+    }
+};
+
+TEST_F(GPUCullerTest, WritesCommandsForVisibleInstances) {
+    // 짝수 번호만 절두체 안
+    for ( uint32_t i = 0 ; i < 8 ; ++i ) {
+        culler->add_instance(make_instance(i % 2 == 0 ? 0.0f : 5.0f, i));
+    }
+    EXPECT_EQ(cull_visible(0), (vector<uint32_t>{ 0, 2, 4, 6 }));
+
+    // 바뀐 인스턴스만 다시 복사해도 결과에 반영
+    culler->set_matrix(1, glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, 0.5f)));
+    culler->set_matrix(2, glm::translate(glm::mat4(1.0f), glm::vec3(-5.0f, 0.0f, 0.5f)));
+    EXPECT_EQ(cull_visible(0), (vector<uint32_t>{ 0, 1, 4, 6 }));
+    EXPECT_EQ(cull_visible(1), (vector<uint32_t>{ 0, 1, 4, 6 }));
+}
+
+TEST_F(GPUCullerTest, GrowingRecreatesInstanceBuffer) {
+    culler->add_instance(make_instance(0.0f, 0));
+    cull_visible(0);
+    const uint32_t generation = culler->get_instance_buffer_generation(0);
+    const shared_ptr<ev::Buffer> buffer = culler->get_instance_buffer(0);
+
+    // 용량 안에서는 같은 버퍼를 유지
+    culler->add_instance(make_instance(5.0f, 1));
+    cull_visible(0);
+    EXPECT_EQ(culler->get_instance_buffer_generation(0), generation);
+    EXPECT_EQ(culler->get_instance_buffer(0), buffer);
+
+    // 용량을 넘으면 새 버퍼로 바뀌고 generation 이 증가해 다시 바인딩해야 함을 알림
+    for ( uint32_t i = 2 ; i < 200 ; ++i ) {
+        culler->add_instance(make_instance(0.0f, i));
+    }
+    vector<uint32_t> visible = cull_visible(0);
+    EXPECT_NE(culler->get_instance_buffer_generation(0), generation);
+    EXPECT_NE(culler->get_instance_buffer(0), buffer);
+    EXPECT_EQ(visible.size(), 199u);
+    EXPECT_TRUE(find(visible.begin(), visible.end(), 1u) == visible.end());
+}
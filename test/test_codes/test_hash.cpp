@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "tools/ev-hash.h"
+
+using namespace ev::tools;
+
+TEST(HashTest, MatchesReferenceVectors) {
+    // XXH64 공개 테스트 값
+    EXPECT_EQ(hash64("", 0), 0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(hash64("a", 1), 0xD24EC4F1A98C6E5BULL);
+    EXPECT_EQ(hash64("abc", 3), 0x44BC2CF5AD770999ULL);
+    const std::string long_input = "Nobody inspects the spammish repetition";
+    EXPECT_EQ(hash64(long_input.data(), long_input.size()), 0xFBCEA83C8A378BF1ULL);
+}
+
+TEST(HashTest, DependsOnEveryByteAndSeed) {
+    std::vector<uint8_t> data(1000);
+    for ( size_t i = 0 ; i < data.size() ; ++i ) {
+        data[i] = static_cast<uint8_t>(i * 7);
+    }
+    const uint64_t base = hash64(data.data(), data.size());
+    EXPECT_EQ(base, hash64(data.data(), data.size()));
+    EXPECT_NE(base, hash64(data.data(), data.size(), 1));
+    EXPECT_NE(base, hash64(data.data(), data.size() - 1));
+
+    for ( size_t i : { size_t(0), size_t(31), size_t(32), size_t(997), size_t(999) } ) {
+        data[i] ^= 0x01;
+        EXPECT_NE(base, hash64(data.data(), data.size())) << "byte: " << i;
+        data[i] ^= 0x01;
+    }
+}
+
+TEST(HashTest, HashFileMatchesMemory) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "ev_hash_test.bin";
+    const std::string contents = "easy-vulkan model cache key";
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << contents;
+    }
+
+    uint64_t hash = 0;
+    ASSERT_TRUE(hash_file(path, hash));
+    EXPECT_EQ(hash, hash64(contents.data(), contents.size()));
+    std::filesystem::remove(path);
+
+    EXPECT_FALSE(hash_file(path, hash));
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include "tools/ev-mapped_file.h"
+
+using namespace ev::tools;
+
+class MappedFileTest : public ::testing::Test {
+    protected:
+
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "ev_mapped_file_test.bin";
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    void write_file(const std::vector<uint8_t>& bytes) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+};
+
+TEST_F(MappedFileTest, MapsFileContents) {
+    std::vector<uint8_t> bytes(70000);
+    for ( size_t i = 0 ; i < bytes.size() ; ++i ) {
+        bytes[i] = static_cast<uint8_t>(i * 31);
+    }
+    write_file(bytes);
+
+    MappedFile file(path);
+    ASSERT_TRUE(file.is_open());
+    ASSERT_EQ(file.get_size(), bytes.size());
+    EXPECT_EQ(std::memcmp(file.get_data(), bytes.data(), bytes.size()), 0);
+
+    file.close();
+    EXPECT_FALSE(file.is_open());
+    EXPECT_EQ(file.get_data(), nullptr);
+}
+
+TEST_F(MappedFileTest, EmptyAndMissingFiles) {
+    write_file({});
+    MappedFile empty(path);
+    EXPECT_TRUE(empty.is_open());
+    EXPECT_EQ(empty.get_size(), 0u);
+    EXPECT_EQ(empty.get_data(), nullptr);
+
+    MappedFile missing(path.parent_path() / "ev_mapped_file_missing.bin");
+    EXPECT_FALSE(missing.is_open());
+    EXPECT_EQ(missing.get_size(), 0u);
+}
@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <set>
+#include <vector>
+#include "tools/ev-mesh_optimizer.h"
+
+using namespace ev::tools::mesh_optimizer;
+
+namespace {
+
+/**
+ * @brief n x n 격자를 행 순서가 뒤섞인 삼각형 리스트로 생성합니다.
+ */
+std::vector<uint32_t> make_shuffled_grid(uint32_t n, uint32_t seed) {
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for ( uint32_t y = 0 ; y < n ; ++y ) {
+        for ( uint32_t x = 0 ; x < n ; ++x ) {
+            const uint32_t v0 = y * (n + 1) + x;
+            const uint32_t v1 = v0 + 1;
+            const uint32_t v2 = v0 + n + 1;
+            const uint32_t v3 = v2 + 1;
+            triangles.push_back({ v0, v2, v1 });
+            triangles.push_back({ v1, v2, v3 });
+        }
+    }
+    std::mt19937 rng(seed);
+    std::shuffle(triangles.begin(), triangles.end(), rng);
+    std::vector<uint32_t> indices;
+    for ( const auto& triangle : triangles ) {
+        indices.insert(indices.end(), triangle.begin(), triangle.end());
+    }
+    return indices;
+}
+
+/**
+ * @brief 회전에 무관한 삼각형 집합. winding 이 바뀌면 다른 원소가 됩니다.
+ */
+std::multiset<std::array<uint32_t, 3>> triangle_set(const std::vector<uint32_t>& indices) {
+    std::multiset<std::array<uint32_t, 3>> set;
+    for ( size_t i = 0 ; i + 2 < indices.size() ; i += 3 ) {
+        std::array<uint32_t, 3> t = { indices[i], indices[i + 1], indices[i + 2] };
+        std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+        set.insert(t);
+    }
+    return set;
+}
+
+}
+
+TEST(MeshOptimizerTest, DeduplicatesIdenticalVertices) {
+    const std::vector<std::array<float, 3>> vertices = {
+        { 0, 0, 0 }, { 1, 0, 0 }, { 0, 0, 0 }, { 0, 1, 0 }, { 1, 0, 0 }
+    };
+    std::vector<uint32_t> remap(vertices.size());
+    const uint32_t unique_count = generate_vertex_remap(remap.data(), vertices.data(), vertices.size(), sizeof(vertices[0]));
+    EXPECT_EQ(unique_count, 3u);
+    EXPECT_EQ(remap, (std::vector<uint32_t>{ 0, 1, 0, 2, 1 }));
+
+    std::vector<std::array<float, 3>> compacted(unique_count);
+    remap_vertices(compacted.data(), vertices.data(), vertices.size(), sizeof(vertices[0]), remap.data());
+    EXPECT_EQ(compacted[2], vertices[3]);
+
+    std::vector<uint32_t> indices = { 0, 1, 3, 2, 3, 4 };
+    remap_indices(indices.data(), indices.data(), indices.size(), remap.data());
+    EXPECT_EQ(indices, (std::vector<uint32_t>{ 0, 1, 2, 0, 2, 1 }));
+}
+
+TEST(MeshOptimizerTest, VertexCacheKeepsTrianglesAndImprovesAcmr) {
+    const uint32_t n = 64;
+    const uint32_t vertex_count = (n + 1) * (n + 1);
+    const std::vector<uint32_t> indices = make_shuffled_grid(n, 7);
+
+    std::vector<uint32_t> optimized(indices.size());
+    optimize_vertex_cache(optimized.data(), indices.data(), indices.size(), vertex_count);
+    EXPECT_EQ(triangle_set(optimized), triangle_set(indices));
+
+    const float before = compute_acmr(indices.data(), indices.size(), vertex_count);
+    const float after = compute_acmr(optimized.data(), optimized.size(), vertex_count);
+    EXPECT_GT(before, 2.0f);
+    EXPECT_LT(after, 0.9f);
+
+    // 제자리 실행도 같은 결과
+    std::vector<uint32_t> in_place = indices;
+    optimize_vertex_cache(in_place.data(), in_place.data(), in_place.size(), vertex_count);
+    EXPECT_EQ(in_place, optimized);
+}
+
+TEST(MeshOptimizerTest, VertexFetchOrdersByFirstUseAndDropsUnused) {
+    const std::vector<uint32_t> indices = { 4, 2, 0, 0, 2, 5 };
+    std::vector<uint32_t> remap(6);
+    const uint32_t used = optimize_vertex_fetch_remap(remap.data(), indices.data(), indices.size(), remap.size());
+    EXPECT_EQ(used, 4u);
+    EXPECT_EQ(remap, (std::vector<uint32_t>{ 2, INVALID_INDEX, 1, INVALID_INDEX, 0, 3 }));
+
+    std::vector<uint32_t> remapped(indices.size());
+    remap_indices(remapped.data(), indices.data(), indices.size(), remap.data());
+    EXPECT_EQ(remapped, (std::vector<uint32_t>{ 0, 1, 2, 2, 1, 3 }));
+}
+
+TEST(MeshOptimizerTest, AcmrOfSingleTriangleAndEmpty) {
+    const uint32_t triangle[3] = { 0, 1, 2 };
+    EXPECT_FLOAT_EQ(compute_acmr(triangle, 3, 3), 3.0f);
+    EXPECT_FLOAT_EQ(compute_acmr(nullptr, 0, 0), 0.0f);
+}
+
+TEST(MeshOptimizerTest, SimplifyFlatGridWithoutError) {
+    const uint32_t n = 32;
+    std::vector<std::array<float, 3>> positions;
+    for ( uint32_t y = 0 ; y <= n ; ++y ) {
+        for ( uint32_t x = 0 ; x <= n ; ++x ) {
+            positions.push_back({ static_cast<float>(x), static_cast<float>(y), 0.0f });
+        }
+    }
+    const std::vector<uint32_t> indices = make_shuffled_grid(n, 3);
+
+    std::vector<uint32_t> lod(indices.size());
+    float error = -1.0f;
+    const size_t count = simplify(lod.data(), indices.data(), indices.size(),
+        positions[0].data(), positions.size(), sizeof(positions[0]), indices.size() / 4, &error);
+    EXPECT_EQ(count % 3, 0u);
+    EXPECT_LE(count, indices.size() / 4);
+    EXPECT_NEAR(error, 0.0f, 1e-5f);
+
+    // 경계 정점은 그대로 남아 있어야 함
+    std::set<uint32_t> used(lod.begin(), lod.begin() + count);
+    for ( uint32_t x = 0 ; x <= n ; ++x ) {
+        EXPECT_TRUE(used.count(x)) << "border vertex " << x;
+    }
+    // 평면이 뒤집히지 않음 (모두 +Z 방향)
+    for ( size_t i = 0 ; i < count ; i += 3 ) {
+        const auto& a = positions[lod[i]];
+        const auto& b = positions[lod[i + 1]];
+        const auto& c = positions[lod[i + 2]];
+        const float z = (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+        EXPECT_LT(z, 0.0f);
+    }
+}
+
+TEST(MeshOptimizerTest, SimplifySphereReportsError) {
+    // UV 구. u = 0 / 1 경계에 seam 정점이 중복됨
+    const uint32_t rings = 24, segments = 48;
+    std::vector<std::array<float, 3>> positions;
+    for ( uint32_t r = 0 ; r <= rings ; ++r ) {
+        const float theta = 3.14159265f * r / rings;
+        for ( uint32_t s = 0 ; s <= segments ; ++s ) {
+            const float phi = 2.0f * 3.14159265f * (s % segments) / segments;
+            positions.push_back({ std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi) });
+        }
+    }
+    std::vector<uint32_t> indices;
+    for ( uint32_t r = 0 ; r < rings ; ++r ) {
+        for ( uint32_t s = 0 ; s < segments ; ++s ) {
+            const uint32_t v0 = r * (segments + 1) + s;
+            const uint32_t v1 = v0 + segments + 1;
+            if ( r != 0 ) indices.insert(indices.end(), { v0, v0 + 1, v1 });
+            if ( r != rings - 1 ) indices.insert(indices.end(), { v0 + 1, v1 + 1, v1 });
+        }
+    }
+
+    std::vector<uint32_t> lod(indices.size());
+    float error = 0.0f;
+    const size_t count = simplify(lod.data(), indices.data(), indices.size(),
+        positions[0].data(), positions.size(), sizeof(positions[0]), indices.size() / 4, &error);
+    EXPECT_LT(count, indices.size() / 2);
+    EXPECT_GT(error, 0.0f);
+    EXPECT_LT(error, 0.2f);
+    for ( size_t i = 0 ; i < count ; i += 3 ) {
+        EXPECT_LT(lod[i], positions.size());
+        EXPECT_NE(lod[i], lod[i + 1]);
+        EXPECT_NE(lod[i + 1], lod[i + 2]);
+        EXPECT_NE(lod[i], lod[i + 2]);
+    }
+}
+
+TEST(MeshOptimizerTest, MeshletsRespectLimitsAndCoverAllTriangles) {
+    const uint32_t n = 32;
+    const uint32_t vertex_count = (n + 1) * (n + 1);
+    std::vector<uint32_t> indices = make_shuffled_grid(n, 11);
+    optimize_vertex_cache(indices.data(), indices.data(), indices.size(), vertex_count);
+
+    std::vector<Meshlet> meshlets;
+    std::vector<uint32_t> meshlet_vertices;
+    std::vector<uint8_t> meshlet_triangles;
+    const size_t count = build_meshlets(meshlets, meshlet_vertices, meshlet_triangles,
+        indices.data(), indices.size(), vertex_count);
+    ASSERT_EQ(count, meshlets.size());
+    EXPECT_LE(count, indices.size() / 3 / 32);
+
+    // meshlet 을 펼치면 원본 인덱스 버퍼와 같은 순서가 됨
+    std::vector<uint32_t> expanded;
+    uint32_t next_triangle = 0;
+    for ( const Meshlet& meshlet : meshlets ) {
+        EXPECT_LE(meshlet.vertex_count, MAX_MESHLET_VERTICES);
+        EXPECT_LE(meshlet.triangle_count, MAX_MESHLET_TRIANGLES);
+        EXPECT_EQ(meshlet.triangle_offset, next_triangle);
+        next_triangle += meshlet.triangle_count;
+        for ( uint32_t i = 0 ; i < meshlet.triangle_count * 3 ; ++i ) {
+            const uint8_t local = meshlet_triangles[meshlet.triangle_offset * 3 + i];
+            ASSERT_LT(local, meshlet.vertex_count);
+            expanded.push_back(meshlet_vertices[meshlet.vertex_offset + local]);
+        }
+    }
+    EXPECT_EQ(expanded, indices);
+}
+
+TEST(MeshOptimizerTest, MeshletBoundsAndConeCulling) {
+    // +Z 를 향하는 평면 두 삼각형
+    const std::vector<std::array<float, 3>> positions = {
+        { -1, -1, 0 }, { 1, -1, 0 }, { 1, 1, 0 }, { -1, 1, 0 }
+    };
+    const std::vector<uint32_t> indices = { 0, 1, 2, 0, 2, 3 };
+    std::vector<Meshlet> meshlets;
+    std::vector<uint32_t> meshlet_vertices;
+    std::vector<uint8_t> meshlet_triangles;
+    ASSERT_EQ(build_meshlets(meshlets, meshlet_vertices, meshlet_triangles, indices.data(), indices.size(), positions.size()), 1u);
+
+    const MeshletBounds bounds = compute_meshlet_bounds(meshlets[0], meshlet_vertices.data(), meshlet_triangles.data(),
+        positions[0].data(), sizeof(positions[0]));
+    EXPECT_NEAR(bounds.center[0], 0.0f, 1e-6f);
+    EXPECT_NEAR(bounds.center[2], 0.0f, 1e-6f);
+    EXPECT_NEAR(bounds.radius, std::sqrt(2.0f), 1e-5f);
+    EXPECT_NEAR(bounds.cone_axis[2], 1.0f, 1e-6f);
+    EXPECT_NEAR(bounds.cone_cutoff, 0.0f, 1e-6f);
+
+    const float front[3] = { 0, 0, 5 };
+    const float behind[3] = { 0, 0, -5 };
+    const float grazing[3] = { 0, 0, -1 };
+    EXPECT_FALSE(is_cone_backfacing(bounds, front));
+    EXPECT_TRUE(is_cone_backfacing(bounds, behind));
+    // sphere 안쪽에 가까우면 보수적으로 남김
+    EXPECT_FALSE(is_cone_backfacing(bounds, grazing));
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#include "tools/ev-parallel.h"
+
+using namespace ev::tools;
+
+TEST(ParallelTest, VisitsEveryIndexOnce) {
+    for ( uint32_t grain : { 1u, 7u, 1000u } ) {
+        std::vector<std::atomic<uint32_t>> visits(1000);
+        parallel_for(static_cast<uint32_t>(visits.size()), [&](uint32_t begin, uint32_t end) {
+            EXPECT_LT(begin, end);
+            for ( uint32_t i = begin ; i < end ; ++i ) {
+                visits[i]++;
+            }
+        }, grain);
+        for ( size_t i = 0 ; i < visits.size() ; ++i ) {
+            EXPECT_EQ(visits[i].load(), 1u) << "index " << i << ", grain " << grain;
+        }
+    }
+}
+
+TEST(ParallelTest, EmptyRangeDoesNotCall) {
+    bool called = false;
+    parallel_for(0, [&](uint32_t, uint32_t) { called = true; });
+    EXPECT_FALSE(called);
+    EXPECT_GE(get_worker_count(), 1u);
+}
+
+TEST(ParallelTest, ReusesPoolThreads) {
+    WorkerPool pool(3);
+    std::mutex mutex;
+    std::set<std::thread::id> thread_ids;
+    for ( int call = 0 ; call < 50 ; ++call ) {
+        pool.parallel_for(64, [&](uint32_t, uint32_t) {
+            std::lock_guard<std::mutex> lock(mutex);
+            thread_ids.insert(std::this_thread::get_id());
+        });
+    }
+    // 호출마다 스레드를 새로 만들면 id 가 계속 늘어남
+    EXPECT_LE(thread_ids.size(), pool.get_thread_count() + 1u);
+    EXPECT_EQ(pool.get_thread_count(), 3u);
+}
+
+TEST(ParallelTest, NestedAndConcurrentCallsComplete) {
+    WorkerPool pool(2);
+    std::atomic<uint32_t> total = 0;
+    auto nested = [&]() {
+        pool.parallel_for(8, [&](uint32_t begin, uint32_t end) {
+            for ( uint32_t i = begin ; i < end ; ++i ) {
+                // 작업 안의 parallel_for 는 호출한 스레드에서 실행
+                pool.parallel_for(4, [&](uint32_t b, uint32_t e) { total += e - b; });
+            }
+        });
+    };
+    std::thread other(nested);
+    nested();
+    other.join();
+    EXPECT_EQ(total.load(), 2u * 8u * 4u);
+}
+
+TEST(ParallelTest, EmptyPoolRunsOnCaller) {
+    WorkerPool pool(0);
+    const std::thread::id caller = std::this_thread::get_id();
+    uint32_t visited = 0;
+    pool.parallel_for(100, [&](uint32_t begin, uint32_t end) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        visited += end - begin;
+    }, 10);
+    EXPECT_EQ(visited, 100u);
+}
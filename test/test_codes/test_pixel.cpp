@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "tools/ev-pixel.h"
+
+using namespace ev::tools;
+
+class PixelTest : public ::testing::Test {
+    protected:
+
+    std::mt19937 rng{ 0x5EED };
+
+    std::vector<uint8_t> random_bytes(size_t size) {
+        std::vector<uint8_t> bytes(size);
+        for ( auto& b : bytes ) {
+            b = static_cast<uint8_t>(rng());
+        }
+        return bytes;
+    }
+
+    template<typename F>
+    static double measure_ms(F&& func, int repeat = 3) {
+        double best = 1e30;
+        for ( int i = 0 ; i < repeat ; ++i ) {
+            auto start = std::chrono::high_resolution_clock::now();
+            func();
+            auto end = std::chrono::high_resolution_clock::now();
+            best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+        }
+        return best;
+    }
+};
+
+TEST_F(PixelTest, RGB8ToRGBA8MatchesScalar) {
+    // SIMD 폭의 배수가 아닌 길이로 tail 처리까지 확인
+    for ( size_t n : { 0, 1, 5, 17, 63, 1000, 4099 } ) {
+        auto rgb = random_bytes(n * 3);
+        std::vector<uint8_t> expected(n * 4), actual(n * 4);
+        pixel::scalar::rgb8_to_rgba8(rgb.data(), expected.data(), n, 0x7F);
+        pixel::rgb8_to_rgba8(rgb.data(), actual.data(), n, 0x7F);
+        EXPECT_EQ(expected, actual) << "pixel count: " << n;
+        if ( n > 0 ) {
+            EXPECT_EQ(actual[3], 0x7F);
+            EXPECT_EQ(actual[0], rgb[0]);
+        }
+    }
+}
+
+TEST_F(PixelTest, PremultiplyIsExact) {
+    for ( int a = 0 ; a < 256 ; ++a ) {
+        std::vector<uint8_t> px(256 * 4);
+        for ( int c = 0 ; c < 256 ; ++c ) {
+            px[c * 4 + 0] = static_cast<uint8_t>(c);
+            px[c * 4 + 1] = static_cast<uint8_t>(255 - c);
+            px[c * 4 + 2] = static_cast<uint8_t>(c);
+            px[c * 4 + 3] = static_cast<uint8_t>(a);
+        }
+        pixel::premultiply_rgba8(px.data(), 256);
+        for ( int c = 0 ; c < 256 ; ++c ) {
+            ASSERT_EQ(px[c * 4 + 0], std::lround(c * a / 255.0));
+            ASSERT_EQ(px[c * 4 + 1], std::lround((255 - c) * a / 255.0));
+            ASSERT_EQ(px[c * 4 + 3], a);
+        }
+    }
+}
+
+TEST_F(PixelTest, R32FToR16F) {
+    const float values[] = { 0.0f, -0.0f, 1.0f, -2.0f, 0.5f, 65504.0f, 65520.0f, 1e-7f, 6.1035156e-5f, INFINITY, -INFINITY };
+    const uint16_t expected[] = { 0x0000, 0x8000, 0x3C00, 0xC000, 0x3800, 0x7BFF, 0x7C00, 0x0002, 0x0400, 0x7C00, 0xFC00 };
+    const size_t count = sizeof(values) / sizeof(values[0]);
+
+    uint16_t actual[count];
+    pixel::r32f_to_r16f(values, actual, count);
+    for ( size_t i = 0 ; i < count ; ++i ) {
+        EXPECT_EQ(actual[i], expected[i]) << "value: " << values[i];
+    }
+
+    // 넓은 범위의 비트 패턴에 대해 scalar 구현과 비교 (NaN 은 payload 가 구현마다 다를 수 있음)
+    std::vector<float> src;
+    for ( uint64_t bits = 0 ; bits <= 0xFFFFFFFFull ; bits += 65521 ) {
+        uint32_t b = static_cast<uint32_t>(bits);
+        float f;
+        std::memcpy(&f, &b, sizeof(f));
+        src.push_back(f);
+    }
+    std::vector<uint16_t> simd(src.size()), scalar(src.size());
+    pixel::r32f_to_r16f(src.data(), simd.data(), src.size());
+    pixel::scalar::r32f_to_r16f(src.data(), scalar.data(), src.size());
+    for ( size_t i = 0 ; i < src.size() ; ++i ) {
+        if ( std::isnan(src[i]) ) {
+            EXPECT_GT(simd[i] & 0x7FFF, 0x7C00);
+        } else {
+            ASSERT_EQ(simd[i], scalar[i]) << "index: " << i;
+        }
+    }
+}
+
+TEST_F(PixelTest, LuminanceMatchesScalar) {
+    for ( size_t n : { 0, 3, 31, 33, 1000 } ) {
+        auto rgba = random_bytes(n * 4);
+        std::vector<uint8_t> expected(n), actual(n);
+        pixel::scalar::rgba8_to_luminance8(rgba.data(), expected.data(), n);
+        pixel::rgba8_to_luminance8(rgba.data(), actual.data(), n);
+        EXPECT_EQ(expected, actual) << "pixel count: " << n;
+    }
+
+    const uint8_t white[4] = { 255, 255, 255, 0 };
+    uint8_t y = 0;
+    pixel::rgba8_to_luminance8(white, &y, 1);
+    EXPECT_EQ(y, 255);
+}
+
+// 8K 버퍼 약 600 MB 를 쓰는 벤치마크이므로 기본 실행에서 제외. --gtest_also_run_disabled_tests 로 실행하면 결과는 XML 출력의 property 로 남음
+TEST_F(PixelTest, DISABLED_Benchmark8K) {
+    const size_t width = 7680, height = 4320;
+    const size_t pixel_count = width * height;
+    auto rgb = random_bytes(pixel_count * 3);
+    std::vector<uint8_t> rgba(pixel_count * 4, 0);
+
+    // GLTFModelManager::load_texture 의 기존 채널 단위 루프
+    double legacy_ms = measure_ms([&]() {
+        uint8_t* dst = rgba.data();
+        const uint8_t* src = rgb.data();
+        for ( size_t i = 0 ; i < pixel_count ; ++i ) {
+            for ( uint32_t ch = 0 ; ch < 3 ; ++ch ) {
+                dst[ch] = src[ch];
+            }
+            dst += 4;
+            src += 3;
+        }
+    });
+    double simd_ms = measure_ms([&]() { pixel::rgb8_to_rgba8(rgb.data(), rgba.data(), pixel_count); });
+
+    std::vector<uint8_t> premul = rgba;
+    double premul_ms = measure_ms([&]() { pixel::premultiply_rgba8(premul.data(), pixel_count); }, 1);
+    double premul_scalar_ms = measure_ms([&]() { pixel::scalar::premultiply_rgba8(premul.data(), pixel_count); }, 1);
+
+    std::vector<uint8_t> luminance(pixel_count);
+    double lum_ms = measure_ms([&]() { pixel::rgba8_to_luminance8(rgba.data(), luminance.data(), pixel_count); });
+    double lum_scalar_ms = measure_ms([&]() { pixel::scalar::rgba8_to_luminance8(rgba.data(), luminance.data(), pixel_count); });
+
+    std::vector<float> hdr(pixel_count);
+    for ( size_t i = 0 ; i < pixel_count ; ++i ) {
+        hdr[i] = static_cast<float>(i % 4096) * 0.25f;
+    }
+    std::vector<uint16_t> half(pixel_count);
+    double half_ms = measure_ms([&]() { pixel::r32f_to_r16f(hdr.data(), half.data(), pixel_count); });
+    double half_scalar_ms = measure_ms([&]() { pixel::scalar::r32f_to_r16f(hdr.data(), half.data(), pixel_count); });
+
+    RecordProperty("backend", pixel::simd_backend());
+    RecordProperty("rgb8_to_rgba8_legacy_ms", std::to_string(legacy_ms));
+    RecordProperty("rgb8_to_rgba8_simd_ms", std::to_string(simd_ms));
+    RecordProperty("premultiply_scalar_ms", std::to_string(premul_scalar_ms));
+    RecordProperty("premultiply_simd_ms", std::to_string(premul_ms));
+    RecordProperty("luminance_scalar_ms", std::to_string(lum_scalar_ms));
+    RecordProperty("luminance_simd_ms", std::to_string(lum_ms));
+    RecordProperty("r32f_to_r16f_scalar_ms", std::to_string(half_scalar_ms));
+    RecordProperty("r32f_to_r16f_simd_ms", std::to_string(half_ms));
+
+    EXPECT_EQ(rgba[3], 0xFF);
+}
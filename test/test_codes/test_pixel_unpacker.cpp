@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <easy-vulkan.h>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+#include "test_common.h"
+#include "tools/ev-pixel.h"
+#include "tools/ev-pixel_unpacker.h"
+
+using namespace std;
+
+namespace {
+
+// convert_pixels 는 로더 내부 함수이므로 파생 타입으로 노출
+struct TextureLoaderAccess : ev::tools::TextureLoader {
+    using TextureLoader::DecodedImage;
+    using TextureLoader::convert_pixels;
+};
+
+}
+
+class PixelUnpackerTest : public ::testing::Test {
+protected:
+    shared_ptr<ev::Instance> instance;
+    shared_ptr<ev::PhysicalDevice> physical_device;
+    shared_ptr<ev::Device> device;
+    shared_ptr<ev::MemoryAllocator> memory_allocator;
+    shared_ptr<ev::CommandPool> command_pool;
+    shared_ptr<ev::Queue> queue;
+    shared_ptr<ev::tools::PixelUnpacker> unpacker;
+
+    std::mt19937 rng{ 0x5EED };
+
+    void SetUp() override {
+        create_default_test_context(instance, physical_device, device);
+        shared_ptr<ev::Shader> shader = load_tool_shader(device, VK_SHADER_STAGE_COMPUTE_BIT, "unpack_pixels.comp");
+        if ( !shader ) {
+            GTEST_SKIP() << "unpack_pixels.comp.spv is not built";
+        }
+        memory_allocator = make_shared<ev::BitmapBuddyMemoryAllocator>(device);
+        memory_allocator->add_pool(ev::memory_type::GPU_ONLY, 16 * 1024 * 1024);
+        memory_allocator->add_pool(ev::memory_type::HOST_ONLY, 16 * 1024 * 1024);
+        ASSERT_EQ(memory_allocator->build(), VK_SUCCESS);
+        command_pool = make_shared<ev::CommandPool>(device, VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT);
+        queue = make_shared<ev::Queue>(device, device->get_queue_index(VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
+        unpacker = make_shared<ev::tools::PixelUnpacker>(device, memory_allocator, command_pool, queue, shader);
+    }
+
+    vector<uint8_t> random_bytes(size_t size) {
+        vector<uint8_t> bytes(size);
+        for ( auto& b : bytes ) {
+            b = static_cast<uint8_t>(rng());
+        }
+        return bytes;
+    }
+
+    // GPU 에서 확장한 이미지를 호스트 버퍼로 다시 읽음
+    vector<uint8_t> unpack(VkFormat format, uint32_t texel_size, const vector<uint8_t>& src, uint32_t width, uint32_t height,
+        uint32_t src_channels, bool premultiply_alpha = false) {
+        shared_ptr<ev::Image> image = make_shared<ev::Image>(device, VK_IMAGE_TYPE_2D, format, width, height, 1, 1, 1,
+            VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
+        EXPECT_EQ(memory_allocator->allocate_image(image, ev::memory_type::GPU_ONLY), VK_SUCCESS);
+        EXPECT_EQ(unpacker->upload(image, src.data(), width, height, src_channels, 1,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, false, premultiply_alpha), VK_SUCCESS);
+
+        const VkDeviceSize size = static_cast<VkDeviceSize>(width) * height * texel_size;
+        shared_ptr<ev::Buffer> readback = make_shared<ev::Buffer>(device, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+        EXPECT_EQ(memory_allocator->allocate_buffer(readback, ev::memory_type::HOST_ONLY), VK_SUCCESS);
+
+        VkBufferImageCopy region = {};
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.layerCount = 1;
+        region.imageExtent = { width, height, 1 };
+        shared_ptr<ev::CommandBuffer> command_buffer = command_pool->allocate(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+        command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+        command_buffer->copy_image_to_buffer(image, readback, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, { region });
+        command_buffer->end();
+        shared_ptr<ev::Fence> fence = make_shared<ev::Fence>(device, 0);
+        EXPECT_EQ(queue->submit(command_buffer, {}, {}, nullptr, fence), VK_SUCCESS);
+        EXPECT_EQ(fence->wait(), VK_SUCCESS);
+
+        vector<uint8_t> pixels(size);
+        EXPECT_EQ(readback->map(), VK_SUCCESS);
+        readback->read(pixels.data(), size);
+        readback->unmap();
+        return pixels;
+    }
+};
+
+TEST_F(PixelUnpackerTest, PremultiplyMatchesCpuPath) {
+    const uint32_t width = 37, height = 5;
+    vector<uint8_t> rgba = random_bytes(static_cast<size_t>(width) * height * 4);
+    // 경계값 알파 포함
+    rgba[3] = 0;
+    rgba[7] = 255;
+
+    vector<uint8_t> expected = rgba;
+    ev::tools::pixel::premultiply_rgba8(expected.data(), static_cast<size_t>(width) * height);
+    EXPECT_EQ(unpack(VK_FORMAT_R8G8B8A8_UNORM, 4, rgba, width, height, 4, true), expected);
+    EXPECT_EQ(unpack(VK_FORMAT_R8G8B8A8_UNORM, 4, rgba, width, height, 4, false), rgba);
+}
+
+TEST(TextureLoaderPixelTest, PremultipliesOnlyWhenEnabled) {
+    const uint8_t source[] = { 200, 100, 50, 128, 10, 20, 30, 255 };
+    TextureLoaderAccess::DecodedImage image;
+    image.pixels.reset(malloc(sizeof(source)));
+    memcpy(image.pixels.get(), source, sizeof(source));
+    image.width = 2;
+    image.height = 1;
+    image.channels = 4;
+
+    vector<uint8_t> straight(sizeof(source)), premultiplied(sizeof(source));
+    TextureLoaderAccess::convert_pixels(image, VK_FORMAT_R8G8B8A8_UNORM, straight.data());
+    TextureLoaderAccess::convert_pixels(image, VK_FORMAT_R8G8B8A8_UNORM, premultiplied.data(), true);
+
+    EXPECT_EQ(straight, vector<uint8_t>(source, source + sizeof(source)));
+    const vector<uint8_t> expected = { 100, 50, 25, 128, 10, 20, 30, 255 };
+    EXPECT_EQ(premultiplied, expected);
+}
+
+TEST_F(PixelUnpackerTest, LuminanceMatchesCpuPath) {
+    const uint32_t width = 61, height = 3;
+    const size_t pixel_count = static_cast<size_t>(width) * height;
+    vector<uint8_t> rgba = random_bytes(pixel_count * 4);
+    // 흰색과 검은색은 정확히 255, 0
+    for ( int i = 0 ; i < 4 ; ++i ) {
+        rgba[i] = 255;
+        rgba[4 + i] = 0;
+    }
+
+    vector<uint8_t> expected(pixel_count);
+    ev::tools::pixel::rgba8_to_luminance8(rgba.data(), expected.data(), pixel_count);
+    vector<uint8_t> actual = unpack(VK_FORMAT_R8_UNORM, 1, rgba, width, height, 4);
+    EXPECT_EQ(actual, expected);
+    EXPECT_EQ(actual[0], 255);
+    EXPECT_EQ(actual[1], 0);
+}
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include "tools/ev-range_allocator.h"
+
+using namespace ev::tools;
+
+TEST(RangeAllocatorTest, AllocatesUntilFullAndReusesFreedRanges) {
+    RangeAllocator allocator(100);
+    const uint64_t a = allocator.allocate(40);
+    const uint64_t b = allocator.allocate(30);
+    const uint64_t c = allocator.allocate(30);
+    EXPECT_EQ(a, 0u);
+    EXPECT_EQ(b, 40u);
+    EXPECT_EQ(c, 70u);
+    EXPECT_EQ(allocator.get_free_size(), 0u);
+    EXPECT_EQ(allocator.allocate(1), RangeAllocator::INVALID_OFFSET);
+    EXPECT_EQ(allocator.allocate(0), RangeAllocator::INVALID_OFFSET);
+
+    EXPECT_TRUE(allocator.free(b, 30));
+    EXPECT_EQ(allocator.get_free_size(), 30u);
+    EXPECT_EQ(allocator.allocate(31), RangeAllocator::INVALID_OFFSET);
+    EXPECT_EQ(allocator.allocate(20), 40u);
+    EXPECT_EQ(allocator.get_largest_free_range(), 10u);
+}
+
+TEST(RangeAllocatorTest, PrefersSmallestFittingRange) {
+    RangeAllocator allocator(100);
+    const uint64_t a = allocator.allocate(50);
+    const uint64_t b = allocator.allocate(10);
+    const uint64_t c = allocator.allocate(20);
+    allocator.allocate(20);
+    ASSERT_TRUE(allocator.free(a, 50));
+    ASSERT_TRUE(allocator.free(c, 20));
+    EXPECT_EQ(allocator.get_free_range_count(), 2u);
+
+    // 50 짜리 앞 구간보다 딱 맞는 20 짜리 구간을 사용
+    EXPECT_EQ(allocator.allocate(20), c);
+    EXPECT_EQ(allocator.allocate(10), 0u);
+    EXPECT_TRUE(allocator.free(b, 10));
+}
+
+TEST(RangeAllocatorTest, CoalescesNeighboursAndRejectsDoubleFree) {
+    RangeAllocator allocator(90);
+    const uint64_t a = allocator.allocate(30);
+    const uint64_t b = allocator.allocate(30);
+    const uint64_t c = allocator.allocate(30);
+
+    ASSERT_TRUE(allocator.free(a, 30));
+    ASSERT_TRUE(allocator.free(c, 30));
+    EXPECT_EQ(allocator.get_free_range_count(), 2u);
+    EXPECT_FALSE(allocator.free(a, 30));
+    EXPECT_FALSE(allocator.free(a + 10, 30));
+    EXPECT_FALSE(allocator.free(80, 30));
+    EXPECT_EQ(allocator.get_free_size(), 60u);
+
+    // 가운데를 해제하면 세 구간이 하나로 합쳐짐
+    ASSERT_TRUE(allocator.free(b, 30));
+    EXPECT_EQ(allocator.get_free_range_count(), 1u);
+    EXPECT_EQ(allocator.get_largest_free_range(), 90u);
+    EXPECT_EQ(allocator.get_used_size(), 0u);
+    EXPECT_EQ(allocator.allocate(90), 0u);
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <easy-vulkan.h>
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <vector>
+#include "test_common.h"
+#include "tools/ev-gltf.h"
+#include "tools/ev-model_instance.h"
+#include "tools/ev-skinning.h"
+
+using namespace std;
+using ev::tools::gltf::SkinningSystem;
+
+class SkinningTest : public ::testing::Test {
+protected:
+    shared_ptr<ev::Instance> instance;
+    shared_ptr<ev::PhysicalDevice> physical_device;
+    shared_ptr<ev::Device> device;
+    shared_ptr<ev::MemoryAllocator> memory_allocator;
+    shared_ptr<ev::DescriptorPool> descriptor_pool;
+    shared_ptr<ev::CommandPool> command_pool;
+    shared_ptr<ev::Queue> queue;
+    shared_ptr<ev::tools::gltf::Model> model;
+    filesystem::path directory;
+
+    static constexpr float JOINT_TRANSLATION[3] = { 0.0f, 3.0f, 0.0f };
+
+    void SetUp() override {
+        create_default_test_context(instance, physical_device, device);
+        memory_allocator = make_shared<ev::BitmapBuddyMemoryAllocator>(device);
+        memory_allocator->add_pool(ev::memory_type::GPU_ONLY, 16 * 1024 * 1024);
+        memory_allocator->add_pool(ev::memory_type::HOST_ONLY, 16 * 1024 * 1024);
+        memory_allocator->add_pool(ev::memory_type::HOST_READABLE, 4 * 1024 * 1024);
+        ASSERT_EQ(memory_allocator->build(), VK_SUCCESS);
+        descriptor_pool = make_shared<ev::DescriptorPool>(device);
+        descriptor_pool->add(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 16);
+        descriptor_pool->add(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 16);
+        ASSERT_EQ(descriptor_pool->create_pool(), VK_SUCCESS);
+        command_pool = make_shared<ev::CommandPool>(device, VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT);
+        queue = make_shared<ev::Queue>(device, device->get_queue_index(VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
+
+        directory = filesystem::temp_directory_path() / "ev-skinning-test";
+        filesystem::remove_all(directory);
+        filesystem::create_directories(directory);
+        write_skinned_triangle_glb(directory / "skinned.glb", JOINT_TRANSLATION);
+
+        auto manager = make_shared<ev::tools::gltf::GLTFModelManager>(device, memory_allocator, descriptor_pool, command_pool, queue);
+        model = manager->load_model((directory / "skinned.glb").string());
+        ASSERT_NE(model, nullptr);
+        ASSERT_EQ(model->get_skins().size(), 1u);
+    }
+
+    void TearDown() override {
+        if ( !directory.empty() ) {
+            filesystem::remove_all(directory);
+        }
+    }
+};
+
+TEST_F(SkinningTest, PaletteHoldsJointMatrices) {
+    SkinningSystem skinning(device, memory_allocator, model, 2);
+    ASSERT_EQ(skinning.get_joint_count(), 1u);
+    EXPECT_FALSE(skinning.is_pre_skinning_enabled());
+
+    skinning.update(1, false);
+    const glm::mat4* palette = static_cast<const glm::mat4*>(skinning.get_palette_buffer(1)->get_mapped_ptr());
+    ASSERT_NE(palette, nullptr);
+    const glm::mat4 expected = glm::translate(glm::mat4(1.0f), glm::vec3(JOINT_TRANSLATION[0], JOINT_TRANSLATION[1], JOINT_TRANSLATION[2]));
+    EXPECT_EQ(palette[0], expected);
+
+    // 메시 uniform 에 palette 시작 위치가 올라가 있어야 정점 셰이더가 찾아감
+    for ( const auto& node : model->get_linear_nodes() ) {
+        if ( node->get_mesh() ) {
+            const auto* uniform = static_cast<const ev::tools::gltf::Mesh::Uniform*>(node->get_mesh()->get_uniform_buffer()->get_mapped_ptr());
+            ASSERT_NE(uniform, nullptr);
+            EXPECT_EQ(uniform->joint_offset, 0u);
+            EXPECT_EQ(uniform->joint_count, 1u);
+        }
+    }
+}
+
+TEST_F(SkinningTest, PreSkinnedVerticesFollowJoint) {
+    shared_ptr<ev::Shader> shader = load_tool_shader(device, VK_SHADER_STAGE_COMPUTE_BIT, "skinning.comp");
+    if ( !shader ) {
+        GTEST_SKIP() << "skinning.comp.spv is not built";
+    }
+    SkinningSystem skinning(device, memory_allocator, model, 1, shader);
+    ASSERT_TRUE(skinning.is_pre_skinning_enabled());
+    skinning.update(0, false);
+
+    const uint32_t vertex_count = model->get_vertex_count();
+    const VkDeviceSize size = static_cast<VkDeviceSize>(vertex_count) * sizeof(SkinningSystem::SkinnedVertex);
+    shared_ptr<ev::Buffer> readback = make_shared<ev::Buffer>(device, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    ASSERT_EQ(memory_allocator->allocate_buffer(readback, ev::memory_type::HOST_ONLY), VK_SUCCESS);
+
+    shared_ptr<ev::CommandBuffer> command_buffer = command_pool->allocate(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+    command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+    skinning.dispatch(command_buffer, 0);
+    command_buffer->pipeline_barrier(
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        {},
+        {ev::BufferMemoryBarrier(skinning.get_skinned_vertex_buffer(0), VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT)},
+        {}
+    );
+    command_buffer->copy_buffer(readback, skinning.get_skinned_vertex_buffer(0), size);
+    command_buffer->end();
+    shared_ptr<ev::Fence> fence = make_shared<ev::Fence>(device, 0);
+    ASSERT_EQ(queue->submit(command_buffer, {}, {}, nullptr, fence), VK_SUCCESS);
+    ASSERT_EQ(fence->wait(), VK_SUCCESS);
+
+    vector<SkinningSystem::SkinnedVertex> skinned(vertex_count);
+    ASSERT_EQ(readback->map(), VK_SUCCESS);
+    readback->read(skinned.data(), size);
+    readback->unmap();
+
+    // 정점 최적화로 순서가 바뀔 수 있으므로 위치 집합으로 비교
+    vector<glm::vec3> positions;
+    for ( const auto& vertex : skinned ) {
+        positions.push_back(glm::vec3(vertex.position));
+        EXPECT_EQ(vertex.position.w, 1.0f);
+        EXPECT_NEAR(vertex.normal.z, 1.0f, 1e-5f);
+    }
+    const vector<glm::vec3> expected = { { 0.0f, 3.0f, 0.0f }, { 1.0f, 3.0f, 0.0f }, { 0.0f, 1.0f, 0.0f } };
+    ASSERT_EQ(positions.size(), expected.size());
+    for ( const glm::vec3& position : expected ) {
+        const bool found = any_of(positions.begin(), positions.end(), [&](const glm::vec3& p) {
+            return glm::all(glm::lessThan(glm::abs(p - position), glm::vec3(1e-5f)));
+        });
+        EXPECT_TRUE(found) << "missing skinned position (" << position.x << ", " << position.y << ", " << position.z << ")";
+    }
+}
+
+TEST_F(SkinningTest, InstancePaletteFollowsInstanceTransforms) {
+    auto moved = make_shared<ev::tools::gltf::ModelInstance>(device, model);
+    auto still = make_shared<ev::tools::gltf::ModelInstance>(device, model);
+    ASSERT_TRUE(moved->enable_skinning(memory_allocator, 1));
+    ASSERT_TRUE(still->enable_skinning(memory_allocator, 1));
+
+    // 한 인스턴스의 관절만 옮기면 그 인스턴스의 palette 만 바뀌고 모델의 hierarchy 는 그대로
+    const uint32_t joint = model->get_skins()[0]->get_joints()[0]->get_transform_index();
+    const float translation[3] = { 2.0f, 0.0f, 0.0f };
+    moved->get_transforms()->set_translation(joint, translation);
+    moved->update(0.0f, false);
+    still->update(0.0f, false);
+    moved->update_instances(0);
+    still->update_instances(0);
+
+    const glm::mat4* moved_palette = static_cast<const glm::mat4*>(moved->get_skinning()->get_palette_buffer(0)->get_mapped_ptr());
+    const glm::mat4* still_palette = static_cast<const glm::mat4*>(still->get_skinning()->get_palette_buffer(0)->get_mapped_ptr());
+    ASSERT_NE(moved_palette, nullptr);
+    ASSERT_NE(still_palette, nullptr);
+    EXPECT_EQ(moved_palette[0], glm::translate(glm::mat4(1.0f), glm::vec3(2.0f, 0.0f, 0.0f)));
+    EXPECT_EQ(still_palette[0], glm::translate(glm::mat4(1.0f), glm::vec3(JOINT_TRANSLATION[0], JOINT_TRANSLATION[1], JOINT_TRANSLATION[2])));
+    EXPECT_EQ(model->get_skins()[0]->get_joints()[0]->get_translation(), glm::vec3(JOINT_TRANSLATION[0], JOINT_TRANSLATION[1], JOINT_TRANSLATION[2]));
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "tools/ev-texture_cache.h"
+
+using namespace ev::tools;
+
+namespace {
+
+ResourceKey key_of(const std::string& source, uint32_t params = 0) {
+    return make_resource_key(source.data(), source.size(), &params, sizeof(params));
+}
+
+}
+
+TEST(TextureCacheTest, SharesResourcesByContentAndParams) {
+    ResourceCache<int> cache(1024);
+    EXPECT_EQ(key_of("atlas"), key_of("atlas"));
+    EXPECT_FALSE(key_of("atlas") == key_of("atlas", 1));
+    EXPECT_FALSE(key_of("atlas") == key_of("atlas2"));
+
+    int loads = 0;
+    auto load = [&]() {
+        ++loads;
+        return std::make_pair(std::make_shared<int>(loads), uint64_t{ 100 });
+    };
+    std::shared_ptr<int> a = cache.acquire(key_of("atlas"), load);
+    std::shared_ptr<int> b = cache.acquire(key_of("atlas"), load);
+    std::shared_ptr<int> c = cache.acquire(key_of("atlas", 1), load);
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(loads, 2);
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.get_resident_bytes(), 200u);
+    EXPECT_EQ(cache.get_stats().hits, 1u);
+    EXPECT_EQ(cache.get_stats().misses, 2u);
+
+    // 먼저 등록된 리소스가 이김
+    std::shared_ptr<int> raced = cache.insert(key_of("atlas"), std::make_shared<int>(42), 100);
+    EXPECT_EQ(raced, a);
+}
+
+TEST(TextureCacheTest, EvictsOnlyUnreferencedEntriesInLruOrder) {
+    ResourceCache<int> cache(300);
+    std::shared_ptr<int> held = cache.insert(key_of("0"), std::make_shared<int>(0), 100);
+    cache.insert(key_of("1"), std::make_shared<int>(1), 100);
+    cache.insert(key_of("2"), std::make_shared<int>(2), 100);
+    EXPECT_EQ(cache.size(), 3u);
+
+    // 1 을 최근 사용으로 만들어 2 가 가장 오래된 해제 대상이 되도록 함
+    EXPECT_NE(cache.find(key_of("1")), nullptr);
+    cache.insert(key_of("3"), std::make_shared<int>(3), 100);
+    EXPECT_TRUE(cache.contains(key_of("0")));   // 참조 중이므로 가장 오래되었어도 유지
+    EXPECT_TRUE(cache.contains(key_of("1")));
+    EXPECT_FALSE(cache.contains(key_of("2")));
+    EXPECT_TRUE(cache.contains(key_of("3")));
+    EXPECT_EQ(cache.get_resident_bytes(), 300u);
+    EXPECT_EQ(cache.get_stats().evictions, 1u);
+
+    // 모두 참조 중이면 budget 을 넘어도 유지
+    std::shared_ptr<int> one = cache.find(key_of("1"));
+    std::shared_ptr<int> three = cache.find(key_of("3"));
+    cache.set_budget(0);
+    EXPECT_EQ(cache.size(), 3u);
+
+    held.reset();
+    one.reset();
+    EXPECT_EQ(cache.trim(), 2u);
+    EXPECT_EQ(cache.size(), 1u);
+    EXPECT_TRUE(cache.contains(key_of("3")));
+}
+
+TEST(TextureCacheTest, ConcurrentAcquireReturnsSingleResource) {
+    ResourceCache<int> cache;
+    std::atomic<int> loads{ 0 };
+    std::vector<std::shared_ptr<int>> results(8);
+    std::vector<std::thread> threads;
+    for ( size_t i = 0 ; i < results.size() ; ++i ) {
+        threads.emplace_back([&, i]() {
+            results[i] = cache.acquire(key_of("shared"), [&]() {
+                ++loads;
+                return std::make_pair(std::make_shared<int>(7), uint64_t{ 64 });
+            });
+        });
+    }
+    for ( std::thread& thread : threads ) {
+        thread.join();
+    }
+    for ( const auto& result : results ) {
+        EXPECT_EQ(result, results.front());
+    }
+    EXPECT_GE(loads.load(), 1);
+    EXPECT_EQ(cache.size(), 1u);
+    EXPECT_EQ(cache.get_resident_bytes(), 64u);
+}
+
+TEST(TextureCacheTest, EvictCallbackReceivesDroppedResources) {
+    ResourceCache<int> cache(200);
+    std::vector<int> evicted;
+    cache.set_evict_callback([&](const std::shared_ptr<int>& resource) {
+        // 잠금 밖에서 호출되므로 캐시를 다시 사용할 수 있음
+        EXPECT_FALSE(cache.contains(key_of(std::to_string(*resource))));
+        evicted.push_back(*resource);
+    });
+    std::shared_ptr<int> held = cache.insert(key_of("0"), std::make_shared<int>(0), 100);
+    cache.insert(key_of("1"), std::make_shared<int>(1), 100);
+    cache.insert(key_of("2"), std::make_shared<int>(2), 100);
+    EXPECT_EQ(evicted, std::vector<int>{ 1 });
+
+    // clear 는 참조되지 않던 항목만 전달
+    cache.clear();
+    EXPECT_EQ(evicted, (std::vector<int>{ 1, 2 }));
+    EXPECT_EQ(cache.size(), 0u);
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "tools/ev-transform_hierarchy.h"
+
+using namespace ev::tools;
+
+namespace {
+
+constexpr uint32_t NONE = TransformHierarchy::NO_PARENT;
+
+void expect_translation(const TransformHierarchy& hierarchy, uint32_t node, float x, float y, float z) {
+    const float* m = hierarchy.get_world_matrix(node);
+    EXPECT_NEAR(m[12], x, 1e-5f) << "node " << node;
+    EXPECT_NEAR(m[13], y, 1e-5f) << "node " << node;
+    EXPECT_NEAR(m[14], z, 1e-5f) << "node " << node;
+}
+
+}
+
+TEST(TransformHierarchyTest, SubtreeSizesFollowPreOrder) {
+    //      0         4
+    //    1   3       5
+    //    2
+    TransformHierarchy hierarchy({ NONE, 0, 1, 0, NONE, 4 });
+    EXPECT_EQ(hierarchy.size(), 6u);
+    EXPECT_EQ(hierarchy.get_subtree_size(0), 4u);
+    EXPECT_EQ(hierarchy.get_subtree_size(1), 2u);
+    EXPECT_EQ(hierarchy.get_subtree_size(3), 1u);
+    EXPECT_EQ(hierarchy.get_subtree_size(4), 2u);
+    EXPECT_EQ(hierarchy.get_parent(5), 4u);
+}
+
+TEST(TransformHierarchyTest, PropagatesTranslationRotationScale) {
+    TransformHierarchy hierarchy({ NONE, 0, 1 });
+    const float half = std::sqrt(0.5f);
+    const float rotate_z[4] = { 0.0f, 0.0f, half, half };   // z 축 90도
+    const float scale[3] = { 2.0f, 2.0f, 2.0f };
+    const float offset[3] = { 1.0f, 0.0f, 0.0f };
+    const float root_offset[3] = { 10.0f, 0.0f, 0.0f };
+
+    hierarchy.set_translation(0, root_offset);
+    hierarchy.set_rotation(0, rotate_z);
+    hierarchy.set_scale(1, scale);
+    hierarchy.set_translation(1, offset);
+    hierarchy.set_translation(2, offset);
+    EXPECT_EQ(hierarchy.update(), 3u);
+
+    // 루트가 회전했으므로 자식의 +x 이동은 +y 로, 스케일 2 가 손자의 이동에 곱해짐
+    expect_translation(hierarchy, 0, 10.0f, 0.0f, 0.0f);
+    expect_translation(hierarchy, 1, 10.0f, 1.0f, 0.0f);
+    expect_translation(hierarchy, 2, 10.0f, 3.0f, 0.0f);
+
+    float rotation[4];
+    hierarchy.get_rotation(0, rotation);
+    EXPECT_FLOAT_EQ(rotation[2], half);
+}
+
+TEST(TransformHierarchyTest, UpdatesOnlyDirtySubtrees) {
+    TransformHierarchy hierarchy({ NONE, 0, 1, 0, NONE, 4 });
+    const float offset[3] = { 1.0f, 2.0f, 3.0f };
+    for ( uint32_t i = 0 ; i < hierarchy.size() ; ++i ) {
+        hierarchy.set_translation(i, offset);
+    }
+    EXPECT_EQ(hierarchy.update(), 6u);
+    EXPECT_FALSE(hierarchy.is_dirty());
+    EXPECT_EQ(hierarchy.update(), 0u);
+
+    const float moved[3] = { 5.0f, 0.0f, 0.0f };
+    hierarchy.set_translation(1, moved);
+    EXPECT_TRUE(hierarchy.is_dirty());
+    EXPECT_EQ(hierarchy.update(), 2u);
+    expect_translation(hierarchy, 2, 7.0f, 4.0f, 6.0f);
+    expect_translation(hierarchy, 3, 2.0f, 4.0f, 6.0f);
+
+    // 성분 배열에 직접 기록
+    hierarchy.get_translations(TransformHierarchy::X)[4] = -1.0f;
+    hierarchy.mark_dirty(4);
+    EXPECT_EQ(hierarchy.update(false), 2u);
+    expect_translation(hierarchy, 5, 0.0f, 4.0f, 6.0f);
+}
+
+TEST(TransformHierarchyTest, LocalMatrixOverride) {
+    TransformHierarchy hierarchy({ NONE, 0 });
+    float matrix[16] = {
+        1, 0, 0, 0,
+        0, 1, 0, 0,
+        0, 0, 1, 0,
+        4, 5, 6, 1
+    };
+    const float offset[3] = { 1.0f, 0.0f, 0.0f };
+    hierarchy.set_local_matrix(0, matrix);
+    hierarchy.set_translation(1, offset);
+    hierarchy.update();
+    expect_translation(hierarchy, 1, 5.0f, 5.0f, 6.0f);
+
+    // TRS 를 다시 설정하면 TRS 로 계산
+    hierarchy.set_translation(0, offset);
+    hierarchy.update();
+    expect_translation(hierarchy, 1, 2.0f, 0.0f, 0.0f);
+}
+
+TEST(TransformHierarchyTest, ParallelMatchesSerial) {
+    // 루트 하나 아래 64 개 체인
+    std::vector<uint32_t> parents = { NONE };
+    for ( uint32_t chain = 0 ; chain < 64 ; ++chain ) {
+        parents.push_back(0);
+        for ( uint32_t depth = 1 ; depth < 16 ; ++depth ) {
+            parents.push_back(static_cast<uint32_t>(parents.size()) - 1);
+        }
+    }
+    TransformHierarchy parallel(parents);
+    TransformHierarchy serial(parents);
+    for ( uint32_t i = 0 ; i < parents.size() ; ++i ) {
+        const float offset[3] = { 0.5f, static_cast<float>(i % 7), 0.0f };
+        const float rotation[4] = { 0.0f, std::sin(0.05f), 0.0f, std::cos(0.05f) };
+        for ( TransformHierarchy* hierarchy : { &parallel, &serial } ) {
+            hierarchy->set_translation(i, offset);
+            hierarchy->set_rotation(i, rotation);
+        }
+    }
+    EXPECT_EQ(parallel.update(true), parents.size());
+    EXPECT_EQ(serial.update(false), parents.size());
+    for ( uint32_t i = 0 ; i < parents.size() ; ++i ) {
+        for ( uint32_t k = 0 ; k < 16 ; ++k ) {
+            ASSERT_FLOAT_EQ(parallel.get_world_matrix(i)[k], serial.get_world_matrix(i)[k]) << "node " << i;
+        }
+    }
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include "tools/ev-vertex_quantize.h"
+
+using namespace ev::tools::quantize;
+
+TEST(VertexQuantizeTest, NormalizedIntegersRoundAndClamp) {
+    EXPECT_EQ(float_to_snorm16(1.0f), 32767);
+    EXPECT_EQ(float_to_snorm16(-1.0f), -32767);
+    EXPECT_EQ(float_to_snorm16(2.0f), 32767);
+    EXPECT_EQ(float_to_snorm16(0.0f), 0);
+    EXPECT_EQ(float_to_snorm8(-0.5f), -64);
+    EXPECT_EQ(float_to_unorm8(0.5f), 128);
+    EXPECT_EQ(float_to_unorm8(-1.0f), 0);
+}
+
+TEST(VertexQuantizeTest, OctahedralRoundTripWithinSnorm16Precision) {
+    std::mt19937 rng(0x5EED);
+    std::normal_distribution<float> dist;
+    for ( int i = 0 ; i < 10000 ; ++i ) {
+        float n[3] = { dist(rng), dist(rng), dist(rng) };
+        const float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        for ( float& c : n ) c /= length;
+
+        float encoded[2];
+        octahedral_encode(n, encoded);
+        ASSERT_LE(std::fabs(encoded[0]), 1.0f);
+        ASSERT_LE(std::fabs(encoded[1]), 1.0f);
+
+        // GPU 의 R16G16_SNORM 복원과 같은 경로
+        const float quantized[2] = { float_to_snorm16(encoded[0]) / 32767.0f, float_to_snorm16(encoded[1]) / 32767.0f };
+        float decoded[3];
+        octahedral_decode(quantized, decoded);
+        const float dot = n[0] * decoded[0] + n[1] * decoded[1] + n[2] * decoded[2];
+        EXPECT_GT(dot, 0.99999f) << "normal (" << n[0] << ", " << n[1] << ", " << n[2] << ")";
+    }
+}
+
+TEST(VertexQuantizeTest, OctahedralAxes) {
+    const float axes[6][3] = { {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1} };
+    for ( const auto& axis : axes ) {
+        float encoded[2];
+        float decoded[3];
+        octahedral_encode(axis, encoded);
+        octahedral_decode(encoded, decoded);
+        for ( int c = 0 ; c < 3 ; ++c ) {
+            EXPECT_NEAR(decoded[c], axis[c], 1e-6f);
+        }
+    }
+}
+
+TEST(VertexQuantizeTest, WeightsSumTo255) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    for ( int i = 0 ; i < 10000 ; ++i ) {
+        float weights[4] = { dist(rng), dist(rng), dist(rng), dist(rng) };
+        if ( i % 3 == 0 ) weights[3] = 0.0f;
+        uint8_t quantized[4];
+        weights_to_unorm8(weights, quantized);
+        EXPECT_EQ(quantized[0] + quantized[1] + quantized[2] + quantized[3], 255);
+    }
+
+    const float single[4] = { 1.0f, 0.0f, 0.0f, 0.0f };
+    uint8_t quantized[4];
+    weights_to_unorm8(single, quantized);
+    EXPECT_EQ(quantized[0], 255);
+    EXPECT_EQ(quantized[1], 0);
+
+    const float zero[4] = {};
+    weights_to_unorm8(zero, quantized);
+    EXPECT_EQ(quantized[0] + quantized[1] + quantized[2] + quantized[3], 0);
+}